@@ -31,6 +31,8 @@
 
 #include "check_handle.h"
 #include "fvdecheck_extent.h"
+#include "fvdecheck_lookup.h"
+#include "fvdecheck_scan.h"
 #include "fvdetools_libbfio.h"
 #include "fvdetools_libcerror.h"
 #include "fvdetools_libfguid.h"
@@ -345,6 +347,11 @@ int check_handle_initialize(
 	( *check_handle )->unattended_mode = unattended_mode;
 	( *check_handle )->processing_order = CHECK_HANDLE_ORDER_ASCENDING;
 
+	( *check_handle )->surface_scan_threads        = FVDECHECK_SCAN_DEFAULT_NUMBER_OF_THREADS;
+	( *check_handle )->surface_scan_slow_threshold = FVDECHECK_SCAN_DEFAULT_SLOW_THRESHOLD;
+
+	( *check_handle )->lookup_unit = FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR;
+
 	return( 1 );
 
 on_error:
@@ -397,6 +404,38 @@ int check_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *check_handle )->scan != NULL )
+		{
+			if( fvdecheck_scan_free(
+			     &( ( *check_handle )->scan ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scan.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *check_handle )->lookup != NULL )
+		{
+			if( fvdecheck_lookup_free(
+			     &( ( *check_handle )->lookup ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free lookup.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *check_handle )->volume_state != NULL )
 		{
 			if( fvdecheck_volume_state_free(
@@ -471,6 +510,22 @@ int check_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	if( check_handle->scan != NULL )
+	{
+		if( fvdecheck_scan_signal_abort(
+		     check_handle->scan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal scan to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	check_handle->abort = 1;
 
 	return( 1 );
@@ -945,6 +1000,388 @@ int check_handle_set_lookup_linux_sector(
 	return( 1 );
 }
 
+/* Sets the unit of the values of a batch lookup
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_set_lookup_unit(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_set_lookup_unit";
+	size_t string_length  = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 6 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "sector" ),
+	       6 ) == 0 ) )
+	{
+		check_handle->lookup_unit = FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR;
+	}
+	else if( ( string_length == 5 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "block" ),
+	            5 ) == 0 ) )
+	{
+		check_handle->lookup_unit = FVDECHECK_LOOKUP_UNIT_BLOCK;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported lookup unit value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the values of a batch lookup from a file, one decimal value per line
+ * A filename of "-" reads the values from stdin. Empty lines and lines
+ * starting with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_set_lookup_file(
+     check_handle_t *check_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ FVDECHECK_LOOKUP_MAXIMUM_LINE_SIZE ];
+
+	FILE *file_stream     = NULL;
+	static char *function = "check_handle_set_lookup_file";
+	size_t line_index     = 0;
+	size_t line_length    = 0;
+	uint64_t value_64bit  = 0;
+	int line_number       = 0;
+	int read_stdin        = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->lookup == NULL )
+	{
+		if( fvdecheck_lookup_initialize(
+		     &( check_handle->lookup ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize lookup.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( filename[ 0 ] == (system_character_t) '-' )
+	 && ( filename[ 1 ] == 0 ) )
+	{
+		file_stream = stdin;
+		read_stdin  = 1;
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		file_stream = file_stream_open_wide(
+		               filename,
+		               _SYSTEM_STRING( "r" ) );
+#else
+		file_stream = file_stream_open(
+		               filename,
+		               FILE_STREAM_OPEN_READ );
+#endif
+	}
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open lookup file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_stream,
+	        line,
+	        FVDECHECK_LOOKUP_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        FVDECHECK_LOOKUP_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != (system_character_t) '\n' )
+		 && ( file_stream_at_end(
+		       file_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: line: %d in lookup file exceeds maximum size.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) ' ' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\t' ) ) )
+		{
+			line_length--;
+		}
+		line[ line_length ] = 0;
+
+		for( line_index = 0;
+		     line_index < line_length;
+		     line_index++ )
+		{
+			if( ( line[ line_index ] != (system_character_t) ' ' )
+			 && ( line[ line_index ] != (system_character_t) '\t' ) )
+			{
+				break;
+			}
+		}
+		if( ( line_index == line_length )
+		 || ( line[ line_index ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		if( fvdetools_system_string_copy_from_64_bit_in_decimal(
+		     &( line[ line_index ] ),
+		     line_length - line_index + 1,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value of line: %d to 64-bit decimal.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( fvdecheck_lookup_append_value(
+		     check_handle->lookup,
+		     value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value of line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( read_stdin == 0 )
+	{
+		if( file_stream_close(
+		     file_stream ) != 0 )
+		{
+			file_stream = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close lookup file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( ( file_stream != NULL )
+	 && ( read_stdin == 0 ) )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( check_handle->lookup != NULL )
+	{
+		fvdecheck_lookup_free(
+		 &( check_handle->lookup ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the surface scan number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_set_scan_threads(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_set_scan_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fvdetools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: unsupported number of threads, expected 1 to %d.",
+		 function,
+		 FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS );
+
+		return( -1 );
+	}
+	check_handle->surface_scan_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the surface scan slow threshold in milliseconds
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_set_scan_slow_threshold(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_set_scan_slow_threshold";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( fvdetools_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	check_handle->surface_scan_slow_threshold = value_64bit;
+
+	return( 1 );
+}
+
 /* Opens the check handle
  * Returns 1 if successful or -1 on error
  */
@@ -2308,6 +2745,233 @@ int check_handle_lookup_block(
 	return( 1 );
 }
 
+/* Perform batch block lookup
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_lookup_batch(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "check_handle_lookup_batch";
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid check handle - missing lookup.",
+		 function );
+
+		return( -1 );
+	}
+	check_handle->lookup->unit = check_handle->lookup_unit;
+
+	if( fvdecheck_lookup_resolve(
+	     check_handle->lookup,
+	     check_handle->volume_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to resolve lookup.",
+		 function );
+
+		return( -1 );
+	}
+	/* In JSON mode the results are part of the JSON output */
+	if( check_handle->json_mode == 0 )
+	{
+		if( fvdecheck_lookup_print(
+		     check_handle->lookup,
+		     check_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print lookup results.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans the allocated extents for unreadable and slow regions
+ * and optionally checks the decrypted file system headers
+ * Returns 1 if successful or -1 on error
+ */
+int check_handle_scan_surface(
+     check_handle_t *check_handle,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_t *logical_volume = NULL;
+	static char *function                    = "check_handle_scan_surface";
+	int logical_volume_index                 = 0;
+	int number_of_logical_volumes            = 0;
+
+	if( check_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid check handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( check_handle->scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid check handle - scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( fvdecheck_scan_initialize(
+	     &( check_handle->scan ),
+	     check_handle->physical_volume_file_io_pool,
+	     check_handle->volume_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize scan.",
+		 function );
+
+		goto on_error;
+	}
+	check_handle->scan->number_of_threads = check_handle->surface_scan_threads;
+	check_handle->scan->slow_threshold    = check_handle->surface_scan_slow_threshold;
+
+	/* Progress goes to stderr so it does not mix with the results */
+	if( !check_handle->quiet_mode && !check_handle->json_mode )
+	{
+		check_handle->scan->progress_stream = stderr;
+	}
+	if( check_handle->abort != 0 )
+	{
+		check_handle->scan->abort = 1;
+	}
+	if( fvdecheck_scan_run(
+	     check_handle->scan,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan allocated extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( check_handle->surface_scan_verify == 0 )
+	{
+		return( 1 );
+	}
+	if( libfvde_volume_group_get_number_of_logical_volumes(
+	     check_handle->volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < number_of_logical_volumes;
+	     logical_volume_index++ )
+	{
+		if( check_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libfvde_volume_group_get_logical_volume_by_index(
+		     check_handle->volume_group,
+		     logical_volume_index,
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( fvdecheck_scan_check_logical_volume(
+		     check_handle->scan,
+		     logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+		if( libfvde_logical_volume_free(
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume: %d.",
+			 function,
+			 logical_volume_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Print allocation summary
  * Returns 1 if successful or -1 on error
  */
@@ -2452,6 +3116,23 @@ int check_handle_print_allocation_summary(
 	 "Warnings: %" PRIu32 "\n",
 	 check_handle->volume_state->warning_count );
 
+	if( check_handle->scan != NULL )
+	{
+		if( fvdecheck_scan_print(
+		     check_handle->scan,
+		     check_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print scan results.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -2751,6 +3432,27 @@ int check_handle_print_json(
 	fprintf( check_handle->notify_stream, "    }\n" );
 	fprintf( check_handle->notify_stream, "  },\n" );
 
+	if( check_handle->scan != NULL )
+	{
+		if( fvdecheck_scan_print_json(
+		     check_handle->scan,
+		     check_handle->notify_stream,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( check_handle->lookup != NULL )
+	 && ( check_handle->lookup->resolved != 0 ) )
+	{
+		if( fvdecheck_lookup_print_json(
+		     check_handle->lookup,
+		     check_handle->notify_stream,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
 	fprintf( check_handle->notify_stream, "  \"errors\": [],\n" );
 	fprintf( check_handle->notify_stream, "  \"warnings\": []\n" );
 	fprintf( check_handle->notify_stream, "}\n" );
@@ -28,6 +28,8 @@
 #include <types.h>
 
 #include "fvdecheck_extent.h"
+#include "fvdecheck_lookup.h"
+#include "fvdecheck_scan.h"
 #include "fvdetools_libbfio.h"
 #include "fvdetools_libcerror.h"
 #include "fvdetools_libfvde.h"
@@ -126,6 +128,23 @@ struct check_handle
 	uint32_t lookup_logical_lv;
 	uint64_t lookup_logical_block;
 
+	/* Batch block lookup options */
+	int lookup_unit;
+
+	/* The batch block lookup, NULL if not requested
+	 */
+	fvdecheck_lookup_t *lookup;
+
+	/* Surface scan options */
+	int surface_scan;
+	int surface_scan_verify;
+	int surface_scan_threads;
+	uint64_t surface_scan_slow_threshold;
+
+	/* The surface scan results
+	 */
+	fvdecheck_scan_t *scan;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -220,6 +239,18 @@ int check_handle_set_lookup_linux_sector(
      const system_character_t *string,
      libcerror_error_t **error );
 
+/* Set batch lookup unit */
+int check_handle_set_lookup_unit(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+/* Read the values of a batch lookup from a file or stdin */
+int check_handle_set_lookup_file(
+     check_handle_t *check_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 /* Set lookup physical block */
 int check_handle_set_lookup_physical(
      check_handle_t *check_handle,
@@ -232,6 +263,18 @@ int check_handle_set_lookup_logical(
      const system_character_t *string,
      libcerror_error_t **error );
 
+/* Set surface scan number of threads */
+int check_handle_set_scan_threads(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+/* Set surface scan slow threshold */
+int check_handle_set_scan_slow_threshold(
+     check_handle_t *check_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 /* Open the check handle */
 int check_handle_open(
      check_handle_t *check_handle,
@@ -259,6 +302,16 @@ int check_handle_lookup_block(
      check_handle_t *check_handle,
      libcerror_error_t **error );
 
+/* Perform batch block lookup */
+int check_handle_lookup_batch(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
+/* Scan the allocated extents */
+int check_handle_scan_surface(
+     check_handle_t *check_handle,
+     libcerror_error_t **error );
+
 /* Print allocation summary */
 int check_handle_print_allocation_summary(
      check_handle_t *check_handle,
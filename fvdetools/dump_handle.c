@@ -48,6 +48,7 @@
 #include "dump_handle.h"
 #include "fvdetools_libcerror.h"
 #include "fvdetools_libcnotify.h"
+#include "zero_block.h"
 
 /* Volume header size is 512 bytes */
 #define FVDE_VOLUME_HEADER_SIZE 512
@@ -798,11 +799,14 @@ int dump_handle_copy_region(
 {
 	uint8_t *buffer       = NULL;
 	static char *function = "dump_handle_copy_region";
+	size_t buffer_offset  = 0;
 	size_t buffer_size    = 0;
 	size_t bytes_to_copy  = 0;
+	size_t run_size       = 0;
 	ssize_t read_count    = 0;
 	ssize_t write_count   = 0;
 	size64_t remaining    = 0;
+	uint8_t is_zero       = 0;
 
 	if( dump_handle == NULL )
 	{
@@ -914,21 +918,71 @@ int dump_handle_copy_region(
 
 			goto on_error;
 		}
-		write_count = write(
-		               dump_handle->destination_fd,
-		               buffer,
-		               bytes_to_copy );
+		buffer_offset = 0;
 
-		if( write_count != (ssize_t) bytes_to_copy )
+		while( buffer_offset < bytes_to_copy )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_WRITE_FAILED,
-			 "%s: unable to write to destination.",
-			 function );
+			run_size = bytes_to_copy - buffer_offset;
+			is_zero  = 0;
 
-			goto on_error;
+			/* The sparse file was truncated to its full size, hence runs of
+			 * zero blocks can be skipped to leave holes
+			 */
+			if( ( dump_handle->backup_mode == 0 )
+			 && ( dump_handle->restore_mode == 0 ) )
+			{
+				if( zero_block_get_run_size(
+				     &( buffer[ buffer_offset ] ),
+				     bytes_to_copy - buffer_offset,
+				     &run_size,
+				     &is_zero,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve run size.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( is_zero != 0 )
+			{
+				if( lseek( dump_handle->destination_fd, (off_t) run_size, SEEK_CUR ) == (off_t) -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek destination past zero blocks.",
+					 function );
+
+					goto on_error;
+				}
+				dump_handle->zero_bytes += run_size;
+			}
+			else
+			{
+				write_count = write(
+				               dump_handle->destination_fd,
+				               &( buffer[ buffer_offset ] ),
+				               run_size );
+
+				if( write_count != (ssize_t) run_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write to destination.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			buffer_offset += run_size;
 		}
 		remaining -= bytes_to_copy;
 		dump_handle->bytes_copied += bytes_to_copy;
@@ -1626,6 +1680,10 @@ int dump_handle_dump(
 		 stdout,
 		 "Sparse file size: %" PRIu64 " bytes\n",
 		 dump_handle->physical_volume_size );
+		fprintf(
+		 stdout,
+		 "Zero blocks not written: %" PRIu64 " bytes\n",
+		 dump_handle->zero_bytes );
 	}
 	return( 1 );
 }
@@ -98,6 +98,10 @@ struct dump_handle
 	 */
 	uint64_t bytes_copied;
 
+	/* Total bytes of zero blocks not written to the sparse file
+	 */
+	uint64_t zero_bytes;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -0,0 +1,5772 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#include "export_handle.h"
+#include "export_scheduler.h"
+#include "fvdetools_input.h"
+#include "fvdetools_libbfio.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcnotify.h"
+#include "fvdetools_libcthreads.h"
+#include "fvdetools_libfvde.h"
+#include "fvdetools_libuna.h"
+#include "hash_pipeline.h"
+#include "zero_block.h"
+
+#if !defined( LIBFVDE_HAVE_BFIO )
+
+extern \
+int libfvde_volume_open_file_io_handle(
+     libfvde_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfvde_error_t **error );
+
+extern \
+int libfvde_volume_open_physical_volume_files_file_io_pool(
+     libfvde_volume_t *handle,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error );
+
+#endif /* !defined( LIBFVDE_HAVE_BFIO ) */
+
+#define EXPORT_HANDLE_NOTIFY_STREAM		stdout
+
+/* Copies a string of a decimal value to a 64-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function              = "export_handle_system_string_copy_from_64_bit_in_decimal";
+	system_character_t character_value = 0;
+	size_t string_index                = 0;
+	uint8_t maximum_string_index       = 20;
+	int8_t sign                        = 1;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	*value_64bit = 0;
+
+	if( string[ string_index ] == (system_character_t) '-' )
+	{
+		string_index++;
+		maximum_string_index++;
+
+		sign = -1;
+	}
+	else if( string[ string_index ] == (system_character_t) '+' )
+	{
+		string_index++;
+		maximum_string_index++;
+	}
+	while( string_index < string_size )
+	{
+		if( string[ string_index ] == 0 )
+		{
+			break;
+		}
+		if( string_index > (size_t) maximum_string_index )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_LARGE,
+			 "%s: string too large.",
+			 function );
+
+			return( -1 );
+		}
+		*value_64bit *= 10;
+
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			character_value = (system_character_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character value: %" PRIc_SYSTEM " at index: %d.",
+			 function,
+			 string[ string_index ],
+			 string_index );
+
+			return( -1 );
+		}
+		*value_64bit += character_value;
+
+		string_index++;
+	}
+	if( sign == -1 )
+	{
+		*value_64bit *= (uint64_t) -1;
+	}
+	return( 1 );
+}
+
+
+/* Creates an export handle
+ * Make sure the value export_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     int unattended_mode,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_initialize";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_handle = memory_allocate_structure(
+	                  export_handle_t );
+
+	if( *export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_handle,
+	     0,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export handle.",
+		 function );
+
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+
+		return( -1 );
+	}
+	( *export_handle )->buffer = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * EXPORT_HANDLE_BUFFER_SIZE );
+
+	if( ( *export_handle )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->notify_stream   = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->unattended_mode = unattended_mode;
+
+	return( 1 );
+
+on_error:
+	if( *export_handle != NULL )
+	{
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_free";
+	int result            = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_handle != NULL )
+	{
+		if( ( *export_handle )->parent_handle != NULL )
+		{
+			/* A group handle only owns its logical volume
+			 */
+			if( ( *export_handle )->logical_volume != NULL )
+			{
+				if( libfvde_logical_volume_free(
+				     &( ( *export_handle )->logical_volume ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free logical volume.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		else if( ( *export_handle )->physical_volume_file_io_pool != NULL )
+		{
+			if( export_handle_close(
+			     *export_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close export handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( memory_set(
+		     ( *export_handle )->key_data,
+		     0,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear key data.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *export_handle )->journal_stream != NULL )
+		{
+			if( export_handle_close_journal(
+			     *export_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close journal.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->hash_pipeline != NULL )
+		{
+			if( hash_pipeline_free(
+			     &( ( *export_handle )->hash_pipeline ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hash pipeline.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->group_handles != NULL )
+		{
+			if( export_handle_free_group_handles(
+			     *export_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free group handles.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( ( *export_handle )->scheduler != NULL )
+		 && ( ( *export_handle )->parent_handle == NULL ) )
+		{
+			if( export_scheduler_free(
+			     &( ( *export_handle )->scheduler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free scheduler.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->target_path != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->target_path );
+		}
+		if( ( *export_handle )->extents != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->extents );
+		}
+		if( ( *export_handle )->previous_extents != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->previous_extents );
+		}
+		if( ( *export_handle )->ranges != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->ranges );
+		}
+		if( ( *export_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->buffer );
+		}
+		memory_free(
+		 *export_handle );
+
+		*export_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the export handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_signal_abort";
+	int group_handle_index = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->abort = 1;
+
+	for( group_handle_index = 0;
+	     group_handle_index < export_handle->number_of_group_handles;
+	     group_handle_index++ )
+	{
+		export_handle->group_handles[ group_handle_index ]->abort = 1;
+	}
+	if( ( export_handle->volume != NULL )
+	 && ( export_handle->parent_handle == NULL ) )
+	{
+		if( libfvde_volume_signal_abort(
+		     export_handle->volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal volume to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the path of the EncryptedRoot.plist.wipekey file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_encrypted_root_plist(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_encrypted_root_plist";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->encrypted_root_plist_path = string;
+
+	return( 1 );
+}
+
+/* Sets the key
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_key(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function   = "export_handle_set_key";
+	size_t string_length    = 0;
+	uint32_t base16_variant = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( memory_set(
+	     export_handle->key_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key data.",
+		 function );
+
+		goto on_error;
+	}
+	base16_variant = LIBUNA_BASE16_VARIANT_RFC4648;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( _BYTE_STREAM_HOST_IS_ENDIAN_BIG )
+	{
+		base16_variant |= LIBUNA_BASE16_VARIANT_ENCODING_UTF16_BIG_ENDIAN;
+	}
+	else
+	{
+		base16_variant |= LIBUNA_BASE16_VARIANT_ENCODING_UTF16_LITTLE_ENDIAN;
+	}
+#endif
+	if( string_length != 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string length.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_base16_stream_copy_to_byte_stream(
+	     (uint8_t *) string,
+	     string_length,
+	     export_handle->key_data,
+	     16,
+	     base16_variant,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy key data.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->key_data_size = 16;
+
+	return( 1 );
+
+on_error:
+	memory_set(
+	 export_handle->key_data,
+	 0,
+	 16 );
+
+	export_handle->key_data_size = 0;
+
+	return( -1 );
+}
+
+/* Sets the volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_offset";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( export_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->volume_offset = (off64_t) value_64bit;
+
+	return( 1 );
+}
+
+/* Sets the password
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_password(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_password";
+	size_t string_length  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	export_handle->user_password        = string;
+	export_handle->user_password_length = string_length;
+
+	return( 1 );
+}
+
+/* Sets the recovery password
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_recovery_password(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_recovery_password";
+	size_t string_length  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	export_handle->recovery_password        = string;
+	export_handle->recovery_password_length = string_length;
+
+	return( 1 );
+}
+
+/* Sets the logical volumes to export
+ * The string contains all or a comma separated list of indexes, where 1
+ * represents the first logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_logical_volumes(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_logical_volumes";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	size_t value_length   = 0;
+	uint64_t value_64bit  = 0;
+	int value_index       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 3 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "all" ),
+	       3 ) == 0 ) )
+	{
+		export_handle->all_logical_volumes              = 1;
+		export_handle->number_of_logical_volume_indexes = 0;
+
+		return( 1 );
+	}
+	export_handle->all_logical_volumes              = 0;
+	export_handle->number_of_logical_volume_indexes = 0;
+
+	while( string_index < string_length )
+	{
+		for( value_length = 0;
+		     ( string_index + value_length ) < string_length;
+		     value_length++ )
+		{
+			if( string[ string_index + value_length ] == (system_character_t) ',' )
+			{
+				break;
+			}
+		}
+		if( export_handle->number_of_logical_volume_indexes >= EXPORT_HANDLE_MAXIMUM_NUMBER_OF_LOGICAL_VOLUMES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of logical volumes value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle_system_string_copy_from_64_bit_in_decimal(
+		     &( string[ string_index ] ),
+		     value_length,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy string to 64-bit decimal.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( value_64bit == 0 )
+		 || ( value_64bit > (uint64_t) INT_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume index value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		for( value_index = 0;
+		     value_index < export_handle->number_of_logical_volume_indexes;
+		     value_index++ )
+		{
+			if( export_handle->logical_volume_indexes[ value_index ] == ( (int) value_64bit - 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: logical volume: %" PRIu64 " selected more than once.",
+				 function,
+				 value_64bit );
+
+				return( -1 );
+			}
+		}
+		export_handle->logical_volume_indexes[ export_handle->number_of_logical_volume_indexes ] = (int) value_64bit - 1;
+
+		export_handle->number_of_logical_volume_indexes += 1;
+
+		string_index += value_length + 1;
+	}
+	if( export_handle->number_of_logical_volume_indexes == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing logical volume index.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->logical_volume_index = export_handle->logical_volume_indexes[ 0 ];
+
+	return( 1 );
+}
+
+/* Sets the resume mode
+ * In resume mode an interrupted export is continued using its journal
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_resume(
+     export_handle_t *export_handle,
+     int resume,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_resume";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->resume = resume;
+
+	return( 1 );
+}
+
+/* Sets the hash types
+ * The string contains a comma separated list of: md5, sha1, sha256 and tree
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_hash_types(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_hash_types";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	size_t value_length   = 0;
+	int hash_flags        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	while( string_index < string_length )
+	{
+		for( value_length = 0;
+		     ( string_index + value_length ) < string_length;
+		     value_length++ )
+		{
+			if( string[ string_index + value_length ] == (system_character_t) ',' )
+			{
+				break;
+			}
+		}
+		if( ( value_length == 3 )
+		 && ( system_string_compare(
+		       &( string[ string_index ] ),
+		       _SYSTEM_STRING( "md5" ),
+		       3 ) == 0 ) )
+		{
+			hash_flags |= HASH_PIPELINE_CALCULATE_MD5;
+		}
+		else if( ( value_length == 4 )
+		      && ( system_string_compare(
+		            &( string[ string_index ] ),
+		            _SYSTEM_STRING( "sha1" ),
+		            4 ) == 0 ) )
+		{
+			hash_flags |= HASH_PIPELINE_CALCULATE_SHA1;
+		}
+		else if( ( value_length == 6 )
+		      && ( system_string_compare(
+		            &( string[ string_index ] ),
+		            _SYSTEM_STRING( "sha256" ),
+		            6 ) == 0 ) )
+		{
+			hash_flags |= HASH_PIPELINE_CALCULATE_SHA256;
+		}
+		else if( ( value_length == 4 )
+		      && ( system_string_compare(
+		            &( string[ string_index ] ),
+		            _SYSTEM_STRING( "tree" ),
+		            4 ) == 0 ) )
+		{
+			hash_flags |= HASH_PIPELINE_CALCULATE_TREE;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported hash type.",
+			 function );
+
+			return( -1 );
+		}
+		string_index += value_length + 1;
+	}
+	if( hash_flags == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing hash types.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->hash_flags = hash_flags;
+
+	return( 1 );
+}
+
+/* Sets the piece size of the piecewise hashes
+ * The piece size in the string is in MiB
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_piece_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_piece_size";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( export_handle_system_string_copy_from_64_bit_in_decimal(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit decimal.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_64bit == 0 )
+	 || ( value_64bit > (uint64_t) ( INT64_MAX / ( 1024 * 1024 ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid piece size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->piece_size = (size64_t) value_64bit * 1024 * 1024;
+
+	return( 1 );
+}
+
+/* Sets the sparse output mode
+ * In sparse output mode runs of zero blocks are not written, which leaves holes in the target
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_set_sparse_output(
+     export_handle_t *export_handle,
+     int sparse_output,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_sparse_output";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->sparse_output = sparse_output;
+
+	return( 1 );
+}
+
+/* Opens the export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open(
+     export_handle_t *export_handle,
+     system_character_t * const * filenames,
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "export_handle_open";
+	size_t filename_length           = 0;
+	int filename_index               = 0;
+	int logical_volume_index         = 0;
+	int number_of_logical_volumes    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->physical_volume_file_io_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - physical volume file IO pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_initialize(
+	     &( export_handle->volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->encrypted_root_plist_path != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libfvde_volume_read_encrypted_root_plist_wide(
+		     export_handle->volume,
+		     export_handle->encrypted_root_plist_path,
+		     error ) != 1 )
+#else
+		if( libfvde_volume_read_encrypted_root_plist(
+		     export_handle->volume,
+		     export_handle->encrypted_root_plist_path,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read EncryptedRoot.plist.wipekey file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_pool_initialize(
+	     &( export_handle->physical_volume_file_io_pool ),
+	     number_of_filenames,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize physical volume file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		if( libbfio_file_range_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize file IO handle: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		filename_length = system_string_length(
+		                   filenames[ filename_index ] );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libbfio_file_range_set_name_wide(
+		     file_io_handle,
+		     filenames[ filename_index ],
+		     filename_length,
+		     error ) != 1 )
+#else
+		if( libbfio_file_range_set_name(
+		     file_io_handle,
+		     filenames[ filename_index ],
+		     filename_length,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to set name of file IO handle: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( libbfio_file_range_set(
+		     file_io_handle,
+		     export_handle->volume_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to set volume offset of file IO handle: %d.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		if( filename_index == 0 )
+		{
+			if( libfvde_volume_open_file_io_handle(
+			     export_handle->volume,
+			     file_io_handle,
+			     LIBFVDE_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open volume.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libbfio_pool_set_handle(
+		     export_handle->physical_volume_file_io_pool,
+		     filename_index,
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO handle: %d in pool.",
+			 function,
+			 filename_index );
+
+			goto on_error;
+		}
+		/* The file IO pool takes over management of the file IO handle
+		 */
+		file_io_handle = NULL;
+	}
+	if( libfvde_volume_open_physical_volume_files_file_io_pool(
+	     export_handle->volume,
+	     export_handle->physical_volume_file_io_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open physical volume files.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_get_volume_group(
+	     export_handle->volume,
+	     &( export_handle->volume_group ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_group_get_number_of_logical_volumes(
+	     export_handle->volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->all_logical_volumes != 0 )
+	{
+		if( number_of_logical_volumes > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_LOGICAL_VOLUMES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of logical volumes value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		for( logical_volume_index = 0;
+		     logical_volume_index < number_of_logical_volumes;
+		     logical_volume_index++ )
+		{
+			export_handle->logical_volume_indexes[ logical_volume_index ] = logical_volume_index;
+		}
+		export_handle->number_of_logical_volume_indexes = number_of_logical_volumes;
+	}
+	else if( export_handle->number_of_logical_volume_indexes == 0 )
+	{
+		export_handle->logical_volume_indexes[ 0 ] = export_handle->logical_volume_index;
+
+		export_handle->number_of_logical_volume_indexes = 1;
+	}
+	if( export_handle->number_of_logical_volume_indexes == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	for( logical_volume_index = 0;
+	     logical_volume_index < export_handle->number_of_logical_volume_indexes;
+	     logical_volume_index++ )
+	{
+		if( ( export_handle->logical_volume_indexes[ logical_volume_index ] < 0 )
+		 || ( export_handle->logical_volume_indexes[ logical_volume_index ] >= number_of_logical_volumes ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: no such logical volume: %d.",
+			 function,
+			 export_handle->logical_volume_indexes[ logical_volume_index ] + 1 );
+
+			goto on_error;
+		}
+	}
+	/* The extent map of a previous export describes a single logical volume
+	 */
+	if( ( export_handle->number_of_logical_volume_indexes > 1 )
+	 && ( export_handle->has_previous_map != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: a previous extent map is only supported for a single logical volume.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->logical_volume_index = export_handle->logical_volume_indexes[ 0 ];
+
+	if( export_handle_open_logical_volume(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open logical volume: %d.",
+		 function,
+		 export_handle->logical_volume_index + 1 );
+
+		goto on_error;
+	}
+	if( export_handle->number_of_logical_volume_indexes > 1 )
+	{
+		if( export_handle_open_group_handles(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open other logical volumes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle->group_handles != NULL )
+	{
+		export_handle_free_group_handles(
+		 export_handle,
+		 NULL );
+	}
+	if( export_handle->logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &( export_handle->logical_volume ),
+		 NULL );
+	}
+	if( export_handle->volume_group != NULL )
+	{
+		libfvde_volume_group_free(
+		 &( export_handle->volume_group ),
+		 NULL );
+	}
+	if( export_handle->volume != NULL )
+	{
+		libfvde_volume_free(
+		 &( export_handle->volume ),
+		 NULL );
+	}
+	/* The file IO pool must be freed after the volume
+	 */
+	if( export_handle->physical_volume_file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &( export_handle->physical_volume_file_io_pool ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the logical volume with the current logical volume index
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_logical_volume(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_logical_volume";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->logical_volume != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - logical volume value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_group_get_logical_volume_by_index(
+	     export_handle->volume_group,
+	     export_handle->logical_volume_index,
+	     &( export_handle->logical_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume: %d.",
+		 function,
+		 export_handle->logical_volume_index );
+
+		goto on_error;
+	}
+	if( export_handle_unlock_logical_volume(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unlock logical volume: %d.",
+		 function,
+		 export_handle->logical_volume_index );
+
+		goto on_error;
+	}
+	if( export_handle_read_extents(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extents of logical volume: %d.",
+		 function,
+		 export_handle->logical_volume_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle->logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &( export_handle->logical_volume ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the export handles of the other selected logical volumes
+ * The group handles share the volume and volume group of the export handle
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_group_handles(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_handle_t *group_handle = NULL;
+	static char *function         = "export_handle_open_group_handles";
+	size_t handles_size           = 0;
+	int group_handle_index        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->group_handles != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - group handles value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_logical_volume_indexes < 2 )
+	 || ( export_handle->number_of_logical_volume_indexes > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_LOGICAL_VOLUMES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of logical volume indexes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	handles_size = sizeof( export_handle_t * ) * ( export_handle->number_of_logical_volume_indexes - 1 );
+
+	export_handle->group_handles = (export_handle_t **) memory_allocate(
+	                                                     handles_size );
+
+	if( export_handle->group_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create group handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->group_handles,
+	     0,
+	     handles_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear group handles.",
+		 function );
+
+		goto on_error;
+	}
+	for( group_handle_index = 0;
+	     group_handle_index < export_handle->number_of_logical_volume_indexes - 1;
+	     group_handle_index++ )
+	{
+		if( export_handle_initialize(
+		     &group_handle,
+		     export_handle->unattended_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create group handle: %d.",
+			 function,
+			 group_handle_index );
+
+			goto on_error;
+		}
+		/* The group handle takes over the settings but not the ownership of the volume
+		 */
+		group_handle->parent_handle             = export_handle;
+		group_handle->volume                    = export_handle->volume;
+		group_handle->volume_group              = export_handle->volume_group;
+		group_handle->key_data_size             = export_handle->key_data_size;
+		group_handle->encrypted_root_plist_path = export_handle->encrypted_root_plist_path;
+		group_handle->recovery_password         = export_handle->recovery_password;
+		group_handle->recovery_password_length  = export_handle->recovery_password_length;
+		group_handle->user_password             = export_handle->user_password;
+		group_handle->user_password_length      = export_handle->user_password_length;
+		group_handle->resume                    = export_handle->resume;
+		group_handle->hash_flags                = export_handle->hash_flags;
+		group_handle->piece_size                = export_handle->piece_size;
+		group_handle->sparse_output             = export_handle->sparse_output;
+		group_handle->notify_stream             = export_handle->notify_stream;
+		group_handle->logical_volume_index      = export_handle->logical_volume_indexes[ group_handle_index + 1 ];
+
+		if( memory_copy(
+		     group_handle->key_data,
+		     export_handle->key_data,
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy key data.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->group_handles[ group_handle_index ] = group_handle;
+
+		export_handle->number_of_group_handles += 1;
+
+		group_handle = NULL;
+
+		if( export_handle_open_logical_volume(
+		     export_handle->group_handles[ group_handle_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open logical volume: %d.",
+			 function,
+			 export_handle->logical_volume_indexes[ group_handle_index + 1 ] + 1 );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( group_handle != NULL )
+	{
+		export_handle_free(
+		 &group_handle,
+		 NULL );
+	}
+	if( export_handle->group_handles != NULL )
+	{
+		export_handle_free_group_handles(
+		 export_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the export handles of the other selected logical volumes
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_free_group_handles(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function  = "export_handle_free_group_handles";
+	int group_handle_index = 0;
+	int result             = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->group_handles != NULL )
+	{
+		for( group_handle_index = 0;
+		     group_handle_index < export_handle->number_of_group_handles;
+		     group_handle_index++ )
+		{
+			if( export_handle_free(
+			     &( export_handle->group_handles[ group_handle_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free group handle: %d.",
+				 function,
+				 group_handle_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 export_handle->group_handles );
+
+		export_handle->group_handles = NULL;
+	}
+	export_handle->number_of_group_handles = 0;
+
+	return( result );
+}
+
+/* Closes the export handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->parent_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid export handle - unable to close group handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The group handles must be freed before the volume group
+	 */
+	if( export_handle_free_group_handles(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free group handles.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_logical_volume_free(
+	     &( export_handle->logical_volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free logical volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_volume_group_free(
+	     &( export_handle->volume_group ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume group.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_volume_close(
+	     export_handle->volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_volume_free(
+	     &( export_handle->volume ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_pool_free(
+	     &( export_handle->physical_volume_file_io_pool ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free physical volume file IO pool.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Unlocks the logical volume
+ * Prompts for a password if the logical volume remains locked and user interaction is enabled
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_unlock_logical_volume(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	system_character_t password[ 64 ];
+
+	static char *function  = "export_handle_unlock_logical_volume";
+	size_t password_length = 0;
+	int result             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->key_data_size != 0 )
+	{
+		if( libfvde_logical_volume_set_key(
+		     export_handle->logical_volume,
+		     export_handle->key_data,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->user_password != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libfvde_logical_volume_set_utf16_password(
+		     export_handle->logical_volume,
+		     (uint16_t *) export_handle->user_password,
+		     export_handle->user_password_length,
+		     error ) != 1 )
+#else
+		if( libfvde_logical_volume_set_utf8_password(
+		     export_handle->logical_volume,
+		     (uint8_t *) export_handle->user_password,
+		     export_handle->user_password_length,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set password.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->recovery_password != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( libfvde_logical_volume_set_utf16_recovery_password(
+		     export_handle->logical_volume,
+		     (uint16_t *) export_handle->recovery_password,
+		     export_handle->recovery_password_length,
+		     error ) != 1 )
+#else
+		if( libfvde_logical_volume_set_utf8_recovery_password(
+		     export_handle->logical_volume,
+		     (uint8_t *) export_handle->recovery_password,
+		     export_handle->recovery_password_length,
+		     error ) != 1 )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set recovery password.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libfvde_logical_volume_unlock(
+	          export_handle->logical_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unlock logical volume.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      && ( export_handle->unattended_mode == 0 ) )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Logical volume: %d is locked and a password is needed to unlock it.\n\n",
+		 export_handle->logical_volume_index + 1 );
+
+		if( fvdetools_prompt_for_password(
+		     export_handle->notify_stream,
+		     "Password",
+		     password,
+		     64,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve password.",
+			 function );
+
+			goto on_error;
+		}
+		password_length = system_string_length(
+		                   password );
+
+		if( password_length > 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			if( libfvde_logical_volume_set_utf16_password(
+			     export_handle->logical_volume,
+			     (uint16_t *) password,
+			     password_length,
+			     error ) != 1 )
+#else
+			if( libfvde_logical_volume_set_utf8_password(
+			     export_handle->logical_volume,
+			     (uint8_t *) password,
+			     password_length,
+			     error ) != 1 )
+#endif
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set password.",
+				 function );
+
+				goto on_error;
+			}
+			memory_set(
+			 password,
+			 0,
+			 64 );
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "\n\n" );
+
+		result = libfvde_logical_volume_unlock(
+		          export_handle->logical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to unlock logical volume.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: logical volume is locked.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 password,
+	 0,
+	 64 );
+
+	return( -1 );
+}
+
+/* Reads the transaction identifier, size and extents of the logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_read_extents(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_handle_extent_t *extent = NULL;
+	static char *function          = "export_handle_read_extents";
+	int extent_index               = 0;
+	int number_of_extents          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->extents != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - extents value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_get_transaction_identifier(
+	     export_handle->volume,
+	     &( export_handle->transaction_identifier ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve transaction identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_logical_volume_get_size(
+	     export_handle->logical_volume,
+	     &( export_handle->logical_volume_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_logical_volume_get_number_of_extents(
+	     export_handle->logical_volume,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of extents.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_extents < 0 )
+	 || ( (size_t) number_of_extents > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_handle_extent_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of extents value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_extents > 0 )
+	{
+		export_handle->extents = (export_handle_extent_t *) memory_allocate(
+		                                                     sizeof( export_handle_extent_t ) * number_of_extents );
+
+		if( export_handle->extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create extents.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( extent_index = 0;
+	     extent_index < number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( export_handle->extents[ extent_index ] );
+
+		if( libfvde_logical_volume_get_extent_by_index(
+		     export_handle->logical_volume,
+		     extent_index,
+		     &( extent->offset ),
+		     &( extent->size ),
+		     &( extent->physical_volume_index ),
+		     &( extent->physical_volume_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	export_handle->number_of_extents = number_of_extents;
+
+	return( 1 );
+
+on_error:
+	if( export_handle->extents != NULL )
+	{
+		memory_free(
+		 export_handle->extents );
+
+		export_handle->extents = NULL;
+	}
+	return( -1 );
+}
+
+/* Parses a number of space separated decimal values
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_parse_values(
+     const char *string,
+     size_t string_length,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_parse_values";
+	size_t string_index   = 0;
+	uint64_t value_64bit  = 0;
+	int number_of_digits  = 0;
+	int value_index       = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		while( ( string_index < string_length )
+		    && ( string[ string_index ] == ' ' ) )
+		{
+			string_index++;
+		}
+		value_64bit      = 0;
+		number_of_digits = 0;
+
+		while( ( string_index < string_length )
+		    && ( string[ string_index ] >= '0' )
+		    && ( string[ string_index ] <= '9' ) )
+		{
+			if( value_64bit > ( ( (uint64_t) UINT64_MAX - 9 ) / 10 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: value: %d too large.",
+				 function,
+				 value_index );
+
+				return( -1 );
+			}
+			value_64bit *= 10;
+			value_64bit += (uint64_t) ( string[ string_index ] - '0' );
+
+			string_index++;
+			number_of_digits++;
+		}
+		if( ( number_of_digits == 0 )
+		 || ( ( string_index < string_length )
+		  &&  ( string[ string_index ] != ' ' ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		values[ value_index ] = value_64bit;
+	}
+	while( ( string_index < string_length )
+	    && ( string[ string_index ] == ' ' ) )
+	{
+		string_index++;
+	}
+	if( string_index < string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported trailing data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an extent to the previous extent map
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_previous_extent(
+     export_handle_t *export_handle,
+     off64_t offset,
+     size64_t size,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     libcerror_error_t **error )
+{
+	export_handle_extent_t *extent           = NULL;
+	export_handle_extent_t *previous_extents = NULL;
+	static char *function                    = "export_handle_append_previous_extent";
+	int maximum_number_of_previous_extents   = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_previous_extents >= export_handle->maximum_number_of_previous_extents )
+	{
+		if( export_handle->maximum_number_of_previous_extents == 0 )
+		{
+			maximum_number_of_previous_extents = 64;
+		}
+		else if( export_handle->maximum_number_of_previous_extents < ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_previous_extents = export_handle->maximum_number_of_previous_extents * 2;
+		}
+		if( ( maximum_number_of_previous_extents == 0 )
+		 || ( (size_t) maximum_number_of_previous_extents > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_handle_extent_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of previous extents value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		previous_extents = (export_handle_extent_t *) memory_reallocate(
+		                                               export_handle->previous_extents,
+		                                               sizeof( export_handle_extent_t ) * maximum_number_of_previous_extents );
+
+		if( previous_extents == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize previous extents.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->previous_extents                   = previous_extents;
+		export_handle->maximum_number_of_previous_extents = maximum_number_of_previous_extents;
+	}
+	extent = &( export_handle->previous_extents[ export_handle->number_of_previous_extents ] );
+
+	extent->offset                 = offset;
+	extent->size                   = size;
+	extent->physical_volume_index  = physical_volume_index;
+	extent->physical_volume_offset = physical_volume_offset;
+
+	export_handle->number_of_previous_extents += 1;
+
+	return( 1 );
+}
+
+/* Reads a previously written extent map
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_read_previous_map(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char line[ EXPORT_HANDLE_MAXIMUM_LINE_SIZE ];
+	uint64_t values[ 4 ];
+
+	FILE *file_stream       = NULL;
+	static char *function   = "export_handle_read_previous_map";
+	size_t line_length      = 0;
+	off64_t last_end_offset = 0;
+	int has_version         = 0;
+	int line_number         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->has_previous_map != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - previous map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( "r" ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open extent map.",
+		 function );
+
+		goto on_error;
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        EXPORT_HANDLE_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != '\n' )
+		 && ( file_stream_at_end(
+		       file_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: line: %d in extent map exceeds maximum size.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		if( ( line_length > 9 )
+		 && ( narrow_string_compare(
+		       line,
+		       "version: ",
+		       9 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 9 ] ),
+			     line_length - 9,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse version on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			if( values[ 0 ] != EXPORT_HANDLE_MAP_FORMAT_VERSION )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported extent map version: %" PRIu64 ".",
+				 function,
+				 values[ 0 ] );
+
+				goto on_error;
+			}
+			has_version = 1;
+		}
+		else if( ( line_length > 24 )
+		      && ( narrow_string_compare(
+		            line,
+		            "transaction identifier: ",
+		            24 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 24 ] ),
+			     line_length - 24,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse transaction identifier on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			export_handle->previous_transaction_identifier = values[ 0 ];
+		}
+		else if( ( line_length > 21 )
+		      && ( narrow_string_compare(
+		            line,
+		            "logical volume size: ",
+		            21 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 21 ] ),
+			     line_length - 21,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse logical volume size on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			export_handle->previous_logical_volume_size = (size64_t) values[ 0 ];
+		}
+		else if( ( line_length > 8 )
+		      && ( narrow_string_compare(
+		            line,
+		            "extent: ",
+		            8 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 8 ] ),
+			     line_length - 8,
+			     values,
+			     4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse extent on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			if( ( values[ 0 ] > (uint64_t) INT64_MAX )
+			 || ( values[ 1 ] == 0 )
+			 || ( values[ 1 ] > ( (uint64_t) INT64_MAX - values[ 0 ] ) )
+			 || ( values[ 2 ] > (uint64_t) INT_MAX )
+			 || ( values[ 3 ] > (uint64_t) INT64_MAX )
+			 || ( (off64_t) values[ 0 ] < last_end_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid extent on line: %d value out of bounds.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			if( export_handle_append_previous_extent(
+			     export_handle,
+			     (off64_t) values[ 0 ],
+			     (size64_t) values[ 1 ],
+			     (int) values[ 2 ],
+			     (off64_t) values[ 3 ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append extent of line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			last_end_offset = (off64_t) ( values[ 0 ] + values[ 1 ] );
+		}
+		else if( ( line_length > 9 )
+		      && ( narrow_string_compare(
+		            line,
+		            "changed: ",
+		            9 ) == 0 ) )
+		{
+			/* The changed ranges of the previous export are not needed
+			 */
+			continue;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %d in extent map.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( has_version == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing extent map version.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close extent map.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->has_previous_map = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	export_handle->number_of_previous_extents = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the extent that contains a specific offset
+ * The extents are searched from extent_index onwards, which is updated so that
+ * successive calls with ascending offsets pass over the extents only once
+ * range_end_offset is set to the end of the extent or, if no extent contains the offset,
+ * to the start of the next extent, both limited to end_offset
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_extent_at_offset(
+     export_handle_extent_t *extents,
+     int number_of_extents,
+     int *extent_index,
+     off64_t offset,
+     off64_t end_offset,
+     export_handle_extent_t **extent,
+     off64_t *range_end_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_extent_at_offset";
+
+	if( ( extents == NULL )
+	 && ( number_of_extents != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extents.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_end_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range end offset.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( *extent_index < number_of_extents )
+	    && ( ( extents[ *extent_index ].offset + (off64_t) extents[ *extent_index ].size ) <= offset ) )
+	{
+		*extent_index += 1;
+	}
+	*extent           = NULL;
+	*range_end_offset = end_offset;
+
+	if( *extent_index < number_of_extents )
+	{
+		if( extents[ *extent_index ].offset <= offset )
+		{
+			*extent           = &( extents[ *extent_index ] );
+			*range_end_offset = extents[ *extent_index ].offset + (off64_t) extents[ *extent_index ].size;
+		}
+		else
+		{
+			*range_end_offset = extents[ *extent_index ].offset;
+		}
+		if( *range_end_offset > end_offset )
+		{
+			*range_end_offset = end_offset;
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a range to export
+ * The range is merged with the last range if they are contiguous
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_range(
+     export_handle_t *export_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	export_handle_range_t *last_range = NULL;
+	export_handle_range_t *range      = NULL;
+	export_handle_range_t *ranges     = NULL;
+	static char *function             = "export_handle_append_range";
+	off64_t target_offset             = 0;
+	int maximum_number_of_ranges      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_ranges > 0 )
+	{
+		last_range = &( export_handle->ranges[ export_handle->number_of_ranges - 1 ] );
+
+		if( ( last_range->offset + (off64_t) last_range->size ) == offset )
+		{
+			last_range->size += size;
+
+			return( 1 );
+		}
+		target_offset = last_range->target_offset + (off64_t) last_range->size;
+	}
+	if( export_handle->number_of_ranges >= export_handle->maximum_number_of_ranges )
+	{
+		if( export_handle->maximum_number_of_ranges == 0 )
+		{
+			maximum_number_of_ranges = 64;
+		}
+		else if( export_handle->maximum_number_of_ranges < ( INT_MAX / 2 ) )
+		{
+			maximum_number_of_ranges = export_handle->maximum_number_of_ranges * 2;
+		}
+		if( ( maximum_number_of_ranges == 0 )
+		 || ( (size_t) maximum_number_of_ranges > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_handle_range_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid maximum number of ranges value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		ranges = (export_handle_range_t *) memory_reallocate(
+		                                    export_handle->ranges,
+		                                    sizeof( export_handle_range_t ) * maximum_number_of_ranges );
+
+		if( ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize ranges.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->ranges                   = ranges;
+		export_handle->maximum_number_of_ranges = maximum_number_of_ranges;
+	}
+	range = &( export_handle->ranges[ export_handle->number_of_ranges ] );
+
+	range->offset        = offset;
+	range->size          = size;
+	range->target_offset = target_offset;
+
+	export_handle->number_of_ranges += 1;
+
+	return( 1 );
+}
+
+/* Determines the ranges to export
+ * Without a previous extent map the entire logical volume is exported, otherwise
+ * only the ranges of which the mapping onto the physical volumes changed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_compute_ranges(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	export_handle_extent_t *extent          = NULL;
+	export_handle_extent_t *previous_extent = NULL;
+	static char *function                   = "export_handle_compute_ranges";
+	off64_t end_offset                      = 0;
+	off64_t offset                          = 0;
+	off64_t previous_range_end_offset       = 0;
+	off64_t range_end_offset                = 0;
+	int extent_index                        = 0;
+	int is_changed                          = 0;
+	int previous_extent_index               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->logical_volume_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - logical volume size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->number_of_ranges = 0;
+
+	end_offset = (off64_t) export_handle->logical_volume_size;
+
+	if( export_handle->has_previous_map == 0 )
+	{
+		if( end_offset > 0 )
+		{
+			if( export_handle_append_range(
+			     export_handle,
+			     0,
+			     export_handle->logical_volume_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append range.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	while( offset < end_offset )
+	{
+		if( export_handle_get_extent_at_offset(
+		     export_handle->extents,
+		     export_handle->number_of_extents,
+		     &extent_index,
+		     offset,
+		     end_offset,
+		     &extent,
+		     &range_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve extent at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		if( export_handle_get_extent_at_offset(
+		     export_handle->previous_extents,
+		     export_handle->number_of_previous_extents,
+		     &previous_extent_index,
+		     offset,
+		     end_offset,
+		     &previous_extent,
+		     &previous_range_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve previous extent at offset: %" PRIi64 ".",
+			 function,
+			 offset );
+
+			return( -1 );
+		}
+		if( previous_range_end_offset < range_end_offset )
+		{
+			range_end_offset = previous_range_end_offset;
+		}
+		if( range_end_offset <= offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid range end offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		/* Ranges that are sparse in both maps read as zero bytes and are considered unchanged
+		 */
+		if( ( extent == NULL )
+		 || ( previous_extent == NULL ) )
+		{
+			is_changed = (int) ( extent != previous_extent );
+		}
+		else if( extent->physical_volume_index != previous_extent->physical_volume_index )
+		{
+			is_changed = 1;
+		}
+		else
+		{
+			is_changed = (int) ( ( extent->physical_volume_offset + ( offset - extent->offset ) )
+			                  != ( previous_extent->physical_volume_offset + ( offset - previous_extent->offset ) ) );
+		}
+		if( is_changed != 0 )
+		{
+			if( export_handle_append_range(
+			     export_handle,
+			     offset,
+			     (size64_t) ( range_end_offset - offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append range.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		offset = range_end_offset;
+	}
+	return( 1 );
+}
+
+/* Flushes a file stream and synchronizes its data with the storage
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_sync_file_stream(
+     FILE *file_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_sync_file_stream";
+	int result            = 0;
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( fflush(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush file stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	result = _commit(
+	          _fileno(
+	           file_stream ) );
+#elif defined( HAVE_UNISTD_H )
+	result = fsync(
+	          fileno(
+	           file_stream ) );
+#endif
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize file stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a path that consists of a path and a suffix
+ * Make sure the value path_with_suffix is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_path_with_suffix(
+     const system_character_t *path,
+     const system_character_t *suffix,
+     system_character_t **path_with_suffix,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_create_path_with_suffix";
+	size_t path_length    = 0;
+	size_t suffix_length  = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( suffix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid suffix.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_with_suffix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path with suffix.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_with_suffix != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path with suffix value already set.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	suffix_length = system_string_length(
+	                 suffix );
+
+	if( ( suffix_length > 16 )
+	 || ( path_length > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 17 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*path_with_suffix = system_string_allocate(
+	                     path_length + suffix_length + 1 );
+
+	if( *path_with_suffix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path with suffix.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     *path_with_suffix,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( ( *path_with_suffix )[ path_length ] ),
+	     suffix,
+	     suffix_length + 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *path_with_suffix != NULL )
+	{
+		memory_free(
+		 *path_with_suffix );
+
+		*path_with_suffix = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the total size of the ranges to export
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_export_size(
+     export_handle_t *export_handle,
+     size64_t *export_size,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_get_export_size";
+	int range_index       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export size.",
+		 function );
+
+		return( -1 );
+	}
+	*export_size = 0;
+
+	for( range_index = 0;
+	     range_index < export_handle->number_of_ranges;
+	     range_index++ )
+	{
+		*export_size += export_handle->ranges[ range_index ].size;
+	}
+	return( 1 );
+}
+
+/* Reads the journal of an interrupted export
+ * The journal must have been written for the same transaction identifier, logical volume size,
+ * previous extent map and ranges, otherwise the export cannot be resumed
+ * Sets the resume target offset to the end of the completed ranges
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_read_journal(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	char line[ EXPORT_HANDLE_MAXIMUM_LINE_SIZE ];
+	uint64_t values[ 2 ];
+
+	FILE *file_stream                        = NULL;
+	static char *function                    = "export_handle_read_journal";
+	size64_t export_size                     = 0;
+	size_t line_length                       = 0;
+	uint64_t journal_export_size             = 0;
+	uint64_t journal_logical_volume_size     = 0;
+	uint64_t journal_previous_transaction_id = 0;
+	uint64_t journal_transaction_identifier  = 0;
+	off64_t completed_offset                 = 0;
+	int has_header_values                    = 0;
+	int has_previous_transaction_id          = 0;
+	int has_version                          = 0;
+	int line_number                          = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_export_size(
+	     export_handle,
+	     &export_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( "r" ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open journal.",
+		 function );
+
+		goto on_error;
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        EXPORT_HANDLE_MAXIMUM_LINE_SIZE ) != NULL )
+	{
+		line_number++;
+
+		line_length = narrow_string_length(
+		               line );
+
+		/* A line without end of line character was only partially written
+		 * when the export was interrupted and is ignored
+		 */
+		if( ( line_length == 0 )
+		 || ( line[ line_length - 1 ] != '\n' ) )
+		{
+			if( file_stream_at_end(
+			     file_stream ) != 0 )
+			{
+				break;
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: line: %d in journal exceeds maximum size.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == '\n' )
+		     ||  ( line[ line_length - 1 ] == '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == '#' ) )
+		{
+			continue;
+		}
+		if( ( line_length > 9 )
+		 && ( narrow_string_compare(
+		       line,
+		       "version: ",
+		       9 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 9 ] ),
+			     line_length - 9,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse version on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			if( values[ 0 ] != EXPORT_HANDLE_JOURNAL_FORMAT_VERSION )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported journal version: %" PRIu64 ".",
+				 function,
+				 values[ 0 ] );
+
+				goto on_error;
+			}
+			has_version = 1;
+		}
+		else if( ( line_length > 24 )
+		      && ( narrow_string_compare(
+		            line,
+		            "transaction identifier: ",
+		            24 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 24 ] ),
+			     line_length - 24,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse transaction identifier on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			journal_transaction_identifier = values[ 0 ];
+			has_header_values             |= 0x01;
+		}
+		else if( ( line_length > 33 )
+		      && ( narrow_string_compare(
+		            line,
+		            "previous transaction identifier: ",
+		            33 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 33 ] ),
+			     line_length - 33,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse previous transaction identifier on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			journal_previous_transaction_id = values[ 0 ];
+			has_previous_transaction_id     = 1;
+		}
+		else if( ( line_length > 21 )
+		      && ( narrow_string_compare(
+		            line,
+		            "logical volume size: ",
+		            21 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 21 ] ),
+			     line_length - 21,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse logical volume size on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			journal_logical_volume_size = values[ 0 ];
+			has_header_values          |= 0x02;
+		}
+		else if( ( line_length > 13 )
+		      && ( narrow_string_compare(
+		            line,
+		            "export size: ",
+		            13 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 13 ] ),
+			     line_length - 13,
+			     values,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse export size on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			journal_export_size = values[ 0 ];
+			has_header_values  |= 0x04;
+		}
+		else if( ( line_length > 11 )
+		      && ( narrow_string_compare(
+		            line,
+		            "completed: ",
+		            11 ) == 0 ) )
+		{
+			if( export_handle_parse_values(
+			     &( line[ 11 ] ),
+			     line_length - 11,
+			     values,
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to parse completed range on line: %d.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			/* Completed ranges are recorded in target order, a range that does not
+			 * follow the previous one is not trusted
+			 */
+			if( ( values[ 0 ] != (uint64_t) completed_offset )
+			 || ( values[ 1 ] > ( export_size - (size64_t) completed_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid completed range on line: %d value out of bounds.",
+				 function,
+				 line_number );
+
+				goto on_error;
+			}
+			completed_offset += (off64_t) values[ 1 ];
+		}
+		else if( ( line_length == 8 )
+		      && ( narrow_string_compare(
+		            line,
+		            "finished",
+		            8 ) == 0 ) )
+		{
+			continue;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported line: %d in journal.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( ( has_version == 0 )
+	 || ( has_header_values != 0x07 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing journal header values.",
+		 function );
+
+		goto on_error;
+	}
+	if( journal_transaction_identifier != export_handle->transaction_identifier )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: journal transaction identifier: %" PRIu64 " does not match volume transaction identifier: %" PRIu64 ".",
+		 function,
+		 journal_transaction_identifier,
+		 export_handle->transaction_identifier );
+
+		goto on_error;
+	}
+	if( ( has_previous_transaction_id != export_handle->has_previous_map )
+	 || ( ( has_previous_transaction_id != 0 )
+	  &&  ( journal_previous_transaction_id != export_handle->previous_transaction_identifier ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: journal was written for a different previous extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( journal_logical_volume_size != export_handle->logical_volume_size )
+	 || ( journal_export_size != export_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: journal was written for a different set of ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close journal.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->resume_target_offset = completed_offset;
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Opens the journal
+ * When resuming the journal is opened for appending, otherwise a new journal is created
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_journal(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_journal";
+	size64_t export_size  = 0;
+	int print_count       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->journal_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - journal stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->resume != 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		export_handle->journal_stream = file_stream_open_wide(
+		                                 filename,
+		                                 _SYSTEM_STRING( "a" ) );
+#else
+		export_handle->journal_stream = file_stream_open(
+		                                 filename,
+		                                 FILE_STREAM_OPEN_APPEND );
+#endif
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		export_handle->journal_stream = file_stream_open_wide(
+		                                 filename,
+		                                 _SYSTEM_STRING( "w" ) );
+#else
+		export_handle->journal_stream = file_stream_open(
+		                                 filename,
+		                                 FILE_STREAM_OPEN_WRITE );
+#endif
+	}
+	if( export_handle->journal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open journal.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->resume != 0 )
+	{
+		return( 1 );
+	}
+	if( export_handle_get_export_size(
+	     export_handle,
+	     &export_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export size.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = fprintf(
+	               export_handle->journal_stream,
+	               "# fvdeexport journal\n"
+	               "version: %d\n"
+	               "transaction identifier: %" PRIu64 "\n",
+	               EXPORT_HANDLE_JOURNAL_FORMAT_VERSION,
+	               export_handle->transaction_identifier );
+
+	if( ( print_count >= 0 )
+	 && ( export_handle->has_previous_map != 0 ) )
+	{
+		print_count = fprintf(
+		               export_handle->journal_stream,
+		               "previous transaction identifier: %" PRIu64 "\n",
+		               export_handle->previous_transaction_identifier );
+	}
+	if( print_count >= 0 )
+	{
+		print_count = fprintf(
+		               export_handle->journal_stream,
+		               "logical volume size: %" PRIu64 "\n"
+		               "export size: %" PRIu64 "\n",
+		               export_handle->logical_volume_size,
+		               export_size );
+	}
+	if( print_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write journal header.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_sync_file_stream(
+	     export_handle->journal_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize journal.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( export_handle->journal_stream != NULL )
+	{
+		file_stream_close(
+		 export_handle->journal_stream );
+
+		export_handle->journal_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes the journal
+ * Returns 0 if successful or -1 on error
+ */
+int export_handle_close_journal(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_journal";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->journal_stream == NULL )
+	{
+		return( 0 );
+	}
+	if( file_stream_close(
+	     export_handle->journal_stream ) != 0 )
+	{
+		export_handle->journal_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close journal.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->journal_stream = NULL;
+
+	return( 0 );
+}
+
+/* Appends a line to the journal and synchronizes the journal
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_journal_line(
+     export_handle_t *export_handle,
+     const char *line,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_append_journal_line";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->journal_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing journal stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( fprintf(
+	     export_handle->journal_stream,
+	     "%s\n",
+	     line ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write journal line.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_sync_file_stream(
+	     export_handle->journal_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize journal.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Marks a range of the target as completed
+ * The target is synchronized before the range is recorded in the journal,
+ * so that the journal never refers to data that is not stored
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_complete_batch(
+     export_handle_t *export_handle,
+     FILE *target_stream,
+     off64_t target_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	char line[ EXPORT_HANDLE_MAXIMUM_LINE_SIZE ];
+
+	static char *function = "export_handle_complete_batch";
+	int print_count       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_sync_file_stream(
+	     target_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to synchronize target.",
+		 function );
+
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               line,
+	               EXPORT_HANDLE_MAXIMUM_LINE_SIZE,
+	               "completed: %" PRIi64 " %" PRIu64,
+	               target_offset,
+	               size );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= EXPORT_HANDLE_MAXIMUM_LINE_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format journal line.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_append_journal_line(
+	     export_handle,
+	     line,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to append completed range to journal.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data to the target at the current offset of the target stream
+ * In sparse output mode the runs of zero blocks are skipped, which leaves a hole in
+ * the target. A resumed export can overwrite data of the interrupted export, hence
+ * it writes the runs of zero blocks
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_target_data(
+     export_handle_t *export_handle,
+     FILE *target_stream,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t target_offset,
+     uint8_t *has_trailing_hole,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_target_data";
+	size_t data_offset    = 0;
+	size_t run_size       = 0;
+	uint8_t is_zero       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_trailing_hole == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has trailing hole.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		run_size = data_size - data_offset;
+		is_zero  = 0;
+
+		if( ( export_handle->sparse_output != 0 )
+		 && ( export_handle->resume_target_offset == 0 ) )
+		{
+			if( zero_block_get_run_size(
+			     &( data[ data_offset ] ),
+			     data_size - data_offset,
+			     &run_size,
+			     &is_zero,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve run size.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( is_zero != 0 )
+		{
+			if( file_stream_seek_offset(
+			     target_stream,
+			     target_offset + (off64_t) ( data_offset + run_size ),
+			     SEEK_SET ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek offset: %" PRIi64 " in target.",
+				 function,
+				 target_offset + (off64_t) ( data_offset + run_size ) );
+
+				return( -1 );
+			}
+			export_handle->zero_size += run_size;
+		}
+		else if( file_stream_write(
+		          target_stream,
+		          &( data[ data_offset ] ),
+		          run_size ) != run_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data at target offset: %" PRIi64 ".",
+			 function,
+			 target_offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		*has_trailing_hole = is_zero;
+
+		data_offset += run_size;
+	}
+	return( 1 );
+}
+
+/* Extends the target to a specific size after data that ends with a hole
+ * A seek beyond the end of the target does not change its size, hence the last
+ * byte of the hole is written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_extend_target(
+     FILE *target_stream,
+     off64_t target_size,
+     libcerror_error_t **error )
+{
+	uint8_t zero_byte     = 0;
+	static char *function = "export_handle_extend_target";
+
+	if( target_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_size <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid target size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_stream_seek_offset(
+	     target_stream,
+	     target_size - 1,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " in target.",
+		 function,
+		 target_size - 1 );
+
+		return( -1 );
+	}
+	if( file_stream_write(
+	     target_stream,
+	     &zero_byte,
+	     1 ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write last byte of target.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the data of the ranges to a file
+ * The ranges are written consecutively in buffers that are aligned with the
+ * target. Every batch of data is synchronized with the storage and recorded in
+ * the journal. When resuming, the data before the resume target offset is not
+ * written again, it is only read back from the target if hashes are calculated
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_ranges(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	export_handle_extent_t *extent          = NULL;
+	export_handle_range_t *range            = NULL;
+	hash_pipeline_buffer_t *pipeline_buffer = NULL;
+	FILE *file_stream                       = NULL;
+	uint8_t *buffer                         = NULL;
+	static char *function                   = "export_handle_export_ranges";
+	size64_t export_size                    = 0;
+	size_t buffer_data_size                 = 0;
+	size_t fill_size                        = 0;
+	size_t read_size                        = 0;
+	size_t write_size                       = 0;
+	ssize_t read_count                      = 0;
+	off64_t batch_offset                    = 0;
+	off64_t data_offset                     = 0;
+	off64_t extent_end_offset               = 0;
+	off64_t logical_offset                  = 0;
+	off64_t physical_volume_offset          = 0;
+	off64_t range_offset                    = 0;
+	off64_t stream_offset                   = 0;
+	off64_t target_offset                   = 0;
+	off64_t write_offset                    = 0;
+	uint8_t has_trailing_hole               = 0;
+	int extent_index                        = 0;
+	int range_index                         = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->resume_target_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - resume target offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_get_export_size(
+	     export_handle,
+	     &export_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export size.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->resume_target_offset > 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		file_stream = file_stream_open_wide(
+		               filename,
+		               _SYSTEM_STRING( "r+b" ) );
+#else
+		file_stream = file_stream_open(
+		               filename,
+		               "r+b" );
+#endif
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		file_stream = file_stream_open_wide(
+		               filename,
+		               _SYSTEM_STRING( "wb" ) );
+#else
+		file_stream = file_stream_open(
+		               filename,
+		               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	}
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open target.",
+		 function );
+
+		goto on_error;
+	}
+	/* The hashes cover the entire target, hence the data that was written
+	 * before the interruption is read back from the target
+	 */
+	if( export_handle->hash_pipeline == NULL )
+	{
+		stream_offset = export_handle->resume_target_offset;
+	}
+	batch_offset = export_handle->resume_target_offset;
+
+	while( stream_offset < (off64_t) export_size )
+	{
+		if( export_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle->hash_pipeline != NULL )
+		{
+			if( hash_pipeline_get_buffer(
+			     export_handle->hash_pipeline,
+			     &pipeline_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve hash pipeline buffer.",
+				 function );
+
+				goto on_error;
+			}
+			buffer = pipeline_buffer->data;
+		}
+		else
+		{
+			buffer = export_handle->buffer;
+		}
+		fill_size = EXPORT_HANDLE_BUFFER_SIZE - (size_t) ( stream_offset % EXPORT_HANDLE_BUFFER_SIZE );
+
+		if( (size64_t) fill_size > ( export_size - (size64_t) stream_offset ) )
+		{
+			fill_size = (size_t) ( export_size - (size64_t) stream_offset );
+		}
+		buffer_data_size = 0;
+
+		while( buffer_data_size < fill_size )
+		{
+			data_offset = stream_offset + (off64_t) buffer_data_size;
+			read_size   = fill_size - buffer_data_size;
+
+			if( data_offset < export_handle->resume_target_offset )
+			{
+				if( (off64_t) read_size > ( export_handle->resume_target_offset - data_offset ) )
+				{
+					read_size = (size_t) ( export_handle->resume_target_offset - data_offset );
+				}
+				if( file_stream_seek_offset(
+				     file_stream,
+				     data_offset,
+				     SEEK_SET ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek offset: %" PRIi64 " in target.",
+					 function,
+					 data_offset );
+
+					goto on_error;
+				}
+				if( file_stream_read(
+				     file_stream,
+				     &( buffer[ buffer_data_size ] ),
+				     read_size ) != read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read back data at offset: %" PRIi64 " from target.",
+					 function,
+					 data_offset );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				while( ( range_index < export_handle->number_of_ranges )
+				    && ( ( export_handle->ranges[ range_index ].target_offset + (off64_t) export_handle->ranges[ range_index ].size ) <= data_offset ) )
+				{
+					range_index++;
+				}
+				if( range_index >= export_handle->number_of_ranges )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing range for target offset: %" PRIi64 ".",
+					 function,
+					 data_offset );
+
+					goto on_error;
+				}
+				range        = &( export_handle->ranges[ range_index ] );
+				range_offset = data_offset - range->target_offset;
+
+				if( (size64_t) read_size > ( range->size - (size64_t) range_offset ) )
+				{
+					read_size = (size_t) ( range->size - (size64_t) range_offset );
+				}
+				logical_offset = range->offset + range_offset;
+				extent         = NULL;
+
+				/* Concurrent exports read one extent at a time, in the order
+				 * of the physical volume offsets chosen by the scheduler
+				 */
+				if( export_handle->scheduler != NULL )
+				{
+					if( export_handle_get_extent_at_offset(
+					     export_handle->extents,
+					     export_handle->number_of_extents,
+					     &extent_index,
+					     logical_offset,
+					     logical_offset + (off64_t) read_size,
+					     &extent,
+					     &extent_end_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve extent at offset: %" PRIi64 ".",
+						 function,
+						 logical_offset );
+
+						goto on_error;
+					}
+					read_size = (size_t) ( extent_end_offset - logical_offset );
+
+					if( extent != NULL )
+					{
+						physical_volume_offset = extent->physical_volume_offset + ( logical_offset - extent->offset );
+
+						if( export_scheduler_acquire(
+						     export_handle->scheduler,
+						     extent->physical_volume_index,
+						     physical_volume_offset,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to acquire scheduler.",
+							 function );
+
+							extent = NULL;
+
+							goto on_error;
+						}
+					}
+				}
+				read_count = libfvde_logical_volume_read_buffer_at_offset(
+				              export_handle->logical_volume,
+				              &( buffer[ buffer_data_size ] ),
+				              read_size,
+				              logical_offset,
+				              error );
+
+				if( extent != NULL )
+				{
+					if( export_scheduler_release(
+					     export_handle->scheduler,
+					     extent->physical_volume_index,
+					     physical_volume_offset + (off64_t) read_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to release scheduler.",
+						 function );
+
+						extent = NULL;
+
+						goto on_error;
+					}
+					extent = NULL;
+				}
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 logical_offset,
+					 logical_offset );
+
+					goto on_error;
+				}
+			}
+			buffer_data_size += read_size;
+		}
+		/* The hash threads only read the buffer, so the buffer is handed over
+		 * before it is written to the target
+		 */
+		if( export_handle->hash_pipeline != NULL )
+		{
+			pipeline_buffer->data_size = buffer_data_size;
+
+			if( hash_pipeline_push_buffer(
+			     export_handle->hash_pipeline,
+			     pipeline_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push buffer onto hash pipeline.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		target_offset = stream_offset + (off64_t) buffer_data_size;
+
+		if( target_offset > export_handle->resume_target_offset )
+		{
+			write_offset = stream_offset;
+
+			if( write_offset < export_handle->resume_target_offset )
+			{
+				write_offset = export_handle->resume_target_offset;
+			}
+			/* The first write follows the completed data or the data that was
+			 * read back, both require a seek
+			 */
+			if( ( write_offset == export_handle->resume_target_offset )
+			 && ( write_offset > 0 ) )
+			{
+				if( file_stream_seek_offset(
+				     file_stream,
+				     write_offset,
+				     SEEK_SET ) != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek resume offset: %" PRIi64 " in target.",
+					 function,
+					 write_offset );
+
+					goto on_error;
+				}
+			}
+			write_size = (size_t) ( target_offset - write_offset );
+
+			if( export_handle_write_target_data(
+			     export_handle,
+			     file_stream,
+			     &( buffer[ write_offset - stream_offset ] ),
+			     write_size,
+			     write_offset,
+			     &has_trailing_hole,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data at target offset: %" PRIi64 ".",
+				 function,
+				 write_offset );
+
+				goto on_error;
+			}
+			if( ( target_offset - batch_offset ) >= EXPORT_HANDLE_JOURNAL_BATCH_SIZE )
+			{
+				/* A completed batch is read back when resuming, hence the target
+				 * must contain all of its data
+				 */
+				if( has_trailing_hole != 0 )
+				{
+					if( export_handle_extend_target(
+					     file_stream,
+					     target_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_WRITE_FAILED,
+						 "%s: unable to extend target to offset: %" PRIi64 ".",
+						 function,
+						 target_offset );
+
+						goto on_error;
+					}
+					has_trailing_hole = 0;
+				}
+				if( export_handle_complete_batch(
+				     export_handle,
+				     file_stream,
+				     batch_offset,
+				     (size64_t) ( target_offset - batch_offset ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to complete batch at target offset: %" PRIi64 ".",
+					 function,
+					 batch_offset );
+
+					goto on_error;
+				}
+				batch_offset = target_offset;
+			}
+		}
+		stream_offset = target_offset;
+	}
+	if( has_trailing_hole != 0 )
+	{
+		if( export_handle_extend_target(
+		     file_stream,
+		     stream_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to extend target to offset: %" PRIi64 ".",
+			 function,
+			 stream_offset );
+
+			goto on_error;
+		}
+	}
+	if( stream_offset > batch_offset )
+	{
+		if( export_handle_complete_batch(
+		     export_handle,
+		     file_stream,
+		     batch_offset,
+		     (size64_t) ( stream_offset - batch_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to complete batch at target offset: %" PRIi64 ".",
+			 function,
+			 batch_offset );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close target.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( extent != NULL )
+	{
+		export_scheduler_release(
+		 export_handle->scheduler,
+		 extent->physical_volume_index,
+		 physical_volume_offset,
+		 NULL );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Writes the extent map
+ * The map contains the current extents, which can be passed as the previous
+ * extent map of a next export, and the ranges contained in the target
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_map(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	export_handle_extent_t *extent = NULL;
+	export_handle_range_t *range   = NULL;
+	FILE *file_stream              = NULL;
+	static char *function          = "export_handle_write_map";
+	int extent_index               = 0;
+	int print_count                = 0;
+	int range_index                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( "w" ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open extent map.",
+		 function );
+
+		goto on_error;
+	}
+	print_count = fprintf(
+	               file_stream,
+	               "# fvdeexport extent map\n"
+	               "version: %d\n"
+	               "transaction identifier: %" PRIu64 "\n"
+	               "logical volume size: %" PRIu64 "\n",
+	               EXPORT_HANDLE_MAP_FORMAT_VERSION,
+	               export_handle->transaction_identifier,
+	               export_handle->logical_volume_size );
+
+	if( print_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->has_previous_map != 0 )
+	{
+		print_count = fprintf(
+		               file_stream,
+		               "# changed since transaction identifier: %" PRIu64 "\n",
+		               export_handle->previous_transaction_identifier );
+
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write header.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* extent: logical offset, size, physical volume index, physical volume offset
+	 */
+	for( extent_index = 0;
+	     extent_index < export_handle->number_of_extents;
+	     extent_index++ )
+	{
+		extent = &( export_handle->extents[ extent_index ] );
+
+		print_count = fprintf(
+		               file_stream,
+		               "extent: %" PRIi64 " %" PRIu64 " %d %" PRIi64 "\n",
+		               extent->offset,
+		               extent->size,
+		               extent->physical_volume_index,
+		               extent->physical_volume_offset );
+
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write extent: %d.",
+			 function,
+			 extent_index );
+
+			goto on_error;
+		}
+	}
+	/* changed: logical offset, size, offset in the target
+	 */
+	for( range_index = 0;
+	     range_index < export_handle->number_of_ranges;
+	     range_index++ )
+	{
+		range = &( export_handle->ranges[ range_index ] );
+
+		print_count = fprintf(
+		               file_stream,
+		               "changed: %" PRIi64 " %" PRIu64 " %" PRIi64 "\n",
+		               range->offset,
+		               range->size,
+		               range->target_offset );
+
+		if( print_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write range: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close extent map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Exports the logical volume
+ * The data is written to the target path, the journal to the target path with
+ * the suffix .journal and the extent map to the target path with the suffix .map
+ * The hashes are calculated over the data written to the target path and remain
+ * available until the summary is printed
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_logical_volume(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	system_character_t *journal_path = NULL;
+	system_character_t *map_path     = NULL;
+	static char *function            = "export_handle_export_logical_volume";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_create_path_with_suffix(
+	     target_path,
+	     _SYSTEM_STRING( ".map" ),
+	     &map_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create map path.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_create_path_with_suffix(
+	     target_path,
+	     _SYSTEM_STRING( ".journal" ),
+	     &journal_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create journal path.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_compute_ranges(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine ranges to export.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_get_export_size(
+	     export_handle,
+	     &( export_handle->export_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve export size.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->has_previous_map != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Changes between transaction: %" PRIu64 " and %" PRIu64 ": %d ranges, %" PRIu64 " of %" PRIu64 " bytes.\n",
+		 export_handle->previous_transaction_identifier,
+		 export_handle->transaction_identifier,
+		 export_handle->number_of_ranges,
+		 export_handle->export_size,
+		 export_handle->logical_volume_size );
+	}
+	export_handle->resume_target_offset = 0;
+
+	if( export_handle->resume != 0 )
+	{
+		if( export_handle_read_journal(
+		     export_handle,
+		     journal_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read journal.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Resuming export of logical volume: %d at: %" PRIi64 " of %" PRIu64 " bytes.\n",
+		 export_handle->logical_volume_index + 1,
+		 export_handle->resume_target_offset,
+		 export_handle->export_size );
+	}
+	if( export_handle->hash_flags != 0 )
+	{
+		if( hash_pipeline_initialize(
+		     &( export_handle->hash_pipeline ),
+		     export_handle->hash_flags,
+		     export_handle->export_size,
+		     export_handle->piece_size,
+		     HASH_PIPELINE_DEFAULT_NUMBER_OF_TREE_THREADS,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create hash pipeline.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_open_journal(
+	     export_handle,
+	     journal_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open journal.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_export_ranges(
+	     export_handle,
+	     target_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle->hash_pipeline != NULL )
+	{
+		if( hash_pipeline_finalize(
+		     export_handle->hash_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize hashes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_write_map(
+	     export_handle,
+	     map_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write extent map.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_append_journal_line(
+	     export_handle,
+	     "finished",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to append finished to journal.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_close_journal(
+	     export_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close journal.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 journal_path );
+
+	memory_free(
+	 map_path );
+
+	return( 1 );
+
+on_error:
+	if( export_handle->journal_stream != NULL )
+	{
+		export_handle_close_journal(
+		 export_handle,
+		 NULL );
+	}
+	if( export_handle->hash_pipeline != NULL )
+	{
+		hash_pipeline_free(
+		 &( export_handle->hash_pipeline ),
+		 NULL );
+	}
+	if( journal_path != NULL )
+	{
+		memory_free(
+		 journal_path );
+	}
+	if( map_path != NULL )
+	{
+		memory_free(
+		 map_path );
+	}
+	return( -1 );
+}
+
+/* Prints the summary of an export of a logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_print_summary(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_print_summary";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Exported: %" PRIu64 " bytes of logical volume: %d at transaction: %" PRIu64 ".\n",
+	 export_handle->export_size,
+	 export_handle->logical_volume_index + 1,
+	 export_handle->transaction_identifier );
+
+	if( export_handle->sparse_output != 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Zero blocks: %" PRIu64 " bytes were not written to the target.\n",
+		 export_handle->zero_size );
+	}
+	if( export_handle->hash_pipeline != NULL )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "\n" );
+
+		if( hash_pipeline_print(
+		     export_handle->hash_pipeline,
+		     export_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print hashes.",
+			 function );
+
+			return( -1 );
+		}
+		if( hash_pipeline_free(
+		     &( export_handle->hash_pipeline ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash pipeline.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to export a logical volume from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_callback(
+     export_handle_t *export_handle,
+     export_handle_t *parent_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_handle_export_callback";
+
+	if( ( export_handle == NULL )
+	 || ( parent_handle == NULL ) )
+	{
+		return( -1 );
+	}
+	export_handle->export_result = export_handle_export_logical_volume(
+	                                export_handle,
+	                                export_handle->target_path,
+	                                &error );
+
+	if( export_handle->export_result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export logical volume: %d.",
+		 function,
+		 export_handle->logical_volume_index + 1 );
+
+		/* The failure is reported by the thread that joins the thread pool
+		 */
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		/* Stop the other exports since the export as a whole failed
+		 */
+		export_handle_signal_abort(
+		 parent_handle,
+		 NULL );
+	}
+	return( export_handle->export_result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the selected logical volumes
+ * A single logical volume is exported to the target path, multiple logical volumes
+ * are exported concurrently to the target path with the suffix .N, where N is the
+ * number of the logical volume, and share a scheduler that orders their reads by
+ * physical volume offset
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error )
+{
+	system_character_t suffix[ 16 ];
+
+	export_handle_t *group_handle          = NULL;
+	export_handle_t **handles              = NULL;
+	static char *function                  = "export_handle_export";
+	int handle_index                       = 0;
+	int number_of_handles                  = 0;
+	int print_count                        = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( target_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid target path.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_group_handles == 0 )
+	{
+		if( export_handle_export_logical_volume(
+		     export_handle,
+		     target_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export logical volume: %d.",
+			 function,
+			 export_handle->logical_volume_index + 1 );
+
+			return( -1 );
+		}
+		if( export_handle_print_summary(
+		     export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print summary.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	number_of_handles = export_handle->number_of_group_handles + 1;
+
+	handles = (export_handle_t **) memory_allocate(
+	                                sizeof( export_handle_t * ) * number_of_handles );
+
+	if( handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handles.",
+		 function );
+
+		goto on_error;
+	}
+	handles[ 0 ] = export_handle;
+
+	for( handle_index = 1;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		handles[ handle_index ] = export_handle->group_handles[ handle_index - 1 ];
+	}
+	if( export_scheduler_initialize(
+	     &( export_handle->scheduler ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		group_handle = handles[ handle_index ];
+
+		print_count = system_string_sprintf(
+		               suffix,
+		               16,
+		               _SYSTEM_STRING( ".%d" ),
+		               group_handle->logical_volume_index + 1 );
+
+		if( ( print_count < 0 )
+		 || ( print_count >= 16 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set suffix of logical volume: %d.",
+			 function,
+			 group_handle->logical_volume_index + 1 );
+
+			goto on_error;
+		}
+		if( group_handle->target_path != NULL )
+		{
+			memory_free(
+			 group_handle->target_path );
+
+			group_handle->target_path = NULL;
+		}
+		if( export_handle_create_path_with_suffix(
+		     target_path,
+		     suffix,
+		     &( group_handle->target_path ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create target path of logical volume: %d.",
+			 function,
+			 group_handle->logical_volume_index + 1 );
+
+			goto on_error;
+		}
+		group_handle->scheduler     = export_handle->scheduler;
+		group_handle->export_result = 0;
+
+		fprintf(
+		 export_handle->notify_stream,
+		 "Exporting logical volume: %d to: %" PRIs_SYSTEM "\n",
+		 group_handle->logical_volume_index + 1,
+		 group_handle->target_path );
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "\n" );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_handles,
+	     number_of_handles,
+	     (int (*)(intptr_t *, void *)) &export_handle_export_callback,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) handles[ handle_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push logical volume: %d onto thread pool.",
+			 function,
+			 handles[ handle_index ]->logical_volume_index + 1 );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		handles[ handle_index ]->export_result = export_handle_export_logical_volume(
+		                                          handles[ handle_index ],
+		                                          handles[ handle_index ]->target_path,
+		                                          error );
+
+		if( handles[ handle_index ]->export_result != 1 )
+		{
+			break;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		if( handles[ handle_index ]->export_result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to export logical volume: %d.",
+			 function,
+			 handles[ handle_index ]->logical_volume_index + 1 );
+
+			goto on_error;
+		}
+	}
+	for( handle_index = 0;
+	     handle_index < number_of_handles;
+	     handle_index++ )
+	{
+		if( handle_index > 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "\n" );
+		}
+		if( export_handle_print_summary(
+		     handles[ handle_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print summary of logical volume: %d.",
+			 function,
+			 handles[ handle_index ]->logical_volume_index + 1 );
+
+			goto on_error;
+		}
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "\nRead: %" PRIu64 " extents of %d logical volumes with: %" PRIu64 " seeks.\n",
+	 export_handle->scheduler->number_of_reads,
+	 number_of_handles,
+	 export_handle->scheduler->number_of_seeks );
+
+	memory_free(
+	 handles );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( handles != NULL )
+	{
+		memory_free(
+		 handles );
+	}
+	return( -1 );
+}
+
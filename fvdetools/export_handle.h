@@ -0,0 +1,532 @@
+/*
+ * Export handle
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_HANDLE_H )
+#define _EXPORT_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fvdetools_libbfio.h"
+#include "export_scheduler.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcthreads.h"
+#include "fvdetools_libfvde.h"
+#include "hash_pipeline.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to copy data (1 MiB)
+ * The buffers are shared with the hash pipeline
+ */
+#define EXPORT_HANDLE_BUFFER_SIZE		HASH_PIPELINE_BUFFER_SIZE
+
+/* The maximum size of a line in an extent map
+ */
+#define EXPORT_HANDLE_MAXIMUM_LINE_SIZE		256
+
+/* The maximum number of logical volumes that are exported concurrently
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_LOGICAL_VOLUMES	EXPORT_SCHEDULER_MAXIMUM_NUMBER_OF_READERS
+
+/* The version of the extent map format
+ */
+#define EXPORT_HANDLE_MAP_FORMAT_VERSION	1
+
+/* The version of the journal format
+ */
+#define EXPORT_HANDLE_JOURNAL_FORMAT_VERSION	1
+
+/* The amount of data written between journal sync points (64 MiB)
+ */
+#define EXPORT_HANDLE_JOURNAL_BATCH_SIZE	( 64 * 1024 * 1024 )
+
+typedef struct export_handle_extent export_handle_extent_t;
+
+struct export_handle_extent
+{
+	/* The logical offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The physical volume index
+	 */
+	int physical_volume_index;
+
+	/* The physical volume offset
+	 */
+	off64_t physical_volume_offset;
+};
+
+typedef struct export_handle_range export_handle_range_t;
+
+struct export_handle_range
+{
+	/* The logical offset
+	 */
+	off64_t offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The offset of the data in the target
+	 */
+	off64_t target_offset;
+};
+
+typedef struct export_handle export_handle_t;
+
+struct export_handle
+{
+	/* The encrypted root plist path
+	 */
+	const system_character_t *encrypted_root_plist_path;
+
+	/* The key data
+	 */
+	uint8_t key_data[ 16 ];
+
+	/* The key data size
+	 */
+	size_t key_data_size;
+
+	/* The volume offset
+	 */
+	off64_t volume_offset;
+
+	/* The recovery password
+	 */
+	const system_character_t *recovery_password;
+
+	/* The recovery password length
+	 */
+	size_t recovery_password_length;
+
+	/* The user password
+	 */
+	const system_character_t *user_password;
+
+	/* The user password length
+	 */
+	size_t user_password_length;
+
+	/* The index of the logical volume to export
+	 */
+	int logical_volume_index;
+
+	/* Value to indicate all logical volumes should be exported
+	 */
+	int all_logical_volumes;
+
+	/* The indexes of the logical volumes to export
+	 */
+	int logical_volume_indexes[ EXPORT_HANDLE_MAXIMUM_NUMBER_OF_LOGICAL_VOLUMES ];
+
+	/* The number of logical volume indexes
+	 */
+	int number_of_logical_volume_indexes;
+
+	/* The libbfio physical volume file IO pool
+	 */
+	libbfio_pool_t *physical_volume_file_io_pool;
+
+	/* The libfvde volume
+	 */
+	libfvde_volume_t *volume;
+
+	/* The volume group
+	 */
+	libfvde_volume_group_t *volume_group;
+
+	/* The logical volume
+	 */
+	libfvde_logical_volume_t *logical_volume;
+
+	/* The export handle that owns the volume, NULL if owned by this handle
+	 */
+	export_handle_t *parent_handle;
+
+	/* The export handles of the other logical volumes that are exported concurrently
+	 */
+	export_handle_t **group_handles;
+
+	/* The number of group handles
+	 */
+	int number_of_group_handles;
+
+	/* The read scheduler shared by the concurrent exports
+	 */
+	export_scheduler_t *scheduler;
+
+	/* The target path of a concurrent export
+	 */
+	system_character_t *target_path;
+
+	/* The export size
+	 */
+	size64_t export_size;
+
+	/* The result of a concurrent export
+	 */
+	int export_result;
+
+	/* The transaction identifier of the metadata
+	 */
+	uint64_t transaction_identifier;
+
+	/* The logical volume size
+	 */
+	size64_t logical_volume_size;
+
+	/* The extents of the logical volume
+	 */
+	export_handle_extent_t *extents;
+
+	/* The number of extents
+	 */
+	int number_of_extents;
+
+	/* Value to indicate a previous extent map was read
+	 */
+	int has_previous_map;
+
+	/* The transaction identifier of the previous extent map
+	 */
+	uint64_t previous_transaction_identifier;
+
+	/* The logical volume size of the previous extent map
+	 */
+	size64_t previous_logical_volume_size;
+
+	/* The extents of the previous extent map
+	 */
+	export_handle_extent_t *previous_extents;
+
+	/* The number of extents of the previous extent map
+	 */
+	int number_of_previous_extents;
+
+	/* The maximum number of extents of the previous extent map
+	 */
+	int maximum_number_of_previous_extents;
+
+	/* The ranges to export
+	 */
+	export_handle_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The maximum number of ranges
+	 */
+	int maximum_number_of_ranges;
+
+	/* Value to indicate an interrupted export should be resumed
+	 */
+	int resume;
+
+	/* The offset in the target up to which a previous export completed
+	 */
+	off64_t resume_target_offset;
+
+	/* The journal stream
+	 */
+	FILE *journal_stream;
+
+	/* The flags of the hashes to calculate
+	 */
+	int hash_flags;
+
+	/* The piece size of the piecewise hashes
+	 */
+	size64_t piece_size;
+
+	/* The hash pipeline
+	 */
+	hash_pipeline_t *hash_pipeline;
+
+	/* Value to indicate runs of zero blocks are not written to the target
+	 */
+	int sparse_output;
+
+	/* The number of bytes in runs of zero blocks that were not written
+	 */
+	size64_t zero_size;
+
+	/* The copy buffer
+	 */
+	uint8_t *buffer;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if user interaction is disabled
+	 */
+	int unattended_mode;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int export_handle_system_string_copy_from_64_bit_in_decimal(
+     const system_character_t *string,
+     size_t string_size,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int export_handle_initialize(
+     export_handle_t **export_handle,
+     int unattended_mode,
+     libcerror_error_t **error );
+
+int export_handle_free(
+     export_handle_t **export_handle,
+     libcerror_error_t **error );
+
+int export_handle_signal_abort(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_set_encrypted_root_plist(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_key(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_offset(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_password(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_recovery_password(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_logical_volumes(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_resume(
+     export_handle_t *export_handle,
+     int resume,
+     libcerror_error_t **error );
+
+int export_handle_set_hash_types(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_piece_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_sparse_output(
+     export_handle_t *export_handle,
+     int sparse_output,
+     libcerror_error_t **error );
+
+int export_handle_open(
+     export_handle_t *export_handle,
+     system_character_t * const * filenames,
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+int export_handle_open_logical_volume(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_open_group_handles(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_free_group_handles(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_close(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_unlock_logical_volume(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_read_extents(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_parse_values(
+     const char *string,
+     size_t string_length,
+     uint64_t *values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int export_handle_append_previous_extent(
+     export_handle_t *export_handle,
+     off64_t offset,
+     size64_t size,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     libcerror_error_t **error );
+
+int export_handle_read_previous_map(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_get_extent_at_offset(
+     export_handle_extent_t *extents,
+     int number_of_extents,
+     int *extent_index,
+     off64_t offset,
+     off64_t end_offset,
+     export_handle_extent_t **extent,
+     off64_t *range_end_offset,
+     libcerror_error_t **error );
+
+int export_handle_append_range(
+     export_handle_t *export_handle,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int export_handle_compute_ranges(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_sync_file_stream(
+     FILE *file_stream,
+     libcerror_error_t **error );
+
+int export_handle_create_path_with_suffix(
+     const system_character_t *path,
+     const system_character_t *suffix,
+     system_character_t **path_with_suffix,
+     libcerror_error_t **error );
+
+int export_handle_get_export_size(
+     export_handle_t *export_handle,
+     size64_t *export_size,
+     libcerror_error_t **error );
+
+int export_handle_read_journal(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_open_journal(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_close_journal(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_append_journal_line(
+     export_handle_t *export_handle,
+     const char *line,
+     libcerror_error_t **error );
+
+int export_handle_complete_batch(
+     export_handle_t *export_handle,
+     FILE *target_stream,
+     off64_t target_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int export_handle_write_target_data(
+     export_handle_t *export_handle,
+     FILE *target_stream,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t target_offset,
+     uint8_t *has_trailing_hole,
+     libcerror_error_t **error );
+
+int export_handle_extend_target(
+     FILE *target_stream,
+     off64_t target_size,
+     libcerror_error_t **error );
+
+int export_handle_export_ranges(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_write_map(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_export_logical_volume(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+int export_handle_print_summary(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_export_callback(
+     export_handle_t *export_handle,
+     export_handle_t *parent_handle );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_export(
+     export_handle_t *export_handle,
+     const system_character_t *target_path,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_HANDLE_H ) */
+
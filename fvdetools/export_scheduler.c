@@ -0,0 +1,483 @@
+/*
+ * Shared read scheduler for concurrent exports
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "export_scheduler.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcthreads.h"
+
+/* Creates an export scheduler
+ * Make sure the value export_scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_initialize(
+     export_scheduler_t **export_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_initialize";
+
+	if( export_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*export_scheduler = memory_allocate_structure(
+	                     export_scheduler_t );
+
+	if( *export_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_scheduler,
+	     0,
+	     sizeof( export_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export scheduler.",
+		 function );
+
+		memory_free(
+		 *export_scheduler );
+
+		*export_scheduler = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *export_scheduler )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *export_scheduler != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_scheduler )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *export_scheduler )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *export_scheduler );
+
+		*export_scheduler = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_free(
+     export_scheduler_t **export_scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_free";
+	int result            = 1;
+
+	if( export_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_scheduler != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *export_scheduler )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *export_scheduler )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *export_scheduler );
+
+		*export_scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Grants the next read
+ * The reads are granted in ascending physical order starting at the end of the
+ * last read and wrap around to the lowest physical offset, like an elevator
+ * Must be called with the mutex grabbed
+ */
+void export_scheduler_dispatch(
+      export_scheduler_t *export_scheduler )
+{
+	export_scheduler_request_t *request = NULL;
+	int lowest_index                    = -1;
+	int next_index                      = -1;
+	int request_index                   = 0;
+
+	if( export_scheduler == NULL )
+	{
+		return;
+	}
+	if( ( export_scheduler->busy != 0 )
+	 || ( export_scheduler->number_of_requests == 0 ) )
+	{
+		return;
+	}
+	for( request_index = 0;
+	     request_index < export_scheduler->number_of_requests;
+	     request_index++ )
+	{
+		request = export_scheduler->requests[ request_index ];
+
+		if( ( lowest_index == -1 )
+		 || ( request->physical_volume_index < export_scheduler->requests[ lowest_index ]->physical_volume_index )
+		 || ( ( request->physical_volume_index == export_scheduler->requests[ lowest_index ]->physical_volume_index )
+		  &&  ( request->physical_volume_offset < export_scheduler->requests[ lowest_index ]->physical_volume_offset ) ) )
+		{
+			lowest_index = request_index;
+		}
+		if( ( request->physical_volume_index < export_scheduler->head_physical_volume_index )
+		 || ( ( request->physical_volume_index == export_scheduler->head_physical_volume_index )
+		  &&  ( request->physical_volume_offset < export_scheduler->head_physical_volume_offset ) ) )
+		{
+			continue;
+		}
+		if( ( next_index == -1 )
+		 || ( request->physical_volume_index < export_scheduler->requests[ next_index ]->physical_volume_index )
+		 || ( ( request->physical_volume_index == export_scheduler->requests[ next_index ]->physical_volume_index )
+		  &&  ( request->physical_volume_offset < export_scheduler->requests[ next_index ]->physical_volume_offset ) ) )
+		{
+			next_index = request_index;
+		}
+	}
+	if( next_index == -1 )
+	{
+		next_index = lowest_index;
+	}
+	request = export_scheduler->requests[ next_index ];
+
+	if( ( export_scheduler->number_of_reads > 0 )
+	 && ( ( request->physical_volume_index != export_scheduler->head_physical_volume_index )
+	  ||  ( request->physical_volume_offset != export_scheduler->head_physical_volume_offset ) ) )
+	{
+		export_scheduler->number_of_seeks += 1;
+	}
+	export_scheduler->number_of_requests -= 1;
+
+	export_scheduler->requests[ next_index ] = export_scheduler->requests[ export_scheduler->number_of_requests ];
+	export_scheduler->requests[ export_scheduler->number_of_requests ] = NULL;
+
+	request->granted = 1;
+
+	export_scheduler->busy             = 1;
+	export_scheduler->number_of_reads += 1;
+}
+
+/* Waits until a read at a specific physical offset is granted
+ * Every granted read must be followed by a release
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_acquire(
+     export_scheduler_t *export_scheduler,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     libcerror_error_t **error )
+{
+	export_scheduler_request_t request;
+
+	static char *function = "export_scheduler_acquire";
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int request_index     = 0;
+#endif
+
+	if( export_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	request.physical_volume_index  = physical_volume_index;
+	request.physical_volume_offset = physical_volume_offset;
+	request.granted                = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( export_scheduler->number_of_requests >= EXPORT_SCHEDULER_MAXIMUM_NUMBER_OF_READERS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of requests value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		export_scheduler->requests[ export_scheduler->number_of_requests ] = &request;
+
+		export_scheduler->number_of_requests += 1;
+
+		export_scheduler_dispatch(
+		 export_scheduler );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		while( request.granted == 0 )
+		{
+			if( libcthreads_condition_wait(
+			     export_scheduler->condition,
+			     export_scheduler->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		/* A request that was not granted must not remain referenced
+		 */
+		if( request.granted == 0 )
+		{
+			for( request_index = 0;
+			     request_index < export_scheduler->number_of_requests;
+			     request_index++ )
+			{
+				if( export_scheduler->requests[ request_index ] == &request )
+				{
+					export_scheduler->number_of_requests -= 1;
+
+					export_scheduler->requests[ request_index ] = export_scheduler->requests[ export_scheduler->number_of_requests ];
+					export_scheduler->requests[ export_scheduler->number_of_requests ] = NULL;
+
+					break;
+				}
+			}
+		}
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     export_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a granted read
+ * The physical offset is the end of the read, from where the next read is chosen
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_release(
+     export_scheduler_t *export_scheduler,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_release";
+
+	if( export_scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export scheduler.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_scheduler->head_physical_volume_index  = physical_volume_index;
+	export_scheduler->head_physical_volume_offset = physical_volume_offset;
+	export_scheduler->busy                        = 0;
+
+	export_scheduler_dispatch(
+	 export_scheduler );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     export_scheduler->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 export_scheduler->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     export_scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
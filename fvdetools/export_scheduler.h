@@ -0,0 +1,128 @@
+/*
+ * Shared read scheduler for concurrent exports
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_SCHEDULER_H )
+#define _EXPORT_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of readers that can wait for the scheduler
+ */
+#define EXPORT_SCHEDULER_MAXIMUM_NUMBER_OF_READERS	64
+
+typedef struct export_scheduler_request export_scheduler_request_t;
+
+struct export_scheduler_request
+{
+	/* The physical volume index
+	 */
+	int physical_volume_index;
+
+	/* The physical volume offset
+	 */
+	off64_t physical_volume_offset;
+
+	/* Value to indicate the read was granted
+	 */
+	int granted;
+};
+
+typedef struct export_scheduler export_scheduler_t;
+
+struct export_scheduler
+{
+	/* The requests that wait to be granted
+	 */
+	export_scheduler_request_t *requests[ EXPORT_SCHEDULER_MAXIMUM_NUMBER_OF_READERS ];
+
+	/* The number of requests that wait to be granted
+	 */
+	int number_of_requests;
+
+	/* Value to indicate a read is in progress
+	 */
+	int busy;
+
+	/* The physical volume index of the end of the last read
+	 */
+	int head_physical_volume_index;
+
+	/* The physical volume offset of the end of the last read
+	 */
+	off64_t head_physical_volume_offset;
+
+	/* The number of reads
+	 */
+	uint64_t number_of_reads;
+
+	/* The number of reads that did not continue the last read
+	 */
+	uint64_t number_of_seeks;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Mutex protecting the requests and the head
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* Condition signalled when a read was granted
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int export_scheduler_initialize(
+     export_scheduler_t **export_scheduler,
+     libcerror_error_t **error );
+
+int export_scheduler_free(
+     export_scheduler_t **export_scheduler,
+     libcerror_error_t **error );
+
+void export_scheduler_dispatch(
+      export_scheduler_t *export_scheduler );
+
+int export_scheduler_acquire(
+     export_scheduler_t *export_scheduler,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     libcerror_error_t **error );
+
+int export_scheduler_release(
+     export_scheduler_t *export_scheduler,
+     int physical_volume_index,
+     off64_t physical_volume_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_SCHEDULER_H ) */
+
@@ -75,6 +75,9 @@ void usage_fprint(
 	                 "                 [ --order=ORDER ] [ --stop-at-block=N ]\n"
 	                 "                 [ --stop-at-transaction=ID ]\n"
 	                 "                 [ --lookup-linux-sector=N ]\n"
+	                 "                 [ --lookup-file=FILE ] [ --lookup-unit=UNIT ]\n"
+	                 "                 [ --scan ] [ --scan-verify ] [ --scan-threads=N ]\n"
+	                 "                 [ --scan-slow-threshold=MS ]\n"
 	                 "                 [ --dump-allocation-map ] [ --json ]\n"
 	                 "                 [ -hquvV ] sources\n\n" );
 
@@ -104,6 +107,20 @@ void usage_fprint(
 
 	fprintf( stream, "\nBLOCK LOOKUP:\n" );
 	fprintf( stream, "\t--lookup-linux-sector=N    Look up Linux 512-byte sector N\n" );
+	fprintf( stream, "\t--lookup-file=FILE         Look up all values in FILE, one per line, in a\n" );
+	fprintf( stream, "\t                           single pass, use - to read from stdin\n" );
+	fprintf( stream, "\t--lookup-unit=UNIT         Unit of the values in the lookup file:\n" );
+	fprintf( stream, "\t                           sector (Linux 512-byte sectors, default)\n" );
+	fprintf( stream, "\t                           block (FVDE physical blocks)\n" );
+
+	fprintf( stream, "\nSURFACE SCAN:\n" );
+	fprintf( stream, "\t--scan                     Read all allocated extents and report unreadable\n" );
+	fprintf( stream, "\t                           and slow regions\n" );
+	fprintf( stream, "\t--scan-verify              Scan and check the decrypted file system headers\n" );
+	fprintf( stream, "\t                           of the logical volumes (requires a key)\n" );
+	fprintf( stream, "\t--scan-threads=N           Number of concurrent reads (default is 4)\n" );
+	fprintf( stream, "\t--scan-slow-threshold=MS   Report reads of a 1 MiB chunk that take longer\n" );
+	fprintf( stream, "\t                           than MS milliseconds (default is 1000)\n" );
 
 	fprintf( stream, "\nOUTPUT OPTIONS:\n" );
 	fprintf( stream, "\t--dump-allocation-map      Dump full allocation map after processing\n" );
@@ -173,6 +190,10 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_stop_at_block             = NULL;
 	system_character_t *option_stop_at_transaction       = NULL;
 	system_character_t *option_lookup_linux_sector       = NULL;
+	system_character_t *option_lookup_file               = NULL;
+	system_character_t *option_lookup_unit               = NULL;
+	system_character_t *option_scan_threads              = NULL;
+	system_character_t *option_scan_slow_threshold       = NULL;
 	char *program                                        = "fvdecheck";
 	system_integer_t option                              = 0;
 	int number_of_sources                                = 0;
@@ -181,6 +202,8 @@ int main( int argc, char * const argv[] )
 	int quiet_mode                                       = 0;
 	int json_mode                                        = 0;
 	int dump_allocation_map                              = 0;
+	int surface_scan                                     = 0;
+	int surface_scan_verify                              = 0;
 	int option_index                                     = 0;
 
 #if defined( HAVE_GETOPT_LONG )
@@ -189,8 +212,14 @@ int main( int argc, char * const argv[] )
 		{ "stop-at-block",         required_argument, NULL, 'B' },
 		{ "stop-at-transaction",   required_argument, NULL, 'T' },
 		{ "lookup-linux-sector",   required_argument, NULL, 'L' },
+		{ "lookup-file",           required_argument, NULL, 'F' },
+		{ "lookup-unit",           required_argument, NULL, 'U' },
 		{ "dump-allocation-map",   no_argument,       NULL, 'D' },
 		{ "json",                  no_argument,       NULL, 'J' },
+		{ "scan",                  no_argument,       NULL, 'S' },
+		{ "scan-verify",           no_argument,       NULL, 'Y' },
+		{ "scan-threads",          required_argument, NULL, 'N' },
+		{ "scan-slow-threshold",   required_argument, NULL, 'W' },
 		{ "help",                  no_argument,       NULL, 'h' },
 		{ "verbose",               no_argument,       NULL, 'v' },
 		{ "version",               no_argument,       NULL, 'V' },
@@ -329,6 +358,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'F':
+				option_lookup_file = optarg;
+
+				break;
+
+			case (system_integer_t) 'U':
+				option_lookup_unit = optarg;
+
+				break;
+
 			case (system_integer_t) 'D':
 				dump_allocation_map = 1;
 
@@ -337,6 +376,27 @@ int main( int argc, char * const argv[] )
 			case (system_integer_t) 'J':
 				json_mode = 1;
 
+				break;
+
+			case (system_integer_t) 'S':
+				surface_scan = 1;
+
+				break;
+
+			case (system_integer_t) 'Y':
+				surface_scan        = 1;
+				surface_scan_verify = 1;
+
+				break;
+
+			case (system_integer_t) 'N':
+				option_scan_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'W':
+				option_scan_slow_threshold = optarg;
+
 				break;
 		}
 	}
@@ -377,6 +437,8 @@ int main( int argc, char * const argv[] )
 	fvdecheck_check_handle->quiet_mode = quiet_mode;
 	fvdecheck_check_handle->json_mode = json_mode;
 	fvdecheck_check_handle->dump_allocation_map = dump_allocation_map;
+	fvdecheck_check_handle->surface_scan = surface_scan;
+	fvdecheck_check_handle->surface_scan_verify = surface_scan_verify;
 
 	if( option_encrypted_root_plist_path != NULL )
 	{
@@ -504,6 +566,63 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_lookup_unit != NULL )
+	{
+		if( check_handle_set_lookup_unit(
+		     fvdecheck_check_handle,
+		     option_lookup_unit,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set lookup-unit.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_lookup_file != NULL )
+	{
+		if( check_handle_set_lookup_file(
+		     fvdecheck_check_handle,
+		     option_lookup_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read lookup file: %" PRIs_SYSTEM ".\n",
+			 option_lookup_file );
+
+			goto on_error;
+		}
+	}
+	if( option_scan_threads != NULL )
+	{
+		if( check_handle_set_scan_threads(
+		     fvdecheck_check_handle,
+		     option_scan_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set scan-threads.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_scan_slow_threshold != NULL )
+	{
+		if( check_handle_set_scan_slow_threshold(
+		     fvdecheck_check_handle,
+		     option_scan_slow_threshold,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set scan-slow-threshold.\n" );
+
+			goto on_error;
+		}
+	}
 	if( !quiet_mode && !json_mode )
 	{
 		fprintf(
@@ -569,6 +688,34 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	/* Perform batch block lookup if requested */
+	if( fvdecheck_check_handle->lookup != NULL )
+	{
+		if( check_handle_lookup_batch(
+		     fvdecheck_check_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to perform batch block lookup.\n" );
+
+			goto on_error;
+		}
+	}
+	/* Perform surface scan if requested */
+	if( fvdecheck_check_handle->surface_scan )
+	{
+		if( check_handle_scan_surface(
+		     fvdecheck_check_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan surface.\n" );
+
+			goto on_error;
+		}
+	}
 	/* Print output based on mode */
 	if( json_mode )
 	{
@@ -0,0 +1,653 @@
+/*
+ * Batch block lookup for fvdecheck
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvdecheck_extent.h"
+#include "fvdecheck_lookup.h"
+#include "fvdetools_libcerror.h"
+
+/* Initialize lookup
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_lookup_initialize(
+     fvdecheck_lookup_t **lookup,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_lookup_initialize";
+
+	if( lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lookup != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid lookup value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*lookup = memory_allocate_structure(
+	           fvdecheck_lookup_t );
+
+	if( *lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *lookup,
+	     0,
+	     sizeof( fvdecheck_lookup_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lookup.",
+		 function );
+
+		memory_free(
+		 *lookup );
+
+		*lookup = NULL;
+
+		return( -1 );
+	}
+	( *lookup )->unit = FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR;
+
+	return( 1 );
+}
+
+/* Free lookup
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_lookup_free(
+     fvdecheck_lookup_t **lookup,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_lookup_free";
+
+	if( lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( *lookup != NULL )
+	{
+		if( ( *lookup )->entries != NULL )
+		{
+			memory_free(
+			 ( *lookup )->entries );
+		}
+		memory_free(
+		 *lookup );
+
+		*lookup = NULL;
+	}
+	return( 1 );
+}
+
+/* Append a value to look up
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_lookup_append_value(
+     fvdecheck_lookup_t *lookup,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	fvdecheck_lookup_entry_t *entries = NULL;
+	static char *function             = "fvdecheck_lookup_append_value";
+	int maximum_number_of_entries     = 0;
+
+	if( lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup->number_of_entries >= lookup->maximum_number_of_entries )
+	{
+		if( lookup->maximum_number_of_entries == 0 )
+		{
+			maximum_number_of_entries = 1024;
+		}
+		else if( lookup->maximum_number_of_entries < FVDECHECK_LOOKUP_MAXIMUM_NUMBER_OF_ENTRIES )
+		{
+			maximum_number_of_entries = lookup->maximum_number_of_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: too many entries.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (fvdecheck_lookup_entry_t *) memory_reallocate(
+		                                        lookup->entries,
+		                                        sizeof( fvdecheck_lookup_entry_t ) * maximum_number_of_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		lookup->entries                   = entries;
+		lookup->maximum_number_of_entries = maximum_number_of_entries;
+	}
+	lookup->entries[ lookup->number_of_entries ].value           = value;
+	lookup->entries[ lookup->number_of_entries ].block_number    = 0;
+	lookup->entries[ lookup->number_of_entries ].offset_in_block = 0;
+	lookup->entries[ lookup->number_of_entries ].extent          = NULL;
+
+	lookup->number_of_entries += 1;
+	lookup->resolved           = 0;
+
+	return( 1 );
+}
+
+/* Compare entries by physical block number and value */
+static int fvdecheck_lookup_compare_entries(
+            const void *first,
+            const void *second )
+{
+	const fvdecheck_lookup_entry_t *first_entry  = (const fvdecheck_lookup_entry_t *) first;
+	const fvdecheck_lookup_entry_t *second_entry = (const fvdecheck_lookup_entry_t *) second;
+
+	if( first_entry->block_number != second_entry->block_number )
+	{
+		return( ( first_entry->block_number < second_entry->block_number ) ? -1 : 1 );
+	}
+	if( first_entry->value != second_entry->value )
+	{
+		return( ( first_entry->value < second_entry->value ) ? -1 : 1 );
+	}
+	return( 0 );
+}
+
+/* Resolve all values against the physical extents
+ * The entries are sorted by physical block number so that the sorted
+ * extent list of the physical volume is only walked once
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_lookup_resolve(
+     fvdecheck_lookup_t *lookup,
+     fvdecheck_volume_state_t *volume_state,
+     libcerror_error_t **error )
+{
+	fvdecheck_extent_t *extent      = NULL;
+	fvdecheck_lookup_entry_t *entry = NULL;
+	static char *function           = "fvdecheck_lookup_resolve";
+	uint64_t byte_offset            = 0;
+	int entry_index                 = 0;
+
+	if( lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume state.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_state->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume state - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( lookup->unit != FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR )
+	 && ( lookup->unit != FVDECHECK_LOOKUP_UNIT_BLOCK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported unit.",
+		 function );
+
+		return( -1 );
+	}
+	lookup->block_size                  = volume_state->block_size;
+	lookup->number_of_allocated_entries = 0;
+	lookup->number_of_free_entries      = 0;
+	lookup->number_of_reserved_entries  = 0;
+	lookup->number_of_unknown_entries   = 0;
+
+	for( entry_index = 0;
+	     entry_index < lookup->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( lookup->entries[ entry_index ] );
+
+		if( lookup->unit == FVDECHECK_LOOKUP_UNIT_BLOCK )
+		{
+			entry->block_number    = entry->value;
+			entry->offset_in_block = 0;
+		}
+		else
+		{
+			if( entry->value > ( (uint64_t) UINT64_MAX / 512 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: Linux sector: %" PRIu64 " value out of bounds.",
+				 function,
+				 entry->value );
+
+				return( -1 );
+			}
+			byte_offset = entry->value * 512;
+
+			entry->block_number    = byte_offset / volume_state->block_size;
+			entry->offset_in_block = (uint32_t) ( byte_offset % volume_state->block_size );
+		}
+		entry->extent = NULL;
+	}
+	if( lookup->number_of_entries > 1 )
+	{
+		qsort(
+		 lookup->entries,
+		 (size_t) lookup->number_of_entries,
+		 sizeof( fvdecheck_lookup_entry_t ),
+		 &fvdecheck_lookup_compare_entries );
+	}
+	if( lookup->pv_index < volume_state->num_physical_volumes )
+	{
+		extent = volume_state->physical_volumes[ lookup->pv_index ].extent_list_head;
+	}
+	for( entry_index = 0;
+	     entry_index < lookup->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( lookup->entries[ entry_index ] );
+
+		/* An extent that ends before this block also ends before all following blocks
+		 */
+		while( ( extent != NULL )
+		    && ( ( extent->physical_block_start + extent->physical_block_count ) <= entry->block_number ) )
+		{
+			extent = extent->phys_next;
+		}
+		if( ( extent != NULL )
+		 && ( extent->physical_block_start <= entry->block_number ) )
+		{
+			entry->extent = extent;
+		}
+		if( entry->extent == NULL )
+		{
+			lookup->number_of_unknown_entries += 1;
+		}
+		else if( entry->extent->state == FVDECHECK_EXTENT_STATE_ALLOCATED )
+		{
+			lookup->number_of_allocated_entries += 1;
+		}
+		else if( entry->extent->state == FVDECHECK_EXTENT_STATE_FREE )
+		{
+			lookup->number_of_free_entries += 1;
+		}
+		else if( entry->extent->state == FVDECHECK_EXTENT_STATE_RESERVED )
+		{
+			lookup->number_of_reserved_entries += 1;
+		}
+		else
+		{
+			lookup->number_of_unknown_entries += 1;
+		}
+	}
+	lookup->resolved = 1;
+
+	return( 1 );
+}
+
+/* Print lookup results
+ * One tab separated line is printed per entry in physical block order
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_lookup_print(
+     fvdecheck_lookup_t *lookup,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	fvdecheck_lookup_entry_t *entry = NULL;
+	static char *function           = "fvdecheck_lookup_print";
+	uint64_t logical_block          = 0;
+	int entry_index                 = 0;
+
+	if( lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup->resolved == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid lookup - entries not resolved.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf( stream, "\nBlock Lookup:\n" );
+
+	fprintf(
+	 stream,
+	 "  Entries:            %d (%s)\n",
+	 lookup->number_of_entries,
+	 fvdecheck_lookup_unit_to_string( lookup->unit ) );
+
+	fprintf(
+	 stream,
+	 "  Physical volume:    %" PRIu32 "\n",
+	 lookup->pv_index );
+
+	fprintf(
+	 stream,
+	 "  Allocated:          %d\n",
+	 lookup->number_of_allocated_entries );
+
+	fprintf(
+	 stream,
+	 "  Free:               %d\n",
+	 lookup->number_of_free_entries );
+
+	fprintf(
+	 stream,
+	 "  Reserved:           %d\n",
+	 lookup->number_of_reserved_entries );
+
+	fprintf(
+	 stream,
+	 "  Unknown:            %d\n",
+	 lookup->number_of_unknown_entries );
+
+	fprintf(
+	 stream,
+	 "\n# %s\tphysical block\tstate\tlogical volume\tlogical block\tlogical offset\tprovenance\n",
+	 ( lookup->unit == FVDECHECK_LOOKUP_UNIT_BLOCK ) ? "block" : "sector" );
+
+	for( entry_index = 0;
+	     entry_index < lookup->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( lookup->entries[ entry_index ] );
+
+		fprintf(
+		 stream,
+		 "%" PRIu64 "\t%" PRIu64 "\t",
+		 entry->value,
+		 entry->block_number );
+
+		if( entry->extent == NULL )
+		{
+			fprintf(
+			 stream,
+			 "UNKNOWN\t-\t-\t-\t-\n" );
+
+			continue;
+		}
+		fprintf(
+		 stream,
+		 "%s\t",
+		 fvdecheck_extent_state_to_string( entry->extent->state ) );
+
+		if( entry->extent->state == FVDECHECK_EXTENT_STATE_ALLOCATED )
+		{
+			logical_block = entry->extent->logical_block_start
+			              + ( entry->block_number - entry->extent->physical_block_start );
+
+			fprintf(
+			 stream,
+			 "%" PRIu32 "\t%" PRIu64 "\t%" PRIu64 "\t",
+			 entry->extent->logical_volume_index,
+			 logical_block,
+			 ( logical_block * lookup->block_size ) + entry->offset_in_block );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "-\t-\t-\t" );
+		}
+		if( entry->extent->state == FVDECHECK_EXTENT_STATE_RESERVED )
+		{
+			fprintf(
+			 stream,
+			 "%s\n",
+			 entry->extent->reserved_description != NULL ? entry->extent->reserved_description : "Unknown" );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "Transaction %" PRIu64 ", 0x%04" PRIx16 "\n",
+			 entry->extent->transaction_id,
+			 entry->extent->block_type );
+		}
+	}
+	fprintf( stream, "\n" );
+
+	return( 1 );
+}
+
+/* Print lookup results as a JSON object member
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_lookup_print_json(
+     fvdecheck_lookup_t *lookup,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	fvdecheck_lookup_entry_t *entry = NULL;
+	static char *function           = "fvdecheck_lookup_print_json";
+	uint64_t logical_block          = 0;
+	int entry_index                 = 0;
+
+	if( lookup == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid lookup.",
+		 function );
+
+		return( -1 );
+	}
+	if( lookup->resolved == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid lookup - entries not resolved.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf( stream, "  \"block_lookup\": {\n" );
+	fprintf( stream, "    \"unit\": \"%s\",\n",
+	         ( lookup->unit == FVDECHECK_LOOKUP_UNIT_BLOCK ) ? "block" : "sector" );
+	fprintf( stream, "    \"pv_index\": %" PRIu32 ",\n", lookup->pv_index );
+	fprintf( stream, "    \"allocated\": %d,\n", lookup->number_of_allocated_entries );
+	fprintf( stream, "    \"free\": %d,\n", lookup->number_of_free_entries );
+	fprintf( stream, "    \"reserved\": %d,\n", lookup->number_of_reserved_entries );
+	fprintf( stream, "    \"unknown\": %d,\n", lookup->number_of_unknown_entries );
+	fprintf( stream, "    \"entries\": [\n" );
+
+	for( entry_index = 0;
+	     entry_index < lookup->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( lookup->entries[ entry_index ] );
+
+		fprintf( stream, "      { \"value\": %" PRIu64 ", \"block\": %" PRIu64 ", \"state\": \"%s\"",
+		         entry->value,
+		         entry->block_number,
+		         ( entry->extent != NULL ) ? fvdecheck_extent_state_to_string( entry->extent->state ) : "UNKNOWN" );
+
+		if( ( entry->extent != NULL )
+		 && ( entry->extent->state == FVDECHECK_EXTENT_STATE_ALLOCATED ) )
+		{
+			logical_block = entry->extent->logical_block_start
+			              + ( entry->block_number - entry->extent->physical_block_start );
+
+			fprintf( stream, ", \"lv_index\": %" PRIu32 ", \"logical_block\": %" PRIu64 ", \"logical_offset\": %" PRIu64 "",
+			         entry->extent->logical_volume_index,
+			         logical_block,
+			         ( logical_block * lookup->block_size ) + entry->offset_in_block );
+		}
+		if( entry->extent != NULL )
+		{
+			if( entry->extent->state == FVDECHECK_EXTENT_STATE_RESERVED )
+			{
+				fprintf( stream, ", \"reserved_description\": \"%s\"",
+				         entry->extent->reserved_description != NULL ? entry->extent->reserved_description : "Unknown" );
+			}
+			else
+			{
+				fprintf( stream, ", \"transaction_id\": %" PRIu64 ", \"block_type\": %" PRIu16 "",
+				         entry->extent->transaction_id,
+				         entry->extent->block_type );
+			}
+		}
+		fprintf( stream, " }%s\n",
+		         ( entry_index < lookup->number_of_entries - 1 ) ? "," : "" );
+	}
+	fprintf( stream, "    ]\n" );
+	fprintf( stream, "  },\n" );
+
+	return( 1 );
+}
+
+/* Get unit name string */
+const char *fvdecheck_lookup_unit_to_string(
+             int unit )
+{
+	switch( unit )
+	{
+		case FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR:
+			return( "Linux 512-byte sectors" );
+
+		case FVDECHECK_LOOKUP_UNIT_BLOCK:
+			return( "FVDE physical blocks" );
+
+		default:
+			return( "unknown" );
+	}
+}
+
@@ -0,0 +1,138 @@
+/*
+ * Batch block lookup for fvdecheck
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FVDECHECK_LOOKUP_H )
+#define _FVDECHECK_LOOKUP_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fvdecheck_extent.h"
+#include "fvdetools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Maximum size of a line in a lookup file */
+#define FVDECHECK_LOOKUP_MAXIMUM_LINE_SIZE            128
+
+/* Maximum number of values in a lookup */
+#define FVDECHECK_LOOKUP_MAXIMUM_NUMBER_OF_ENTRIES    ( 64 * 1024 * 1024 )
+
+/* Unit of the values to look up */
+enum fvdecheck_lookup_unit
+{
+	FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR = 0,
+	FVDECHECK_LOOKUP_UNIT_BLOCK        = 1
+};
+
+typedef struct fvdecheck_lookup_entry fvdecheck_lookup_entry_t;
+
+struct fvdecheck_lookup_entry
+{
+	/* Value as read from the input */
+	uint64_t value;
+
+	/* Physical block number */
+	uint64_t block_number;
+
+	/* Byte offset of the value within the block */
+	uint32_t offset_in_block;
+
+	/* Extent containing the block, NULL if not in any tracked extent (not owned) */
+	fvdecheck_extent_t *extent;
+};
+
+typedef struct fvdecheck_lookup fvdecheck_lookup_t;
+
+struct fvdecheck_lookup
+{
+	/* Unit of the values */
+	int unit;
+
+	/* Physical volume the values refer to */
+	uint32_t pv_index;
+
+	/* Block size of the volume state the entries were resolved against */
+	uint32_t block_size;
+
+	/* Entries */
+	fvdecheck_lookup_entry_t *entries;
+	int number_of_entries;
+	int maximum_number_of_entries;
+
+	/* Value to indicate the entries were resolved */
+	int resolved;
+
+	/* Statistics per extent state */
+	int number_of_allocated_entries;
+	int number_of_free_entries;
+	int number_of_reserved_entries;
+	int number_of_unknown_entries;
+};
+
+/* Initialize lookup */
+int fvdecheck_lookup_initialize(
+     fvdecheck_lookup_t **lookup,
+     libcerror_error_t **error );
+
+/* Free lookup */
+int fvdecheck_lookup_free(
+     fvdecheck_lookup_t **lookup,
+     libcerror_error_t **error );
+
+/* Append a value to look up */
+int fvdecheck_lookup_append_value(
+     fvdecheck_lookup_t *lookup,
+     uint64_t value,
+     libcerror_error_t **error );
+
+/* Resolve all values against the physical extents */
+int fvdecheck_lookup_resolve(
+     fvdecheck_lookup_t *lookup,
+     fvdecheck_volume_state_t *volume_state,
+     libcerror_error_t **error );
+
+/* Print lookup results */
+int fvdecheck_lookup_print(
+     fvdecheck_lookup_t *lookup,
+     FILE *stream,
+     libcerror_error_t **error );
+
+/* Print lookup results as a JSON object member */
+int fvdecheck_lookup_print_json(
+     fvdecheck_lookup_t *lookup,
+     FILE *stream,
+     libcerror_error_t **error );
+
+/* Get unit name string */
+const char *fvdecheck_lookup_unit_to_string(
+     int unit );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FVDECHECK_LOOKUP_H ) */
+
@@ -0,0 +1,1877 @@
+/*
+ * Surface scan of the allocated extents for fvdecheck
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_TIME_H )
+#include <sys/time.h>
+#endif
+
+#include "fvdecheck_extent.h"
+#include "fvdecheck_scan.h"
+#include "fvdetools_libbfio.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcnotify.h"
+#include "fvdetools_libcthreads.h"
+#include "fvdetools_libfvde.h"
+
+/* Initialize scan
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_initialize(
+     fvdecheck_scan_t **scan,
+     libbfio_pool_t *file_io_pool,
+     fvdecheck_volume_state_t *volume_state,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_scan_initialize";
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume state.",
+		 function );
+
+		return( -1 );
+	}
+	*scan = memory_allocate_structure(
+	         fvdecheck_scan_t );
+
+	if( *scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *scan,
+	     0,
+	     sizeof( fvdecheck_scan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan.",
+		 function );
+
+		memory_free(
+		 *scan );
+
+		*scan = NULL;
+
+		return( -1 );
+	}
+	( *scan )->file_io_pool      = file_io_pool;
+	( *scan )->volume_state      = volume_state;
+	( *scan )->number_of_threads = FVDECHECK_SCAN_DEFAULT_NUMBER_OF_THREADS;
+	( *scan )->slow_threshold    = FVDECHECK_SCAN_DEFAULT_SLOW_THRESHOLD;
+	( *scan )->last_progress     = -1;
+
+	return( 1 );
+}
+
+/* Free scan
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_free(
+     fvdecheck_scan_t **scan,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_scan_free";
+	int slot_index        = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan != NULL )
+	{
+		/* Slots are normally released at the end of the run */
+		for( slot_index = 0;
+		     slot_index < FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS;
+		     slot_index++ )
+		{
+			if( ( *scan )->slots[ slot_index ].file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &( ( *scan )->slots[ slot_index ].file_io_handle ),
+				 NULL );
+			}
+			if( ( *scan )->slots[ slot_index ].buffer != NULL )
+			{
+				memory_free(
+				 ( *scan )->slots[ slot_index ].buffer );
+			}
+		}
+		if( ( *scan )->regions != NULL )
+		{
+			memory_free(
+			 ( *scan )->regions );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *scan )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *scan )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *scan );
+
+		*scan = NULL;
+	}
+	return( 1 );
+}
+
+/* Signal abort
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_signal_abort(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_scan_signal_abort";
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	scan->abort = 1;
+
+	return( 1 );
+}
+
+/* Grab the scan mutex, does nothing if the scan is single threaded
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_grab(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_scan_grab";
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan->mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     scan->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Release the scan mutex, does nothing if the scan is single threaded
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_release(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_scan_release";
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan->mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     scan->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Get the current time in milliseconds */
+uint64_t fvdecheck_scan_get_current_time(
+          void )
+{
+#if defined( WINAPI )
+	return( (uint64_t) GetTickCount() );
+#else
+	struct timeval time_value;
+
+	if( gettimeofday(
+	     &time_value,
+	     NULL ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000 ) + ( (uint64_t) time_value.tv_usec / 1000 ) );
+#endif
+}
+
+/* Append an unreadable or slow region
+ * The caller must hold the scan mutex
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_append_region(
+     fvdecheck_scan_t *scan,
+     int type,
+     uint32_t pv_index,
+     uint64_t offset,
+     uint64_t size,
+     uint64_t duration,
+     libcerror_error_t **error )
+{
+	fvdecheck_scan_region_t *last_region = NULL;
+	fvdecheck_scan_region_t *regions     = NULL;
+	static char *function                = "fvdecheck_scan_append_region";
+	int maximum_number_of_regions        = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	/* Merge with the last region if it is adjacent */
+	if( scan->number_of_regions > 0 )
+	{
+		last_region = &( scan->regions[ scan->number_of_regions - 1 ] );
+
+		if( ( last_region->type == type )
+		 && ( last_region->pv_index == pv_index )
+		 && ( ( last_region->offset + last_region->size ) == offset ) )
+		{
+			last_region->size += size;
+
+			if( duration > last_region->duration )
+			{
+				last_region->duration = duration;
+			}
+			return( 1 );
+		}
+	}
+	if( scan->number_of_regions >= scan->maximum_number_of_regions )
+	{
+		if( scan->maximum_number_of_regions == 0 )
+		{
+			maximum_number_of_regions = 64;
+		}
+		else if( scan->maximum_number_of_regions < ( 1024 * 1024 ) )
+		{
+			maximum_number_of_regions = scan->maximum_number_of_regions * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: too many regions.",
+			 function );
+
+			return( -1 );
+		}
+		regions = (fvdecheck_scan_region_t *) memory_reallocate(
+		                                       scan->regions,
+		                                       sizeof( fvdecheck_scan_region_t ) * maximum_number_of_regions );
+
+		if( regions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize regions.",
+			 function );
+
+			return( -1 );
+		}
+		scan->regions                   = regions;
+		scan->maximum_number_of_regions = maximum_number_of_regions;
+	}
+	scan->regions[ scan->number_of_regions ].type     = type;
+	scan->regions[ scan->number_of_regions ].pv_index = pv_index;
+	scan->regions[ scan->number_of_regions ].offset   = offset;
+	scan->regions[ scan->number_of_regions ].size     = size;
+	scan->regions[ scan->number_of_regions ].duration = duration;
+
+	scan->number_of_regions += 1;
+
+	return( 1 );
+}
+
+/* Compare regions by physical volume and offset */
+static int fvdecheck_scan_compare_regions(
+            const void *first,
+            const void *second )
+{
+	const fvdecheck_scan_region_t *first_region  = (const fvdecheck_scan_region_t *) first;
+	const fvdecheck_scan_region_t *second_region = (const fvdecheck_scan_region_t *) second;
+
+	if( first_region->pv_index != second_region->pv_index )
+	{
+		return( ( first_region->pv_index < second_region->pv_index ) ? -1 : 1 );
+	}
+	if( first_region->offset != second_region->offset )
+	{
+		return( ( first_region->offset < second_region->offset ) ? -1 : 1 );
+	}
+	return( first_region->type - second_region->type );
+}
+
+/* Sort the regions in physical order and merge adjacent regions
+ * Concurrent readers can finish out of order so regions are only merged here
+ */
+static void fvdecheck_scan_sort_regions(
+             fvdecheck_scan_t *scan )
+{
+	fvdecheck_scan_region_t *last_region = NULL;
+	fvdecheck_scan_region_t *region      = NULL;
+	int number_of_regions                = 0;
+	int region_index                     = 0;
+
+	if( scan->number_of_regions <= 1 )
+	{
+		return;
+	}
+	qsort(
+	 scan->regions,
+	 (size_t) scan->number_of_regions,
+	 sizeof( fvdecheck_scan_region_t ),
+	 &fvdecheck_scan_compare_regions );
+
+	for( region_index = 0;
+	     region_index < scan->number_of_regions;
+	     region_index++ )
+	{
+		region = &( scan->regions[ region_index ] );
+
+		if( ( last_region != NULL )
+		 && ( last_region->type == region->type )
+		 && ( last_region->pv_index == region->pv_index )
+		 && ( ( last_region->offset + last_region->size ) == region->offset ) )
+		{
+			last_region->size += region->size;
+
+			if( region->duration > last_region->duration )
+			{
+				last_region->duration = region->duration;
+			}
+			continue;
+		}
+		last_region = &( scan->regions[ number_of_regions ] );
+
+		if( last_region != region )
+		{
+			*last_region = *region;
+		}
+		number_of_regions++;
+	}
+	scan->number_of_regions = number_of_regions;
+}
+
+/* Read data from a slot or the file IO pool
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t fvdecheck_scan_read_buffer_at_offset(
+         fvdecheck_scan_t *scan,
+         fvdecheck_scan_slot_t *slot,
+         uint32_t pv_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "fvdecheck_scan_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot->file_io_handle != NULL )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              slot->file_io_handle,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+	}
+	else
+	{
+		read_count = libbfio_pool_read_buffer_at_offset(
+		              scan->file_io_pool,
+		              (int) pv_index,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+	}
+	return( read_count );
+}
+
+/* Print the progress and estimated time remaining
+ * The caller must hold the scan mutex
+ */
+static void fvdecheck_scan_print_progress(
+             fvdecheck_scan_t *scan )
+{
+	uint64_t elapsed_time      = 0;
+	uint64_t bytes_per_second  = 0;
+	uint64_t remaining_seconds = 0;
+	int progress               = 0;
+
+	if( ( scan->progress_stream == NULL )
+	 || ( scan->total_size == 0 ) )
+	{
+		return;
+	}
+	progress = (int) ( ( scan->scanned_size * 100 ) / scan->total_size );
+
+	if( progress == scan->last_progress )
+	{
+		return;
+	}
+	scan->last_progress = progress;
+
+	elapsed_time = fvdecheck_scan_get_current_time() - scan->start_time;
+
+	if( elapsed_time > 0 )
+	{
+		bytes_per_second = ( scan->scanned_size * 1000 ) / elapsed_time;
+	}
+	if( bytes_per_second > 0 )
+	{
+		remaining_seconds = ( scan->total_size - scan->scanned_size ) / bytes_per_second;
+	}
+	fprintf(
+	 scan->progress_stream,
+	 "\rScanned: %3d%% (%" PRIu64 " of %" PRIu64 " MiB) at %" PRIu64 " MiB/s, ETA: %02" PRIu64 ":%02" PRIu64 ":%02" PRIu64 " ",
+	 progress,
+	 scan->scanned_size / ( 1024 * 1024 ),
+	 scan->total_size / ( 1024 * 1024 ),
+	 bytes_per_second / ( 1024 * 1024 ),
+	 remaining_seconds / 3600,
+	 ( remaining_seconds / 60 ) % 60,
+	 remaining_seconds % 60 );
+
+	fflush(
+	 scan->progress_stream );
+}
+
+/* Read a chunk and record the unreadable and slow regions
+ * A chunk that cannot be read is re-read per block to locate the unreadable blocks
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_read_chunk(
+     fvdecheck_scan_t *scan,
+     fvdecheck_scan_slot_t *slot,
+     fvdecheck_scan_chunk_t *chunk,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "fvdecheck_scan_read_chunk";
+	uint64_t block_offset         = 0;
+	uint64_t duration             = 0;
+	uint64_t start_time           = 0;
+	size_t block_size             = 0;
+	ssize_t read_count            = 0;
+	int is_locked                 = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid slot.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk == NULL )
+	 || ( chunk->size == 0 )
+	 || ( chunk->size > FVDECHECK_SCAN_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	start_time = fvdecheck_scan_get_current_time();
+
+	read_count = fvdecheck_scan_read_buffer_at_offset(
+	              scan,
+	              slot,
+	              chunk->pv_index,
+	              slot->buffer,
+	              (size_t) chunk->size,
+	              (off64_t) chunk->offset,
+	              &read_error );
+
+	duration = fvdecheck_scan_get_current_time() - start_time;
+
+	if( read_error != NULL )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( fvdecheck_scan_grab(
+	     scan,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	is_locked = 1;
+
+	if( read_count != (ssize_t) chunk->size )
+	{
+		/* Narrow the failure down to the unreadable blocks */
+		block_size = (size_t) scan->volume_state->block_size;
+
+		if( block_size == 0 )
+		{
+			block_size = 4096;
+		}
+		for( block_offset = 0;
+		     block_offset < chunk->size;
+		     block_offset += block_size )
+		{
+			if( scan->abort != 0 )
+			{
+				break;
+			}
+			if( block_size > ( chunk->size - block_offset ) )
+			{
+				block_size = (size_t) ( chunk->size - block_offset );
+			}
+			/* Do not hold the mutex while reading */
+			if( fvdecheck_scan_release(
+			     scan,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			is_locked = 0;
+
+			read_count = fvdecheck_scan_read_buffer_at_offset(
+			              scan,
+			              slot,
+			              chunk->pv_index,
+			              slot->buffer,
+			              block_size,
+			              (off64_t) ( chunk->offset + block_offset ),
+			              &read_error );
+
+			if( read_error != NULL )
+			{
+				libcerror_error_free(
+				 &read_error );
+			}
+			if( fvdecheck_scan_grab(
+			     scan,
+			     error ) != 1 )
+			{
+				return( -1 );
+			}
+			is_locked = 1;
+
+			if( read_count != (ssize_t) block_size )
+			{
+				if( fvdecheck_scan_append_region(
+				     scan,
+				     FVDECHECK_SCAN_REGION_UNREADABLE,
+				     chunk->pv_index,
+				     chunk->offset + block_offset,
+				     (uint64_t) block_size,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append unreadable region.",
+					 function );
+
+					goto on_error;
+				}
+				scan->unreadable_size += block_size;
+			}
+		}
+	}
+	else if( duration >= scan->slow_threshold )
+	{
+		if( fvdecheck_scan_append_region(
+		     scan,
+		     FVDECHECK_SCAN_REGION_SLOW,
+		     chunk->pv_index,
+		     chunk->offset,
+		     chunk->size,
+		     duration,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append slow region.",
+			 function );
+
+			goto on_error;
+		}
+		scan->slow_size += chunk->size;
+	}
+	scan->scanned_size += chunk->size;
+
+	fvdecheck_scan_print_progress(
+	 scan );
+
+	if( fvdecheck_scan_release(
+	     scan,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( is_locked != 0 )
+	{
+		fvdecheck_scan_release(
+		 scan,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to read a chunk from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_read_chunk_callback(
+     fvdecheck_scan_chunk_t *chunk,
+     fvdecheck_scan_t *scan )
+{
+	fvdecheck_scan_slot_t *slot = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "fvdecheck_scan_read_chunk_callback";
+	int slot_index              = 0;
+
+	if( scan == NULL )
+	{
+		if( chunk != NULL )
+		{
+			memory_free(
+			 chunk );
+		}
+		return( -1 );
+	}
+	if( scan->abort != 0 )
+	{
+		memory_free(
+		 chunk );
+
+		return( 1 );
+	}
+	/* Claim a free slot, there is one slot per thread */
+	if( fvdecheck_scan_grab(
+	     scan,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < scan->number_of_threads;
+	     slot_index++ )
+	{
+		if( scan->slots[ slot_index ].in_use == 0 )
+		{
+			slot         = &( scan->slots[ slot_index ] );
+			slot->in_use = 1;
+
+			break;
+		}
+	}
+	if( fvdecheck_scan_release(
+	     scan,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( slot == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing free slot.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_scan_read_chunk(
+	     scan,
+	     slot,
+	     chunk,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunk.",
+		 function );
+
+		goto on_error;
+	}
+	/* Slots are only claimed and released under the mutex */
+	if( fvdecheck_scan_grab(
+	     scan,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	slot->in_use = 0;
+
+	if( fvdecheck_scan_release(
+	     scan,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	memory_free(
+	 chunk );
+
+	return( 1 );
+
+on_error:
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	/* The error is reported by the thread that joins the thread pool */
+	scan->reader_failed = 1;
+
+	if( slot != NULL )
+	{
+		slot->in_use = 0;
+	}
+	if( chunk != NULL )
+	{
+		memory_free(
+		 chunk );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Release the slots of a physical volume */
+static void fvdecheck_scan_free_slots(
+             fvdecheck_scan_t *scan )
+{
+	int slot_index = 0;
+
+	for( slot_index = 0;
+	     slot_index < FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS;
+	     slot_index++ )
+	{
+		if( scan->slots[ slot_index ].file_io_handle != NULL )
+		{
+			libbfio_handle_close(
+			 scan->slots[ slot_index ].file_io_handle,
+			 NULL );
+
+			libbfio_handle_free(
+			 &( scan->slots[ slot_index ].file_io_handle ),
+			 NULL );
+		}
+		if( scan->slots[ slot_index ].buffer != NULL )
+		{
+			memory_free(
+			 scan->slots[ slot_index ].buffer );
+
+			scan->slots[ slot_index ].buffer = NULL;
+		}
+		scan->slots[ slot_index ].in_use = 0;
+	}
+}
+
+/* Set up the slots to read a physical volume
+ * Every concurrent reader gets its own clone of the physical volume file IO handle
+ * so that reads do not contend for the file offset of a shared handle
+ * Returns 1 if successful or -1 on error
+ */
+static int fvdecheck_scan_create_slots(
+            fvdecheck_scan_t *scan,
+            uint32_t pv_index,
+            int number_of_slots,
+            libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "fvdecheck_scan_create_slots";
+	int slot_index                   = 0;
+
+	if( number_of_slots > 1 )
+	{
+		if( libbfio_pool_get_handle(
+		     scan->file_io_pool,
+		     (int) pv_index,
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file IO handle: %" PRIu32 " from pool.",
+			 function,
+			 pv_index );
+
+			return( -1 );
+		}
+	}
+	for( slot_index = 0;
+	     slot_index < number_of_slots;
+	     slot_index++ )
+	{
+		scan->slots[ slot_index ].buffer = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * FVDECHECK_SCAN_CHUNK_SIZE );
+
+		if( scan->slots[ slot_index ].buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+		if( file_io_handle == NULL )
+		{
+			continue;
+		}
+		if( libbfio_handle_clone(
+		     &( scan->slots[ slot_index ].file_io_handle ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to clone file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     scan->slots[ slot_index ].file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	fvdecheck_scan_free_slots(
+	 scan );
+
+	return( -1 );
+}
+
+/* Scan all allocated extents in physical order
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_run(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error )
+{
+	fvdecheck_extent_t *extent     = NULL;
+	fvdecheck_scan_chunk_t chunk;
+	static char *function          = "fvdecheck_scan_run";
+	uint64_t extent_end_offset     = 0;
+	uint64_t offset                = 0;
+	uint32_t pv_index              = 0;
+	int number_of_threads          = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	fvdecheck_scan_chunk_t *queued_chunk   = NULL;
+#endif
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan->number_of_threads <= 0 )
+	 || ( scan->number_of_threads > FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the total size to scan for the progress */
+	scan->total_size      = 0;
+	scan->scanned_size    = 0;
+	scan->unreadable_size = 0;
+	scan->slow_size       = 0;
+	scan->last_progress   = -1;
+	scan->reader_failed   = 0;
+
+	for( pv_index = 0;
+	     pv_index < scan->volume_state->num_physical_volumes;
+	     pv_index++ )
+	{
+		for( extent = scan->volume_state->physical_volumes[ pv_index ].extent_list_head;
+		     extent != NULL;
+		     extent = extent->phys_next )
+		{
+			if( extent->state == FVDECHECK_EXTENT_STATE_ALLOCATED )
+			{
+				scan->total_size += extent->physical_block_count * scan->volume_state->block_size;
+			}
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_threads = scan->number_of_threads;
+
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( scan->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	scan->start_time = fvdecheck_scan_get_current_time();
+
+	for( pv_index = 0;
+	     pv_index < scan->volume_state->num_physical_volumes;
+	     pv_index++ )
+	{
+		if( scan->abort != 0 )
+		{
+			break;
+		}
+		if( fvdecheck_scan_create_slots(
+		     scan,
+		     pv_index,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create slots for physical volume: %" PRIu32 ".",
+			 function,
+			 pv_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( number_of_threads > 1 )
+		{
+			if( libcthreads_thread_pool_create(
+			     &thread_pool,
+			     NULL,
+			     number_of_threads,
+			     number_of_threads * 4,
+			     (int (*)(intptr_t *, void *)) &fvdecheck_scan_read_chunk_callback,
+			     (void *) scan,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		/* The extent list is kept in physical order */
+		for( extent = scan->volume_state->physical_volumes[ pv_index ].extent_list_head;
+		     extent != NULL;
+		     extent = extent->phys_next )
+		{
+			if( scan->abort != 0 )
+			{
+				break;
+			}
+			if( extent->state != FVDECHECK_EXTENT_STATE_ALLOCATED )
+			{
+				continue;
+			}
+			offset            = extent->physical_block_start * scan->volume_state->block_size;
+			extent_end_offset = offset + ( extent->physical_block_count * scan->volume_state->block_size );
+
+			while( offset < extent_end_offset )
+			{
+				if( scan->abort != 0 )
+				{
+					break;
+				}
+				chunk.pv_index = pv_index;
+				chunk.offset   = offset;
+				chunk.size     = extent_end_offset - offset;
+
+				if( chunk.size > FVDECHECK_SCAN_CHUNK_SIZE )
+				{
+					chunk.size = FVDECHECK_SCAN_CHUNK_SIZE;
+				}
+				offset += chunk.size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+				if( thread_pool != NULL )
+				{
+					queued_chunk = memory_allocate_structure(
+					                fvdecheck_scan_chunk_t );
+
+					if( queued_chunk == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create chunk.",
+						 function );
+
+						goto on_error;
+					}
+					*queued_chunk = chunk;
+
+					/* The callback takes over ownership of the chunk */
+					if( libcthreads_thread_pool_push(
+					     thread_pool,
+					     (intptr_t *) queued_chunk,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to push chunk onto thread pool.",
+						 function );
+
+						memory_free(
+						 queued_chunk );
+
+						goto on_error;
+					}
+					continue;
+				}
+#endif
+				if( fvdecheck_scan_read_chunk(
+				     scan,
+				     &( scan->slots[ 0 ] ),
+				     &chunk,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read chunk at offset: 0x%08" PRIx64 " of physical volume: %" PRIu32 ".",
+					 function,
+					 chunk.offset,
+					 pv_index );
+
+					goto on_error;
+				}
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				goto on_error;
+			}
+		}
+#endif
+		fvdecheck_scan_free_slots(
+		 scan );
+
+		if( scan->reader_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan physical volume: %" PRIu32 ".",
+			 function,
+			 pv_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scan->mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( scan->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	scan->elapsed_time = fvdecheck_scan_get_current_time() - scan->start_time;
+
+	fvdecheck_scan_sort_regions(
+	 scan );
+
+	if( ( scan->progress_stream != NULL )
+	 && ( scan->last_progress >= 0 ) )
+	{
+		fprintf(
+		 scan->progress_stream,
+		 "\n" );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( scan->mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( scan->mutex ),
+		 NULL );
+	}
+#endif
+	fvdecheck_scan_free_slots(
+	 scan );
+
+	return( -1 );
+}
+
+/* Check the HFS+ or HFSX volume header at offset 1024 of a logical volume
+ * Returns 1 if the header decodes sanely, 0 if not or -1 on error
+ */
+static int fvdecheck_scan_check_hfs_header(
+            libfvde_logical_volume_t *logical_volume,
+            off64_t offset,
+            size64_t volume_size,
+            uint64_t *header_volume_size,
+            libcerror_error_t **error )
+{
+	uint8_t header_data[ 512 ];
+
+	static char *function = "fvdecheck_scan_check_hfs_header";
+	ssize_t read_count    = 0;
+	uint32_t block_size   = 0;
+	uint32_t total_blocks = 0;
+	uint16_t signature    = 0;
+	uint16_t version      = 0;
+
+	read_count = libfvde_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              header_data,
+	              512,
+	              offset,
+	              error );
+
+	if( read_count != (ssize_t) 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read volume header at offset: %" PRIi64 ".",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_big_endian(
+	 &( header_data[ 0 ] ),
+	 signature );
+
+	byte_stream_copy_to_uint16_big_endian(
+	 &( header_data[ 2 ] ),
+	 version );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( header_data[ 40 ] ),
+	 block_size );
+
+	byte_stream_copy_to_uint32_big_endian(
+	 &( header_data[ 44 ] ),
+	 total_blocks );
+
+	/* "H+" version 4 or "HX" version 5 */
+	if( !( ( ( signature == 0x482b ) && ( version == 4 ) )
+	    || ( ( signature == 0x4858 ) && ( version == 5 ) ) ) )
+	{
+		return( 0 );
+	}
+	if( ( block_size < 512 )
+	 || ( ( block_size & ( block_size - 1 ) ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( total_blocks == 0 )
+	 || ( ( (uint64_t) total_blocks * block_size ) > volume_size ) )
+	{
+		return( 0 );
+	}
+	if( header_volume_size != NULL )
+	{
+		*header_volume_size = (uint64_t) total_blocks * block_size;
+	}
+	return( 1 );
+}
+
+/* Check the decrypted file system headers of a logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_check_logical_volume(
+     fvdecheck_scan_t *scan,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error )
+{
+	uint8_t container_data[ 512 ];
+
+	fvdecheck_scan_volume_check_t *volume_check = NULL;
+	static char *function                       = "fvdecheck_scan_check_logical_volume";
+	size64_t volume_size                        = 0;
+	uint64_t block_count                        = 0;
+	uint64_t header_volume_size                 = 0;
+	uint32_t block_size                         = 0;
+	ssize_t read_count                          = 0;
+	int result                                  = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan->number_of_volume_checks >= FVDECHECK_MAX_LOGICAL_VOLUMES )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: too many logical volumes.",
+		 function );
+
+		return( -1 );
+	}
+	volume_check = &( scan->volume_checks[ scan->number_of_volume_checks ] );
+
+	volume_check->file_system_type       = FVDECHECK_SCAN_FILE_SYSTEM_UNKNOWN;
+	volume_check->primary_header_valid   = 0;
+	volume_check->alternate_header_valid = 0;
+
+	scan->number_of_volume_checks += 1;
+
+	result = libfvde_logical_volume_is_locked(
+	          logical_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if logical volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Without a key the decrypted data cannot be checked */
+		volume_check->file_system_type = FVDECHECK_SCAN_FILE_SYSTEM_LOCKED;
+
+		return( 1 );
+	}
+	if( libfvde_logical_volume_get_size(
+	     logical_volume,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_size < 4096 )
+	{
+		return( 1 );
+	}
+	/* HFS+ keeps the primary volume header at offset 1024
+	 * and the alternate volume header 1024 bytes before the end of the volume
+	 */
+	result = fvdecheck_scan_check_hfs_header(
+	          logical_volume,
+	          1024,
+	          volume_size,
+	          &header_volume_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check primary HFS volume header.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		volume_check->file_system_type     = FVDECHECK_SCAN_FILE_SYSTEM_HFS;
+		volume_check->primary_header_valid = 1;
+
+		result = fvdecheck_scan_check_hfs_header(
+		          logical_volume,
+		          (off64_t) header_volume_size - 1024,
+		          volume_size,
+		          NULL,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check alternate HFS volume header.",
+			 function );
+
+			return( -1 );
+		}
+		volume_check->alternate_header_valid = result;
+
+		return( 1 );
+	}
+	/* APFS keeps the container superblock at the start of the volume */
+	read_count = libfvde_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              container_data,
+	              512,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) 512 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read container superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( container_data[ 32 ] ),
+	     "NXSB",
+	     4 ) == 0 )
+	{
+		volume_check->file_system_type = FVDECHECK_SCAN_FILE_SYSTEM_APFS;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( container_data[ 36 ] ),
+		 block_size );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( container_data[ 40 ] ),
+		 block_count );
+
+		if( ( block_size >= 4096 )
+		 && ( ( block_size & ( block_size - 1 ) ) == 0 )
+		 && ( block_count > 0 )
+		 && ( block_count <= ( volume_size / block_size ) ) )
+		{
+			volume_check->primary_header_valid = 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Print scan results
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_print(
+     fvdecheck_scan_t *scan,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	fvdecheck_scan_region_t *region = NULL;
+	static char *function           = "fvdecheck_scan_print";
+	uint64_t bytes_per_second       = 0;
+	int region_index                = 0;
+	int check_index                 = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan->elapsed_time > 0 )
+	{
+		bytes_per_second = ( scan->scanned_size * 1000 ) / scan->elapsed_time;
+	}
+	fprintf( stream, "\nSurface Scan:\n" );
+
+	fprintf(
+	 stream,
+	 "  Scanned:          %" PRIu64 " of %" PRIu64 " bytes%s\n",
+	 scan->scanned_size,
+	 scan->total_size,
+	 ( scan->abort != 0 ) ? " (aborted)" : "" );
+
+	fprintf(
+	 stream,
+	 "  Duration:         %" PRIu64 ".%03" PRIu64 " seconds (%" PRIu64 " MiB/s)\n",
+	 scan->elapsed_time / 1000,
+	 scan->elapsed_time % 1000,
+	 bytes_per_second / ( 1024 * 1024 ) );
+
+	fprintf(
+	 stream,
+	 "  Unreadable:       %" PRIu64 " bytes\n",
+	 scan->unreadable_size );
+
+	fprintf(
+	 stream,
+	 "  Slow:             %" PRIu64 " bytes (threshold: %" PRIu64 " ms)\n",
+	 scan->slow_size,
+	 scan->slow_threshold );
+
+	for( region_index = 0;
+	     region_index < scan->number_of_regions;
+	     region_index++ )
+	{
+		region = &( scan->regions[ region_index ] );
+
+		if( region->type == FVDECHECK_SCAN_REGION_SLOW )
+		{
+			fprintf(
+			 stream,
+			 "  %-10s PV %" PRIu32 " offset 0x%08" PRIx64 " - 0x%08" PRIx64 " (%" PRIu64 " bytes, %" PRIu64 " ms)\n",
+			 fvdecheck_scan_region_type_to_string(
+			  region->type ),
+			 region->pv_index,
+			 region->offset,
+			 region->offset + region->size,
+			 region->size,
+			 region->duration );
+		}
+		else
+		{
+			fprintf(
+			 stream,
+			 "  %-10s PV %" PRIu32 " offset 0x%08" PRIx64 " - 0x%08" PRIx64 " (%" PRIu64 " bytes)\n",
+			 fvdecheck_scan_region_type_to_string(
+			  region->type ),
+			 region->pv_index,
+			 region->offset,
+			 region->offset + region->size,
+			 region->size );
+		}
+	}
+	for( check_index = 0;
+	     check_index < scan->number_of_volume_checks;
+	     check_index++ )
+	{
+		fprintf(
+		 stream,
+		 "  Logical Volume %d: %s",
+		 check_index,
+		 fvdecheck_scan_file_system_type_to_string(
+		  scan->volume_checks[ check_index ].file_system_type ) );
+
+		if( ( scan->volume_checks[ check_index ].file_system_type == FVDECHECK_SCAN_FILE_SYSTEM_HFS )
+		 || ( scan->volume_checks[ check_index ].file_system_type == FVDECHECK_SCAN_FILE_SYSTEM_APFS ) )
+		{
+			fprintf(
+			 stream,
+			 ", primary header: %s",
+			 ( scan->volume_checks[ check_index ].primary_header_valid != 0 ) ? "valid" : "INVALID" );
+		}
+		if( scan->volume_checks[ check_index ].file_system_type == FVDECHECK_SCAN_FILE_SYSTEM_HFS )
+		{
+			fprintf(
+			 stream,
+			 ", alternate header: %s",
+			 ( scan->volume_checks[ check_index ].alternate_header_valid != 0 ) ? "valid" : "INVALID" );
+		}
+		fprintf( stream, "\n" );
+	}
+	return( 1 );
+}
+
+/* Print scan results as a JSON object member
+ * Returns 1 if successful or -1 on error
+ */
+int fvdecheck_scan_print_json(
+     fvdecheck_scan_t *scan,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	fvdecheck_scan_region_t *region = NULL;
+	static char *function           = "fvdecheck_scan_print_json";
+	int region_index                = 0;
+	int check_index                 = 0;
+
+	if( scan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf( stream, "  \"surface_scan\": {\n" );
+	fprintf( stream, "    \"total_bytes\": %" PRIu64 ",\n", scan->total_size );
+	fprintf( stream, "    \"scanned_bytes\": %" PRIu64 ",\n", scan->scanned_size );
+	fprintf( stream, "    \"unreadable_bytes\": %" PRIu64 ",\n", scan->unreadable_size );
+	fprintf( stream, "    \"slow_bytes\": %" PRIu64 ",\n", scan->slow_size );
+	fprintf( stream, "    \"slow_threshold_ms\": %" PRIu64 ",\n", scan->slow_threshold );
+	fprintf( stream, "    \"duration_ms\": %" PRIu64 ",\n", scan->elapsed_time );
+	fprintf( stream, "    \"aborted\": %s,\n", ( scan->abort != 0 ) ? "true" : "false" );
+	fprintf( stream, "    \"regions\": [\n" );
+
+	for( region_index = 0;
+	     region_index < scan->number_of_regions;
+	     region_index++ )
+	{
+		region = &( scan->regions[ region_index ] );
+
+		fprintf( stream, "      {\n" );
+		fprintf( stream, "        \"type\": \"%s\",\n",
+		         ( region->type == FVDECHECK_SCAN_REGION_SLOW ) ? "slow" : "unreadable" );
+		fprintf( stream, "        \"pv_index\": %" PRIu32 ",\n", region->pv_index );
+		fprintf( stream, "        \"offset\": %" PRIu64 ",\n", region->offset );
+		fprintf( stream, "        \"size\": %" PRIu64 ",\n", region->size );
+		fprintf( stream, "        \"duration_ms\": %" PRIu64 "\n", region->duration );
+		fprintf( stream, "      }%s\n",
+		         ( region_index < scan->number_of_regions - 1 ) ? "," : "" );
+	}
+	fprintf( stream, "    ],\n" );
+	fprintf( stream, "    \"logical_volumes\": [\n" );
+
+	for( check_index = 0;
+	     check_index < scan->number_of_volume_checks;
+	     check_index++ )
+	{
+		fprintf( stream, "      {\n" );
+		fprintf( stream, "        \"index\": %d,\n", check_index );
+		fprintf( stream, "        \"file_system\": \"%s\",\n",
+		         fvdecheck_scan_file_system_type_to_string(
+		          scan->volume_checks[ check_index ].file_system_type ) );
+		fprintf( stream, "        \"primary_header_valid\": %s,\n",
+		         ( scan->volume_checks[ check_index ].primary_header_valid != 0 ) ? "true" : "false" );
+		fprintf( stream, "        \"alternate_header_valid\": %s\n",
+		         ( scan->volume_checks[ check_index ].alternate_header_valid != 0 ) ? "true" : "false" );
+		fprintf( stream, "      }%s\n",
+		         ( check_index < scan->number_of_volume_checks - 1 ) ? "," : "" );
+	}
+	fprintf( stream, "    ]\n" );
+	fprintf( stream, "  },\n" );
+
+	return( 1 );
+}
+
+/* Get region type name string */
+const char *fvdecheck_scan_region_type_to_string(
+             int type )
+{
+	switch( type )
+	{
+		case FVDECHECK_SCAN_REGION_UNREADABLE:
+			return( "UNREADABLE" );
+
+		case FVDECHECK_SCAN_REGION_SLOW:
+			return( "SLOW" );
+
+		default:
+			return( "INVALID" );
+	}
+}
+
+/* Get file system type name string */
+const char *fvdecheck_scan_file_system_type_to_string(
+             int file_system_type )
+{
+	switch( file_system_type )
+	{
+		case FVDECHECK_SCAN_FILE_SYSTEM_HFS:
+			return( "HFS+" );
+
+		case FVDECHECK_SCAN_FILE_SYSTEM_APFS:
+			return( "APFS" );
+
+		case FVDECHECK_SCAN_FILE_SYSTEM_LOCKED:
+			return( "locked" );
+
+		default:
+			return( "unknown" );
+	}
+}
+
@@ -0,0 +1,279 @@
+/*
+ * Surface scan of the allocated extents for fvdecheck
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FVDECHECK_SCAN_H )
+#define _FVDECHECK_SCAN_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fvdecheck_extent.h"
+#include "fvdetools_libbfio.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcthreads.h"
+#include "fvdetools_libfvde.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Size of the individual reads of the scan (1 MiB) */
+#define FVDECHECK_SCAN_CHUNK_SIZE                     ( 1024 * 1024 )
+
+/* Number of concurrent reads */
+#define FVDECHECK_SCAN_DEFAULT_NUMBER_OF_THREADS      4
+#define FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS      32
+
+/* A chunk read that takes longer than this number of milliseconds is reported as slow */
+#define FVDECHECK_SCAN_DEFAULT_SLOW_THRESHOLD         1000
+
+/* Region types */
+enum fvdecheck_scan_region_type
+{
+	FVDECHECK_SCAN_REGION_UNREADABLE = 1,
+	FVDECHECK_SCAN_REGION_SLOW       = 2
+};
+
+/* File system types found by the decrypted header check */
+enum fvdecheck_scan_file_system_type
+{
+	FVDECHECK_SCAN_FILE_SYSTEM_UNKNOWN = 0,
+	FVDECHECK_SCAN_FILE_SYSTEM_HFS     = 1,
+	FVDECHECK_SCAN_FILE_SYSTEM_APFS    = 2,
+	FVDECHECK_SCAN_FILE_SYSTEM_LOCKED  = 3
+};
+
+typedef struct fvdecheck_scan_region fvdecheck_scan_region_t;
+
+struct fvdecheck_scan_region
+{
+	/* Region type */
+	int type;
+
+	/* Physical volume and byte range */
+	uint32_t pv_index;
+	uint64_t offset;
+	uint64_t size;
+
+	/* Longest read duration in milliseconds */
+	uint64_t duration;
+};
+
+typedef struct fvdecheck_scan_chunk fvdecheck_scan_chunk_t;
+
+struct fvdecheck_scan_chunk
+{
+	/* Physical volume and byte range */
+	uint32_t pv_index;
+	uint64_t offset;
+	uint64_t size;
+};
+
+typedef struct fvdecheck_scan_slot fvdecheck_scan_slot_t;
+
+struct fvdecheck_scan_slot
+{
+	/* File IO handle used by a single reader, NULL to read from the pool */
+	libbfio_handle_t *file_io_handle;
+
+	/* Read buffer */
+	uint8_t *buffer;
+
+	/* Value to indicate the slot is in use by a reader */
+	int in_use;
+};
+
+typedef struct fvdecheck_scan_volume_check fvdecheck_scan_volume_check_t;
+
+struct fvdecheck_scan_volume_check
+{
+	/* File system type */
+	int file_system_type;
+
+	/* Value to indicate the primary header decodes sanely */
+	int primary_header_valid;
+
+	/* Value to indicate the alternate header decodes sanely */
+	int alternate_header_valid;
+};
+
+typedef struct fvdecheck_scan fvdecheck_scan_t;
+
+struct fvdecheck_scan
+{
+	/* Physical volume file IO pool (not owned) */
+	libbfio_pool_t *file_io_pool;
+
+	/* Volume state with the extents to scan (not owned) */
+	fvdecheck_volume_state_t *volume_state;
+
+	/* Number of concurrent reads */
+	int number_of_threads;
+
+	/* Slow read threshold in milliseconds */
+	uint64_t slow_threshold;
+
+	/* Progress output stream, NULL if no progress is shown */
+	FILE *progress_stream;
+
+	/* Per reader resources */
+	fvdecheck_scan_slot_t slots[ FVDECHECK_SCAN_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* Unreadable and slow regions */
+	fvdecheck_scan_region_t *regions;
+	int number_of_regions;
+	int maximum_number_of_regions;
+
+	/* Statistics in bytes */
+	uint64_t total_size;
+	uint64_t scanned_size;
+	uint64_t unreadable_size;
+	uint64_t slow_size;
+
+	/* Timing in milliseconds */
+	uint64_t start_time;
+	uint64_t elapsed_time;
+
+	/* Last progress percentage shown */
+	int last_progress;
+
+	/* Value to indicate a reader failed for a reason other than a read error */
+	int reader_failed;
+
+	/* Value to indicate if abort was signalled */
+	int abort;
+
+	/* Decrypted header checks per logical volume */
+	int number_of_volume_checks;
+	fvdecheck_scan_volume_check_t volume_checks[ FVDECHECK_MAX_LOGICAL_VOLUMES ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Mutex protecting the statistics, regions and slots */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+/* Initialize scan */
+int fvdecheck_scan_initialize(
+     fvdecheck_scan_t **scan,
+     libbfio_pool_t *file_io_pool,
+     fvdecheck_volume_state_t *volume_state,
+     libcerror_error_t **error );
+
+/* Free scan */
+int fvdecheck_scan_free(
+     fvdecheck_scan_t **scan,
+     libcerror_error_t **error );
+
+/* Signal abort */
+int fvdecheck_scan_signal_abort(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error );
+
+/* Grab the scan mutex */
+int fvdecheck_scan_grab(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error );
+
+/* Release the scan mutex */
+int fvdecheck_scan_release(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error );
+
+/* Get the current time in milliseconds */
+uint64_t fvdecheck_scan_get_current_time(
+          void );
+
+/* Append an unreadable or slow region */
+int fvdecheck_scan_append_region(
+     fvdecheck_scan_t *scan,
+     int type,
+     uint32_t pv_index,
+     uint64_t offset,
+     uint64_t size,
+     uint64_t duration,
+     libcerror_error_t **error );
+
+/* Read data from a slot or the file IO pool */
+ssize_t fvdecheck_scan_read_buffer_at_offset(
+         fvdecheck_scan_t *scan,
+         fvdecheck_scan_slot_t *slot,
+         uint32_t pv_index,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+/* Read a chunk and record the unreadable and slow regions */
+int fvdecheck_scan_read_chunk(
+     fvdecheck_scan_t *scan,
+     fvdecheck_scan_slot_t *slot,
+     fvdecheck_scan_chunk_t *chunk,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to read a chunk from a thread pool */
+int fvdecheck_scan_read_chunk_callback(
+     fvdecheck_scan_chunk_t *chunk,
+     fvdecheck_scan_t *scan );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Scan all allocated extents in physical order */
+int fvdecheck_scan_run(
+     fvdecheck_scan_t *scan,
+     libcerror_error_t **error );
+
+/* Check the decrypted file system headers of a logical volume */
+int fvdecheck_scan_check_logical_volume(
+     fvdecheck_scan_t *scan,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error );
+
+/* Print scan results */
+int fvdecheck_scan_print(
+     fvdecheck_scan_t *scan,
+     FILE *stream,
+     libcerror_error_t **error );
+
+/* Print scan results as a JSON object member */
+int fvdecheck_scan_print_json(
+     fvdecheck_scan_t *scan,
+     FILE *stream,
+     libcerror_error_t **error );
+
+/* Get region type name string */
+const char *fvdecheck_scan_region_type_to_string(
+     int type );
+
+/* Get file system type name string */
+const char *fvdecheck_scan_file_system_type_to_string(
+     int file_system_type );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FVDECHECK_SCAN_H ) */
+
@@ -0,0 +1,606 @@
+/*
+ * Exports the data of a logical volume of a FileVault Drive Encrypted (FVDE) volume
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include <stdio.h>
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "export_handle.h"
+#include "fvdetools_getopt.h"
+#include "fvdetools_i18n.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libclocale.h"
+#include "fvdetools_libcnotify.h"
+#include "fvdetools_libfvde.h"
+#include "fvdetools_output.h"
+#include "fvdetools_signal.h"
+#include "fvdetools_unused.h"
+
+export_handle_t *fvdeexport_export_handle = NULL;
+int fvdeexport_abort                      = 0;
+
+/* Prints usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use fvdeexport to export the data of a logical volume of a FileVault Drive\n"
+	                 "Encrypted (FVDE) volume\n\n" );
+
+	fprintf( stream, "Usage: fvdeexport [ -d previous_map ] [ -e plist_path ]\n"
+	                 "                  [ -H hash_types ] [ -k key ] [ -l volume_indexes ]\n"
+	                 "                  [ -o offset ] [ -p password ] [ -P piece_size ]\n"
+	                 "                  [ -r recovery_password ] [ -chsuvV ] -t target sources\n\n" );
+
+	fprintf( stream, "\tsources: one or more source files or devices\n\n" );
+
+	fprintf( stream, "\t-c:      continue an interrupted export using the journal of the target\n" );
+	fprintf( stream, "\t-d:      only export the ranges of which the mapping changed since the\n"
+	                 "\t         extent map of a previous export\n" );
+	fprintf( stream, "\t-e:      specify the path of the EncryptedRoot.plist.wipekey file\n" );
+	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-H:      calculate hashes of the exported data, options: md5, sha1,\n"
+	                 "\t         sha256 or tree, a comma separated list selects multiple\n"
+	                 "\t         hashes\n" );
+	fprintf( stream, "\t-k:      specify the volume master key formatted in base16\n" );
+	fprintf( stream, "\t-l:      specify the logical volumes to export: all or a comma\n"
+	                 "\t         separated list of indexes, where 1 represents the first\n"
+	                 "\t         logical volume (default is 1), multiple logical volumes\n"
+	                 "\t         are exported concurrently to the target file with the\n"
+	                 "\t         suffix .N\n" );
+	fprintf( stream, "\t-o:      specify the volume offset in bytes\n" );
+	fprintf( stream, "\t-p:      specify the password/passphrase\n" );
+	fprintf( stream, "\t-P:      calculate piecewise hashes of the specified size in MiB\n" );
+	fprintf( stream, "\t-r:      specify the recovery password/passphrase\n" );
+	fprintf( stream, "\t-s:      write runs of zero blocks as holes in a sparse target file\n" );
+	fprintf( stream, "\t-t:      specify the target file to export to, the extent map is\n"
+	                 "\t         written to the target file with the suffix .map\n" );
+	fprintf( stream, "\t-u:      unattended mode (disables user interaction)\n" );
+	fprintf( stream, "\t-v:      verbose output to stderr\n" );
+	fprintf( stream, "\t-V:      print version\n" );
+}
+
+/* Signal handler for fvdeexport
+ */
+void fvdeexport_signal_handler(
+      fvdetools_signal_t signal FVDETOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "fvdeexport_signal_handler";
+
+	FVDETOOLS_UNREFERENCED_PARAMETER( signal )
+
+	fvdeexport_abort = 1;
+
+	if( fvdeexport_export_handle != NULL )
+	{
+		if( export_handle_signal_abort(
+		     fvdeexport_export_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal export handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	system_character_t * const *sources                  = NULL;
+	libfvde_error_t *error                               = NULL;
+	system_character_t *option_encrypted_root_plist_path = NULL;
+	system_character_t *option_hash_types                = NULL;
+	system_character_t *option_key                       = NULL;
+	system_character_t *option_logical_volumes           = NULL;
+	system_character_t *option_offset                    = NULL;
+	system_character_t *option_password                  = NULL;
+	system_character_t *option_piece_size                = NULL;
+	system_character_t *option_previous_map              = NULL;
+	system_character_t *option_recovery_password         = NULL;
+	system_character_t *option_target_path               = NULL;
+	char *program                                        = "fvdeexport";
+	system_integer_t option                              = 0;
+	int number_of_sources                                = 0;
+	int resume                                           = 0;
+	int sparse_output                                    = 0;
+	int unattended_mode                                  = 0;
+	int verbose                                          = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "fvdetools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( fvdetools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	fvdetools_output_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = fvdetools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "cd:e:hH:k:l:o:p:P:r:st:uvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				resume = 1;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_previous_map = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				option_encrypted_root_plist_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'H':
+				option_hash_types = optarg;
+
+				break;
+
+			case (system_integer_t) 'k':
+				option_key = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				option_logical_volumes = optarg;
+
+				break;
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_password = optarg;
+
+				break;
+
+			case (system_integer_t) 'P':
+				option_piece_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_recovery_password = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				sparse_output = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_target_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'u':
+				unattended_mode = 1;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				fvdetools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source volume.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	if( option_target_path == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Missing target.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	sources           = &( argv[ optind ] );
+	number_of_sources = argc - optind;
+
+	libcnotify_verbose_set(
+	 verbose );
+	libfvde_notify_set_stream(
+	 stderr,
+	 NULL );
+	libfvde_notify_set_verbose(
+	 verbose );
+
+	if( export_handle_initialize(
+	     &fvdeexport_export_handle,
+	     unattended_mode,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize export handle.\n" );
+
+		goto on_error;
+	}
+	if( fvdetools_signal_attach(
+	     fvdeexport_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( option_encrypted_root_plist_path != NULL )
+	{
+		if( export_handle_set_encrypted_root_plist(
+		     fvdeexport_export_handle,
+		     option_encrypted_root_plist_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set path of EncryptedRoot.plist.wipekey file.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_key != NULL )
+	{
+		if( export_handle_set_key(
+		     fvdeexport_export_handle,
+		     option_key,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set key.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_logical_volumes != NULL )
+	{
+		if( export_handle_set_logical_volumes(
+		     fvdeexport_export_handle,
+		     option_logical_volumes,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set logical volumes.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_offset != NULL )
+	{
+		if( export_handle_set_offset(
+		     fvdeexport_export_handle,
+		     option_offset,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set volume offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_password != NULL )
+	{
+		if( export_handle_set_password(
+		     fvdeexport_export_handle,
+		     option_password,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set password.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_recovery_password != NULL )
+	{
+		if( export_handle_set_recovery_password(
+		     fvdeexport_export_handle,
+		     option_recovery_password,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set recovery password.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_hash_types != NULL )
+	{
+		if( export_handle_set_hash_types(
+		     fvdeexport_export_handle,
+		     option_hash_types,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported hash types.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_piece_size != NULL )
+	{
+		if( option_hash_types == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Piecewise hashes require hash types.\n" );
+
+			usage_fprint(
+			 stdout );
+
+			goto on_error;
+		}
+		if( export_handle_set_piece_size(
+		     fvdeexport_export_handle,
+		     option_piece_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set piece size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_set_resume(
+	     fvdeexport_export_handle,
+	     resume,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set resume mode.\n" );
+
+		goto on_error;
+	}
+	if( export_handle_set_sparse_output(
+	     fvdeexport_export_handle,
+	     sparse_output,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set sparse output mode.\n" );
+
+		goto on_error;
+	}
+	if( option_previous_map != NULL )
+	{
+		if( export_handle_read_previous_map(
+		     fvdeexport_export_handle,
+		     option_previous_map,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read previous extent map: %" PRIs_SYSTEM ".\n",
+			 option_previous_map );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_open(
+	     fvdeexport_export_handle,
+	     sources,
+	     number_of_sources,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 sources[ 0 ] );
+
+		goto on_error;
+	}
+	if( export_handle_export(
+	     fvdeexport_export_handle,
+	     option_target_path,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to export to: %" PRIs_SYSTEM ".\n",
+		 option_target_path );
+
+		goto on_error;
+	}
+	if( export_handle_close(
+	     fvdeexport_export_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close export handle.\n" );
+
+		goto on_error;
+	}
+	if( fvdetools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_handle_free(
+	     &fvdeexport_export_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free export handle.\n" );
+
+		goto on_error;
+	}
+	if( fvdeexport_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Export aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( fvdeexport_export_handle != NULL )
+	{
+		export_handle_free(
+		 &fvdeexport_export_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -50,8 +50,10 @@
 #include "fvdetools_output.h"
 #include "fvdetools_signal.h"
 #include "fvdetools_unused.h"
+#include "info_batch.h"
 #include "info_handle.h"
 
+info_batch_t *fvdeinfo_info_batch   = NULL;
 info_handle_t *fvdeinfo_info_handle = NULL;
 int fvdeinfo_abort                  = 0;
 
@@ -67,18 +69,29 @@ void usage_fprint(
 	fprintf( stream, "Use fvdeinfo to determine information about a MacOS-X FileVault\n"
 	                 " Drive Encrypted (FVDE) volume\n\n" );
 
-	fprintf( stream, "Usage: fvdeinfo [ -e plist_path ] [ -k key ] [ -o offset ]\n"
-	                 "                [ -p password ] [ -r password ] [ -huvV ]\n"
-	                 "                sources\n\n" );
+	fprintf( stream, "Usage: fvdeinfo [ -e plist_path ] [ -k key ] [ -l sources_file ]\n"
+	                 "                [ -o offset ] [ -p password ] [ -r password ]\n"
+	                 "                [ -t threads ] [ -bhjmsuvV ] sources\n\n" );
 
 	fprintf( stream, "\tsources: one or more source files or devices\n\n" );
 
+	fprintf( stream, "\t-b:      batch mode, every source is a separate image and\n"
+	                 "\t         one JSON record is written per line for every image\n" );
 	fprintf( stream, "\t-e:      specify the path of the EncryptedRoot.plist.wipekey file\n" );
 	fprintf( stream, "\t-h:      shows this help\n" );
+	fprintf( stream, "\t-j:      output the information as JSON, implies unattended mode\n" );
 	fprintf( stream, "\t-k:      specify the volume master key formatted in base16\n" );
+	fprintf( stream, "\t-l:      specify a file that contains the sources, one per line,\n"
+	                 "\t         implies batch mode\n" );
+	fprintf( stream, "\t-m:      metadata only, do not unlock the logical volumes when\n"
+	                 "\t         no key or password is provided\n" );
 	fprintf( stream, "\t-o:      specify the volume offset\n" );
 	fprintf( stream, "\t-p:      specify the password\n" );
 	fprintf( stream, "\t-r:      specify the recovery password\n" );
+	fprintf( stream, "\t-s:      scan the source for Core Storage volume headers and\n"
+	                 "\t         print their offsets, for example in a whole disk image\n" );
+	fprintf( stream, "\t-t:      specify the number of images processed concurrently in\n"
+	                 "\t         batch mode, options: 1 to 64 (default is 4)\n" );
 	fprintf( stream, "\t-u:      unattended mode (disables user interaction)\n" );
 	fprintf( stream, "\t-v:      verbose output to stderr\n" );
 	fprintf( stream, "\t-V:      print version\n" );
@@ -96,6 +109,22 @@ void fvdeinfo_signal_handler(
 
 	fvdeinfo_abort = 1;
 
+	if( fvdeinfo_info_batch != NULL )
+	{
+		if( info_batch_signal_abort(
+		     fvdeinfo_info_batch,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal info batch to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	if( fvdeinfo_info_handle != NULL )
 	{
 		if( info_handle_signal_abort(
@@ -141,11 +170,22 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_encrypted_root_plist_path = NULL;
 	system_character_t *option_key                       = NULL;
 	system_character_t *option_password                  = NULL;
+	system_character_t *option_number_of_threads         = NULL;
 	system_character_t *option_recovery_password         = NULL;
+	system_character_t *option_sources_file              = NULL;
 	system_character_t *option_volume_offset             = NULL;
 	char *program                                        = "fvdeinfo";
 	system_integer_t option                              = 0;
+	size_t string_length                                 = 0;
+	uint64_t value_64bit                                 = 0;
+	int batch_mode                                       = 0;
+	int json_mode                                        = 0;
+	int metadata_only                                    = 0;
 	int number_of_sources                                = 0;
+	int number_of_threads                                = INFO_BATCH_DEFAULT_NUMBER_OF_THREADS;
+	int result                                           = 0;
+	int scan_mode                                        = 0;
+	int source_index                                     = 0;
 	int unattended_mode                                  = 0;
 	int verbose                                          = 0;
 
@@ -175,19 +215,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	fvdetools_output_version_fprint(
-	 stdout,
-	 program );
-
 	while( ( option = fvdetools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "e:hk:o:p:r:uvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "be:hjk:l:mo:p:r:st:uvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case (system_integer_t) '?':
 			default:
+				fvdetools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -198,22 +238,47 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				batch_mode = 1;
+
+				break;
+
 			case (system_integer_t) 'e':
 				option_encrypted_root_plist_path = optarg;
 
 				break;
 
 			case (system_integer_t) 'h':
+				fvdetools_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				json_mode = 1;
+
+				break;
+
 			case (system_integer_t) 'k':
 				option_key = optarg;
 
 				break;
 
+			case (system_integer_t) 'l':
+				option_sources_file = optarg;
+				batch_mode          = 1;
+
+				break;
+
+			case (system_integer_t) 'm':
+				metadata_only = 1;
+
+				break;
+
 			case (system_integer_t) 'o':
 				option_volume_offset = optarg;
 
@@ -229,6 +294,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 's':
+				scan_mode = 1;
+
+				break;
+
+			case (system_integer_t) 't':
+				option_number_of_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'u':
 				unattended_mode = 1;
 
@@ -240,13 +315,31 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case (system_integer_t) 'V':
+				fvdetools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fvdetools_output_copyright_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	/* In batch and JSON mode stdout only contains the records
+	 */
+	if( json_mode != 0 )
+	{
+		unattended_mode = 1;
+	}
+	if( ( batch_mode == 0 )
+	 && ( json_mode == 0 ) )
+	{
+		fvdetools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	if( ( optind == argc )
+	 && ( option_sources_file == NULL ) )
 	{
 		fprintf(
 		 stderr,
@@ -268,6 +361,107 @@ int main( int argc, char * const argv[] )
 	libfvde_notify_set_verbose(
 	 verbose );
 
+	if( batch_mode != 0 )
+	{
+		if( option_number_of_threads != NULL )
+		{
+			string_length = system_string_length(
+			                 option_number_of_threads );
+
+			if( ( fvdetools_system_string_copy_from_64_bit_in_decimal(
+			       option_number_of_threads,
+			       string_length + 1,
+			       &value_64bit,
+			       &error ) != 1 )
+			 || ( value_64bit == 0 )
+			 || ( value_64bit > (uint64_t) INFO_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of threads.\n" );
+
+				goto on_error;
+			}
+			number_of_threads = (int) value_64bit;
+		}
+		if( info_batch_initialize(
+		     &fvdeinfo_info_batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize info batch.\n" );
+
+			goto on_error;
+		}
+		fvdeinfo_info_batch->encrypted_root_plist_path = option_encrypted_root_plist_path;
+		fvdeinfo_info_batch->key                       = option_key;
+		fvdeinfo_info_batch->password                  = option_password;
+		fvdeinfo_info_batch->recovery_password         = option_recovery_password;
+		fvdeinfo_info_batch->volume_offset             = option_volume_offset;
+		fvdeinfo_info_batch->metadata_only             = metadata_only;
+
+		for( source_index = 0;
+		     source_index < number_of_sources;
+		     source_index++ )
+		{
+			if( info_batch_append_source(
+			     fvdeinfo_info_batch,
+			     sources[ source_index ],
+			     system_string_length(
+			      sources[ source_index ] ),
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append source: %" PRIs_SYSTEM ".\n",
+				 sources[ source_index ] );
+
+				goto on_error;
+			}
+		}
+		if( option_sources_file != NULL )
+		{
+			if( info_batch_read_sources_file(
+			     fvdeinfo_info_batch,
+			     option_sources_file,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to read sources file: %" PRIs_SYSTEM ".\n",
+				 option_sources_file );
+
+				goto on_error;
+			}
+		}
+		if( info_batch_run(
+		     fvdeinfo_info_batch,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to process sources.\n" );
+
+			goto on_error;
+		}
+		if( info_batch_free(
+		     &fvdeinfo_info_batch,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info batch.\n" );
+
+			goto on_error;
+		}
+		if( fvdeinfo_abort != 0 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
 	if( info_handle_initialize(
 	     &fvdeinfo_info_handle,
 	     unattended_mode,
@@ -279,6 +473,32 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( scan_mode != 0 )
+	{
+		if( info_handle_scan_fprint(
+		     fvdeinfo_info_handle,
+		     sources[ 0 ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan: %" PRIs_SYSTEM ".\n",
+			 sources[ 0 ] );
+
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &fvdeinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+		return( EXIT_SUCCESS );
+	}
 	if( option_encrypted_root_plist_path != NULL )
 	{
 		if( info_handle_set_encrypted_root_plist(
@@ -349,6 +569,17 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( info_handle_set_metadata_only(
+	     fvdeinfo_info_handle,
+	     metadata_only,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set metadata only.\n" );
+
+		goto on_error;
+	}
 	if( info_handle_open(
 	     fvdeinfo_info_handle,
 	     sources,
@@ -362,9 +593,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( info_handle_volume_fprint(
-	     fvdeinfo_info_handle,
-	     &error ) != 1 )
+	if( json_mode != 0 )
+	{
+		result = info_handle_volume_json_fprint(
+		          fvdeinfo_info_handle,
+		          &error );
+	}
+	else
+	{
+		result = info_handle_volume_fprint(
+		          fvdeinfo_info_handle,
+		          &error );
+	}
+	if( result != 1 )
 	{
 		fprintf(
 		 stderr,
@@ -402,6 +643,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( fvdeinfo_info_batch != NULL )
+	{
+		info_batch_free(
+		 &fvdeinfo_info_batch,
+		 NULL );
+	}
 	if( fvdeinfo_info_handle != NULL )
 	{
 		info_handle_free(
@@ -69,7 +69,8 @@ void usage_fprint(
 	fprintf( stream, "Use fvdemount to mount a FileVault Drive Encrypted (FVDE) volume\n\n" );
 
 	fprintf( stream, "Usage: fvdemount [ -e plist_path ] [ -k key ] [ -o offset ] [ -p password ]\n"
-	                 "                 [ -r recovery_password ] [ -X extended_options ] [ -huvV ]\n"
+	                 "                 [ -r recovery_password ] [ -T trace_file ]\n"
+	                 "                 [ -X extended_options ] [ -huvV ]\n"
 	                 "                 sources mount_point\n\n" );
 
 	fprintf( stream, "\tsources:     one or more source files or devices\n\n" );
@@ -81,6 +82,9 @@ void usage_fprint(
 	fprintf( stream, "\t-o:          specify the volume offset in bytes\n" );
 	fprintf( stream, "\t-p:          specify the password/passphrase\n" );
 	fprintf( stream, "\t-r:          specify the recovery password/passphrase\n" );
+	fprintf( stream, "\t-T:          specify the access trace file, the reads recorded in this\n"
+	                 "\t             file are replayed on mount to warm up the first logical\n"
+	                 "\t             volume and the file is rewritten on unmount\n" );
 	fprintf( stream, "\t-u:          unattended mode (disables user interaction)\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr, while fvdemount will remain running in the\n"
 	                 "\t             foreground\n" );
@@ -149,6 +153,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *option_offset                    = NULL;
 	system_character_t *option_password                  = NULL;
 	system_character_t *option_recovery_password         = NULL;
+	system_character_t *option_trace_file                = NULL;
 	const system_character_t *path_prefix                = NULL;
 	char *program                                        = "fvdemount";
 	system_integer_t option                              = 0;
@@ -211,7 +216,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = fvdetools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "e:hk:o:p:r:uvVX:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "e:hk:o:p:r:T:uvVX:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -258,6 +263,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'T':
+				option_trace_file = optarg;
+
+				break;
+
 			case (system_integer_t) 'u':
 				unattended_mode = 1;
 
@@ -396,6 +406,20 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_trace_file != NULL )
+	{
+		if( mount_handle_set_access_trace_path(
+		     fvdemount_mount_handle,
+		     option_trace_file,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set access trace file.\n" );
+
+			goto on_error;
+		}
+	}
 #if defined( WINAPI )
 	path_prefix = _SYSTEM_STRING( "\\FVDE" );
 #else
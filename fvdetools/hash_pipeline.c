@@ -0,0 +1,1993 @@
+/*
+ * Single pass hashing of an exported data stream
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcnotify.h"
+#include "fvdetools_libcthreads.h"
+#include "fvdetools_libhmac.h"
+#include "hash_pipeline.h"
+
+/* Creates a hash pipeline
+ * The hashes are calculated over a stream of stream size bytes that is pushed
+ * in order in buffers of HASH_PIPELINE_BUFFER_SIZE bytes, only the last buffer
+ * can be smaller. A piece size of 0 disables the piecewise hashes
+ * Make sure the value hash_pipeline is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_initialize(
+     hash_pipeline_t **hash_pipeline,
+     int flags,
+     size64_t stream_size,
+     size64_t piece_size,
+     int number_of_tree_threads,
+     libcerror_error_t **error )
+{
+	hash_pipeline_digest_t *digest = NULL;
+	static char *function          = "hash_pipeline_initialize";
+	size64_t number_of_blocks      = 0;
+	size64_t number_of_pieces      = 0;
+	int buffer_index               = 0;
+	int digest_type                = 0;
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_pipeline != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash pipeline value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( HASH_PIPELINE_CALCULATE_MD5 | HASH_PIPELINE_CALCULATE_SHA1 | HASH_PIPELINE_CALCULATE_SHA256 | HASH_PIPELINE_CALCULATE_TREE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02x.",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
+	if( flags == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags - no hashes selected.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( piece_size != 0 )
+	{
+		if( ( flags & ( HASH_PIPELINE_CALCULATE_MD5 | HASH_PIPELINE_CALCULATE_SHA1 | HASH_PIPELINE_CALCULATE_SHA256 ) ) == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid flags - piecewise hashes require a MD5, SHA1 or SHA256 hash.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_pieces = stream_size / piece_size;
+
+		if( ( stream_size % piece_size ) != 0 )
+		{
+			number_of_pieces++;
+		}
+		if( number_of_pieces > (size64_t) ( INT_MAX / HASH_PIPELINE_MAXIMUM_HASH_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid piece size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( number_of_tree_threads < 1 )
+	 || ( number_of_tree_threads > HASH_PIPELINE_MAXIMUM_NUMBER_OF_TREE_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of tree threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_pipeline = memory_allocate_structure(
+	                  hash_pipeline_t );
+
+	if( *hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash pipeline.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_pipeline,
+	     0,
+	     sizeof( hash_pipeline_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash pipeline.",
+		 function );
+
+		memory_free(
+		 *hash_pipeline );
+
+		*hash_pipeline = NULL;
+
+		return( -1 );
+	}
+	( *hash_pipeline )->flags                    = flags;
+	( *hash_pipeline )->stream_size              = stream_size;
+	( *hash_pipeline )->piece_size               = piece_size;
+	( *hash_pipeline )->maximum_number_of_pieces = (int) number_of_pieces;
+
+	for( digest_type = 0;
+	     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		digest = &( ( *hash_pipeline )->digests[ digest_type ] );
+
+		digest->pipeline = *hash_pipeline;
+		digest->type     = digest_type;
+
+		switch( digest_type )
+		{
+			case HASH_PIPELINE_DIGEST_TYPE_MD5:
+				if( ( flags & HASH_PIPELINE_CALCULATE_MD5 ) == 0 )
+				{
+					continue;
+				}
+				digest->hash_size = LIBHMAC_MD5_HASH_SIZE;
+				break;
+
+			case HASH_PIPELINE_DIGEST_TYPE_SHA1:
+				if( ( flags & HASH_PIPELINE_CALCULATE_SHA1 ) == 0 )
+				{
+					continue;
+				}
+				digest->hash_size = LIBHMAC_SHA1_HASH_SIZE;
+				break;
+
+			case HASH_PIPELINE_DIGEST_TYPE_SHA256:
+				if( ( flags & HASH_PIPELINE_CALCULATE_SHA256 ) == 0 )
+				{
+					continue;
+				}
+				digest->hash_size = LIBHMAC_SHA256_HASH_SIZE;
+				break;
+		}
+		if( hash_pipeline_context_initialize(
+		     digest_type,
+		     &( digest->context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create context: %d.",
+			 function,
+			 digest_type );
+
+			goto on_error;
+		}
+		if( number_of_pieces > 0 )
+		{
+			digest->piece_hashes = (uint8_t *) memory_allocate(
+			                                    sizeof( uint8_t ) * (size_t) number_of_pieces * digest->hash_size );
+
+			if( digest->piece_hashes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create piece hashes: %d.",
+				 function,
+				 digest_type );
+
+				goto on_error;
+			}
+		}
+		( *hash_pipeline )->number_of_consumers += 1;
+	}
+	if( ( flags & HASH_PIPELINE_CALCULATE_TREE ) != 0 )
+	{
+		number_of_blocks = stream_size / HASH_PIPELINE_BUFFER_SIZE;
+
+		if( ( stream_size % HASH_PIPELINE_BUFFER_SIZE ) != 0 )
+		{
+			number_of_blocks++;
+		}
+		if( number_of_blocks > (size64_t) ( INT_MAX / LIBHMAC_SHA256_HASH_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid stream size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		( *hash_pipeline )->number_of_blocks = (int) number_of_blocks;
+
+		if( number_of_blocks > 0 )
+		{
+			( *hash_pipeline )->block_hashes = (uint8_t *) memory_allocate(
+			                                                sizeof( uint8_t ) * (size_t) number_of_blocks * LIBHMAC_SHA256_HASH_SIZE );
+
+			if( ( *hash_pipeline )->block_hashes == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create block hashes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		( *hash_pipeline )->number_of_consumers += 1;
+	}
+	for( buffer_index = 0;
+	     buffer_index < HASH_PIPELINE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		( *hash_pipeline )->buffers[ buffer_index ].data = (uint8_t *) memory_allocate(
+		                                                                sizeof( uint8_t ) * HASH_PIPELINE_BUFFER_SIZE );
+
+		if( ( *hash_pipeline )->buffers[ buffer_index ].data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer: %d.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *hash_pipeline )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_queue_initialize(
+	     &( ( *hash_pipeline )->free_queue ),
+	     HASH_PIPELINE_NUMBER_OF_BUFFERS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create free queue.",
+		 function );
+
+		goto on_error;
+	}
+	for( buffer_index = 0;
+	     buffer_index < HASH_PIPELINE_NUMBER_OF_BUFFERS;
+	     buffer_index++ )
+	{
+		if( libcthreads_queue_push(
+		     ( *hash_pipeline )->free_queue,
+		     (intptr_t *) &( ( *hash_pipeline )->buffers[ buffer_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer: %d onto free queue.",
+			 function,
+			 buffer_index );
+
+			goto on_error;
+		}
+	}
+	/* Every digest has a single thread so that its buffers are processed
+	 * in stream order, the tree blocks are independent of each other
+	 */
+	for( digest_type = 0;
+	     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		digest = &( ( *hash_pipeline )->digests[ digest_type ] );
+
+		if( digest->context == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_pool_create(
+		     &( digest->thread_pool ),
+		     NULL,
+		     1,
+		     HASH_PIPELINE_NUMBER_OF_BUFFERS,
+		     (int (*)(intptr_t *, void *)) &hash_pipeline_digest_callback,
+		     (void *) digest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool: %d.",
+			 function,
+			 digest_type );
+
+			goto on_error;
+		}
+	}
+	if( ( flags & HASH_PIPELINE_CALCULATE_TREE ) != 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( ( *hash_pipeline )->tree_thread_pool ),
+		     NULL,
+		     number_of_tree_threads,
+		     HASH_PIPELINE_NUMBER_OF_BUFFERS,
+		     (int (*)(intptr_t *, void *)) &hash_pipeline_block_callback,
+		     (void *) *hash_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create tree thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( 1 );
+
+on_error:
+	if( *hash_pipeline != NULL )
+	{
+		hash_pipeline_free(
+		 hash_pipeline,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a hash pipeline
+ * Buffers that are still being processed are waited for
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_free(
+     hash_pipeline_t **hash_pipeline,
+     libcerror_error_t **error )
+{
+	hash_pipeline_digest_t *digest = NULL;
+	static char *function          = "hash_pipeline_free";
+	int buffer_index               = 0;
+	int digest_type                = 0;
+	int result                     = 1;
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_pipeline != NULL )
+	{
+		if( hash_pipeline_join(
+		     *hash_pipeline,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join threads.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *hash_pipeline )->free_queue != NULL )
+		{
+			if( libcthreads_queue_free(
+			     &( ( *hash_pipeline )->free_queue ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free free queue.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *hash_pipeline )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *hash_pipeline )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+		for( digest_type = 0;
+		     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+		     digest_type++ )
+		{
+			digest = &( ( *hash_pipeline )->digests[ digest_type ] );
+
+			if( digest->context != NULL )
+			{
+				if( hash_pipeline_context_free(
+				     digest_type,
+				     &( digest->context ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free context: %d.",
+					 function,
+					 digest_type );
+
+					result = -1;
+				}
+			}
+			if( digest->piece_context != NULL )
+			{
+				if( hash_pipeline_context_free(
+				     digest_type,
+				     &( digest->piece_context ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free piece context: %d.",
+					 function,
+					 digest_type );
+
+					result = -1;
+				}
+			}
+			if( digest->piece_hashes != NULL )
+			{
+				memory_free(
+				 digest->piece_hashes );
+			}
+		}
+		if( ( *hash_pipeline )->block_hashes != NULL )
+		{
+			memory_free(
+			 ( *hash_pipeline )->block_hashes );
+		}
+		for( buffer_index = 0;
+		     buffer_index < HASH_PIPELINE_NUMBER_OF_BUFFERS;
+		     buffer_index++ )
+		{
+			if( ( *hash_pipeline )->buffers[ buffer_index ].data != NULL )
+			{
+				memory_free(
+				 ( *hash_pipeline )->buffers[ buffer_index ].data );
+			}
+		}
+		memory_free(
+		 *hash_pipeline );
+
+		*hash_pipeline = NULL;
+	}
+	return( result );
+}
+
+/* Creates a hash context
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_context_initialize(
+     int digest_type,
+     intptr_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_context_initialize";
+	int result            = -1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case HASH_PIPELINE_DIGEST_TYPE_MD5:
+			result = libhmac_md5_initialize(
+			          (libhmac_md5_context_t **) context,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA1:
+			result = libhmac_sha1_initialize(
+			          (libhmac_sha1_context_t **) context,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA256:
+			result = libhmac_sha256_initialize(
+			          (libhmac_sha256_context_t **) context,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a hash context
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_context_free(
+     int digest_type,
+     intptr_t **context,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_context_free";
+	int result            = -1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	switch( digest_type )
+	{
+		case HASH_PIPELINE_DIGEST_TYPE_MD5:
+			result = libhmac_md5_free(
+			          (libhmac_md5_context_t **) context,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA1:
+			result = libhmac_sha1_free(
+			          (libhmac_sha1_context_t **) context,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA256:
+			result = libhmac_sha256_free(
+			          (libhmac_sha256_context_t **) context,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates a hash context
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_context_update(
+     int digest_type,
+     intptr_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_context_update";
+	int result            = -1;
+
+	switch( digest_type )
+	{
+		case HASH_PIPELINE_DIGEST_TYPE_MD5:
+			result = libhmac_md5_update(
+			          (libhmac_md5_context_t *) context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA1:
+			result = libhmac_sha1_update(
+			          (libhmac_sha1_context_t *) context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA256:
+			result = libhmac_sha256_update(
+			          (libhmac_sha256_context_t *) context,
+			          data,
+			          data_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Finalizes a hash context
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_context_finalize(
+     int digest_type,
+     intptr_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_context_finalize";
+	int result            = -1;
+
+	switch( digest_type )
+	{
+		case HASH_PIPELINE_DIGEST_TYPE_MD5:
+			result = libhmac_md5_finalize(
+			          (libhmac_md5_context_t *) context,
+			          hash,
+			          hash_size,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA1:
+			result = libhmac_sha1_finalize(
+			          (libhmac_sha1_context_t *) context,
+			          hash,
+			          hash_size,
+			          error );
+			break;
+
+		case HASH_PIPELINE_DIGEST_TYPE_SHA256:
+			result = libhmac_sha256_finalize(
+			          (libhmac_sha256_context_t *) context,
+			          hash,
+			          hash_size,
+			          error );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported digest type: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize context.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a buffer to fill with the next data of the stream
+ * Blocks until a buffer is no longer used by the digest threads
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_get_buffer(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t **buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_get_buffer";
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_queue_pop(
+	     hash_pipeline->free_queue,
+	     (intptr_t **) buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to pop buffer from free queue.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	/* Without threads the buffers are processed before the push returns
+	 */
+	*buffer = &( hash_pipeline->buffers[ 0 ] );
+#endif
+	( *buffer )->data_size = 0;
+
+	return( 1 );
+}
+
+/* Pushes a filled buffer onto the pipeline
+ * The buffer must contain the data that directly follows the previous buffer
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_push_buffer(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t *buffer,
+     libcerror_error_t **error )
+{
+	hash_pipeline_digest_t *digest = NULL;
+	static char *function          = "hash_pipeline_push_buffer";
+	int digest_type                = 0;
+	int result                     = 1;
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline->finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash pipeline - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline->consumer_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer->data_size == 0 )
+	 || ( buffer->data_size > HASH_PIPELINE_BUFFER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the last buffer of the stream can be smaller, which keeps
+	 * every buffer aligned with a tree block
+	 */
+	if( ( (size64_t) buffer->data_size > ( hash_pipeline->stream_size - hash_pipeline->stream_offset ) )
+	 || ( ( buffer->data_size < HASH_PIPELINE_BUFFER_SIZE )
+	  &&  ( ( hash_pipeline->stream_offset + (off64_t) buffer->data_size ) != (off64_t) hash_pipeline->stream_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer - data size: %" PRIzd " not aligned with stream offset: %" PRIi64 ".",
+		 function,
+		 buffer->data_size,
+		 hash_pipeline->stream_offset );
+
+		return( -1 );
+	}
+	buffer->offset          = hash_pipeline->stream_offset;
+	buffer->reference_count = hash_pipeline->number_of_consumers;
+
+	hash_pipeline->stream_offset += (off64_t) buffer->data_size;
+
+	for( digest_type = 0;
+	     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		digest = &( hash_pipeline->digests[ digest_type ] );
+
+		if( digest->context == NULL )
+		{
+			continue;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_pool_push(
+		     digest->thread_pool,
+		     (intptr_t *) buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto thread pool: %d.",
+			 function,
+			 digest_type );
+
+			result = -1;
+
+			hash_pipeline_release_buffer(
+			 hash_pipeline,
+			 buffer,
+			 -1,
+			 NULL );
+		}
+#else
+		result = hash_pipeline_digest_update(
+		          digest,
+		          buffer,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest: %d.",
+			 function,
+			 digest_type );
+
+			hash_pipeline->consumer_failed = 1;
+		}
+#endif
+		if( result != 1 )
+		{
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( ( hash_pipeline->flags & HASH_PIPELINE_CALCULATE_TREE ) != 0 ) )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_thread_pool_push(
+		     hash_pipeline->tree_thread_pool,
+		     (intptr_t *) buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto tree thread pool.",
+			 function );
+
+			result = -1;
+
+			hash_pipeline_release_buffer(
+			 hash_pipeline,
+			 buffer,
+			 -1,
+			 NULL );
+		}
+#else
+		result = hash_pipeline_calculate_block_hash(
+		          hash_pipeline,
+		          buffer,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate block hash.",
+			 function );
+
+			hash_pipeline->consumer_failed = 1;
+		}
+#endif
+	}
+	return( result );
+}
+
+/* Releases a buffer after a consumer processed it
+ * The buffer becomes available to the producer when all consumers released it
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_release_buffer(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t *buffer,
+     int result,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_release_buffer";
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hash_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		hash_pipeline->consumer_failed = 1;
+	}
+	buffer->reference_count -= 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The free queue can hold all buffers so the push does not block
+	 */
+	if( buffer->reference_count == 0 )
+	{
+		if( libcthreads_queue_push(
+		     hash_pipeline->free_queue,
+		     (intptr_t *) buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer onto free queue.",
+			 function );
+
+			hash_pipeline->consumer_failed = 1;
+
+			libcthreads_mutex_release(
+			 hash_pipeline->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     hash_pipeline->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Updates a digest with the data of a buffer
+ * The buffers must be passed in stream order
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_digest_update(
+     hash_pipeline_digest_t *digest,
+     hash_pipeline_buffer_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_digest_update";
+	size64_t piece_size   = 0;
+	size_t data_offset    = 0;
+	size_t update_size    = 0;
+
+	if( digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( digest->pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid digest - missing pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline_context_update(
+	     digest->type,
+	     digest->context,
+	     buffer->data,
+	     buffer->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update context.",
+		 function );
+
+		return( -1 );
+	}
+	piece_size = digest->pipeline->piece_size;
+
+	while( ( piece_size > 0 )
+	    && ( data_offset < buffer->data_size ) )
+	{
+		if( digest->piece_context == NULL )
+		{
+			if( digest->number_of_pieces >= digest->pipeline->maximum_number_of_pieces )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of pieces value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( hash_pipeline_context_initialize(
+			     digest->type,
+			     &( digest->piece_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create piece context.",
+				 function );
+
+				return( -1 );
+			}
+			digest->piece_data_size = 0;
+		}
+		update_size = buffer->data_size - data_offset;
+
+		if( (size64_t) update_size > ( piece_size - digest->piece_data_size ) )
+		{
+			update_size = (size_t) ( piece_size - digest->piece_data_size );
+		}
+		if( hash_pipeline_context_update(
+		     digest->type,
+		     digest->piece_context,
+		     &( buffer->data[ data_offset ] ),
+		     update_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update piece context.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset             += update_size;
+		digest->piece_data_size += update_size;
+
+		if( digest->piece_data_size == piece_size )
+		{
+			if( hash_pipeline_context_finalize(
+			     digest->type,
+			     digest->piece_context,
+			     &( digest->piece_hashes[ digest->number_of_pieces * digest->hash_size ] ),
+			     digest->hash_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize piece context.",
+				 function );
+
+				return( -1 );
+			}
+			if( hash_pipeline_context_free(
+			     digest->type,
+			     &( digest->piece_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free piece context.",
+				 function );
+
+				return( -1 );
+			}
+			digest->number_of_pieces += 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Calculates the hash of the tree block contained in a buffer
+ * The blocks are independent of each other and can be calculated in any order
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_calculate_block_hash(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t *buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_calculate_block_hash";
+	off64_t block_index   = 0;
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	block_index = buffer->offset / HASH_PIPELINE_BUFFER_SIZE;
+
+	if( ( block_index < 0 )
+	 || ( block_index >= (off64_t) hash_pipeline->number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libhmac_sha256_calculate(
+	     buffer->data,
+	     buffer->data_size,
+	     &( hash_pipeline->block_hashes[ block_index * LIBHMAC_SHA256_HASH_SIZE ] ),
+	     LIBHMAC_SHA256_HASH_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate hash of block: %" PRIi64 ".",
+		 function,
+		 block_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to update a digest from its thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_digest_callback(
+     hash_pipeline_buffer_t *buffer,
+     hash_pipeline_digest_t *digest )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "hash_pipeline_digest_callback";
+	int result               = 1;
+
+	if( ( digest == NULL )
+	 || ( digest->pipeline == NULL ) )
+	{
+		return( -1 );
+	}
+	/* Once a consumer failed the remaining buffers are only released
+	 */
+	if( digest->pipeline->consumer_failed == 0 )
+	{
+		result = hash_pipeline_digest_update(
+		          digest,
+		          buffer,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update digest: %d.",
+			 function,
+			 digest->type );
+		}
+	}
+	if( hash_pipeline_release_buffer(
+	     digest->pipeline,
+	     buffer,
+	     result,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		/* The error is reported by the thread that finalizes the pipeline
+		 */
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Callback function to calculate a tree block hash from the tree thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_block_callback(
+     hash_pipeline_buffer_t *buffer,
+     hash_pipeline_t *hash_pipeline )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "hash_pipeline_block_callback";
+	int result               = 1;
+
+	if( hash_pipeline == NULL )
+	{
+		return( -1 );
+	}
+	if( hash_pipeline->consumer_failed == 0 )
+	{
+		result = hash_pipeline_calculate_block_hash(
+		          hash_pipeline,
+		          buffer,
+		          &error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to calculate block hash.",
+			 function );
+		}
+	}
+	if( hash_pipeline_release_buffer(
+	     hash_pipeline,
+	     buffer,
+	     result,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release buffer.",
+		 function );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Waits for the digest threads to process all pushed buffers
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_join(
+     hash_pipeline_t *hash_pipeline,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_pipeline_join";
+	int result            = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int digest_type       = 0;
+#endif
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( digest_type = 0;
+	     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		if( hash_pipeline->digests[ digest_type ].thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( hash_pipeline->digests[ digest_type ].thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool: %d.",
+				 function,
+				 digest_type );
+
+				result = -1;
+			}
+		}
+	}
+	if( hash_pipeline->tree_thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &( hash_pipeline->tree_thread_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join tree thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( result );
+}
+
+/* Finalizes the hashes
+ * All data of the stream must have been pushed
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_finalize(
+     hash_pipeline_t *hash_pipeline,
+     libcerror_error_t **error )
+{
+	hash_pipeline_digest_t *digest = NULL;
+	intptr_t *tree_context         = NULL;
+	static char *function          = "hash_pipeline_finalize";
+	int digest_type                = 0;
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline->finalized != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash pipeline - already finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline_join(
+	     hash_pipeline,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join threads.",
+		 function );
+
+		return( -1 );
+	}
+	hash_pipeline->finalized = 1;
+
+	if( hash_pipeline->consumer_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate hashes.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline->stream_offset != (off64_t) hash_pipeline->stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: missing data - hashed: %" PRIi64 " of %" PRIu64 " bytes.",
+		 function,
+		 hash_pipeline->stream_offset,
+		 hash_pipeline->stream_size );
+
+		return( -1 );
+	}
+	for( digest_type = 0;
+	     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		digest = &( hash_pipeline->digests[ digest_type ] );
+
+		if( digest->context == NULL )
+		{
+			continue;
+		}
+		if( hash_pipeline_context_finalize(
+		     digest_type,
+		     digest->context,
+		     digest->hash,
+		     digest->hash_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize context: %d.",
+			 function,
+			 digest_type );
+
+			return( -1 );
+		}
+		/* The last piece can be smaller than the piece size
+		 */
+		if( digest->piece_context != NULL )
+		{
+			if( hash_pipeline_context_finalize(
+			     digest_type,
+			     digest->piece_context,
+			     &( digest->piece_hashes[ digest->number_of_pieces * digest->hash_size ] ),
+			     digest->hash_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to finalize piece context: %d.",
+				 function,
+				 digest_type );
+
+				return( -1 );
+			}
+			digest->number_of_pieces += 1;
+		}
+	}
+	/* The tree hash is the SHA256 of the concatenated block hashes
+	 */
+	if( ( hash_pipeline->flags & HASH_PIPELINE_CALCULATE_TREE ) != 0 )
+	{
+		if( hash_pipeline_context_initialize(
+		     HASH_PIPELINE_DIGEST_TYPE_SHA256,
+		     &tree_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create tree context.",
+			 function );
+
+			goto on_error;
+		}
+		if( hash_pipeline->number_of_blocks > 0 )
+		{
+			if( hash_pipeline_context_update(
+			     HASH_PIPELINE_DIGEST_TYPE_SHA256,
+			     tree_context,
+			     hash_pipeline->block_hashes,
+			     (size_t) hash_pipeline->number_of_blocks * LIBHMAC_SHA256_HASH_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update tree context.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( hash_pipeline_context_finalize(
+		     HASH_PIPELINE_DIGEST_TYPE_SHA256,
+		     tree_context,
+		     hash_pipeline->tree_hash,
+		     LIBHMAC_SHA256_HASH_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize tree context.",
+			 function );
+
+			goto on_error;
+		}
+		if( hash_pipeline_context_free(
+		     HASH_PIPELINE_DIGEST_TYPE_SHA256,
+		     &tree_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free tree context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( tree_context != NULL )
+	{
+		hash_pipeline_context_free(
+		 HASH_PIPELINE_DIGEST_TYPE_SHA256,
+		 &tree_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints a hash as a hexadecimal string
+ */
+void hash_pipeline_print_hash(
+      FILE *stream,
+      const uint8_t *hash,
+      size_t hash_size )
+{
+	size_t hash_index = 0;
+
+	for( hash_index = 0;
+	     hash_index < hash_size;
+	     hash_index++ )
+	{
+		fprintf(
+		 stream,
+		 "%02" PRIx8 "",
+		 hash[ hash_index ] );
+	}
+}
+
+/* Prints the hashes
+ * Returns 1 if successful or -1 on error
+ */
+int hash_pipeline_print(
+     hash_pipeline_t *hash_pipeline,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	const char *digest_names[ HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES ] = {
+		"MD5", "SHA1", "SHA256" };
+
+	hash_pipeline_digest_t *digest = NULL;
+	static char *function          = "hash_pipeline_print";
+	size64_t piece_size            = 0;
+	off64_t piece_offset           = 0;
+	int digest_type                = 0;
+	int piece_index                = 0;
+
+	if( hash_pipeline == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash pipeline.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_pipeline->finalized == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash pipeline - not finalized.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	for( digest_type = 0;
+	     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+	     digest_type++ )
+	{
+		digest = &( hash_pipeline->digests[ digest_type ] );
+
+		if( digest->context == NULL )
+		{
+			continue;
+		}
+		fprintf(
+		 stream,
+		 "%s hash calculated over data:\t%s",
+		 digest_names[ digest_type ],
+		 ( digest_type == HASH_PIPELINE_DIGEST_TYPE_SHA256 ) ? "" : "\t" );
+
+		hash_pipeline_print_hash(
+		 stream,
+		 digest->hash,
+		 digest->hash_size );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	if( ( hash_pipeline->flags & HASH_PIPELINE_CALCULATE_TREE ) != 0 )
+	{
+		fprintf(
+		 stream,
+		 "SHA256 tree hash of %d blocks of %d bytes:\t",
+		 hash_pipeline->number_of_blocks,
+		 HASH_PIPELINE_BUFFER_SIZE );
+
+		hash_pipeline_print_hash(
+		 stream,
+		 hash_pipeline->tree_hash,
+		 LIBHMAC_SHA256_HASH_SIZE );
+
+		fprintf(
+		 stream,
+		 "\n" );
+	}
+	if( hash_pipeline->piece_size > 0 )
+	{
+		fprintf(
+		 stream,
+		 "\nPiecewise hashes of %" PRIu64 " bytes:\n",
+		 hash_pipeline->piece_size );
+
+		for( piece_index = 0;
+		     piece_index < hash_pipeline->maximum_number_of_pieces;
+		     piece_index++ )
+		{
+			piece_size = hash_pipeline->stream_size - (size64_t) piece_offset;
+
+			if( piece_size > hash_pipeline->piece_size )
+			{
+				piece_size = hash_pipeline->piece_size;
+			}
+			fprintf(
+			 stream,
+			 "Piece: %d offset: %" PRIi64 " size: %" PRIu64 "\n",
+			 piece_index + 1,
+			 piece_offset,
+			 piece_size );
+
+			for( digest_type = 0;
+			     digest_type < HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES;
+			     digest_type++ )
+			{
+				digest = &( hash_pipeline->digests[ digest_type ] );
+
+				if( ( digest->context == NULL )
+				 || ( piece_index >= digest->number_of_pieces ) )
+				{
+					continue;
+				}
+				fprintf(
+				 stream,
+				 "\t%s:\t",
+				 digest_names[ digest_type ] );
+
+				hash_pipeline_print_hash(
+				 stream,
+				 &( digest->piece_hashes[ piece_index * digest->hash_size ] ),
+				 digest->hash_size );
+
+				fprintf(
+				 stream,
+				 "\n" );
+			}
+			piece_offset += (off64_t) piece_size;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,309 @@
+/*
+ * Single pass hashing of an exported data stream
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HASH_PIPELINE_H )
+#define _HASH_PIPELINE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcthreads.h"
+#include "fvdetools_libhmac.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of a pipeline buffer and of a tree hash block (1 MiB)
+ */
+#define HASH_PIPELINE_BUFFER_SIZE			( 1024 * 1024 )
+
+/* The number of buffers shared between the producer and the digest threads
+ */
+#define HASH_PIPELINE_NUMBER_OF_BUFFERS			8
+
+/* The default number of threads that calculate tree hash blocks
+ */
+#define HASH_PIPELINE_DEFAULT_NUMBER_OF_TREE_THREADS	4
+
+/* The maximum number of threads that calculate tree hash blocks
+ */
+#define HASH_PIPELINE_MAXIMUM_NUMBER_OF_TREE_THREADS	32
+
+/* The maximum size of a hash
+ */
+#define HASH_PIPELINE_MAXIMUM_HASH_SIZE			32
+
+/* The digest types
+ */
+#define HASH_PIPELINE_DIGEST_TYPE_MD5			0
+#define HASH_PIPELINE_DIGEST_TYPE_SHA1			1
+#define HASH_PIPELINE_DIGEST_TYPE_SHA256		2
+
+#define HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES		3
+
+/* The flags that select the hashes to calculate
+ */
+#define HASH_PIPELINE_CALCULATE_MD5			0x01
+#define HASH_PIPELINE_CALCULATE_SHA1			0x02
+#define HASH_PIPELINE_CALCULATE_SHA256			0x04
+#define HASH_PIPELINE_CALCULATE_TREE			0x08
+
+typedef struct hash_pipeline hash_pipeline_t;
+
+typedef struct hash_pipeline_buffer hash_pipeline_buffer_t;
+
+struct hash_pipeline_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the data in the stream
+	 */
+	off64_t offset;
+
+	/* The number of consumers that did not process the data yet
+	 */
+	int reference_count;
+};
+
+typedef struct hash_pipeline_digest hash_pipeline_digest_t;
+
+struct hash_pipeline_digest
+{
+	/* The pipeline (not owned)
+	 */
+	hash_pipeline_t *pipeline;
+
+	/* The digest type
+	 */
+	int type;
+
+	/* The hash size
+	 */
+	size_t hash_size;
+
+	/* The context of the hash of the entire stream
+	 */
+	intptr_t *context;
+
+	/* The hash of the entire stream
+	 */
+	uint8_t hash[ HASH_PIPELINE_MAXIMUM_HASH_SIZE ];
+
+	/* The context of the hash of the current piece
+	 */
+	intptr_t *piece_context;
+
+	/* The amount of data in the current piece
+	 */
+	size64_t piece_data_size;
+
+	/* The piecewise hashes
+	 */
+	uint8_t *piece_hashes;
+
+	/* The number of piecewise hashes
+	 */
+	int number_of_pieces;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool with the single thread that processes the buffers in order
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+#endif
+};
+
+struct hash_pipeline
+{
+	/* The flags
+	 */
+	int flags;
+
+	/* The size of the stream
+	 */
+	size64_t stream_size;
+
+	/* The offset in the stream of the next buffer
+	 */
+	off64_t stream_offset;
+
+	/* The piece size, 0 if no piecewise hashes are calculated
+	 */
+	size64_t piece_size;
+
+	/* The maximum number of piecewise hashes
+	 */
+	int maximum_number_of_pieces;
+
+	/* The digests of the entire stream and the pieces
+	 */
+	hash_pipeline_digest_t digests[ HASH_PIPELINE_NUMBER_OF_DIGEST_TYPES ];
+
+	/* The tree block hashes
+	 */
+	uint8_t *block_hashes;
+
+	/* The number of tree blocks
+	 */
+	int number_of_blocks;
+
+	/* The tree hash
+	 */
+	uint8_t tree_hash[ 32 ];
+
+	/* The number of consumers of every buffer
+	 */
+	int number_of_consumers;
+
+	/* The buffers
+	 */
+	hash_pipeline_buffer_t buffers[ HASH_PIPELINE_NUMBER_OF_BUFFERS ];
+
+	/* Value to indicate a consumer failed
+	 */
+	int consumer_failed;
+
+	/* Value to indicate the hashes were finalized
+	 */
+	int finalized;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The thread pool that calculates the tree block hashes
+	 */
+	libcthreads_thread_pool_t *tree_thread_pool;
+
+	/* The queue of buffers that are available to the producer
+	 */
+	libcthreads_queue_t *free_queue;
+
+	/* Mutex protecting the reference counts and the consumer failed value
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int hash_pipeline_initialize(
+     hash_pipeline_t **hash_pipeline,
+     int flags,
+     size64_t stream_size,
+     size64_t piece_size,
+     int number_of_tree_threads,
+     libcerror_error_t **error );
+
+int hash_pipeline_free(
+     hash_pipeline_t **hash_pipeline,
+     libcerror_error_t **error );
+
+int hash_pipeline_context_initialize(
+     int digest_type,
+     intptr_t **context,
+     libcerror_error_t **error );
+
+int hash_pipeline_context_free(
+     int digest_type,
+     intptr_t **context,
+     libcerror_error_t **error );
+
+int hash_pipeline_context_update(
+     int digest_type,
+     intptr_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int hash_pipeline_context_finalize(
+     int digest_type,
+     intptr_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+int hash_pipeline_get_buffer(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t **buffer,
+     libcerror_error_t **error );
+
+int hash_pipeline_push_buffer(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t *buffer,
+     libcerror_error_t **error );
+
+int hash_pipeline_release_buffer(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t *buffer,
+     int result,
+     libcerror_error_t **error );
+
+int hash_pipeline_digest_update(
+     hash_pipeline_digest_t *digest,
+     hash_pipeline_buffer_t *buffer,
+     libcerror_error_t **error );
+
+int hash_pipeline_calculate_block_hash(
+     hash_pipeline_t *hash_pipeline,
+     hash_pipeline_buffer_t *buffer,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int hash_pipeline_digest_callback(
+     hash_pipeline_buffer_t *buffer,
+     hash_pipeline_digest_t *digest );
+
+int hash_pipeline_block_callback(
+     hash_pipeline_buffer_t *buffer,
+     hash_pipeline_t *hash_pipeline );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int hash_pipeline_join(
+     hash_pipeline_t *hash_pipeline,
+     libcerror_error_t **error );
+
+int hash_pipeline_finalize(
+     hash_pipeline_t *hash_pipeline,
+     libcerror_error_t **error );
+
+void hash_pipeline_print_hash(
+      FILE *stream,
+      const uint8_t *hash,
+      size_t hash_size );
+
+int hash_pipeline_print(
+     hash_pipeline_t *hash_pipeline,
+     FILE *stream,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HASH_PIPELINE_H ) */
+
@@ -0,0 +1,1355 @@
+/*
+ * Info batch
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fvdetools_libcdata.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcnotify.h"
+#include "fvdetools_libcthreads.h"
+#include "info_batch.h"
+#include "info_handle.h"
+#include "json_writer.h"
+
+#define INFO_BATCH_OUTPUT_STREAM		stdout
+
+/* Frees a source
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_source_free(
+     system_character_t **source,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_source_free";
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( *source != NULL )
+	{
+		memory_free(
+		 *source );
+
+		*source = NULL;
+	}
+	return( 1 );
+}
+
+/* Creates an info batch
+ * Make sure the value info_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_initialize(
+     info_batch_t **info_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_initialize";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*info_batch = memory_allocate_structure(
+	               info_batch_t );
+
+	if( *info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create info batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *info_batch,
+	     0,
+	     sizeof( info_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear info batch.",
+		 function );
+
+		memory_free(
+		 *info_batch );
+
+		*info_batch = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *info_batch )->sources_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sources array.",
+		 function );
+
+		goto on_error;
+	}
+	( *info_batch )->output_stream = INFO_BATCH_OUTPUT_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *info_batch != NULL )
+	{
+		memory_free(
+		 *info_batch );
+
+		*info_batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an info batch
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_free(
+     info_batch_t **info_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_free";
+	int result            = 1;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *info_batch != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *info_batch )->output_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *info_batch )->output_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free output mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( libcdata_array_free(
+		     &( ( *info_batch )->sources_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &info_batch_source_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sources array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *info_batch );
+
+		*info_batch = NULL;
+	}
+	return( result );
+}
+
+/* Signals the info batch to abort
+ * Sources that are being processed are completed, remaining sources are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_signal_abort(
+     info_batch_t *info_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_signal_abort";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	info_batch->abort = 1;
+
+	return( 1 );
+}
+
+/* Appends a source
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_append_source(
+     info_batch_t *info_batch,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error )
+{
+	system_character_t *source_copy = NULL;
+	static char *function           = "info_batch_append_source";
+	int entry_index                 = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( source_length == 0 )
+	 || ( source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	source_copy = system_string_allocate(
+	               source_length + 1 );
+
+	if( source_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     source_copy,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source.",
+		 function );
+
+		goto on_error;
+	}
+	source_copy[ source_length ] = 0;
+
+	if( libcdata_array_append_entry(
+	     info_batch->sources_array,
+	     &entry_index,
+	     (intptr_t *) source_copy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append source to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( source_copy != NULL )
+	{
+		memory_free(
+		 source_copy );
+	}
+	return( -1 );
+}
+
+/* Reads the sources from a file that contains one source per line
+ * Empty lines and lines that start with # are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_read_sources_file(
+     info_batch_t *info_batch,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t line[ INFO_BATCH_MAXIMUM_LINE_SIZE ];
+
+	FILE *file_stream     = NULL;
+	static char *function = "info_batch_read_sources_file";
+	size_t line_length    = 0;
+	int line_number       = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               filename,
+	               _SYSTEM_STRING( "r" ) );
+#else
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open sources file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	while( file_stream_get_string_wide(
+	        file_stream,
+	        line,
+	        INFO_BATCH_MAXIMUM_LINE_SIZE ) != NULL )
+#else
+	while( file_stream_get_string(
+	        file_stream,
+	        line,
+	        INFO_BATCH_MAXIMUM_LINE_SIZE ) != NULL )
+#endif
+	{
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] != (system_character_t) '\n' )
+		 && ( file_stream_at_end(
+		       file_stream ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: line: %d in sources file exceeds maximum size.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		while( ( line_length > 0 )
+		    && ( ( line[ line_length - 1 ] == (system_character_t) '\n' )
+		     ||  ( line[ line_length - 1 ] == (system_character_t) '\r' ) ) )
+		{
+			line_length--;
+		}
+		if( ( line_length == 0 )
+		 || ( line[ 0 ] == (system_character_t) '#' ) )
+		{
+			continue;
+		}
+		if( info_batch_append_source(
+		     info_batch,
+		     line,
+		     line_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source of line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		file_stream = NULL;
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close sources file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of sources
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_get_number_of_sources(
+     info_batch_t *info_batch,
+     int *number_of_sources,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_get_number_of_sources";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     info_batch->sources_array,
+	     number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Applies the batch options to an info handle
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_set_info_handle_options(
+     info_batch_t *info_batch,
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "info_batch_set_info_handle_options";
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_batch->encrypted_root_plist_path != NULL )
+	{
+		if( info_handle_set_encrypted_root_plist(
+		     info_handle,
+		     info_batch->encrypted_root_plist_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path of EncryptedRoot.plist.wipekey file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_batch->key != NULL )
+	{
+		if( info_handle_set_key(
+		     info_handle,
+		     info_batch->key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_batch->password != NULL )
+	{
+		if( info_handle_set_password(
+		     info_handle,
+		     info_batch->password,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set password.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_batch->recovery_password != NULL )
+	{
+		if( info_handle_set_recovery_password(
+		     info_handle,
+		     info_batch->recovery_password,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set recovery password.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_batch->volume_offset != NULL )
+	{
+		if( info_handle_set_volume_offset(
+		     info_handle,
+		     info_batch->volume_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( info_handle_set_metadata_only(
+	     info_handle,
+	     info_batch->metadata_only,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set metadata only.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes a record to the output stream
+ * The record is written at once so that records of concurrently processed sources do not interleave
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_write_record(
+     info_batch_t *info_batch,
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	const uint8_t *data   = NULL;
+	static char *function = "info_batch_write_record";
+	size_t data_size      = 0;
+	size_t write_count    = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_get_data(
+	     json_writer,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_batch->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_grab(
+		     info_batch->output_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab output mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	write_count = file_stream_write(
+	               info_batch->output_stream,
+	               data,
+	               data_size );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( info_batch->output_mutex != NULL )
+	{
+		if( libcthreads_mutex_release(
+		     info_batch->output_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release output mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Processes a single source and writes its record
+ * A source that cannot be opened results in an error record, not in an error
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_process_source(
+     info_batch_t *info_batch,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	char error_string[ 2048 ];
+
+	info_handle_t *info_handle      = NULL;
+	json_writer_t *json_writer      = NULL;
+	libcerror_error_t *source_error = NULL;
+	static char *function           = "info_batch_process_source";
+	size_t error_string_length      = 0;
+	size_t source_length            = 0;
+	int print_count                 = 0;
+	int result                      = 0;
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	source_length = system_string_length(
+	                 source );
+
+	if( json_writer_initialize(
+	     &json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create JSON writer.",
+		 function );
+
+		goto on_error;
+	}
+	/* Each source is processed in unattended mode since there is no sensible way to prompt
+	 * for passwords of concurrently processed sources
+	 */
+	result = info_handle_initialize(
+	          &info_handle,
+	          1,
+	          &source_error );
+
+	if( result == 1 )
+	{
+		result = info_batch_set_info_handle_options(
+		          info_batch,
+		          info_handle,
+		          &source_error );
+	}
+	if( result == 1 )
+	{
+		result = info_handle_open(
+		          info_handle,
+		          (system_character_t * const *) &source,
+		          1,
+		          &source_error );
+	}
+	if( result == 1 )
+	{
+		if( json_writer_object_start(
+		     json_writer,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_key(
+		     json_writer,
+		     "source",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_system_string_value(
+		     json_writer,
+		     source,
+		     source_length,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_key(
+		     json_writer,
+		     "status",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_utf8_string_value(
+		     json_writer,
+		     (uint8_t *) "ok",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		result = info_handle_volume_json_write(
+		          info_handle,
+		          json_writer,
+		          &source_error );
+	}
+	if( result == 1 )
+	{
+		if( json_writer_object_end(
+		     json_writer,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	else
+	{
+		error_string_length = 0;
+
+		if( source_error != NULL )
+		{
+			print_count = libcerror_error_backtrace_sprint(
+			               source_error,
+			               error_string,
+			               2048 );
+
+			if( print_count <= 0 )
+			{
+				print_count = libcerror_error_sprint(
+				               source_error,
+				               error_string,
+				               2048 );
+			}
+			if( print_count > 0 )
+			{
+				error_string_length = narrow_string_length(
+				                       error_string );
+			}
+			libcerror_error_free(
+			 &source_error );
+		}
+		while( ( error_string_length > 0 )
+		    && ( ( error_string[ error_string_length - 1 ] == '\n' )
+		     ||  ( error_string[ error_string_length - 1 ] == '\r' ) ) )
+		{
+			error_string_length--;
+		}
+		if( json_writer_reset(
+		     json_writer,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_object_start(
+		     json_writer,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_key(
+		     json_writer,
+		     "source",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_system_string_value(
+		     json_writer,
+		     source,
+		     source_length,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_key(
+		     json_writer,
+		     "status",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_utf8_string_value(
+		     json_writer,
+		     (uint8_t *) "error",
+		     5,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_key(
+		     json_writer,
+		     "error",
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_utf8_string_value(
+		     json_writer,
+		     (uint8_t *) error_string,
+		     error_string_length,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+		if( json_writer_object_end(
+		     json_writer,
+		     error ) != 1 )
+		{
+			goto on_write_error;
+		}
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "\n",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle != NULL )
+	{
+		/* info_handle_free closes the handle if it was opened
+		 */
+		if( info_handle_free(
+		     &info_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free info handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_batch_write_record(
+	     info_batch,
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write record.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_writer_free(
+	     &json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free JSON writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to write record.",
+	 function );
+
+on_error:
+	if( source_error != NULL )
+	{
+		libcerror_error_free(
+		 &source_error );
+	}
+	if( info_handle != NULL )
+	{
+		info_handle_free(
+		 &info_handle,
+		 NULL );
+	}
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to process a source from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_process_source_callback(
+     system_character_t *source,
+     info_batch_t *info_batch )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "info_batch_process_source_callback";
+
+	if( info_batch == NULL )
+	{
+		return( -1 );
+	}
+	if( info_batch->abort != 0 )
+	{
+		return( 1 );
+	}
+	if( info_batch_process_source(
+	     info_batch,
+	     source,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process source.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcnotify_print_error_backtrace(
+	 error );
+	libcerror_error_free(
+	 &error );
+
+	/* The error is reported by the thread that joins the thread pool
+	 */
+	info_batch->output_failed = 1;
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Processes the sources, one record is written per source
+ * Up to number_of_threads sources are processed concurrently if multi-threading is supported
+ * Returns 1 if successful or -1 on error
+ */
+int info_batch_run(
+     info_batch_t *info_batch,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	system_character_t *source = NULL;
+	static char *function      = "info_batch_run";
+	int number_of_sources      = 0;
+	int source_index           = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+
+	if( info_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > INFO_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     info_batch->sources_array,
+	     &number_of_sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sources.",
+		 function );
+
+		goto on_error;
+	}
+	info_batch->output_failed = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_sources > 1 ) )
+	{
+		if( number_of_threads > number_of_sources )
+		{
+			number_of_threads = number_of_sources;
+		}
+		if( libcthreads_mutex_initialize(
+		     &( info_batch->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create output mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     number_of_sources,
+		     (int (*)(intptr_t *, void *)) &info_batch_process_source_callback,
+		     (void *) info_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( source_index = 0;
+		     source_index < number_of_sources;
+		     source_index++ )
+		{
+			if( info_batch->abort != 0 )
+			{
+				break;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     info_batch->sources_array,
+			     source_index,
+			     (intptr_t **) &source,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve source: %d.",
+				 function,
+				 source_index );
+
+				goto on_error;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) source,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push source: %d onto thread pool.",
+				 function,
+				 source_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_mutex_free(
+		     &( info_batch->output_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_batch->output_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to process sources.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( info_batch->abort != 0 )
+		{
+			break;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     info_batch->sources_array,
+		     source_index,
+		     (intptr_t **) &source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source: %d.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		if( info_batch_process_source(
+		     info_batch,
+		     source,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process source: %d.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( info_batch->output_mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( info_batch->output_mutex ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,168 @@
+/*
+ * Info batch
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INFO_BATCH_H )
+#define _INFO_BATCH_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fvdetools_libcdata.h"
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libcthreads.h"
+#include "info_handle.h"
+#include "json_writer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of images that are processed concurrently
+ */
+#define INFO_BATCH_DEFAULT_NUMBER_OF_THREADS	4
+
+/* The maximum number of images that are processed concurrently
+ */
+#define INFO_BATCH_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum size of a line in a sources file
+ */
+#define INFO_BATCH_MAXIMUM_LINE_SIZE		4096
+
+typedef struct info_batch info_batch_t;
+
+struct info_batch
+{
+	/* The sources array
+	 */
+	libcdata_array_t *sources_array;
+
+	/* The encrypted root plist path
+	 */
+	const system_character_t *encrypted_root_plist_path;
+
+	/* The key
+	 */
+	const system_character_t *key;
+
+	/* The password
+	 */
+	const system_character_t *password;
+
+	/* The recovery password
+	 */
+	const system_character_t *recovery_password;
+
+	/* The volume offset
+	 */
+	const system_character_t *volume_offset;
+
+	/* Value to indicate if unlocking should be skipped when no keys are provided
+	 */
+	int metadata_only;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The output mutex
+	 */
+	libcthreads_mutex_t *output_mutex;
+#endif
+
+	/* Value to indicate writing a record failed
+	 */
+	int output_failed;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int info_batch_source_free(
+     system_character_t **source,
+     libcerror_error_t **error );
+
+int info_batch_initialize(
+     info_batch_t **info_batch,
+     libcerror_error_t **error );
+
+int info_batch_free(
+     info_batch_t **info_batch,
+     libcerror_error_t **error );
+
+int info_batch_signal_abort(
+     info_batch_t *info_batch,
+     libcerror_error_t **error );
+
+int info_batch_append_source(
+     info_batch_t *info_batch,
+     const system_character_t *source,
+     size_t source_length,
+     libcerror_error_t **error );
+
+int info_batch_read_sources_file(
+     info_batch_t *info_batch,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int info_batch_get_number_of_sources(
+     info_batch_t *info_batch,
+     int *number_of_sources,
+     libcerror_error_t **error );
+
+int info_batch_set_info_handle_options(
+     info_batch_t *info_batch,
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+int info_batch_write_record(
+     info_batch_t *info_batch,
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int info_batch_process_source(
+     info_batch_t *info_batch,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int info_batch_process_source_callback(
+     system_character_t *source,
+     info_batch_t *info_batch );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+int info_batch_run(
+     info_batch_t *info_batch,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INFO_BATCH_H ) */
+
@@ -38,6 +38,7 @@
 #include "fvdetools_libfvde.h"
 #include "fvdetools_libuna.h"
 #include "info_handle.h"
+#include "json_writer.h"
 
 #if !defined( LIBFVDE_HAVE_BFIO )
 
@@ -375,6 +376,22 @@ int info_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	if( info_handle->volume_scanner != NULL )
+	{
+		if( libfvde_volume_scanner_signal_abort(
+		     info_handle->volume_scanner,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal volume scanner to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	info_handle->abort = 1;
 
 	return( 1 );
@@ -643,6 +660,33 @@ int info_handle_set_volume_offset(
 	return( 1 );
 }
 
+/* Sets if the logical volumes should not be unlocked when no keys are provided
+ * This allows to stop after the metadata has been read
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_set_metadata_only(
+     info_handle_t *info_handle,
+     int metadata_only,
+     libcerror_error_t **error )
+{
+	static char *function = "info_handle_set_metadata_only";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	info_handle->metadata_only = metadata_only;
+
+	return( 1 );
+}
+
 /* Opens the info handle
  * Returns 1 if successful or -1 on error
  */
@@ -664,6 +708,7 @@ int info_handle_open(
 	int logical_volume_index                 = 0;
 	int number_of_logical_volumes            = 0;
 	int result                               = 0;
+	int skip_unlock                          = 0;
 
 	if( info_handle == NULL )
 	{
@@ -975,6 +1020,16 @@ int info_handle_open(
 
 		goto on_error;
 	}
+	/* Unlocking reads the encryption context and derives the volume keys,
+	 * which is not needed to report the metadata when no keys are provided
+	 */
+	if( ( info_handle->metadata_only != 0 )
+	 && ( info_handle->key_data_size == 0 )
+	 && ( info_handle->user_password == NULL )
+	 && ( info_handle->recovery_password == NULL ) )
+	{
+		skip_unlock = 1;
+	}
 	for( logical_volume_index = 0;
 	     logical_volume_index < number_of_logical_volumes;
 	     logical_volume_index++ )
@@ -995,129 +1050,65 @@ int info_handle_open(
 
 			goto on_error;
 		}
-		if( info_handle->key_data_size != 0 )
+		if( skip_unlock == 0 )
 		{
-			if( libfvde_logical_volume_set_key(
-			     logical_volume,
-			     info_handle->key_data,
-			     16,
-			     error ) != 1 )
+			if( info_handle->key_data_size != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set key.",
-				 function );
+				if( libfvde_logical_volume_set_key(
+				     logical_volume,
+				     info_handle->key_data,
+				     16,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set key.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
 			}
-		}
-		if( info_handle->user_password != NULL )
-		{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( libfvde_logical_volume_set_utf16_password(
-			     logical_volume,
-			     (uint16_t *) info_handle->user_password,
-			     info_handle->user_password_length,
-			     error ) != 1 )
-#else
-			if( libfvde_logical_volume_set_utf8_password(
-			     logical_volume,
-			     (uint8_t *) info_handle->user_password,
-			     info_handle->user_password_length,
-			     error ) != 1 )
-#endif
+			if( info_handle->user_password != NULL )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set password.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		if( info_handle->recovery_password != NULL )
-		{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			if( libfvde_logical_volume_set_utf16_recovery_password(
-			     logical_volume,
-			     (uint16_t *) info_handle->recovery_password,
-			     info_handle->recovery_password_length,
-			     error ) != 1 )
+				if( libfvde_logical_volume_set_utf16_password(
+				     logical_volume,
+				     (uint16_t *) info_handle->user_password,
+				     info_handle->user_password_length,
+				     error ) != 1 )
 #else
-			if( libfvde_logical_volume_set_utf8_recovery_password(
-			     logical_volume,
-			     (uint8_t *) info_handle->recovery_password,
-			     info_handle->recovery_password_length,
-			     error ) != 1 )
+				if( libfvde_logical_volume_set_utf8_password(
+				     logical_volume,
+				     (uint8_t *) info_handle->user_password,
+				     info_handle->user_password_length,
+				     error ) != 1 )
 #endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set recovery password.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		result = libfvde_logical_volume_unlock(
-		          logical_volume,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to unlock logical volume.",
-			 function );
-
-			goto on_error;
-		}
-		else if( ( result == 0 )
-		      && ( info_handle->unattended_mode == 0 ) )
-		{
-/* TODO print logical volume identifier and/or name */
-			fprintf(
-			 stdout,
-			 "Logical volume: %d is locked and a password is needed to unlock it.\n\n",
-			 logical_volume_index + 1 );
-
-			if( fvdetools_prompt_for_password(
-			     stdout,
-			     "Password",
-			     password,
-			     64,
-			     error ) != 1 )
-			{
-				fprintf(
-				 stderr,
-				 "Unable to retrieve password.\n" );
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set password.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
 			}
-			password_length = system_string_length(
-			                   password );
-
-			if( password_length > 0 )
+			if( info_handle->recovery_password != NULL )
 			{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				if( libfvde_logical_volume_set_utf16_password(
+				if( libfvde_logical_volume_set_utf16_recovery_password(
 				     logical_volume,
-				     (uint16_t *) password,
-				     password_length,
+				     (uint16_t *) info_handle->recovery_password,
+				     info_handle->recovery_password_length,
 				     error ) != 1 )
 #else
-				if( libfvde_logical_volume_set_utf8_password(
+				if( libfvde_logical_volume_set_utf8_recovery_password(
 				     logical_volume,
-				     (uint8_t *) password,
-				     password_length,
+				     (uint8_t *) info_handle->recovery_password,
+				     info_handle->recovery_password_length,
 				     error ) != 1 )
 #endif
 				{
@@ -1125,20 +1116,12 @@ int info_handle_open(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set password.",
+					 "%s: unable to set recovery password.",
 					 function );
 
 					goto on_error;
 				}
-				memory_set(
-				 password,
-				 0,
-				 64 );
 			}
-			fprintf(
-			 stdout,
-			 "\n\n" );
-
 			result = libfvde_logical_volume_unlock(
 			          logical_volume,
 			          error );
@@ -1154,11 +1137,86 @@ int info_handle_open(
 
 				goto on_error;
 			}
-			else if( result == 0 )
+			else if( ( result == 0 )
+			      && ( info_handle->unattended_mode == 0 ) )
 			{
+				/* TODO print logical volume identifier and/or name */
+				fprintf(
+				 stdout,
+				 "Logical volume: %d is locked and a password is needed to unlock it.\n\n",
+				 logical_volume_index + 1 );
+
+				if( fvdetools_prompt_for_password(
+				     stdout,
+				     "Password",
+				     password,
+				     64,
+				     error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to retrieve password.\n" );
+
+					goto on_error;
+				}
+				password_length = system_string_length(
+				                   password );
+
+				if( password_length > 0 )
+				{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+					if( libfvde_logical_volume_set_utf16_password(
+					     logical_volume,
+					     (uint16_t *) password,
+					     password_length,
+					     error ) != 1 )
+#else
+					if( libfvde_logical_volume_set_utf8_password(
+					     logical_volume,
+					     (uint8_t *) password,
+					     password_length,
+					     error ) != 1 )
+#endif
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to set password.",
+						 function );
+
+						goto on_error;
+					}
+					memory_set(
+					 password,
+					 0,
+					 64 );
+				}
 				fprintf(
 				 stdout,
-				 "Unable to unlock volume.\n\n" );
+				 "\n\n" );
+
+				result = libfvde_logical_volume_unlock(
+				          logical_volume,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to unlock logical volume.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					fprintf(
+					 stdout,
+					 "Unable to unlock volume.\n\n" );
+				}
 			}
 		}
 		if( libcdata_array_append_entry(
@@ -1350,20 +1408,29 @@ int info_handle_close(
 	return( result );
 }
 
-/* Prints an UUID value
+/* Scans a source for CoreStorage volume headers and prints their offsets
  * Returns 1 if successful or -1 on error
  */
-int info_handle_uuid_value_fprint(
+int info_handle_scan_fprint(
      info_handle_t *info_handle,
-     const char *value_name,
-     const uint8_t *uuid_data,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	system_character_t uuid_string[ 48 ];
+	uint8_t uuid_data[ 16 ];
 
-	libfguid_identifier_t *uuid = NULL;
-	static char *function       = "info_handle_uuid_value_fprint";
-	int result                  = 0;
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "info_handle_scan_fprint";
+	size64_t read_error_size         = 0;
+	size64_t volume_size             = 0;
+	size_t filename_length           = 0;
+	off64_t metadata_offset          = 0;
+	off64_t read_error_offset        = 0;
+	off64_t volume_offset            = 0;
+	int metadata_index               = 0;
+	int number_of_read_errors        = 0;
+	int number_of_volume_headers     = 0;
+	int read_error_index             = 0;
+	int volume_header_index          = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1376,108 +1443,1182 @@ int info_handle_uuid_value_fprint(
 
 		return( -1 );
 	}
-	if( libfguid_identifier_initialize(
-	     &uuid,
-	     error ) != 1 )
+	if( info_handle->volume_scanner != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create UUID.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid info handle - volume scanner value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfguid_identifier_copy_from_byte_stream(
-	     uuid,
-	     uuid_data,
-	     16,
-	     LIBFGUID_ENDIAN_BIG,
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy byte stream to UUID.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle.",
 		 function );
 
 		goto on_error;
 	}
+	filename_length = system_string_length(
+	                   filename );
+
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfguid_identifier_copy_to_utf16_string(
-		  uuid,
-		  (uint16_t *) uuid_string,
-		  48,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-		  error );
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
 #else
-	result = libfguid_identifier_copy_to_utf8_string(
-		  uuid,
-		  (uint8_t *) uuid_string,
-		  48,
-		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
-		  error );
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
 #endif
-	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to set name of file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_scanner_initialize(
+	     &( info_handle->volume_scanner ),
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy UUID to string.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume scanner.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "%s: %" PRIs_SYSTEM "\n",
-	 value_name,
-	 uuid_string );
+	if( libfvde_volume_scanner_scan_file_io_handle(
+	     info_handle->volume_scanner,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan file IO handle.",
+		 function );
 
-	if( libfguid_identifier_free(
-	     &uuid,
+		goto on_error;
+	}
+	if( libfvde_volume_scanner_get_number_of_volume_headers(
+	     info_handle->volume_scanner,
+	     &number_of_volume_headers,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free UUID.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of volume headers.",
 		 function );
 
 		goto on_error;
 	}
-	return( 1 );
-
-on_error:
-	if( uuid != NULL )
+	if( libfvde_volume_scanner_get_number_of_read_errors(
+	     info_handle->volume_scanner,
+	     &number_of_read_errors,
+	     error ) != 1 )
 	{
-		libfguid_identifier_free(
-		 &uuid,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read errors.",
+		 function );
+
+		goto on_error;
 	}
-	return( -1 );
-}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Core Storage volume header scan:\n" );
+
+	if( info_handle->abort != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tScan aborted, results are incomplete\n" );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of volume headers\t: %d\n",
+	 number_of_volume_headers );
+
+	if( number_of_read_errors > 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNumber of read errors\t\t: %d\n",
+		 number_of_read_errors );
+
+		for( read_error_index = 0;
+		     read_error_index < number_of_read_errors;
+		     read_error_index++ )
+		{
+			if( libfvde_volume_scanner_get_read_error_by_index(
+			     info_handle->volume_scanner,
+			     read_error_index,
+			     &read_error_offset,
+			     &read_error_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve read error: %d.",
+				 function,
+				 read_error_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t\tat offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+			 read_error_offset,
+			 read_error_offset,
+			 read_error_size );
+		}
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( volume_header_index = 0;
+	     volume_header_index < number_of_volume_headers;
+	     volume_header_index++ )
+	{
+		if( libfvde_volume_scanner_get_volume_header_offset(
+		     info_handle->volume_scanner,
+		     volume_header_index,
+		     &volume_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume header: %d offset.",
+			 function,
+			 volume_header_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "Volume header: %d\n"
+		 "\tVolume offset\t\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 volume_header_index + 1,
+		 volume_offset,
+		 volume_offset );
+
+		if( libfvde_volume_scanner_get_physical_volume_size(
+		     info_handle->volume_scanner,
+		     volume_header_index,
+		     &volume_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume header: %d physical volume size.",
+			 function,
+			 volume_header_index );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tPhysical volume size\t\t: %" PRIu64 " bytes\n",
+		 volume_size );
+
+		if( libfvde_volume_scanner_get_physical_volume_identifier(
+		     info_handle->volume_scanner,
+		     volume_header_index,
+		     uuid_data,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume header: %d physical volume identifier.",
+			 function,
+			 volume_header_index );
+
+			goto on_error;
+		}
+		if( info_handle_uuid_value_fprint(
+		     info_handle,
+		     "\tPhysical volume identifier\t",
+		     uuid_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print UUID value.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_volume_scanner_get_volume_group_identifier(
+		     info_handle->volume_scanner,
+		     volume_header_index,
+		     uuid_data,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume header: %d volume group identifier.",
+			 function,
+			 volume_header_index );
+
+			goto on_error;
+		}
+		if( info_handle_uuid_value_fprint(
+		     info_handle,
+		     "\tVolume group identifier\t\t",
+		     uuid_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print UUID value.",
+			 function );
+
+			goto on_error;
+		}
+		for( metadata_index = 0;
+		     metadata_index < 4;
+		     metadata_index++ )
+		{
+			if( libfvde_volume_scanner_get_metadata_offset(
+			     info_handle->volume_scanner,
+			     volume_header_index,
+			     metadata_index,
+			     &metadata_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve volume header: %d metadata: %d offset.",
+				 function,
+				 volume_header_index,
+				 metadata_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\tMetadata: %d offset\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 metadata_index + 1,
+			 metadata_offset,
+			 metadata_offset );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\n" );
+	}
+	if( libfvde_volume_scanner_free(
+	     &( info_handle->volume_scanner ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( info_handle->volume_scanner != NULL )
+	{
+		libfvde_volume_scanner_free(
+		 &( info_handle->volume_scanner ),
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints an UUID value
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_uuid_value_fprint(
+     info_handle_t *info_handle,
+     const char *value_name,
+     const uint8_t *uuid_data,
+     libcerror_error_t **error )
+{
+	system_character_t uuid_string[ 48 ];
+
+	libfguid_identifier_t *uuid = NULL;
+	static char *function       = "info_handle_uuid_value_fprint";
+	int result                  = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfguid_identifier_initialize(
+	     &uuid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create UUID.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfguid_identifier_copy_from_byte_stream(
+	     uuid,
+	     uuid_data,
+	     16,
+	     LIBFGUID_ENDIAN_BIG,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to UUID.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfguid_identifier_copy_to_utf16_string(
+		  uuid,
+		  (uint16_t *) uuid_string,
+		  48,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		  error );
+#else
+	result = libfguid_identifier_copy_to_utf8_string(
+		  uuid,
+		  (uint8_t *) uuid_string,
+		  48,
+		  LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UUID to string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "%s: %" PRIs_SYSTEM "\n",
+	 value_name,
+	 uuid_string );
+
+	if( libfguid_identifier_free(
+	     &uuid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free UUID.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( uuid != NULL )
+	{
+		libfguid_identifier_free(
+		 &uuid,
+		 NULL );
+	}
+	return( -1 );
+}
 
 /* Prints physcial volume information
  * Returns 1 if successful or -1 on error
  */
-int info_handle_physical_volume_fprint(
+int info_handle_physical_volume_fprint(
+     info_handle_t *info_handle,
+     int physical_volume_index,
+     libfvde_physical_volume_t *physical_volume,
+     libcerror_error_t **error )
+{
+        system_character_t byte_size_string[ 16 ];
+	uint8_t uuid_data[ 16 ];
+
+	static char *function      = "info_handle_physical_volume_fprint";
+	size64_t volume_size       = 0;
+	uint32_t encryption_method = 0;
+	int result                 = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Physical volume: %d\n",
+	 physical_volume_index + 1 );
+
+	if( libfvde_physical_volume_get_identifier(
+	     physical_volume,
+	     uuid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle_uuid_value_fprint(
+	     info_handle,
+	     "\tIdentifier\t\t\t",
+	     uuid_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print UUID value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_physical_volume_get_size(
+	     physical_volume,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSize\t\t\t\t: " );
+
+	result = byte_size_string_create(
+	          byte_size_string,
+	          16,
+	          volume_size,
+	          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+	          NULL );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
+		 byte_size_string,
+		 volume_size );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%" PRIu64 " bytes",
+		 volume_size );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( libfvde_physical_volume_get_encryption_method(
+	     physical_volume,
+	     &encryption_method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve encryption method.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tEncryption method\t\t: " );
+
+	if( encryption_method == LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "AES-XTS 128-bit" );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Unknown" );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+}
+
+/* Prints logical volume information
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_logical_volume_fprint(
+     info_handle_t *info_handle,
+     int logical_volume_index,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error )
+{
+        system_character_t byte_size_string[ 16 ];
+	uint8_t uuid_data[ 16 ];
+
+	system_character_t *value_string = NULL;
+	static char *function            = "info_handle_logical_volume_fprint";
+	size64_t volume_size             = 0;
+	size_t value_string_size         = 0;
+	int result                       = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Logical volume: %d\n",
+	 logical_volume_index + 1 );
+
+	if( libfvde_logical_volume_get_identifier(
+	     logical_volume,
+	     uuid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_uuid_value_fprint(
+	     info_handle,
+	     "\tIdentifier\t\t\t",
+	     uuid_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print UUID value.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tName\t\t\t\t:" );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfvde_logical_volume_get_utf16_name_size(
+	          logical_volume,
+	          &value_string_size,
+	          error );
+#else
+	result = libfvde_logical_volume_get_utf8_name_size(
+	          logical_volume,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume name string size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( value_string_size > 0 ) )
+	{
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create logical volume name string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfvde_logical_volume_get_utf16_name(
+		          logical_volume,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libfvde_logical_volume_get_utf8_name(
+		          logical_volume,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume name string.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 " %" PRIs_SYSTEM "",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( libfvde_logical_volume_get_size(
+	     logical_volume,
+	     &volume_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tSize\t\t\t\t: " );
+
+	result = byte_size_string_create(
+	          byte_size_string,
+	          16,
+	          volume_size,
+	          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
+	          NULL );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
+		 byte_size_string,
+		 volume_size );
+	}
+	else
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "%" PRIu64 " bytes",
+		 volume_size );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	result = libfvde_logical_volume_is_locked(
+	          logical_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if the logical volume is locked.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tIs locked\n" );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Prints the volume information to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	uint8_t uuid_data[ 16 ];
+
+	libfvde_logical_volume_t *logical_volume   = NULL;
+	libfvde_physical_volume_t *physical_volume = NULL;
+	system_character_t *value_string           = NULL;
+	static char *function                      = "info_handle_volume_fprint";
+	size_t value_string_size                   = 0;
+	int number_of_logical_volumes              = 0;
+	int number_of_physical_volumes             = 0;
+	int result                                 = 0;
+	int volume_index                           = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Core Storage information:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "Logical volume group:\n" );
+
+	if( libfvde_volume_group_get_identifier(
+	     info_handle->volume_group,
+	     uuid_data,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume group identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( info_handle_uuid_value_fprint(
+	     info_handle,
+	     "\tIdentifier\t\t\t",
+	     uuid_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print UUID value.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tName\t\t\t\t:" );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfvde_volume_group_get_utf16_name_size(
+	          info_handle->volume_group,
+	          &value_string_size,
+	          error );
+#else
+	result = libfvde_volume_group_get_utf8_name_size(
+	          info_handle->volume_group,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group name string size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( value_string_size > 0 ) )
+	{
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create volume group name string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfvde_volume_group_get_utf16_name(
+		          info_handle->volume_group,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libfvde_volume_group_get_utf8_name(
+		          info_handle->volume_group,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve volume group name string.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 " %" PRIs_SYSTEM "",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( libfvde_volume_group_get_number_of_physical_volumes(
+	     info_handle->volume_group,
+	     &number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of physical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of physical volumes\t: %d\n",
+	 number_of_physical_volumes );
+
+	if( libcdata_array_get_number_of_entries(
+	     info_handle->logical_volumes_array,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes from array.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tNumber of logical volumes\t: %d\n",
+	 number_of_logical_volumes );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	for( volume_index = 0;
+	     volume_index < number_of_physical_volumes;
+	     volume_index++ )
+	{
+		if( libfvde_volume_group_get_physical_volume_by_index(
+		     info_handle->volume_group,
+		     volume_index,
+		     &physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve physical volume: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( info_handle_physical_volume_fprint(
+		     info_handle,
+		     volume_index,
+		     physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print physical volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libfvde_physical_volume_free(
+		     &physical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free physical volume: %d.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	for( volume_index = 0;
+	     volume_index < number_of_logical_volumes;
+	     volume_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     info_handle->logical_volumes_array,
+		     volume_index,
+		     (intptr_t **) &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d from array.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		result = libfvde_logical_volume_is_locked(
+		          logical_volume,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if logical volume is locked.",
+			 function );
+
+			goto on_error;
+		}
+		if( info_handle_logical_volume_fprint(
+		     info_handle,
+		     volume_index,
+		     logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print logical volume: %d information.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( physical_volume != NULL )
+	{
+		libfvde_physical_volume_free(
+		 &physical_volume,
+		 NULL );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Writes physical volume information as a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_physical_volume_json_write(
      info_handle_t *info_handle,
-     int physical_volume_index,
      libfvde_physical_volume_t *physical_volume,
+     json_writer_t *json_writer,
      libcerror_error_t **error )
 {
-        system_character_t byte_size_string[ 16 ];
 	uint8_t uuid_data[ 16 ];
 
-	static char *function      = "info_handle_physical_volume_fprint";
-	size64_t volume_size       = 0;
-	uint32_t encryption_method = 0;
-	int result                 = 0;
+	const char *encryption_method_string = NULL;
+	static char *function                = "info_handle_physical_volume_json_write";
+	size64_t volume_size                 = 0;
+	uint32_t encryption_method           = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1490,11 +2631,6 @@ int info_handle_physical_volume_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Physical volume: %d\n",
-	 physical_volume_index + 1 );
-
 	if( libfvde_physical_volume_get_identifier(
 	     physical_volume,
 	     uuid_data,
@@ -1510,123 +2646,130 @@ int info_handle_physical_volume_fprint(
 
 		return( -1 );
 	}
-	if( info_handle_uuid_value_fprint(
-	     info_handle,
-	     "\tIdentifier\t\t\t",
-	     uuid_data,
+	if( libfvde_physical_volume_get_size(
+	     physical_volume,
+	     &volume_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print UUID value.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfvde_physical_volume_get_size(
+	if( libfvde_physical_volume_get_encryption_method(
 	     physical_volume,
-	     &volume_size,
+	     &encryption_method,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size.",
+		 "%s: unable to retrieve encryption method.",
 		 function );
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tSize\t\t\t\t: " );
-
-	result = byte_size_string_create(
-	          byte_size_string,
-	          16,
-	          volume_size,
-	          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
-	          NULL );
-
-	if( result == 1 )
+	if( encryption_method == LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
-		 byte_size_string,
-		 volume_size );
+		encryption_method_string = "AES-XTS 128-bit";
+	}
+	else
+	{
+		encryption_method_string = "Unknown";
+	}
+	if( json_writer_object_start(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "identifier",
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( json_writer_uuid_value(
+	     json_writer,
+	     uuid_data,
+	     16,
+	     error ) != 1 )
+	{
+		goto on_error;
 	}
-	else
+	if( json_writer_key(
+	     json_writer,
+	     "size",
+	     error ) != 1 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%" PRIu64 " bytes",
-		 volume_size );
+		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	if( libfvde_physical_volume_get_encryption_method(
-	     physical_volume,
-	     &encryption_method,
+	if( json_writer_unsigned_integer_value(
+	     json_writer,
+	     (uint64_t) volume_size,
 	     error ) != 1 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve encryption method.",
-		 function );
-
-		return( -1 );
+		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tEncryption method\t\t: " );
-
-	if( encryption_method == LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS )
+	if( json_writer_key(
+	     json_writer,
+	     "encryption_method",
+	     error ) != 1 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "AES-XTS 128-bit" );
+		goto on_error;
 	}
-	else
+	if( json_writer_utf8_string_value(
+	     json_writer,
+	     (uint8_t *) encryption_method_string,
+	     narrow_string_length(
+	      encryption_method_string ),
+	     error ) != 1 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Unknown" );
+		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+	if( json_writer_object_end(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to write physical volume.",
+	 function );
 
-	return( 1 );
+	return( -1 );
 }
 
-/* Prints logical volume information
+/* Writes logical volume information as a JSON object
  * Returns 1 if successful or -1 on error
  */
-int info_handle_logical_volume_fprint(
+int info_handle_logical_volume_json_write(
      info_handle_t *info_handle,
-     int logical_volume_index,
      libfvde_logical_volume_t *logical_volume,
+     json_writer_t *json_writer,
      libcerror_error_t **error )
 {
-        system_character_t byte_size_string[ 16 ];
 	uint8_t uuid_data[ 16 ];
 
-	system_character_t *value_string = NULL;
-	static char *function            = "info_handle_logical_volume_fprint";
-	size64_t volume_size             = 0;
-	size_t value_string_size         = 0;
-	int result                       = 0;
+	uint8_t *name_string     = NULL;
+	static char *function    = "info_handle_logical_volume_json_write";
+	size64_t volume_size     = 0;
+	size_t name_string_size  = 0;
+	int is_locked            = 0;
+	int number_of_extents    = 0;
+	int result               = 0;
 
 	if( info_handle == NULL )
 	{
@@ -1639,11 +2782,6 @@ int info_handle_logical_volume_fprint(
 
 		return( -1 );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Logical volume: %d\n",
-	 logical_volume_index + 1 );
-
 	if( libfvde_logical_volume_get_identifier(
 	     logical_volume,
 	     uuid_data,
@@ -1659,36 +2797,11 @@ int info_handle_logical_volume_fprint(
 
 		goto on_error;
 	}
-	if( info_handle_uuid_value_fprint(
-	     info_handle,
-	     "\tIdentifier\t\t\t",
-	     uuid_data,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print UUID value.",
-		 function );
-
-		goto on_error;
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tName\t\t\t\t:" );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfvde_logical_volume_get_utf16_name_size(
-	          logical_volume,
-	          &value_string_size,
-	          error );
-#else
 	result = libfvde_logical_volume_get_utf8_name_size(
 	          logical_volume,
-	          &value_string_size,
+	          &name_string_size,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -1701,12 +2814,12 @@ int info_handle_logical_volume_fprint(
 		goto on_error;
 	}
 	else if( ( result != 0 )
-	      && ( value_string_size > 0 ) )
+	      && ( name_string_size > 0 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		name_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * name_string_size );
 
-		if( value_string == NULL )
+		if( name_string == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -1717,20 +2830,11 @@ int info_handle_logical_volume_fprint(
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfvde_logical_volume_get_utf16_name(
-		          logical_volume,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libfvde_logical_volume_get_utf8_name(
-		          logical_volume,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( libfvde_logical_volume_get_utf8_name(
+		     logical_volume,
+		     name_string,
+		     name_string_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1741,20 +2845,7 @@ int info_handle_logical_volume_fprint(
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 " %" PRIs_SYSTEM "",
-		 value_string );
-
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
 	if( libfvde_logical_volume_get_size(
 	     logical_volume,
 	     &volume_size,
@@ -1769,41 +2860,25 @@ int info_handle_logical_volume_fprint(
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tSize\t\t\t\t: " );
-
-	result = byte_size_string_create(
-	          byte_size_string,
-	          16,
-	          volume_size,
-	          BYTE_SIZE_STRING_UNIT_MEBIBYTE,
-	          NULL );
-
-	if( result == 1 )
-	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%" PRIs_SYSTEM " (%" PRIu64 " bytes)",
-		 byte_size_string,
-		 volume_size );
-	}
-	else
+	if( libfvde_logical_volume_get_number_of_extents(
+	     logical_volume,
+	     &number_of_extents,
+	     error ) != 1 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "%" PRIu64 " bytes",
-		 volume_size );
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volume extents.",
+		 function );
 
-	result = libfvde_logical_volume_is_locked(
-	          logical_volume,
-	          error );
+		goto on_error;
+	}
+	is_locked = libfvde_logical_volume_is_locked(
+	             logical_volume,
+	             error );
 
-	if( result == -1 )
+	if( is_locked == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1814,114 +2889,176 @@ int info_handle_logical_volume_fprint(
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	if( json_writer_object_start(
+	     json_writer,
+	     error ) != 1 )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "\tIs locked\n" );
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "identifier",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_uuid_value(
+	     json_writer,
+	     uuid_data,
+	     16,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "name",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( name_string != NULL )
+	{
+		result = json_writer_utf8_string_value(
+		          json_writer,
+		          name_string,
+		          name_string_size - 1,
+		          error );
+	}
+	else
+	{
+		result = json_writer_null_value(
+		          json_writer,
+		          error );
+	}
+	if( result != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "size",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_unsigned_integer_value(
+	     json_writer,
+	     (uint64_t) volume_size,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "number_of_extents",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_unsigned_integer_value(
+	     json_writer,
+	     (uint64_t) number_of_extents,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "is_locked",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_boolean_value(
+	     json_writer,
+	     (uint8_t) is_locked,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_object_end(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( name_string != NULL )
+	{
+		memory_free(
+		 name_string );
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
 	return( 1 );
 
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to write logical volume.",
+	 function );
+
 on_error:
-	if( value_string != NULL )
+	if( name_string != NULL )
 	{
 		memory_free(
-		 value_string );
+		 name_string );
 	}
 	return( -1 );
 }
 
-/* Prints the volume information to a stream
+/* Writes the volume information as members of the current JSON object
  * Returns 1 if successful or -1 on error
  */
-int info_handle_volume_fprint(
+int info_handle_volume_json_write(
      info_handle_t *info_handle,
+     json_writer_t *json_writer,
      libcerror_error_t **error )
 {
 	uint8_t uuid_data[ 16 ];
 
 	libfvde_logical_volume_t *logical_volume   = NULL;
 	libfvde_physical_volume_t *physical_volume = NULL;
-	system_character_t *value_string           = NULL;
-	static char *function                      = "info_handle_volume_fprint";
-	size_t value_string_size                   = 0;
+	uint8_t *name_string                       = NULL;
+	static char *function                      = "info_handle_volume_json_write";
+	size_t name_string_size                    = 0;
+	uint64_t transaction_identifier            = 0;
 	int number_of_logical_volumes              = 0;
 	int number_of_physical_volumes             = 0;
-	int result                                 = 0;
-	int volume_index                           = 0;
-
-	if( info_handle == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid info handle.",
-		 function );
-
-		return( -1 );
-	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "Core Storage information:\n" );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
-
-	fprintf(
-	 info_handle->notify_stream,
-	 "Logical volume group:\n" );
+	int result                                 = 0;
+	int volume_index                           = 0;
 
-	if( libfvde_volume_group_get_identifier(
-	     info_handle->volume_group,
-	     uuid_data,
-	     16,
-	     error ) != 1 )
+	if( info_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume group identifier.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( info_handle_uuid_value_fprint(
-	     info_handle,
-	     "\tIdentifier\t\t\t",
+	if( libfvde_volume_group_get_identifier(
+	     info_handle->volume_group,
 	     uuid_data,
+	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print UUID value.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume group identifier.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tName\t\t\t\t:" );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfvde_volume_group_get_utf16_name_size(
-	          info_handle->volume_group,
-	          &value_string_size,
-	          error );
-#else
 	result = libfvde_volume_group_get_utf8_name_size(
 	          info_handle->volume_group,
-	          &value_string_size,
+	          &name_string_size,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -1934,12 +3071,12 @@ int info_handle_volume_fprint(
 		goto on_error;
 	}
 	else if( ( result != 0 )
-	      && ( value_string_size > 0 ) )
+	      && ( name_string_size > 0 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		name_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * name_string_size );
 
-		if( value_string == NULL )
+		if( name_string == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -1950,20 +3087,11 @@ int info_handle_volume_fprint(
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfvde_volume_group_get_utf16_name(
-		          info_handle->volume_group,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libfvde_volume_group_get_utf8_name(
-		          info_handle->volume_group,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( libfvde_volume_group_get_utf8_name(
+		     info_handle->volume_group,
+		     name_string,
+		     name_string_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1974,20 +3102,21 @@ int info_handle_volume_fprint(
 
 			goto on_error;
 		}
-		fprintf(
-		 info_handle->notify_stream,
-		 " %" PRIs_SYSTEM "",
-		 value_string );
-
-		memory_free(
-		 value_string );
-
-		value_string = NULL;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+	if( libfvde_volume_get_transaction_identifier(
+	     info_handle->volume,
+	     &transaction_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve transaction identifier.",
+		 function );
 
+		goto on_error;
+	}
 	if( libfvde_volume_group_get_number_of_physical_volumes(
 	     info_handle->volume_group,
 	     &number_of_physical_volumes,
@@ -2002,11 +3131,6 @@ int info_handle_volume_fprint(
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of physical volumes\t: %d\n",
-	 number_of_physical_volumes );
-
 	if( libcdata_array_get_number_of_entries(
 	     info_handle->logical_volumes_array,
 	     &number_of_logical_volumes,
@@ -2021,15 +3145,125 @@ int info_handle_volume_fprint(
 
 		goto on_error;
 	}
-	fprintf(
-	 info_handle->notify_stream,
-	 "\tNumber of logical volumes\t: %d\n",
-	 number_of_logical_volumes );
+	if( json_writer_key(
+	     json_writer,
+	     "volume_group",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_object_start(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "identifier",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_uuid_value(
+	     json_writer,
+	     uuid_data,
+	     16,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "name",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( name_string != NULL )
+	{
+		result = json_writer_utf8_string_value(
+		          json_writer,
+		          name_string,
+		          name_string_size - 1,
+		          error );
+	}
+	else
+	{
+		result = json_writer_null_value(
+		          json_writer,
+		          error );
+	}
+	if( result != 1 )
+	{
+		goto on_write_error;
+	}
+	memory_free(
+	 name_string );
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "\n" );
+	name_string = NULL;
 
+	if( json_writer_key(
+	     json_writer,
+	     "transaction_identifier",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_unsigned_integer_value(
+	     json_writer,
+	     transaction_identifier,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "number_of_physical_volumes",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_unsigned_integer_value(
+	     json_writer,
+	     (uint64_t) number_of_physical_volumes,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "number_of_logical_volumes",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_unsigned_integer_value(
+	     json_writer,
+	     (uint64_t) number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_object_end(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "physical_volumes",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_array_start(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
 	for( volume_index = 0;
 	     volume_index < number_of_physical_volumes;
 	     volume_index++ )
@@ -2050,17 +3284,17 @@ int info_handle_volume_fprint(
 
 			goto on_error;
 		}
-		if( info_handle_physical_volume_fprint(
+		if( info_handle_physical_volume_json_write(
 		     info_handle,
-		     volume_index,
 		     physical_volume,
+		     json_writer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print physical volume: %d information.",
+			 "%s: unable to write physical volume: %d information.",
 			 function,
 			 volume_index );
 
@@ -2081,6 +3315,25 @@ int info_handle_volume_fprint(
 			goto on_error;
 		}
 	}
+	if( json_writer_array_end(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_key(
+	     json_writer,
+	     "logical_volumes",
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_array_start(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
 	for( volume_index = 0;
 	     volume_index < number_of_logical_volumes;
 	     volume_index++ )
@@ -2101,40 +3354,39 @@ int info_handle_volume_fprint(
 
 			goto on_error;
 		}
-		result = libfvde_logical_volume_is_locked(
-		          logical_volume,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if logical volume is locked.",
-			 function );
-
-			goto on_error;
-		}
-		if( info_handle_logical_volume_fprint(
+		if( info_handle_logical_volume_json_write(
 		     info_handle,
-		     volume_index,
 		     logical_volume,
+		     json_writer,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print logical volume: %d information.",
+			 "%s: unable to write logical volume: %d information.",
 			 function,
 			 volume_index );
 
 			goto on_error;
 		}
 	}
+	if( json_writer_array_end(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
 	return( 1 );
 
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to write volume information.",
+	 function );
+
 on_error:
 	if( physical_volume != NULL )
 	{
@@ -2142,10 +3394,124 @@ on_error:
 		 &physical_volume,
 		 NULL );
 	}
-	if( value_string != NULL )
+	if( name_string != NULL )
 	{
 		memory_free(
-		 value_string );
+		 name_string );
+	}
+	return( -1 );
+}
+
+/* Prints the volume information to a stream as a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_json_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	json_writer_t *json_writer = NULL;
+	static char *function      = "info_handle_volume_json_fprint";
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_initialize(
+	     &json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create JSON writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_writer_set_stream(
+	     json_writer,
+	     info_handle->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set JSON writer stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( json_writer_object_start(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( info_handle_volume_json_write(
+	     info_handle,
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_object_end(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "\n",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_flush(
+	     json_writer,
+	     error ) != 1 )
+	{
+		goto on_write_error;
+	}
+	if( json_writer_free(
+	     &json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free JSON writer.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_write_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+	 "%s: unable to print volume information.",
+	 function );
+
+on_error:
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
 	}
 	return( -1 );
 }
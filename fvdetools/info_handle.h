@@ -31,6 +31,7 @@
 #include "fvdetools_libcdata.h"
 #include "fvdetools_libcerror.h"
 #include "fvdetools_libfvde.h"
+#include "json_writer.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -88,6 +89,10 @@ struct info_handle
 	 */
 	libcdata_array_t *logical_volumes_array;
 
+	/* The libfvde volume scanner
+	 */
+	libfvde_volume_scanner_t *volume_scanner;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -96,6 +101,10 @@ struct info_handle
 	 */
 	int unattended_mode;
 
+	/* Value to indicate if unlocking should be skipped when no keys are provided
+	 */
+	int metadata_only;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -145,6 +154,11 @@ int info_handle_set_volume_offset(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int info_handle_set_metadata_only(
+     info_handle_t *info_handle,
+     int metadata_only,
+     libcerror_error_t **error );
+
 int info_handle_open(
      info_handle_t *info_handle,
      system_character_t * const * filenames,
@@ -155,6 +169,11 @@ int info_handle_close(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_scan_fprint(
+     info_handle_t *info_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int info_handle_uuid_value_fprint(
      info_handle_t *info_handle,
      const char *value_name,
@@ -177,6 +196,27 @@ int info_handle_volume_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_physical_volume_json_write(
+     info_handle_t *info_handle,
+     libfvde_physical_volume_t *physical_volume,
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int info_handle_logical_volume_json_write(
+     info_handle_t *info_handle,
+     libfvde_logical_volume_t *logical_volume,
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int info_handle_volume_json_write(
+     info_handle_t *info_handle,
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int info_handle_volume_json_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
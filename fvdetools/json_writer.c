@@ -0,0 +1,1253 @@
+/*
+ * JSON writer
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+#include "fvdetools_libuna.h"
+#include "json_writer.h"
+
+/* Creates a JSON writer
+ * Make sure the value json_writer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_initialize(
+     json_writer_t **json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_initialize";
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *json_writer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid JSON writer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*json_writer = memory_allocate_structure(
+	                json_writer_t );
+
+	if( *json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create JSON writer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *json_writer,
+	     0,
+	     sizeof( json_writer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear JSON writer.",
+		 function );
+
+		memory_free(
+		 *json_writer );
+
+		*json_writer = NULL;
+
+		return( -1 );
+	}
+	( *json_writer )->buffer = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * JSON_WRITER_INITIAL_BUFFER_SIZE );
+
+	if( ( *json_writer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *json_writer )->buffer_size = JSON_WRITER_INITIAL_BUFFER_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *json_writer != NULL )
+	{
+		memory_free(
+		 *json_writer );
+
+		*json_writer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a JSON writer
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_free(
+     json_writer_t **json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_free";
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *json_writer != NULL )
+	{
+		if( ( *json_writer )->buffer != NULL )
+		{
+			memory_free(
+			 ( *json_writer )->buffer );
+		}
+		memory_free(
+		 *json_writer );
+
+		*json_writer = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets the JSON writer so the buffer can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_reset(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_reset";
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->buffer_offset   = 0;
+	json_writer->needs_separator = 0;
+
+	return( 1 );
+}
+
+/* Sets the output stream
+ * When set the data is written to the stream each time the buffer is full
+ * instead of the buffer being resized
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_set_stream(
+     json_writer_t *json_writer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_set_stream";
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->stream = stream;
+
+	return( 1 );
+}
+
+/* Writes the buffered data to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_flush(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_flush";
+	size_t write_count    = 0;
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid JSON writer - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer->buffer_offset > 0 )
+	{
+		write_count = file_stream_write(
+		               json_writer->stream,
+		               json_writer->buffer,
+		               json_writer->buffer_offset );
+
+		if( write_count != json_writer->buffer_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write buffer to stream.",
+			 function );
+
+			return( -1 );
+		}
+		json_writer->buffer_offset = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the data written so far
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_get_data(
+     json_writer_t *json_writer,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_get_data";
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = json_writer->buffer;
+	*data_size = json_writer->buffer_offset;
+
+	return( 1 );
+}
+
+/* Appends data to the buffer
+ * The buffer is resized when needed
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_append_data(
+     json_writer_t *json_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "json_writer_append_data";
+	size_t buffer_size    = 0;
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( json_writer->stream != NULL )
+	 && ( data_size > ( json_writer->buffer_size - json_writer->buffer_offset ) ) )
+	{
+		if( json_writer_flush(
+		     json_writer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush buffer.",
+			 function );
+
+			return( -1 );
+		}
+		/* Data that does not fit in the buffer is written directly
+		 */
+		if( data_size > json_writer->buffer_size )
+		{
+			if( file_stream_write(
+			     json_writer->stream,
+			     data,
+			     data_size ) != data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data to stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( data_size > ( json_writer->buffer_size - json_writer->buffer_offset ) )
+	{
+		buffer_size = json_writer->buffer_size;
+
+		while( data_size > ( buffer_size - json_writer->buffer_offset ) )
+		{
+			if( buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid buffer size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_size *= 2;
+		}
+		reallocation = (uint8_t *) memory_reallocate(
+		                            json_writer->buffer,
+		                            sizeof( uint8_t ) * buffer_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize buffer.",
+			 function );
+
+			return( -1 );
+		}
+		json_writer->buffer      = reallocation;
+		json_writer->buffer_size = buffer_size;
+	}
+	if( memory_copy(
+	     &( json_writer->buffer[ json_writer->buffer_offset ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data to buffer.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->buffer_offset += data_size;
+
+	return( 1 );
+}
+
+/* Appends a value separator if needed
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_append_separator(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_append_separator";
+
+	if( json_writer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid JSON writer.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer->needs_separator != 0 )
+	{
+		if( json_writer_append_data(
+		     json_writer,
+		     (uint8_t *) ",",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append separator.",
+			 function );
+
+			return( -1 );
+		}
+		json_writer->needs_separator = 0;
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-8 string as a quoted and escaped JSON string
+ * Runs of characters that do not need escaping are appended at once
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_append_escaped_string(
+     json_writer_t *json_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t escape_sequence[ 6 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "json_writer_append_escaped_string";
+	size_t escape_sequence_size    = 0;
+	size_t run_offset              = 0;
+	size_t string_index            = 0;
+	uint8_t character              = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		character = utf8_string[ string_index ];
+
+		if( ( character >= 0x20 )
+		 && ( character != (uint8_t) '"' )
+		 && ( character != (uint8_t) '\\' ) )
+		{
+			continue;
+		}
+		if( string_index > run_offset )
+		{
+			if( json_writer_append_data(
+			     json_writer,
+			     &( utf8_string[ run_offset ] ),
+			     string_index - run_offset,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		escape_sequence[ 0 ] = (uint8_t) '\\';
+		escape_sequence_size = 2;
+
+		switch( character )
+		{
+			case (uint8_t) '"':
+			case (uint8_t) '\\':
+				escape_sequence[ 1 ] = character;
+				break;
+
+			case (uint8_t) '\b':
+				escape_sequence[ 1 ] = (uint8_t) 'b';
+				break;
+
+			case (uint8_t) '\f':
+				escape_sequence[ 1 ] = (uint8_t) 'f';
+				break;
+
+			case (uint8_t) '\n':
+				escape_sequence[ 1 ] = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				escape_sequence[ 1 ] = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\t':
+				escape_sequence[ 1 ] = (uint8_t) 't';
+				break;
+
+			default:
+				escape_sequence[ 1 ] = (uint8_t) 'u';
+				escape_sequence[ 2 ] = (uint8_t) '0';
+				escape_sequence[ 3 ] = (uint8_t) '0';
+				escape_sequence[ 4 ] = (uint8_t) hexadecimal_digits[ character >> 4 ];
+				escape_sequence[ 5 ] = (uint8_t) hexadecimal_digits[ character & 0x0f ];
+				escape_sequence_size = 6;
+				break;
+		}
+		if( json_writer_append_data(
+		     json_writer,
+		     escape_sequence,
+		     escape_sequence_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		run_offset = string_index + 1;
+	}
+	if( string_index > run_offset )
+	{
+		if( json_writer_append_data(
+		     json_writer,
+		     &( utf8_string[ run_offset ] ),
+		     string_index - run_offset,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+	 "%s: unable to append escaped string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Starts a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_object_start(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_object_start";
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object start.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Ends a JSON object
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_object_end(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_object_end";
+
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append object end.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
+/* Starts a JSON array
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_array_start(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_array_start";
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "[",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array start.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Ends a JSON array
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_array_end(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_array_end";
+
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "]",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append array end.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
+/* Writes the key of a JSON object member
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_key(
+     json_writer_t *json_writer,
+     const char *key,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_key";
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_escaped_string(
+	     json_writer,
+	     (uint8_t *) key,
+	     narrow_string_length(
+	      key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) ":",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append key separator.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes an UTF-8 string value
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_utf8_string_value(
+     json_writer_t *json_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_utf8_string_value";
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_escaped_string(
+	     json_writer,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string value.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
+/* Writes a system string value
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_system_string_value(
+     json_writer_t *json_writer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function    = "json_writer_system_string_value";
+	int result               = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *utf8_string     = NULL;
+	size_t utf8_string_size  = 0;
+#endif
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     (libuna_utf8_character_t *) utf8_string,
+	     utf8_string_size,
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	result = json_writer_utf8_string_value(
+	          json_writer,
+	          utf8_string,
+	          utf8_string_size - 1,
+	          error );
+#else
+	result = json_writer_utf8_string_value(
+	          json_writer,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string value.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_free(
+	 utf8_string );
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+#endif
+	return( -1 );
+}
+
+/* Writes an unsigned integer value
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_unsigned_integer_value(
+     json_writer_t *json_writer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	uint8_t digits[ 24 ];
+
+	static char *function = "json_writer_unsigned_integer_value";
+	size_t digits_index   = 24;
+
+	do
+	{
+		digits_index--;
+
+		digits[ digits_index ] = (uint8_t) '0' + (uint8_t) ( value % 10 );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     &( digits[ digits_index ] ),
+	     24 - digits_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append integer value.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
+/* Writes a boolean value
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_boolean_value(
+     json_writer_t *json_writer,
+     uint8_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_boolean_value";
+	int result            = 0;
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( value != 0 )
+	{
+		result = json_writer_append_data(
+		          json_writer,
+		          (uint8_t *) "true",
+		          4,
+		          error );
+	}
+	else
+	{
+		result = json_writer_append_data(
+		          json_writer,
+		          (uint8_t *) "false",
+		          5,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append boolean value.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
+/* Writes a null value
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_null_value(
+     json_writer_t *json_writer,
+     libcerror_error_t **error )
+{
+	static char *function = "json_writer_null_value";
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     (uint8_t *) "null",
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append null value.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
+/* Writes an UUID value as a lower case string
+ * The UUID data is formatted directly, in big-endian, without an intermediate identifier
+ * Returns 1 if successful or -1 on error
+ */
+int json_writer_uuid_value(
+     json_writer_t *json_writer,
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t uuid_string[ 38 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "json_writer_uuid_value";
+	size_t string_index            = 0;
+	size_t uuid_data_index         = 0;
+
+	if( uuid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uuid_data_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UUID data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	uuid_string[ string_index++ ] = (uint8_t) '"';
+
+	for( uuid_data_index = 0;
+	     uuid_data_index < 16;
+	     uuid_data_index++ )
+	{
+		if( ( uuid_data_index == 4 )
+		 || ( uuid_data_index == 6 )
+		 || ( uuid_data_index == 8 )
+		 || ( uuid_data_index == 10 ) )
+		{
+			uuid_string[ string_index++ ] = (uint8_t) '-';
+		}
+		uuid_string[ string_index++ ] = (uint8_t) hexadecimal_digits[ uuid_data[ uuid_data_index ] >> 4 ];
+		uuid_string[ string_index++ ] = (uint8_t) hexadecimal_digits[ uuid_data[ uuid_data_index ] & 0x0f ];
+	}
+	uuid_string[ string_index++ ] = (uint8_t) '"';
+
+	if( json_writer_append_separator(
+	     json_writer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
+
+		return( -1 );
+	}
+	if( json_writer_append_data(
+	     json_writer,
+	     uuid_string,
+	     string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UUID value.",
+		 function );
+
+		return( -1 );
+	}
+	json_writer->needs_separator = 1;
+
+	return( 1 );
+}
+
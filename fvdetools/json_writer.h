@@ -0,0 +1,167 @@
+/*
+ * JSON writer
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _JSON_WRITER_H )
+#define _JSON_WRITER_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial size of the JSON writer buffer
+ * When an output stream is set this is the size at which the buffer is flushed
+ */
+#define JSON_WRITER_INITIAL_BUFFER_SIZE		4096
+
+typedef struct json_writer json_writer_t;
+
+struct json_writer
+{
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* Value to indicate a separator is needed before the next value
+	 */
+	uint8_t needs_separator;
+};
+
+int json_writer_initialize(
+     json_writer_t **json_writer,
+     libcerror_error_t **error );
+
+int json_writer_free(
+     json_writer_t **json_writer,
+     libcerror_error_t **error );
+
+int json_writer_reset(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_set_stream(
+     json_writer_t *json_writer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int json_writer_flush(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_get_data(
+     json_writer_t *json_writer,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int json_writer_append_data(
+     json_writer_t *json_writer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int json_writer_append_separator(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_append_escaped_string(
+     json_writer_t *json_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int json_writer_object_start(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_object_end(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_array_start(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_array_end(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_key(
+     json_writer_t *json_writer,
+     const char *key,
+     libcerror_error_t **error );
+
+int json_writer_utf8_string_value(
+     json_writer_t *json_writer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int json_writer_system_string_value(
+     json_writer_t *json_writer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int json_writer_unsigned_integer_value(
+     json_writer_t *json_writer,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int json_writer_boolean_value(
+     json_writer_t *json_writer,
+     uint8_t value,
+     libcerror_error_t **error );
+
+int json_writer_null_value(
+     json_writer_t *json_writer,
+     libcerror_error_t **error );
+
+int json_writer_uuid_value(
+     json_writer_t *json_writer,
+     const uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _JSON_WRITER_H ) */
+
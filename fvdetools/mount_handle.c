@@ -57,6 +57,8 @@ int libfvde_volume_open_physical_volume_files_file_io_pool(
 
 #define MOUNT_HANDLE_NOTIFY_STREAM		stdout
 
+#define MOUNT_HANDLE_MAXIMUM_ACCESS_TRACE_SIZE	( 1024 * 1024 )
+
 /* Copies a string of a decimal value to a 64-bit value
  * Returns 1 if successful or -1 on error
  */
@@ -407,6 +409,43 @@ int mount_handle_set_encrypted_root_plist(
 	return( 1 );
 }
 
+/* Sets the path of the access trace file
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_set_access_trace_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_handle_set_access_trace_path";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	mount_handle->access_trace_path = string;
+
+	return( 1 );
+}
+
 /* Sets the key
  * Returns 1 if successful or -1 on error
  */
@@ -1190,6 +1229,40 @@ int mount_handle_open(
 				 "Unable to unlock volume.\n\n" );
 			}
 		}
+		/* The access trace is recorded and replayed for the first logical volume
+		 */
+		if( ( result == 1 )
+		 && ( logical_volume_index == 0 )
+		 && ( mount_handle->access_trace_path != NULL ) )
+		{
+			if( mount_handle_replay_access_trace(
+			     mount_handle,
+			     logical_volume,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to replay access trace.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfvde_logical_volume_start_access_trace(
+			     logical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to start access trace.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( mount_file_system_append_logical_volume(
 		     mount_handle->file_system,
 		     (intptr_t *) logical_volume,
@@ -1288,6 +1361,40 @@ int mount_handle_close(
 
 		return( -1 );
 	}
+	if( ( mount_handle->access_trace_path != NULL )
+	 && ( number_of_logical_volumes > 0 ) )
+	{
+		if( mount_file_system_get_logical_volume_by_index(
+		     mount_handle->file_system,
+		     0,
+		     &logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: 0.",
+			 function );
+
+			result = -1;
+		}
+		else if( mount_handle_write_access_trace(
+		          mount_handle,
+		          logical_volume,
+		          error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write access trace.",
+			 function );
+
+			result = -1;
+		}
+		logical_volume = NULL;
+	}
 	for( logical_volume_index = number_of_logical_volumes - 1;
 	     logical_volume_index > 0;
 	     logical_volume_index-- )
@@ -1378,6 +1485,299 @@ int mount_handle_close(
 	return( result );
 }
 
+/* Replays the access trace file to warm up a logical volume
+ * Returns 1 if successful, 0 if no access trace file is available or -1 on error
+ */
+int mount_handle_replay_access_trace(
+     mount_handle_t *mount_handle,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "mount_handle_replay_access_trace";
+	size_t data_size      = 0;
+	size_t read_count     = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->access_trace_path == NULL )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               mount_handle->access_trace_path,
+	               _SYSTEM_STRING( "rb" ) );
+#else
+	file_stream = file_stream_open(
+	               mount_handle->access_trace_path,
+	               FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	/* The access trace file is created on the first unmount
+	 */
+	if( file_stream == NULL )
+	{
+		return( 0 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * MOUNT_HANDLE_MAXIMUM_ACCESS_TRACE_SIZE );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access trace data.",
+		 function );
+
+		goto on_error;
+	}
+	while( data_size < MOUNT_HANDLE_MAXIMUM_ACCESS_TRACE_SIZE )
+	{
+		read_count = file_stream_read(
+		              file_stream,
+		              &( data[ data_size ] ),
+		              MOUNT_HANDLE_MAXIMUM_ACCESS_TRACE_SIZE - data_size );
+
+		if( read_count == 0 )
+		{
+			break;
+		}
+		data_size += read_count;
+	}
+	if( file_stream_at_end(
+	     file_stream ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read access trace file or file exceeds maximum size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close access trace file.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	file_stream = NULL;
+
+	if( libfvde_logical_volume_replay_access_trace(
+	     logical_volume,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to replay access trace.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( -1 );
+}
+
+/* Writes the access trace of a logical volume to the access trace file
+ * Returns 1 if successful, 0 if no access trace is available or -1 on error
+ */
+int mount_handle_write_access_trace(
+     mount_handle_t *mount_handle,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	uint8_t *data         = NULL;
+	static char *function = "mount_handle_write_access_trace";
+	size_t data_size      = 0;
+	size_t write_count    = 0;
+	int result            = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->access_trace_path == NULL )
+	{
+		return( 0 );
+	}
+	result = libfvde_logical_volume_get_access_trace_size(
+	          logical_volume,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access trace size.",
+		 function );
+
+		goto on_error;
+	}
+	else if( ( result == 0 )
+	      || ( data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	if( data_size > (size_t) MOUNT_HANDLE_MAXIMUM_ACCESS_TRACE_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid access trace size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access trace data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_logical_volume_copy_access_trace(
+	     logical_volume,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy access trace.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_stream = file_stream_open_wide(
+	               mount_handle->access_trace_path,
+	               _SYSTEM_STRING( "wb" ) );
+#else
+	file_stream = file_stream_open(
+	               mount_handle->access_trace_path,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open access trace file.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write access trace file.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close access trace file.",
+		 function );
+
+		file_stream = NULL;
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
 /* Retrieves a file entry for a specific path
  * Returns 1 if successful, 0 if no such file entry or -1 on error
  */
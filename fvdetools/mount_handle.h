@@ -50,6 +50,10 @@ struct mount_handle
 	 */
 	const system_character_t *encrypted_root_plist_path;
 
+	/* The access trace path
+	 */
+	const system_character_t *access_trace_path;
+
 	/* The key data
 	 */
 	uint8_t key_data[ 16 ];
@@ -127,6 +131,11 @@ int mount_handle_set_encrypted_root_plist(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int mount_handle_set_access_trace_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int mount_handle_set_key(
      mount_handle_t *mount_handle,
      const system_character_t *string,
@@ -163,6 +172,16 @@ int mount_handle_close(
      mount_handle_t *mount_handle,
      libcerror_error_t **error );
 
+int mount_handle_replay_access_trace(
+     mount_handle_t *mount_handle,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error );
+
+int mount_handle_write_access_trace(
+     mount_handle_t *mount_handle,
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error );
+
 int mount_handle_get_file_entry_by_path(
      mount_handle_t *mount_handle,
      const system_character_t *path,
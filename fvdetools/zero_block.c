@@ -0,0 +1,211 @@
+/*
+ * Detection of runs of zero bytes in exported data
+ *
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+#include "zero_block.h"
+
+/* Checks if a buffer is filled with zero bytes
+ * The data is compared a word at a time, like the empty block check of the
+ * metadata blocks in libfvde
+ * Returns 1 if the data only contains zero bytes, 0 if not or -1 on error
+ */
+int zero_block_check(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	zero_block_aligned_t *aligned_data_index = NULL;
+	uint8_t *data_index                      = NULL;
+	static char *function                    = "zero_block_check";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	data_index = (uint8_t *) data;
+
+	/* Only optimize for data larger than the alignment
+	 */
+	if( data_size > ( 2 * sizeof( zero_block_aligned_t ) ) )
+	{
+		/* Align the data index
+		 */
+		while( ( (intptr_t) data_index % sizeof( zero_block_aligned_t ) ) != 0 )
+		{
+			if( *data_index != 0 )
+			{
+				return( 0 );
+			}
+			data_index += 1;
+			data_size  -= 1;
+		}
+		aligned_data_index = (zero_block_aligned_t *) data_index;
+
+		while( data_size >= sizeof( zero_block_aligned_t ) )
+		{
+			if( *aligned_data_index != 0 )
+			{
+				return( 0 );
+			}
+			aligned_data_index += 1;
+			data_size          -= sizeof( zero_block_aligned_t );
+		}
+		data_index = (uint8_t *) aligned_data_index;
+	}
+	while( data_size != 0 )
+	{
+		if( *data_index != 0 )
+		{
+			return( 0 );
+		}
+		data_index += 1;
+		data_size  -= 1;
+	}
+	return( 1 );
+}
+
+/* Determines the size of the run of blocks at the start of a buffer
+ * A run consists of consecutive blocks of ZERO_BLOCK_SIZE that either all
+ * contain only zero bytes or all contain data, the last block can be smaller
+ * Returns 1 if successful or -1 on error
+ */
+int zero_block_get_run_size(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *run_size,
+     uint8_t *is_zero,
+     libcerror_error_t **error )
+{
+	static char *function = "zero_block_get_run_size";
+	size_t block_size     = 0;
+	size_t data_offset    = 0;
+	int result            = 0;
+	int run_result        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run size.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_zero == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is zero.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		block_size = data_size - data_offset;
+
+		if( block_size > ZERO_BLOCK_SIZE )
+		{
+			block_size = ZERO_BLOCK_SIZE;
+		}
+		result = zero_block_check(
+		          &( data[ data_offset ] ),
+		          block_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to check block at offset: %" PRIzd " for zero bytes.",
+			 function,
+			 data_offset );
+
+			return( -1 );
+		}
+		if( data_offset == 0 )
+		{
+			run_result = result;
+		}
+		else if( result != run_result )
+		{
+			break;
+		}
+		data_offset += block_size;
+	}
+	*run_size = data_offset;
+	*is_zero  = (uint8_t) run_result;
+
+	return( 1 );
+}
+
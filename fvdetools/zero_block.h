@@ -0,0 +1,61 @@
+/*
+ * Detection of runs of zero bytes in exported data
+ *
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ZERO_BLOCK_H )
+#define _ZERO_BLOCK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "fvdetools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the blocks that are checked for zero bytes (4 KiB)
+ * Runs of zero bytes are only detected in whole blocks, which matches the
+ * allocation unit of most file systems that support sparse files
+ */
+#define ZERO_BLOCK_SIZE			4096
+
+typedef unsigned long int zero_block_aligned_t;
+
+int zero_block_check(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int zero_block_get_run_size(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *run_size,
+     uint8_t *is_zero,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ZERO_BLOCK_H ) */
+
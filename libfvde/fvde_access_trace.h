@@ -0,0 +1,70 @@
+/*
+ * The access trace definition
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FVDE_ACCESS_TRACE_H )
+#define _FVDE_ACCESS_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fvde_access_trace_header fvde_access_trace_header_t;
+
+struct fvde_access_trace_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "fvdetrac"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 * Contains 1
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The block size
+	 * Consists of 4 bytes
+	 */
+	uint8_t block_size[ 4 ];
+
+	/* The number of block numbers
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_block_numbers[ 4 ];
+};
+
+/* The header is followed by the block numbers in access order,
+ * where every block number is stored as the zigzag encoded difference
+ * with the previous block number in a variable-length (LEB128) integer
+ */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FVDE_ACCESS_TRACE_H ) */
+
@@ -0,0 +1,664 @@
+/*
+ * Access trace functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_access_trace.h"
+#include "libfvde_definitions.h"
+#include "libfvde_libcerror.h"
+
+#include "fvde_access_trace.h"
+
+/* Creates an access trace
+ * Make sure the value access_trace is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_access_trace_initialize(
+     libfvde_access_trace_t **access_trace,
+     uint32_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_access_trace_initialize";
+
+	if( access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_trace != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access trace value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	*access_trace = memory_allocate_structure(
+	                 libfvde_access_trace_t );
+
+	if( *access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *access_trace,
+	     0,
+	     sizeof( libfvde_access_trace_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access trace.",
+		 function );
+
+		memory_free(
+		 *access_trace );
+
+		*access_trace = NULL;
+
+		return( -1 );
+	}
+	( *access_trace )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *access_trace != NULL )
+	{
+		memory_free(
+		 *access_trace );
+
+		*access_trace = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an access trace
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_access_trace_free(
+     libfvde_access_trace_t **access_trace,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_access_trace_free";
+
+	if( access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_trace != NULL )
+	{
+		if( ( *access_trace )->block_numbers != NULL )
+		{
+			memory_free(
+			 ( *access_trace )->block_numbers );
+		}
+		memory_free(
+		 *access_trace );
+
+		*access_trace = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends the blocks of a range that was accessed
+ * A block that is the same as the previously accessed block is not appended again
+ * and blocks are no longer appended once the maximum number of blocks is reached
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_access_trace_append_range(
+     libfvde_access_trace_t *access_trace,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	uint64_t *block_numbers               = NULL;
+	static char *function                 = "libfvde_access_trace_append_range";
+	uint64_t block_number                 = 0;
+	uint64_t last_block_number            = 0;
+	int number_of_allocated_block_numbers = 0;
+
+	if( access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	block_number      = (uint64_t) offset / access_trace->block_size;
+	last_block_number = ( (uint64_t) offset + size - 1 ) / access_trace->block_size;
+
+	while( block_number <= last_block_number )
+	{
+		if( access_trace->number_of_block_numbers >= LIBFVDE_MAXIMUM_NUMBER_OF_ACCESS_TRACE_BLOCKS )
+		{
+			break;
+		}
+		if( ( access_trace->number_of_block_numbers > 0 )
+		 && ( access_trace->block_numbers[ access_trace->number_of_block_numbers - 1 ] == block_number ) )
+		{
+			block_number++;
+
+			continue;
+		}
+		if( access_trace->number_of_block_numbers >= access_trace->number_of_allocated_block_numbers )
+		{
+			number_of_allocated_block_numbers = access_trace->number_of_allocated_block_numbers + 1024;
+
+			if( number_of_allocated_block_numbers > LIBFVDE_MAXIMUM_NUMBER_OF_ACCESS_TRACE_BLOCKS )
+			{
+				number_of_allocated_block_numbers = LIBFVDE_MAXIMUM_NUMBER_OF_ACCESS_TRACE_BLOCKS;
+			}
+			block_numbers = (uint64_t *) memory_reallocate(
+			                              access_trace->block_numbers,
+			                              sizeof( uint64_t ) * number_of_allocated_block_numbers );
+
+			if( block_numbers == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize block numbers.",
+				 function );
+
+				return( -1 );
+			}
+			access_trace->block_numbers                     = block_numbers;
+			access_trace->number_of_allocated_block_numbers = number_of_allocated_block_numbers;
+		}
+		access_trace->block_numbers[ access_trace->number_of_block_numbers ] = block_number;
+
+		access_trace->number_of_block_numbers++;
+
+		block_number++;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the access trace data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_access_trace_get_data_size(
+     libfvde_access_trace_t *access_trace,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvde_access_trace_get_data_size";
+	size_t safe_data_size    = 0;
+	uint64_t previous_number = 0;
+	uint64_t value_64bit     = 0;
+	int block_number_index   = 0;
+
+	if( access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_size = sizeof( fvde_access_trace_header_t );
+
+	for( block_number_index = 0;
+	     block_number_index < access_trace->number_of_block_numbers;
+	     block_number_index++ )
+	{
+		value_64bit = access_trace->block_numbers[ block_number_index ] - previous_number;
+
+		/* Zigzag encode the difference so that small negative differences are small values
+		 */
+		if( (int64_t) value_64bit < 0 )
+		{
+			value_64bit = ( ( ~value_64bit ) << 1 ) | 1;
+		}
+		else
+		{
+			value_64bit <<= 1;
+		}
+		do
+		{
+			safe_data_size++;
+
+			value_64bit >>= 7;
+		}
+		while( value_64bit != 0 );
+
+		previous_number = access_trace->block_numbers[ block_number_index ];
+	}
+	*data_size = safe_data_size;
+
+	return( 1 );
+}
+
+/* Writes the access trace data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_access_trace_write_data(
+     libfvde_access_trace_t *access_trace,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvde_access_trace_write_data";
+	size_t data_offset       = 0;
+	size_t required_size     = 0;
+	uint64_t previous_number = 0;
+	uint64_t value_64bit     = 0;
+	int block_number_index   = 0;
+
+	if( access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_access_trace_get_data_size(
+	     access_trace,
+	     &required_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < required_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( (fvde_access_trace_header_t *) data )->signature,
+	     "fvdetrac",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fvde_access_trace_header_t *) data )->format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fvde_access_trace_header_t *) data )->block_size,
+	 access_trace->block_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (fvde_access_trace_header_t *) data )->number_of_block_numbers,
+	 (uint32_t) access_trace->number_of_block_numbers );
+
+	data_offset = sizeof( fvde_access_trace_header_t );
+
+	for( block_number_index = 0;
+	     block_number_index < access_trace->number_of_block_numbers;
+	     block_number_index++ )
+	{
+		value_64bit = access_trace->block_numbers[ block_number_index ] - previous_number;
+
+		if( (int64_t) value_64bit < 0 )
+		{
+			value_64bit = ( ( ~value_64bit ) << 1 ) | 1;
+		}
+		else
+		{
+			value_64bit <<= 1;
+		}
+		while( value_64bit > 0x7f )
+		{
+			data[ data_offset++ ] = (uint8_t) ( ( value_64bit & 0x7f ) | 0x80 );
+
+			value_64bit >>= 7;
+		}
+		data[ data_offset++ ] = (uint8_t) value_64bit;
+
+		previous_number = access_trace->block_numbers[ block_number_index ];
+	}
+	return( 1 );
+}
+
+/* Reads the access trace data
+ * The block numbers read replace the block numbers of the access trace
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_access_trace_read_data(
+     libfvde_access_trace_t *access_trace,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint64_t *block_numbers          = NULL;
+	static char *function            = "libfvde_access_trace_read_data";
+	size_t data_offset               = 0;
+	uint64_t block_number            = 0;
+	uint64_t value_64bit             = 0;
+	uint32_t block_size              = 0;
+	uint32_t format_version          = 0;
+	uint32_t number_of_block_numbers = 0;
+	uint8_t bit_shift                = 0;
+	uint8_t byte_value               = 0;
+	int block_number_index           = 0;
+
+	if( access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access trace.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fvde_access_trace_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (fvde_access_trace_header_t *) data )->signature,
+	     "fvdetrac",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access trace signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_access_trace_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_access_trace_header_t *) data )->block_size,
+	 block_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (fvde_access_trace_header_t *) data )->number_of_block_numbers,
+	 number_of_block_numbers );
+
+	if( format_version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( block_size != access_trace->block_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported block size: %" PRIu32 ".",
+		 function,
+		 block_size );
+
+		return( -1 );
+	}
+	/* Every block number is stored in at least 1 byte
+	 */
+	if( ( number_of_block_numbers > (uint32_t) LIBFVDE_MAXIMUM_NUMBER_OF_ACCESS_TRACE_BLOCKS )
+	 || ( (size_t) number_of_block_numbers > ( data_size - sizeof( fvde_access_trace_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of block numbers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_block_numbers > 0 )
+	{
+		block_numbers = (uint64_t *) memory_allocate(
+		                              sizeof( uint64_t ) * number_of_block_numbers );
+
+		if( block_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block numbers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = sizeof( fvde_access_trace_header_t );
+
+	for( block_number_index = 0;
+	     block_number_index < (int) number_of_block_numbers;
+	     block_number_index++ )
+	{
+		value_64bit = 0;
+		bit_shift   = 0;
+
+		do
+		{
+			if( ( data_offset >= data_size )
+			 || ( bit_shift > 63 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid block number: %d value out of bounds.",
+				 function,
+				 block_number_index );
+
+				goto on_error;
+			}
+			byte_value = data[ data_offset++ ];
+
+			value_64bit |= (uint64_t) ( byte_value & 0x7f ) << bit_shift;
+
+			bit_shift += 7;
+		}
+		while( ( byte_value & 0x80 ) != 0 );
+
+		if( ( value_64bit & 1 ) != 0 )
+		{
+			value_64bit = ~( value_64bit >> 1 );
+		}
+		else
+		{
+			value_64bit >>= 1;
+		}
+		block_number += value_64bit;
+
+		block_numbers[ block_number_index ] = block_number;
+	}
+	if( access_trace->block_numbers != NULL )
+	{
+		memory_free(
+		 access_trace->block_numbers );
+	}
+	access_trace->block_numbers                     = block_numbers;
+	access_trace->number_of_block_numbers           = (int) number_of_block_numbers;
+	access_trace->number_of_allocated_block_numbers = (int) number_of_block_numbers;
+
+	return( 1 );
+
+on_error:
+	if( block_numbers != NULL )
+	{
+		memory_free(
+		 block_numbers );
+	}
+	return( -1 );
+}
+
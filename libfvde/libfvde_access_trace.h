@@ -0,0 +1,93 @@
+/*
+ * Access trace functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_ACCESS_TRACE_H )
+#define _LIBFVDE_ACCESS_TRACE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_access_trace libfvde_access_trace_t;
+
+struct libfvde_access_trace
+{
+	/* The block size
+	 */
+	uint32_t block_size;
+
+	/* The block numbers in access order
+	 */
+	uint64_t *block_numbers;
+
+	/* The number of block numbers
+	 */
+	int number_of_block_numbers;
+
+	/* The number of allocated block numbers
+	 */
+	int number_of_allocated_block_numbers;
+};
+
+int libfvde_access_trace_initialize(
+     libfvde_access_trace_t **access_trace,
+     uint32_t block_size,
+     libcerror_error_t **error );
+
+int libfvde_access_trace_free(
+     libfvde_access_trace_t **access_trace,
+     libcerror_error_t **error );
+
+int libfvde_access_trace_append_range(
+     libfvde_access_trace_t *access_trace,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_access_trace_get_data_size(
+     libfvde_access_trace_t *access_trace,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfvde_access_trace_write_data(
+     libfvde_access_trace_t *access_trace,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_access_trace_read_data(
+     libfvde_access_trace_t *access_trace,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_ACCESS_TRACE_H ) */
+
@@ -0,0 +1,1212 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_block_cache.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_read_request.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_initialize(
+     libfvde_block_cache_t **block_cache,
+     size_t block_size,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_initialize";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( (size_t) maximum_number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfvde_block_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libfvde_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libfvde_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+	( *block_cache )->entries = (libfvde_block_cache_entry_t *) memory_allocate(
+	                                                             sizeof( libfvde_block_cache_entry_t ) * maximum_number_of_entries );
+
+	if( ( *block_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *block_cache )->block_size                = block_size;
+	( *block_cache )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Pending read requests are waited for, hence the read thread pool must be joined
+ * or the logical volume lock released before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_free(
+     libfvde_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < ( *block_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( ( *block_cache )->entries[ entry_index ].read_request != NULL )
+			{
+				if( libfvde_read_request_free(
+				     &( ( *block_cache )->entries[ entry_index ].read_request ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free read request of entry: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			if( ( *block_cache )->entries[ entry_index ].data != NULL )
+			{
+				memory_free(
+				 ( *block_cache )->entries[ entry_index ].data );
+			}
+		}
+		memory_free(
+		 ( *block_cache )->entries );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Finds the entry of the block at a specific offset
+ * If the block is not found entry_index is set to the index at which the block would be inserted
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfvde_block_cache_find_entry(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_find_entry";
+	int first_index       = 0;
+	int last_index        = 0;
+	int middle_index      = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	first_index = 0;
+	last_index  = block_cache->number_of_entries;
+
+	while( first_index < last_index )
+	{
+		middle_index = first_index + ( ( last_index - first_index ) / 2 );
+
+		if( block_cache->entries[ middle_index ].offset == offset )
+		{
+			*entry_index = middle_index;
+
+			return( 1 );
+		}
+		else if( block_cache->entries[ middle_index ].offset < offset )
+		{
+			first_index = middle_index + 1;
+		}
+		else
+		{
+			last_index = middle_index;
+		}
+	}
+	*entry_index = first_index;
+
+	return( 0 );
+}
+
+/* Removes an entry
+ * A pending read request of the entry is waited for
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_remove_entry(
+     libfvde_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_remove_entry";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= block_cache->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_cache->entries[ entry_index ].read_request != NULL )
+	{
+		if( libfvde_read_request_free(
+		     &( block_cache->entries[ entry_index ].read_request ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read request of entry: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+		}
+	}
+	if( block_cache->entries[ entry_index ].data != NULL )
+	{
+		memory_free(
+		 block_cache->entries[ entry_index ].data );
+	}
+	block_cache->number_of_entries -= 1;
+
+	while( entry_index < block_cache->number_of_entries )
+	{
+		block_cache->entries[ entry_index ] = block_cache->entries[ entry_index + 1 ];
+
+		entry_index++;
+	}
+	return( result );
+}
+
+/* Reserves a block to be filled
+ * The data of the block is not used by other functions until it is filled
+ * by the read request set with libfvde_block_cache_set_read_request
+ * A stale block that is reserved again is no longer removed once it has been filled
+ * and is referenced again
+ * Returns 1 if successful, 0 if the block is already cached or the cache is full or -1 on error
+ */
+int libfvde_block_cache_reserve_block(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	uint8_t *block_data   = NULL;
+	static char *function = "libfvde_block_cache_reserve_block";
+	int entry_index       = 0;
+	int move_index        = 0;
+	int result            = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % block_cache->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          offset,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( block_cache->entries[ entry_index ].is_stale != 0 )
+		{
+			block_cache->entries[ entry_index ].is_stale        = 0;
+			block_cache->entries[ entry_index ].reference_count = 1;
+		}
+		return( 0 );
+	}
+	if( block_cache->number_of_entries >= block_cache->maximum_number_of_entries )
+	{
+		return( 0 );
+	}
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * block_cache->block_size );
+
+	if( block_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block data.",
+		 function );
+
+		return( -1 );
+	}
+	for( move_index = block_cache->number_of_entries;
+	     move_index > entry_index;
+	     move_index-- )
+	{
+		block_cache->entries[ move_index ] = block_cache->entries[ move_index - 1 ];
+	}
+	block_cache->entries[ entry_index ].offset          = offset;
+	block_cache->entries[ entry_index ].data            = block_data;
+	block_cache->entries[ entry_index ].valid_data_size = 0;
+	block_cache->entries[ entry_index ].read_request    = NULL;
+	block_cache->entries[ entry_index ].is_filling      = 1;
+	block_cache->entries[ entry_index ].is_stale        = 0;
+	block_cache->entries[ entry_index ].reference_count = 1;
+
+	block_cache->number_of_entries += 1;
+
+	*data = block_data;
+
+	return( 1 );
+}
+
+/* Reserves the blocks of a range as a whole
+ * Blocks that are already cached are referenced again, the other blocks are reserved
+ * to be filled, as with libfvde_block_cache_reserve_block, and their data is returned
+ * in blocks_data. The blocks_data entries of blocks that were already cached are set to NULL
+ * Returns 1 if successful, 0 if the cache has no room for the blocks that are not cached or -1 on error
+ */
+int libfvde_block_cache_reserve_range(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     int number_of_blocks,
+     uint8_t **blocks_data,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfvde_block_cache_reserve_range";
+	off64_t block_offset         = 0;
+	int block_index              = 0;
+	int entry_index              = 0;
+	int number_of_missing_blocks = 0;
+	int result                   = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( ( offset % block_cache->block_size ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks <= 0 )
+	 || ( (size64_t) number_of_blocks > ( (size64_t) ( INT64_MAX - offset ) / block_cache->block_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blocks data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine if the cache has room for the blocks that are not cached
+	 * before any block is reserved
+	 */
+	block_offset = offset;
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		result = libfvde_block_cache_find_entry(
+		          block_cache,
+		          block_offset,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			number_of_missing_blocks++;
+		}
+		block_offset += (off64_t) block_cache->block_size;
+	}
+	if( number_of_missing_blocks > ( block_cache->maximum_number_of_entries - block_cache->number_of_entries ) )
+	{
+		return( 0 );
+	}
+	block_offset = offset;
+
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		blocks_data[ block_index ] = NULL;
+
+		result = libfvde_block_cache_find_entry(
+		          block_cache,
+		          block_offset,
+		          &entry_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to find entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( block_cache->entries[ entry_index ].is_stale != 0 )
+			{
+				block_cache->entries[ entry_index ].is_stale        = 0;
+				block_cache->entries[ entry_index ].reference_count = 0;
+			}
+			block_cache->entries[ entry_index ].reference_count += 1;
+		}
+		else if( libfvde_block_cache_reserve_block(
+		          block_cache,
+		          block_offset,
+		          &( blocks_data[ block_index ] ),
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reserve block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 block_offset,
+			 block_offset );
+
+			blocks_data[ block_index ] = NULL;
+
+			goto on_error;
+		}
+		block_offset += (off64_t) block_cache->block_size;
+	}
+	return( 1 );
+
+on_error:
+	/* Undo the reservations of the preceding blocks
+	 */
+	while( block_index > 0 )
+	{
+		block_index--;
+
+		block_offset -= (off64_t) block_cache->block_size;
+
+		if( blocks_data[ block_index ] != NULL )
+		{
+			libfvde_block_cache_remove_block(
+			 block_cache,
+			 block_offset,
+			 NULL );
+
+			blocks_data[ block_index ] = NULL;
+		}
+		else if( libfvde_block_cache_find_entry(
+		          block_cache,
+		          block_offset,
+		          &entry_index,
+		          NULL ) == 1 )
+		{
+			block_cache->entries[ entry_index ].reference_count -= 1;
+		}
+	}
+	return( -1 );
+}
+
+/* Sets the read request that fills a reserved block
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_set_read_request(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_set_read_request";
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          offset,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 || ( block_cache->entries[ entry_index ].is_filling == 0 )
+	 || ( block_cache->entries[ entry_index ].read_request != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIi64 " (0x%08" PRIx64 ") value not a reserved block.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	block_cache->entries[ entry_index ].read_request = read_request;
+
+	return( 1 );
+}
+
+/* Removes the block at a specific offset
+ * A pending read request of the block is waited for
+ * Returns 1 if successful, 0 if the block is not cached or -1 on error
+ */
+int libfvde_block_cache_remove_block(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_remove_block";
+	int entry_index       = 0;
+	int result            = 0;
+
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          offset,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libfvde_block_cache_remove_entry(
+	     block_cache,
+	     entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases a reference to the blocks that start in a specific range
+ * A block is removed when its last reference is released. Blocks that are being filled
+ * cannot be removed without waiting for their read request, these are marked as stale
+ * and removed once they have been filled
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_release_range(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfvde_block_cache_entry_t *entry = NULL;
+	static char *function              = "libfvde_block_cache_release_range";
+	int entry_index                    = 0;
+	int result                         = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = block_cache->number_of_entries;
+
+	while( entry_index > 0 )
+	{
+		entry_index--;
+
+		entry = &( block_cache->entries[ entry_index ] );
+
+		if( ( entry->offset < offset )
+		 || ( (size64_t) ( entry->offset - offset ) >= size ) )
+		{
+			continue;
+		}
+		if( entry->reference_count > 0 )
+		{
+			entry->reference_count -= 1;
+		}
+		if( ( entry->reference_count > 0 )
+		 || ( entry->is_stale != 0 ) )
+		{
+			continue;
+		}
+		if( entry->is_filling != 0 )
+		{
+			if( entry->read_request == NULL )
+			{
+				result = 0;
+			}
+			else
+			{
+				result = libfvde_read_request_is_complete(
+				          entry->read_request,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine if read request of entry: %d is complete.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+			}
+			if( result == 0 )
+			{
+				entry->is_stale = 1;
+
+				continue;
+			}
+		}
+		if( libfvde_block_cache_remove_entry(
+		     block_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the stale blocks of which the read request has completed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_remove_stale_blocks(
+     libfvde_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	libfvde_block_cache_entry_t *entry = NULL;
+	static char *function              = "libfvde_block_cache_remove_stale_blocks";
+	int entry_index                    = 0;
+	int result                         = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = block_cache->number_of_entries;
+
+	while( entry_index > 0 )
+	{
+		entry_index--;
+
+		entry = &( block_cache->entries[ entry_index ] );
+
+		if( ( entry->is_stale == 0 )
+		 || ( entry->read_request == NULL ) )
+		{
+			continue;
+		}
+		result = libfvde_read_request_is_complete(
+		          entry->read_request,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if read request of entry: %d is complete.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libfvde_block_cache_remove_entry(
+		     block_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the cached data at a specific offset
+ * A completed read request of the block that contains the offset is finalized,
+ * where a stale block or a block of which the read failed is removed
+ * Returns 1 if successful, 0 if the offset is not cached or -1 on error
+ */
+int libfvde_block_cache_get_data(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfvde_block_cache_entry_t *entry = NULL;
+	static char *function              = "libfvde_block_cache_get_data";
+	size_t data_offset                 = 0;
+	ssize_t read_count                 = 0;
+	off64_t block_offset               = 0;
+	int entry_index                    = 0;
+	int result                         = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset  = (size_t) ( offset % block_cache->block_size );
+	block_offset = offset - data_offset;
+
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          block_offset,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to find entry.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	entry = &( block_cache->entries[ entry_index ] );
+
+	if( entry->read_request != NULL )
+	{
+		result = libfvde_read_request_get_read_count(
+		          entry->read_request,
+		          &read_count,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read count.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* The read request is still pending
+			 */
+			return( 0 );
+		}
+		if( libfvde_read_request_free(
+		     &( entry->read_request ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read request.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( read_count <= 0 )
+		 || ( entry->is_stale != 0 ) )
+		{
+			if( libfvde_block_cache_remove_entry(
+			     block_cache,
+			     entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			return( 0 );
+		}
+		entry->valid_data_size = (size_t) read_count;
+		entry->is_filling      = 0;
+	}
+	if( ( entry->is_filling != 0 )
+	 || ( data_offset >= entry->valid_data_size ) )
+	{
+		return( 0 );
+	}
+	*data      = &( entry->data[ data_offset ] );
+	*data_size = entry->valid_data_size - data_offset;
+
+	return( 1 );
+}
+
+/* Empties the block cache
+ * Blocks that are being filled are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_cache_empty(
+     libfvde_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_block_cache_empty";
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = block_cache->number_of_entries;
+
+	while( entry_index > 0 )
+	{
+		entry_index--;
+
+		if( block_cache->entries[ entry_index ].is_filling != 0 )
+		{
+			if( block_cache->entries[ entry_index ].read_request == NULL )
+			{
+				continue;
+			}
+			result = libfvde_read_request_is_complete(
+			          block_cache->entries[ entry_index ].read_request,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if read request of entry: %d is complete.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				continue;
+			}
+		}
+		if( libfvde_block_cache_remove_entry(
+		     block_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,161 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_BLOCK_CACHE_H )
+#define _LIBFVDE_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_block_cache_entry libfvde_block_cache_entry_t;
+
+struct libfvde_block_cache_entry
+{
+	/* The offset of the block relative to the start of the logical volume
+	 */
+	off64_t offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The number of bytes of data that are valid
+	 */
+	size_t valid_data_size;
+
+	/* The read request that fills the data
+	 */
+	libfvde_read_request_t *read_request;
+
+	/* Value to indicate the data is being filled
+	 */
+	uint8_t is_filling;
+
+	/* Value to indicate the block is removed once it has been filled
+	 */
+	uint8_t is_stale;
+
+	/* The number of references to the block, such as by overlapping ranges
+	 */
+	int reference_count;
+};
+
+typedef struct libfvde_block_cache libfvde_block_cache_t;
+
+struct libfvde_block_cache
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The entries sorted by offset
+	 */
+	libfvde_block_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+};
+
+int libfvde_block_cache_initialize(
+     libfvde_block_cache_t **block_cache,
+     size_t block_size,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_free(
+     libfvde_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_find_entry(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_remove_entry(
+     libfvde_block_cache_t *block_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_reserve_block(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_reserve_range(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     int number_of_blocks,
+     uint8_t **blocks_data,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_set_read_request(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_remove_block(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_release_range(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_remove_stale_blocks(
+     libfvde_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_get_data(
+     libfvde_block_cache_t *block_cache,
+     off64_t offset,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfvde_block_cache_empty(
+     libfvde_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_BLOCK_CACHE_H ) */
+
@@ -0,0 +1,322 @@
+/*
+ * Block reference functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_block_reference.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_logical_volume.h"
+#include "libfvde_sector_data.h"
+#include "libfvde_types.h"
+
+/* Creates a block reference
+ * Make sure the value block_reference is referencing, is set to NULL
+ * The block reference takes over a reference to the logical volume and the sector data,
+ * both are released when the block reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_reference_initialize(
+     libfvde_block_reference_t **block_reference,
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libfvde_sector_data_t *sector_data,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_block_reference_t *internal_block_reference = NULL;
+	static char *function                                        = "libfvde_block_reference_initialize";
+
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reference != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block reference value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > sector_data->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_reference = memory_allocate_structure(
+	                            libfvde_internal_block_reference_t );
+
+	if( internal_block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_block_reference,
+	     0,
+	     sizeof( libfvde_internal_block_reference_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block reference.",
+		 function );
+
+		memory_free(
+		 internal_block_reference );
+
+		return( -1 );
+	}
+	internal_block_reference->internal_logical_volume = internal_logical_volume;
+	internal_block_reference->sector_data             = sector_data;
+	internal_block_reference->offset                  = offset;
+	internal_block_reference->data_size               = data_size;
+
+	*block_reference = (libfvde_block_reference_t *) internal_block_reference;
+
+	return( 1 );
+}
+
+/* Frees a block reference
+ * This releases the reference to the cached sector data and the logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_reference_free(
+     libfvde_block_reference_t **block_reference,
+     libcerror_error_t **error )
+{
+	libfvde_internal_block_reference_t *internal_block_reference = NULL;
+	static char *function                                        = "libfvde_block_reference_free";
+	int result                                                   = 1;
+
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reference != NULL )
+	{
+		internal_block_reference = (libfvde_internal_block_reference_t *) *block_reference;
+		*block_reference         = NULL;
+
+		if( libfvde_internal_logical_volume_release_sector_data(
+		     internal_block_reference->internal_logical_volume,
+		     &( internal_block_reference->sector_data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release sector data.",
+			 function );
+
+			result = -1;
+		}
+		if( libfvde_internal_logical_volume_free(
+		     &( internal_block_reference->internal_logical_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release logical volume.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_block_reference );
+	}
+	return( result );
+}
+
+/* Retrieves the offset of the referenced data relative to the start of the logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_reference_get_offset(
+     libfvde_block_reference_t *block_reference,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libfvde_internal_block_reference_t *internal_block_reference = NULL;
+	static char *function                                        = "libfvde_block_reference_get_offset";
+
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_reference = (libfvde_internal_block_reference_t *) block_reference;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_block_reference->offset;
+
+	return( 1 );
+}
+
+/* Retrieves the referenced data
+ * The data is decrypted, read-only and remains valid until the block reference is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_block_reference_get_data(
+     libfvde_block_reference_t *block_reference,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_block_reference_t *internal_block_reference = NULL;
+	static char *function                                        = "libfvde_block_reference_get_data";
+
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
+
+		return( -1 );
+	}
+	internal_block_reference = (libfvde_internal_block_reference_t *) block_reference;
+
+	if( internal_block_reference->sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block reference - missing sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = internal_block_reference->sector_data->data;
+	*data_size = internal_block_reference->data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,91 @@
+/*
+ * Block reference functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_BLOCK_REFERENCE_H )
+#define _LIBFVDE_BLOCK_REFERENCE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_extern.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_logical_volume.h"
+#include "libfvde_sector_data.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_internal_block_reference libfvde_internal_block_reference_t;
+
+struct libfvde_internal_block_reference
+{
+	/* The internal logical volume
+	 */
+	libfvde_internal_logical_volume_t *internal_logical_volume;
+
+	/* The sector data
+	 */
+	libfvde_sector_data_t *sector_data;
+
+	/* The offset of the data relative to the start of the logical volume
+	 */
+	off64_t offset;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+int libfvde_block_reference_initialize(
+     libfvde_block_reference_t **block_reference,
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libfvde_sector_data_t *sector_data,
+     off64_t offset,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_block_reference_free(
+     libfvde_block_reference_t **block_reference,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_block_reference_get_offset(
+     libfvde_block_reference_t *block_reference,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_block_reference_get_data(
+     libfvde_block_reference_t *block_reference,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_BLOCK_REFERENCE_H ) */
+
@@ -34,19 +34,24 @@
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_executor.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_keyring.h"
 #include "libfvde_libbfio.h"
 #include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
+#include "libfvde_libcthreads.h"
 #include "libfvde_libfguid.h"
 #include "libfvde_libfplist.h"
 #include "libfvde_libfvalue.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_memory_usage.h"
 #include "libfvde_metadata_block.h"
+#include "libfvde_passphrase_wrapped_kek.h"
 #include "libfvde_password.h"
 #include "libfvde_segment_descriptor.h"
+#include "libfvde_unused.h"
 
 #include "fvde_metadata.h"
 
@@ -163,11 +168,33 @@ int libfvde_encrypted_metadata_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *encrypted_metadata )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *encrypted_metadata != NULL )
 	{
+		if( ( *encrypted_metadata )->segment_descriptors_0x0304 != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *encrypted_metadata )->segment_descriptors_0x0304 ),
+			 NULL,
+			 NULL );
+		}
 		if( ( *encrypted_metadata )->logical_volume_descriptors != NULL )
 		{
 			libcdata_array_free(
@@ -263,6 +290,21 @@ int libfvde_encrypted_metadata_free(
 			memory_free(
 			 ( *encrypted_metadata )->compressed_data );
 		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *encrypted_metadata )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *encrypted_metadata );
 
@@ -3699,9 +3741,7 @@ int libfvde_encrypted_metadata_read_type_0x0024(
      size_t block_data_size,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data      = NULL;
 	static char *function           = "libfvde_encrypted_metadata_read_type_0x0024";
-	size_t uncompressed_data_size   = 0;
 	uint64_t next_object_identifier = 0;
 	uint32_t xml_plist_data_size    = 0;
 
@@ -3822,105 +3862,13 @@ int libfvde_encrypted_metadata_read_type_0x0024(
 		encrypted_metadata->compressed_data_object_identifier = next_object_identifier;
 		encrypted_metadata->compressed_data_offset           += (size_t) xml_plist_data_size;
 
-		if( next_object_identifier == 0 )
-		{
-			uncompressed_data_size = encrypted_metadata->uncompressed_data_size;
-
-			if( ( uncompressed_data_size == 0 )
-			 || ( uncompressed_data_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid uncompressed data size value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-			uncompressed_data = (uint8_t *) memory_allocate(
-			                                 sizeof( uint8_t ) * uncompressed_data_size );
-
-			if( uncompressed_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create uncompressed data.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfvde_decompress_data(
-			     encrypted_metadata->compressed_data,
-			     encrypted_metadata->compressed_data_size,
-			     LIBFVDE_COMPRESSION_METHOD_DEFLATE,
-			     uncompressed_data,
-			     &uncompressed_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decompress XML plist data.",
-				 function );
-
-				goto on_error;
-			}
-			if( ( uncompressed_data_size > 5 )
-			 && ( uncompressed_data[ 0 ] == (uint8_t) '<' )
-			 && ( uncompressed_data[ 1 ] == (uint8_t) 'd' )
-			 && ( uncompressed_data[ 2 ] == (uint8_t) 'i' )
-			 && ( uncompressed_data[ 3 ] == (uint8_t) 'c' )
-			 && ( uncompressed_data[ 4 ] == (uint8_t) 't' ) )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: XML:\n%s\n",
-					 function,
-					 (char *) uncompressed_data );
-
-					libcnotify_printf(
-					 "\n" );
-				}
-#endif
-				if( encrypted_metadata->encryption_context_plist_data != NULL )
-				{
-					memory_free(
-					 encrypted_metadata->encryption_context_plist_data );
-
-					encrypted_metadata->encryption_context_plist_data = NULL;
-				}
-				encrypted_metadata->encryption_context_plist_data      = uncompressed_data;
-				encrypted_metadata->encryption_context_plist_data_size = uncompressed_data_size;
-
-				uncompressed_data = NULL;
-			}
-			else
-			{
-				memory_free(
-				 uncompressed_data );
-
-				uncompressed_data = NULL;
-			}
-			memory_free(
-			 encrypted_metadata->compressed_data );
-
-			encrypted_metadata->compressed_data = NULL;
-		}
+		/* The compressed data is decompressed when the encryption context plist
+		 * is first accessed, see libfvde_encrypted_metadata_get_encryption_context_plist
+		 */
 	}
 	return( 1 );
 
 on_error:
-	if( uncompressed_data != NULL )
-	{
-		memory_free(
-		 uncompressed_data );
-	}
 	return( -1 );
 }
 
@@ -5455,7 +5403,250 @@ int libfvde_encrypted_metadata_read_type_0x0605(
 	return( 1 );
 }
 
+/* Reads a decrypted encrypted metadata block
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_read_metadata_block(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libfvde_io_handle_t *io_handle,
+     libfvde_metadata_block_t *metadata_block,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encrypted_metadata_read_metadata_block";
+	int result            = 0;
+
+	if( metadata_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata block.",
+		 function );
+
+		return( -1 );
+	}
+	switch( metadata_block->type )
+	{
+		case 0x0010:
+			result = libfvde_encrypted_metadata_read_type_0x0010(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0011:
+			result = libfvde_encrypted_metadata_read_type_0x0011(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0012:
+			result = libfvde_encrypted_metadata_read_type_0x0012(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0013:
+			result = libfvde_encrypted_metadata_read_type_0x0013(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0014:
+			result = libfvde_encrypted_metadata_read_type_0x0014(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0016:
+			result = libfvde_encrypted_metadata_read_type_0x0016(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0017:
+			result = libfvde_encrypted_metadata_read_type_0x0017(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0018:
+			result = libfvde_encrypted_metadata_read_type_0x0018(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0019:
+			result = libfvde_encrypted_metadata_read_type_0x0019(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x001a:
+			result = libfvde_encrypted_metadata_read_type_0x001a(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x001c:
+			result = libfvde_encrypted_metadata_read_type_0x001c(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x001d:
+			result = libfvde_encrypted_metadata_read_type_0x001d(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0021:
+			result = libfvde_encrypted_metadata_read_type_0x0021(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0022:
+			result = libfvde_encrypted_metadata_read_type_0x0022(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0024:
+			result = libfvde_encrypted_metadata_read_type_0x0024(
+				  encrypted_metadata,
+				  metadata_block->object_identifier,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0025:
+			result = libfvde_encrypted_metadata_read_type_0x0025(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0105:
+			result = libfvde_encrypted_metadata_read_type_0x0105(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0205:
+			result = libfvde_encrypted_metadata_read_type_0x0205(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0304:
+			result = libfvde_encrypted_metadata_read_type_0x0304(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0305:
+			result = libfvde_encrypted_metadata_read_type_0x0305(
+				  encrypted_metadata,
+				  metadata_block->object_identifier,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0404:
+			result = libfvde_encrypted_metadata_read_type_0x0404(
+				  encrypted_metadata,
+				  io_handle,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0405:
+			result = libfvde_encrypted_metadata_read_type_0x0405(
+				  encrypted_metadata,
+				  io_handle,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0505:
+			result = libfvde_encrypted_metadata_read_type_0x0505(
+				  encrypted_metadata,
+				  metadata_block->object_identifier,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		case 0x0605:
+			result = libfvde_encrypted_metadata_read_type_0x0605(
+				  encrypted_metadata,
+				  metadata_block->data,
+				  metadata_block->data_size,
+				  error );
+			break;
+
+		default:
+			result = 0;
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata block type 0x%04" PRIx16 ".",
+		 function,
+		 metadata_block->type );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads the encrypted metadata
+ * The encrypted metadata is read in windows of LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE
+ * so that the memory used does not depend on the size of the encrypted metadata
  * Returns 1 if successful or -1 on error
  */
 int libfvde_encrypted_metadata_read_from_file_io_handle(
@@ -5475,9 +5666,13 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 	uint8_t *encrypted_data                          = NULL;
 	uint8_t *metadata_block_data                     = NULL;
 	static char *function                            = "libfvde_encrypted_metadata_read_from_file_io_handle";
-	size_t encrypted_data_offset                     = 0;
+	size_t read_size                                 = 0;
+	size_t window_data_offset                        = 0;
+	size_t window_data_size                          = 0;
+	size_t window_size                               = 0;
 	ssize_t read_count                               = 0;
 	uint64_t calculated_block_number                 = 0;
+	uint64_t encrypted_data_offset                   = 0;
 	uint8_t empty_block_found                        = 0;
 	int result                                       = 0;
 
@@ -5503,89 +5698,68 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( encrypted_metadata_size == 0 )
-	 || ( encrypted_metadata_size > (uint64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	if( file_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid encrypted metadata size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	encrypted_data = (uint8_t *) memory_allocate(
-	                              sizeof( uint8_t ) * (size_t) encrypted_metadata_size );
-
-	if( encrypted_data == NULL )
+	if( ( encrypted_metadata_size == 0 )
+	 || ( encrypted_metadata_size > (uint64_t) ( INT64_MAX - file_offset ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create encrypted metadata.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid encrypted metadata size value out of bounds.",
 		 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
+		return( -1 );
 	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              encrypted_data,
-	              (size_t) encrypted_metadata_size,
-	              file_offset,
-	              error );
+	encrypted_metadata->memory_usage = io_handle->memory_usage;
 
-	if( read_count != (ssize_t) encrypted_metadata_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+	window_size = LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE;
 
-		goto on_error;
+	if( encrypted_metadata_size < (uint64_t) window_size )
+	{
+		window_size = (size_t) encrypted_metadata_size;
 	}
-	if( libfvde_encryption_context_initialize(
-	     &encryption_context,
-	     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
-	     error ) == -1 )
+	encrypted_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * window_size );
+
+	if( encrypted_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-		 "%s: unable to initialize encryption context.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create encrypted data.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfvde_encryption_context_set_keys(
-	     encryption_context,
+	/* Both copies of the encrypted metadata use the same keys
+	 */
+	if( libfvde_io_handle_get_encryption_context(
+	     io_handle,
+	     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
 	     key,
 	     key_bit_size,
 	     tweak_key,
 	     tweak_key_bit_size,
-	     error ) == -1 )
+	     &encryption_context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to set keys in encryption context.",
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to retrieve encryption context.",
 		 function );
 
 		goto on_error;
@@ -5620,8 +5794,55 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 	}
 	while( encrypted_data_offset < encrypted_metadata_size )
 	{
+		if( window_data_offset >= window_data_size )
+		{
+			read_size = window_size;
+
+			if( (uint64_t) read_size > ( encrypted_metadata_size - encrypted_data_offset ) )
+			{
+				read_size = (size_t) ( encrypted_metadata_size - encrypted_data_offset );
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 file_offset + (off64_t) encrypted_data_offset,
+				 file_offset + (off64_t) encrypted_data_offset );
+			}
+#endif
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              encrypted_data,
+			              read_size,
+			              file_offset + (off64_t) encrypted_data_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read encrypted metadata at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset + (off64_t) encrypted_data_offset,
+				 file_offset + (off64_t) encrypted_data_offset );
+
+				goto on_error;
+			}
+			window_data_offset = 0;
+			window_data_size   = read_size;
+		}
+		/* Ignore trailing data that is smaller than a metadata block
+		 */
+		if( ( window_data_size - window_data_offset ) < 8192 )
+		{
+			break;
+		}
 		result = libfvde_metadata_block_check_for_empty_block(
-			  &( encrypted_data[ encrypted_data_offset ] ),
+			  &( encrypted_data[ window_data_offset ] ),
 			  8192,
 			  error );
 
@@ -5634,7 +5855,7 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 			 "%s: unable to determine if encrypted medadata block data is empty.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result != 0 )
 		{
@@ -5649,8 +5870,8 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 				 "%s: empty metadata block: %d at offset %" PRIi64 " (0x%08" PRIx64 ").\n",
 				 function,
 				 calculated_block_number,
-				 file_offset + encrypted_data_offset,
-				 file_offset + encrypted_data_offset );
+				 file_offset + (off64_t) encrypted_data_offset,
+				 file_offset + (off64_t) encrypted_data_offset );
 			}
 #else
 			break;
@@ -5661,7 +5882,7 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 			if( libfvde_encryption_context_crypt(
 			     encryption_context,
 			     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
-			     &( encrypted_data[ encrypted_data_offset ] ),
+			     &( encrypted_data[ window_data_offset ] ),
 			     8192,
 			     metadata_block_data,
 			     8192,
@@ -5685,8 +5906,8 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 				 "%s: reading decrypted metadata block: %d at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
 				 function,
 				 calculated_block_number,
-				 file_offset + encrypted_data_offset,
-				 file_offset + encrypted_data_offset );
+				 file_offset + (off64_t) encrypted_data_offset,
+				 file_offset + (off64_t) encrypted_data_offset );
 			}
 #endif
 			if( libfvde_metadata_block_read_data(
@@ -5717,224 +5938,25 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 					 io_handle->serial_number );
 				}
 #endif
-				switch( metadata_block->type )
-				{
-					case 0x0010:
-						result = libfvde_encrypted_metadata_read_type_0x0010(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0011:
-						result = libfvde_encrypted_metadata_read_type_0x0011(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0012:
-						result = libfvde_encrypted_metadata_read_type_0x0012(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0013:
-						result = libfvde_encrypted_metadata_read_type_0x0013(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0014:
-						result = libfvde_encrypted_metadata_read_type_0x0014(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0016:
-						result = libfvde_encrypted_metadata_read_type_0x0016(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0017:
-						result = libfvde_encrypted_metadata_read_type_0x0017(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0018:
-						result = libfvde_encrypted_metadata_read_type_0x0018(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0019:
-						result = libfvde_encrypted_metadata_read_type_0x0019(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x001a:
-						result = libfvde_encrypted_metadata_read_type_0x001a(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x001c:
-						result = libfvde_encrypted_metadata_read_type_0x001c(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x001d:
-						result = libfvde_encrypted_metadata_read_type_0x001d(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0021:
-						result = libfvde_encrypted_metadata_read_type_0x0021(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0022:
-						result = libfvde_encrypted_metadata_read_type_0x0022(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0024:
-						result = libfvde_encrypted_metadata_read_type_0x0024(
-							  encrypted_metadata,
-							  metadata_block->object_identifier,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0025:
-						result = libfvde_encrypted_metadata_read_type_0x0025(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0105:
-						result = libfvde_encrypted_metadata_read_type_0x0105(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0205:
-						result = libfvde_encrypted_metadata_read_type_0x0205(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0304:
-						result = libfvde_encrypted_metadata_read_type_0x0304(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0305:
-						result = libfvde_encrypted_metadata_read_type_0x0305(
-							  encrypted_metadata,
-							  metadata_block->object_identifier,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0404:
-						result = libfvde_encrypted_metadata_read_type_0x0404(
-							  encrypted_metadata,
-							  io_handle,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0405:
-						result = libfvde_encrypted_metadata_read_type_0x0405(
-							  encrypted_metadata,
-							  io_handle,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0505:
-						result = libfvde_encrypted_metadata_read_type_0x0505(
-							  encrypted_metadata,
-							  metadata_block->object_identifier,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					case 0x0605:
-						result = libfvde_encrypted_metadata_read_type_0x0605(
-							  encrypted_metadata,
-							  metadata_block->data,
-							  metadata_block->data_size,
-							  error );
-						break;
-
-					default:
-						result = 0;
-						break;
-				}
-				if( result == -1 )
+				if( libfvde_encrypted_metadata_read_metadata_block(
+				     encrypted_metadata,
+				     io_handle,
+				     metadata_block,
+				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_IO,
 					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read metadata block type 0x%04" PRIx16 ".",
-					 function,
-					 metadata_block->type );
+					 "%s: unable to read metadata block.",
+					 function );
 
 					goto on_error;
 				}
 			}
 		}
 		encrypted_data_offset += 8192;
+		window_data_offset    += 8192;
 
 		calculated_block_number += 1;
 	}
@@ -5970,7 +5992,8 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 
 	metadata_block_data = NULL;
 
-	if( libfvde_encryption_context_free(
+	if( libfvde_io_handle_release_encryption_context(
+	     io_handle,
 	     &encryption_context,
 	     error ) != 1 )
 	{
@@ -5978,7 +6001,7 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free encryption context.",
+		 "%s: unable to release encryption context.",
 		 function );
 
 		goto on_error;
@@ -5988,30 +6011,8 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
 
 	encrypted_data = NULL;
 
-	if( encrypted_metadata->encryption_context_plist_data != NULL )
-	{
-		result = libfvde_encryption_context_plist_set_data(
-			  encrypted_metadata->encryption_context_plist,
-			  encrypted_metadata->encryption_context_plist_data,
-			  encrypted_metadata->encryption_context_plist_data_size,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set encryption context plist data.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			encrypted_metadata->encryption_context_plist_file_is_set = 1;
-		}
-	}
+	/* The encryption context plist data is decompressed and parsed on first access
+	 */
 /* TODO find com.apple.corestorage.lvf.encryption.context/WrappedVolumeKeys/?/BlockAlgorithm */
 	return( 1 );
 
@@ -6055,7 +6056,8 @@ on_error:
 	}
 	if( encryption_context != NULL )
 	{
-		libfvde_encryption_context_free(
+		libfvde_io_handle_release_encryption_context(
+		 io_handle,
 		 &encryption_context,
 		 NULL );
 	}
@@ -6067,377 +6069,1341 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the volume master key
- * Returns 1 if successful, 0 in not or -1 on error
+/* Decompresses the encryption context plist data
+ * The compressed data is retained to rebuild the encryption context plist after compaction
+ * Returns 1 if successful, 0 if no compressed encryption context plist data is available or -1 on error
  */
-int libfvde_encrypted_metadata_get_volume_master_key(
-     libfvde_encrypted_metadata_t *metadata,
-     libfvde_encryption_context_plist_t *encryption_context_plist,
-     libfvde_keyring_t *keyring,
-     const uint8_t *user_password,
-     size_t user_password_length,
-     const uint8_t *recovery_password,
-     size_t recovery_password_length,
+int libfvde_encrypted_metadata_decompress_encryption_context_plist_data(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error )
+{
+	uint8_t *uncompressed_data    = NULL;
+	static char *function         = "libfvde_encrypted_metadata_decompress_encryption_context_plist_data";
+	size_t uncompressed_data_size = 0;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	/* The compressed data is complete when there is no next object identifier
+	 */
+	if( ( encrypted_metadata->compressed_data == NULL )
+	 || ( encrypted_metadata->compressed_data_object_identifier != 0 ) )
+	{
+		return( 0 );
+	}
+	uncompressed_data_size = encrypted_metadata->uncompressed_data_size;
+
+	if( ( uncompressed_data_size == 0 )
+	 || ( uncompressed_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid encrypted metadata - uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * uncompressed_data_size );
+
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create uncompressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_decompress_data(
+	     encrypted_metadata->compressed_data,
+	     encrypted_metadata->compressed_data_size,
+	     LIBFVDE_COMPRESSION_METHOD_DEFLATE,
+	     uncompressed_data,
+	     &uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decompress XML plist data.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( uncompressed_data_size > 5 )
+	 && ( uncompressed_data[ 0 ] == (uint8_t) '<' )
+	 && ( uncompressed_data[ 1 ] == (uint8_t) 'd' )
+	 && ( uncompressed_data[ 2 ] == (uint8_t) 'i' )
+	 && ( uncompressed_data[ 3 ] == (uint8_t) 'c' )
+	 && ( uncompressed_data[ 4 ] == (uint8_t) 't' ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: XML:\n%s\n",
+			 function,
+			 (char *) uncompressed_data );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( encrypted_metadata->encryption_context_plist_data != NULL )
+		{
+			memory_free(
+			 encrypted_metadata->encryption_context_plist_data );
+		}
+		encrypted_metadata->encryption_context_plist_data      = uncompressed_data;
+		encrypted_metadata->encryption_context_plist_data_size = uncompressed_data_size;
+
+		return( 1 );
+	}
+	memory_free(
+	 uncompressed_data );
+
+	return( 0 );
+
+on_error:
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the estimated memory usage of the encryption context plist and the data it is built from
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_get_encryption_context_plist_memory_usage(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvde_encrypted_metadata_get_encryption_context_plist_memory_usage";
+	size64_t plist_memory_usage = 0;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( encrypted_metadata->encryption_context_plist != NULL )
+	{
+		if( libfvde_encryption_context_plist_get_memory_usage(
+		     encrypted_metadata->encryption_context_plist,
+		     &plist_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of encryption context plist.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*memory_usage = plist_memory_usage
+	              + encrypted_metadata->encryption_context_plist_data_size
+	              + encrypted_metadata->compressed_data_size;
+
+	return( 1 );
+}
+
+/* Updates the accounted metadata memory usage after the encryption context plist was built or released
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_update_encryption_context_plist_memory_usage(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     size64_t previous_memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfvde_encrypted_metadata_update_encryption_context_plist_memory_usage";
+	size64_t current_memory_usage = 0;
+	int result                    = 1;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( encrypted_metadata->memory_usage == NULL )
+	{
+		return( 1 );
+	}
+	if( libfvde_encrypted_metadata_get_encryption_context_plist_memory_usage(
+	     encrypted_metadata,
+	     &current_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve encryption context plist memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_memory_usage > previous_memory_usage )
+	{
+		result = libfvde_memory_usage_add_used_size(
+		          encrypted_metadata->memory_usage,
+		          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+		          current_memory_usage - previous_memory_usage,
+		          error );
+	}
+	else if( current_memory_usage < previous_memory_usage )
+	{
+		result = libfvde_memory_usage_remove_used_size(
+		          encrypted_metadata->memory_usage,
+		          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+		          previous_memory_usage - current_memory_usage,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update metadata memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the encryption context plist
+ * The encryption context plist is built from the compressed or XML plist data on first access
+ * and after it was released by compaction. The XML plist data is freed afterwards when it
+ * can be decompressed again, otherwise it is retained
+ * A retrieved encryption context plist must be released with
+ * libfvde_encrypted_metadata_release_encryption_context_plist
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfvde_encrypted_metadata_get_encryption_context_plist(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libfvde_encryption_context_plist_t **encryption_context_plist,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvde_encrypted_metadata_get_encryption_context_plist";
+	size64_t previous_memory_usage = 0;
+	int result                     = 0;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context plist.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     encrypted_metadata->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( encrypted_metadata->encryption_context_plist_file_is_set == 0 )
+	 && ( encrypted_metadata->encryption_context_plist != NULL ) )
+	{
+		if( libfvde_encrypted_metadata_get_encryption_context_plist_memory_usage(
+		     encrypted_metadata,
+		     &previous_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context plist memory usage.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfvde_encrypted_metadata_decompress_encryption_context_plist_data(
+		          encrypted_metadata,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress encryption context plist data.",
+			 function );
+
+			goto on_error;
+		}
+		if( encrypted_metadata->encryption_context_plist_data != NULL )
+		{
+			result = libfvde_encryption_context_plist_set_data(
+				  encrypted_metadata->encryption_context_plist,
+				  encrypted_metadata->encryption_context_plist_data,
+				  encrypted_metadata->encryption_context_plist_data_size,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set encryption context plist data.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				encrypted_metadata->encryption_context_plist_file_is_set = 1;
+			}
+			/* The encryption context plist retains its own copy of the data
+			 */
+			if( encrypted_metadata->compressed_data != NULL )
+			{
+				memory_free(
+				 encrypted_metadata->encryption_context_plist_data );
+
+				encrypted_metadata->encryption_context_plist_data      = NULL;
+				encrypted_metadata->encryption_context_plist_data_size = 0;
+			}
+		}
+		if( libfvde_encrypted_metadata_update_encryption_context_plist_memory_usage(
+		     encrypted_metadata,
+		     previous_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update encryption context plist memory usage.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = 0;
+
+	if( encrypted_metadata->encryption_context_plist_file_is_set != 0 )
+	{
+		*encryption_context_plist = encrypted_metadata->encryption_context_plist;
+
+		encrypted_metadata->encryption_context_plist_reference_count += 1;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     encrypted_metadata->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 encrypted_metadata->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases an encryption context plist retrieved with
+ * libfvde_encrypted_metadata_get_encryption_context_plist
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_release_encryption_context_plist(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encrypted_metadata_release_encryption_context_plist";
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     encrypted_metadata->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( encrypted_metadata->encryption_context_plist_reference_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid encrypted metadata - encryption context plist reference count value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	encrypted_metadata->encryption_context_plist_reference_count -= 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     encrypted_metadata->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 encrypted_metadata->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Compacts the encrypted metadata
+ * Releases the encryption context plist data and XML plist elements when they are not in use
+ * and can be rebuilt from the retained compressed or XML plist data on next access
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_compact(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvde_encrypted_metadata_compact";
+	size64_t previous_memory_usage = 0;
+	int result                     = 0;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     encrypted_metadata->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The compressed data can only be used to rebuild the encryption context plist
+	 * when it is complete
+	 */
+	if( ( encrypted_metadata->encryption_context_plist_file_is_set != 0 )
+	 && ( encrypted_metadata->encryption_context_plist_reference_count == 0 )
+	 && ( ( ( encrypted_metadata->compressed_data != NULL )
+	   &&   ( encrypted_metadata->compressed_data_object_identifier == 0 ) )
+	  || ( encrypted_metadata->encryption_context_plist_data != NULL ) ) )
+	{
+		if( libfvde_encrypted_metadata_get_encryption_context_plist_memory_usage(
+		     encrypted_metadata,
+		     &previous_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context plist memory usage.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfvde_encryption_context_plist_release_data(
+		          encrypted_metadata->encryption_context_plist,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release encryption context plist data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			encrypted_metadata->encryption_context_plist_file_is_set = 0;
+
+			if( libfvde_encrypted_metadata_update_encryption_context_plist_memory_usage(
+			     encrypted_metadata,
+			     previous_memory_usage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update encryption context plist memory usage.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     encrypted_metadata->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 encrypted_metadata->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to unwrap a passphrase wrapped KEK from a thread pool
+ * Unwrapping is skipped once another thread has unwrapped a KEK
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_unwrap_passphrase_wrapped_kek_callback(
+     libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek,
+     libfvde_encrypted_metadata_unwrap_arguments_t *unwrap_arguments )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libfvde_encrypted_metadata_unwrap_passphrase_wrapped_kek_callback";
+	int found_kek            = 0;
+	int result               = 0;
+
+	if( unwrap_arguments == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     unwrap_arguments->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	found_kek = unwrap_arguments->found_kek;
+
+	if( libcthreads_mutex_release(
+	     unwrap_arguments->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( found_kek != 0 )
+	{
+		return( 1 );
+	}
+	result = libfvde_passphrase_wrapped_kek_unwrap(
+	          passphrase_wrapped_kek,
+	          unwrap_arguments->password,
+	          unwrap_arguments->password_size,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unwrap passphrase wrapped KEK.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     unwrap_arguments->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		unwrap_arguments->found_kek = 1;
+
+		if( libcthreads_mutex_release(
+		     unwrap_arguments->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	/* The error is reported by the thread that joins the thread pool
+	 */
+	if( libcthreads_mutex_grab(
+	     unwrap_arguments->mutex,
+	     NULL ) == 1 )
+	{
+		unwrap_arguments->unwrap_failed = 1;
+
+		libcthreads_mutex_release(
+		 unwrap_arguments->mutex,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Unwraps the passphrase wrapped KEKs using a password
+ * If multiple passphrase wrapped KEKs are available they are unwrapped concurrently
+ * and the KEK of the first matching passphrase wrapped KEK is returned
+ * The passphrase wrapped KEKs are unwrapped with the executor if not NULL
+ * Returns 1 if successful, 0 if no KEK could be unwrapped or -1 on error
+ */
+int libfvde_encrypted_metadata_unwrap_passphrase_wrapped_keks(
+     libcdata_array_t *passphrase_wrapped_keks,
+     const uint8_t *password,
+     size_t password_size,
+     uint8_t *kek,
+     size_t kek_size,
+     libfvde_executor_t *executor,
      libcerror_error_t **error )
 {
-	uint8_t passphrase_key[ 16 ];
-	uint8_t volume_key_wrapped_kek[ 24 ];
-	uint8_t volume_master_key_wrapped_kek[ 24 ];
-
-	uint8_t *kek_wrapped_volume_key    = NULL;
-	uint8_t *passphrase_wrapped_kek    = NULL;
-	static char *function              = "libfvde_encrypted_metadata_get_volume_master_key";
-	size_t kek_wrapped_volume_key_size = 0;
-	size_t passphrase_wrapped_kek_size = 0;
-	uint32_t number_of_iterations      = 0;
-	uint32_t value_size                = 0;
-	uint32_t value_type                = 0;
-	int found_key                      = 0;
-	int passphrase_wrapped_kek_index   = 0;
-	int result                         = 0;
+	libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek = NULL;
+	static char *function                                    = "libfvde_encrypted_metadata_unwrap_passphrase_wrapped_keks";
+	int number_of_passphrase_wrapped_keks                    = 0;
+	int passphrase_wrapped_kek_index                         = 0;
+	int result                                               = 0;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libfvde_encrypted_metadata_unwrap_arguments_t unwrap_arguments;
+
+	libcthreads_thread_pool_t *thread_pool                   = NULL;
+	libfvde_executor_task_group_t *task_group                = NULL;
+	int number_of_threads                                    = 0;
+	int unwrap_failed                                        = 0;
+#else
+	LIBFVDE_UNREFERENCED_PARAMETER( executor )
+#endif
 
-	if( metadata == NULL )
+	if( passphrase_wrapped_keks == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid metadata.",
+		 "%s: invalid passphrase wrapped KEKs array.",
 		 function );
 
 		return( -1 );
 	}
-	if( encryption_context_plist == NULL )
+	if( kek == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid encryption context plist.",
+		 "%s: invalid KEK.",
 		 function );
 
 		return( -1 );
 	}
-	if( keyring == NULL )
+	if( kek_size != 16 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid keyring.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid KEK size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     passphrase_wrapped_keks,
+	     &number_of_passphrase_wrapped_keks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of passphrase wrapped KEKs.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( memory_set(
+	     &unwrap_arguments,
+	     0,
+	     sizeof( libfvde_encrypted_metadata_unwrap_arguments_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear unwrap arguments.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( user_password != NULL )
-	 || ( recovery_password != NULL ) )
+	if( number_of_passphrase_wrapped_keks > 1 )
 	{
-		do
+		unwrap_arguments.password      = password;
+		unwrap_arguments.password_size = password_size;
+
+		if( libcthreads_mutex_initialize(
+		     &( unwrap_arguments.mutex ),
+		     error ) != 1 )
 		{
-			result = libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
-			          encryption_context_plist,
-			          passphrase_wrapped_kek_index,
-			          &passphrase_wrapped_kek,
-			          &passphrase_wrapped_kek_size,
-			          error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex.",
+			 function );
 
-			if( result == -1 )
+			goto on_error;
+		}
+		if( executor != NULL )
+		{
+			if( libfvde_executor_task_group_initialize(
+			     &task_group,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_GENERIC,
-				 "%s: unable to retrieve passphrase wrapped KEK: %d from encryption context plist.",
-				 function,
-				 passphrase_wrapped_kek_index );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create task group.",
+				 function );
 
 				goto on_error;
 			}
-			else if( result == 0 )
+		}
+		else
+		{
+			number_of_threads = number_of_passphrase_wrapped_keks;
+
+			if( number_of_threads > LIBFVDE_MAXIMUM_NUMBER_OF_UNLOCK_THREADS )
 			{
-				break;
+				number_of_threads = LIBFVDE_MAXIMUM_NUMBER_OF_UNLOCK_THREADS;
 			}
-			if( passphrase_wrapped_kek == NULL )
+			if( libcthreads_thread_pool_create(
+			     &thread_pool,
+			     NULL,
+			     number_of_threads,
+			     number_of_passphrase_wrapped_keks,
+			     (int (*)(intptr_t *, void *)) &libfvde_encrypted_metadata_unwrap_passphrase_wrapped_kek_callback,
+			     (void *) &unwrap_arguments,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing passphrase wrapped KEK: %d.",
-				 function,
-				 passphrase_wrapped_kek_index );
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread pool.",
+				 function );
 
 				goto on_error;
 			}
-			if( passphrase_wrapped_kek_size != 284 )
+		}
+		for( passphrase_wrapped_kek_index = 0;
+		     passphrase_wrapped_kek_index < number_of_passphrase_wrapped_keks;
+		     passphrase_wrapped_kek_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     passphrase_wrapped_keks,
+			     passphrase_wrapped_kek_index,
+			     (intptr_t **) &passphrase_wrapped_kek,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid passphrase wrapped KEK: %d size value out of bounds.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve passphrase wrapped KEK: %d.",
 				 function,
 				 passphrase_wrapped_kek_index );
 
 				goto on_error;
 			}
-			byte_stream_copy_to_uint32_little_endian(
-			 &( passphrase_wrapped_kek[ 0 ] ),
-			 value_type );
-
-			byte_stream_copy_to_uint32_little_endian(
-			 &( passphrase_wrapped_kek[ 4 ] ),
-			 value_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( task_group != NULL )
 			{
-				libcnotify_printf(
-				 "%s: value type\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 value_type );
+				if( libfvde_executor_submit(
+				     executor,
+				     task_group,
+				     (int (*)(intptr_t *, void *)) &libfvde_encrypted_metadata_unwrap_passphrase_wrapped_kek_callback,
+				     (intptr_t *) passphrase_wrapped_kek,
+				     (void *) &unwrap_arguments,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to submit passphrase wrapped KEK: %d to executor.",
+					 function,
+					 passphrase_wrapped_kek_index );
 
-				libcnotify_printf(
-				 "%s: value size\t\t: %" PRIu32 "\n",
-				 function,
-				 value_size );
+					goto on_error;
+				}
 			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-			if( value_type != 0x00000003UL )
+			else if( libcthreads_thread_pool_push(
+			          thread_pool,
+			          (intptr_t *) passphrase_wrapped_kek,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported value type.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push passphrase wrapped KEK: %d onto thread pool.",
+				 function,
+				 passphrase_wrapped_kek_index );
 
 				goto on_error;
 			}
-			if( value_size != 16 )
+		}
+		if( task_group != NULL )
+		{
+			if( libfvde_executor_wait(
+			     executor,
+			     task_group,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported value size.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to wait for task group.",
 				 function );
 
 				goto on_error;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( libfvde_executor_task_group_free(
+			     &task_group,
+			     error ) != 1 )
 			{
-				libcnotify_printf(
-				 "%s: salt:\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free task group.",
 				 function );
-				libcnotify_print_data(
-				 &( passphrase_wrapped_kek[ 8 ] ),
-				 value_size,
-				 0 );
-			}
-#endif
-			byte_stream_copy_to_uint32_little_endian(
-			 &( passphrase_wrapped_kek[ 168 ] ),
-			 number_of_iterations );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: number of iterations\t: %" PRIu32 "\n",
-				 function,
-				 number_of_iterations );
+				goto on_error;
 			}
-#endif
-			if( user_password != NULL )
-			{
-				if( libfvde_password_pbkdf2(
-				     user_password,
-				     user_password_length,
-				     &( passphrase_wrapped_kek[ 8 ] ),
-				     value_size,
-				     number_of_iterations,
-				     passphrase_key,
-				     16,
-				     error ) == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine password key.",
-					 function );
+		}
+		else if( libcthreads_thread_pool_join(
+		          &thread_pool,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
 
-					goto on_error;
-				}
-			}
-			else if( recovery_password != NULL )
-			{
-				if( libfvde_password_pbkdf2(
-				     recovery_password,
-				     recovery_password_length,
-				     &( passphrase_wrapped_kek[ 8 ] ),
-				     value_size,
-				     number_of_iterations,
-				     passphrase_key,
-				     16,
-				     error ) == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to determine recovery password key.",
-					 function );
+			goto on_error;
+		}
+		if( libcthreads_mutex_grab(
+		     unwrap_arguments.mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
 
-					goto on_error;
-				}
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: passphrase key:\n",
-				 function );
-				libcnotify_print_data(
-				 passphrase_key,
-				 16,
-				 0 );
-			}
-#endif
-			byte_stream_copy_to_uint32_little_endian(
-			 &( passphrase_wrapped_kek[ 24 ] ),
-			 value_type );
+			goto on_error;
+		}
+		unwrap_failed = unwrap_arguments.unwrap_failed;
 
-			byte_stream_copy_to_uint32_little_endian(
-			 &( passphrase_wrapped_kek[ 28 ] ),
-			 value_size );
+		if( libcthreads_mutex_release(
+		     unwrap_arguments.mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: value type\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 value_type );
+			goto on_error;
+		}
+		if( libcthreads_mutex_free(
+		     &( unwrap_arguments.mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
 
-				libcnotify_printf(
-				 "%s: value size\t\t: %" PRIu32 "\n",
-				 function,
-				 value_size );
-			}
+			goto on_error;
+		}
+		if( unwrap_failed != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unwrap passphrase wrapped KEK.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	/* Prefer the first passphrase wrapped KEK that matches, as when unwrapping sequentially
+	 */
+	for( passphrase_wrapped_kek_index = 0;
+	     passphrase_wrapped_kek_index < number_of_passphrase_wrapped_keks;
+	     passphrase_wrapped_kek_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     passphrase_wrapped_keks,
+		     passphrase_wrapped_kek_index,
+		     (intptr_t **) &passphrase_wrapped_kek,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve passphrase wrapped KEK: %d.",
+			 function,
+			 passphrase_wrapped_kek_index );
+
+			goto on_error;
+		}
+		if( passphrase_wrapped_kek == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing passphrase wrapped KEK: %d.",
+			 function,
+			 passphrase_wrapped_kek_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( number_of_passphrase_wrapped_keks > 1 )
+		{
+			result = (int) passphrase_wrapped_kek->kek_is_set;
+		}
+		else
 #endif
-			if( value_type != 0x00000010UL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported value type.",
-				 function );
+		{
+			result = libfvde_passphrase_wrapped_kek_unwrap(
+			          passphrase_wrapped_kek,
+			          password,
+			          password_size,
+			          error );
 
-				goto on_error;
-			}
-			if( value_size != 24 )
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported value size.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to unwrap passphrase wrapped KEK: %d.",
+				 function,
+				 passphrase_wrapped_kek_index );
 
 				goto on_error;
 			}
+		}
+		if( result != 0 )
+		{
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
-				 "%s: encrypted volume key wrapped KEK:\n",
+				 "%s: KEK wrapped volume key encryption key:\n",
 				 function );
 				libcnotify_print_data(
-				 &( passphrase_wrapped_kek[ 32 ] ),
-				 value_size,
+				 passphrase_wrapped_kek->kek,
+				 16,
 				 0 );
 			}
-#endif
-			if( libfvde_encryption_aes_key_unwrap(
-			     passphrase_key,
-			     16 * 8,
-			     &( passphrase_wrapped_kek[ 32 ] ),
-			     value_size,
-			     volume_key_wrapped_kek,
-			     24,
-			     error ) == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to retrieve volume key wrapped KEK.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_set(
-			     passphrase_key,
-			     0,
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( memory_copy(
+			     kek,
+			     passphrase_wrapped_kek->kek,
 			     16 ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear passphrase key.",
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy KEK.",
 				 function );
 
 				goto on_error;
 			}
-			memory_free(
-			 passphrase_wrapped_kek );
+			return( 1 );
+		}
+	}
+	return( 0 );
 
-			passphrase_wrapped_kek = NULL;
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( task_group != NULL )
+	{
+		if( libfvde_executor_wait(
+		     executor,
+		     task_group,
+		     NULL ) == 1 )
+		{
+			libfvde_executor_task_group_free(
+			 &task_group,
+			 NULL );
+		}
+	}
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( unwrap_arguments.mutex != NULL )
+	{
+		libcthreads_mutex_free(
+		 &( unwrap_arguments.mutex ),
+		 NULL );
+	}
+#endif
+	return( -1 );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: volume key wrapped KEK:\n",
-				 function );
-				libcnotify_print_data(
-				 volume_key_wrapped_kek,
-				 24,
-				 0 );
-			}
+/* Retrieves the volume master key
+ * Returns 1 if successful, 0 in not or -1 on error
+ */
+int libfvde_encrypted_metadata_get_volume_master_key(
+     libfvde_encrypted_metadata_t *metadata,
+     libfvde_encryption_context_plist_t *encryption_context_plist,
+     libfvde_keyring_t *keyring,
+     const uint8_t *user_password,
+     size_t user_password_length,
+     const uint8_t *recovery_password,
+     size_t recovery_password_length,
+     libfvde_executor_t *executor,
+     libcerror_error_t **error )
+{
+	uint8_t kek[ 16 ];
+	uint8_t volume_master_key_wrapped_kek[ 24 ];
+
+	libcdata_array_t *passphrase_wrapped_keks = NULL;
+	const uint8_t *password                   = NULL;
+	uint8_t *kek_wrapped_volume_key           = NULL;
+	static char *function                     = "libfvde_encrypted_metadata_get_volume_master_key";
+	size_t kek_wrapped_volume_key_size        = 0;
+	size_t password_size                      = 0;
+	int found_key                             = 0;
+	int result                                = 0;
+
+	if( metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context plist.",
+		 function );
+
+		return( -1 );
+	}
+	if( keyring == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keyring.",
+		 function );
+
+		return( -1 );
+	}
+	if( user_password != NULL )
+	{
+		password      = user_password;
+		password_size = user_password_length;
+	}
+	else if( recovery_password != NULL )
+	{
+		password      = recovery_password;
+		password_size = recovery_password_length;
+	}
+	if( password != NULL )
+	{
+		/* The passphrase wrapped KEKs are cached by the encryption context plist,
+		 * which can be shared by the logical volumes
+		 */
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     metadata->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
 #endif
-	                if( memory_compare(
-			     volume_key_wrapped_kek,
-			     libfvde_encrypted_metadata_wrapped_kek_initialization_vector,
-			     8 ) == 0 )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: KEK wrapped volume key encryption key:\n",
-					 function );
-					libcnotify_print_data(
-					 &( volume_key_wrapped_kek[ 8 ] ),
-					 16,
-					 0 );
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+		          encryption_context_plist,
+		          &passphrase_wrapped_keks,
+		          error );
 
-				found_key = 1;
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     metadata->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
 
-				break;
-			}
-			passphrase_wrapped_kek_index++;
+			goto on_error;
+		}
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve passphrase wrapped KEKs.",
+			 function );
+
+			goto on_error;
+		}
+		found_key = libfvde_encrypted_metadata_unwrap_passphrase_wrapped_keks(
+		             passphrase_wrapped_keks,
+		             password,
+		             password_size,
+		             kek,
+		             16,
+		             executor,
+		             error );
+
+		if( found_key == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unwrap passphrase wrapped KEKs.",
+			 function );
+
+			goto on_error;
 		}
-		while( result != 0 );
+		if( libcdata_array_free(
+		     &passphrase_wrapped_keks,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free passphrase wrapped KEKs array.",
+			 function );
 
+			goto on_error;
+		}
 		if( found_key != 0 )
 		{
 			if( libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
@@ -6479,10 +7445,9 @@ int libfvde_encrypted_metadata_get_volume_master_key(
 			}
 /* TODO: again this could be improved to get size dynamically
  * in case it uses larger keys
- * the first 8 bytes of the KEK is the IV
  */
 			if( libfvde_encryption_aes_key_unwrap(
-			     &( volume_key_wrapped_kek[ 8 ] ),
+			     kek,
 			     16 * 8,
 			     &( kek_wrapped_volume_key[ 8 ] ),
 			     24,
@@ -6500,15 +7465,15 @@ int libfvde_encrypted_metadata_get_volume_master_key(
 				goto on_error;
 			}
 			if( memory_set(
-			     volume_key_wrapped_kek,
+			     kek,
 			     0,
-			     24 ) == NULL )
+			     16 ) == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_MEMORY,
 				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-				 "%s: unable to clear volume key wrapped KEK.",
+				 "%s: unable to clear KEK.",
 				 function );
 
 				goto on_error;
@@ -6574,10 +7539,12 @@ on_error:
 		memory_free(
 		 kek_wrapped_volume_key );
 	}
-	if( passphrase_wrapped_kek != NULL )
+	if( passphrase_wrapped_keks != NULL )
 	{
-		memory_free(
-		 passphrase_wrapped_kek );
+		libcdata_array_free(
+		 &passphrase_wrapped_keks,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+		 NULL );
 	}
 	memory_set(
 	 volume_master_key_wrapped_kek,
@@ -6585,18 +7552,152 @@ on_error:
 	 24 );
 
 	memory_set(
-	 volume_key_wrapped_kek,
-	 0,
-	 24 );
-
-	memory_set(
-	 passphrase_key,
+	 kek,
 	 0,
 	 16 );
 
 	return( -1 );
 }
 
+/* Retrieves the estimated memory usage of the encrypted metadata
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encrypted_metadata_get_memory_usage(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	static char *function                                          = "libfvde_encrypted_metadata_get_memory_usage";
+	size64_t plist_memory_usage                                    = 0;
+	size64_t safe_memory_usage                                     = 0;
+	int descriptor_index                                           = 0;
+	int number_of_logical_volume_descriptors                       = 0;
+	int number_of_segment_descriptors                              = 0;
+
+	if( encrypted_metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage = sizeof( libfvde_encrypted_metadata_t )
+	                  + encrypted_metadata->encryption_context_plist_data_size
+	                  + encrypted_metadata->compressed_data_size;
+
+	if( libcdata_array_get_number_of_entries(
+	     encrypted_metadata->logical_volume_descriptors,
+	     &number_of_logical_volume_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volume descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_logical_volume_descriptors;
+	     descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     encrypted_metadata->logical_volume_descriptors,
+		     descriptor_index,
+		     (intptr_t **) &logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume descriptor: %d.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		if( logical_volume_descriptor == NULL )
+		{
+			continue;
+		}
+		safe_memory_usage += sizeof( libfvde_logical_volume_descriptor_t )
+		                   + logical_volume_descriptor->name_size;
+
+		if( libcdata_array_get_number_of_entries(
+		     logical_volume_descriptor->segment_descriptors,
+		     &number_of_segment_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of segment descriptors of logical volume descriptor: %d.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		safe_memory_usage += (size64_t) number_of_segment_descriptors * sizeof( libfvde_segment_descriptor_t );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     encrypted_metadata->segment_descriptors_0x0304,
+	     &number_of_segment_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segment descriptors of metadata block 0x0304.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage += (size64_t) number_of_segment_descriptors * sizeof( libfvde_segment_descriptor_t );
+
+	if( encrypted_metadata->encryption_context_plist != NULL )
+	{
+		if( libfvde_encryption_context_plist_get_memory_usage(
+		     encrypted_metadata->encryption_context_plist,
+		     &plist_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of encryption context plist.",
+			 function );
+
+			return( -1 );
+		}
+		safe_memory_usage += plist_memory_usage;
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
 /* Retrieves the number of logical volume descriptors
  * Returns 1 if successful or -1 on error
  */
@@ -27,17 +27,53 @@
 #include <types.h>
 
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_executor.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_keyring.h"
 #include "libfvde_libbfio.h"
 #include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_memory_usage.h"
+#include "libfvde_metadata_block.h"
+#include "libfvde_passphrase_wrapped_kek.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+extern const uint8_t libfvde_encrypted_metadata_wrapped_kek_initialization_vector[ 8 ];
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+typedef struct libfvde_encrypted_metadata_unwrap_arguments libfvde_encrypted_metadata_unwrap_arguments_t;
+
+struct libfvde_encrypted_metadata_unwrap_arguments
+{
+	/* The password
+	 */
+	const uint8_t *password;
+
+	/* The password size
+	 */
+	size_t password_size;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* Value to indicate a KEK was unwrapped
+	 */
+	int found_kek;
+
+	/* Value to indicate an error occurred
+	 */
+	int unwrap_failed;
+};
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
 typedef struct libfvde_encrypted_metadata libfvde_encrypted_metadata_t;
 
 struct libfvde_encrypted_metadata
@@ -50,6 +86,11 @@ struct libfvde_encrypted_metadata
 	 */
 	uint8_t encryption_context_plist_file_is_set;
 
+	/* The number of users of the encryption context plist,
+	 * which is not released by compaction while in use
+	 */
+	int encryption_context_plist_reference_count;
+
 	/* The logical volume descriptors
 	 */
 	libcdata_array_t *logical_volume_descriptors;
@@ -85,6 +126,16 @@ struct libfvde_encrypted_metadata
 	/* The uncompressed data size
 	 */
 	size_t uncompressed_data_size;
+
+	/* The memory usage, which is referenced and not owned
+	 */
+	libfvde_memory_usage_t *memory_usage;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfvde_encrypted_metadata_initialize(
@@ -244,6 +295,12 @@ int libfvde_encrypted_metadata_read_type_0x0605(
      size_t block_data_size,
      libcerror_error_t **error );
 
+int libfvde_encrypted_metadata_read_metadata_block(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libfvde_io_handle_t *io_handle,
+     libfvde_metadata_block_t *metadata_block,
+     libcerror_error_t **error );
+
 int libfvde_encrypted_metadata_read_from_file_io_handle(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      libfvde_io_handle_t *io_handle,
@@ -256,6 +313,50 @@ int libfvde_encrypted_metadata_read_from_file_io_handle(
      size_t tweak_key_bit_size,
      libcerror_error_t **error );
 
+int libfvde_encrypted_metadata_decompress_encryption_context_plist_data(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_get_encryption_context_plist_memory_usage(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_update_encryption_context_plist_memory_usage(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     size64_t previous_memory_usage,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_get_encryption_context_plist(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libfvde_encryption_context_plist_t **encryption_context_plist,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_release_encryption_context_plist(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_compact(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_encrypted_metadata_unwrap_passphrase_wrapped_kek_callback(
+     libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek,
+     libfvde_encrypted_metadata_unwrap_arguments_t *unwrap_arguments );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+int libfvde_encrypted_metadata_unwrap_passphrase_wrapped_keks(
+     libcdata_array_t *passphrase_wrapped_keks,
+     const uint8_t *password,
+     size_t password_size,
+     uint8_t *kek,
+     size_t kek_size,
+     libfvde_executor_t *executor,
+     libcerror_error_t **error );
+
 int libfvde_encrypted_metadata_get_volume_master_key(
      libfvde_encrypted_metadata_t *encrypted_metadata,
      libfvde_encryption_context_plist_t *encryption_context_plist,
@@ -264,6 +365,12 @@ int libfvde_encrypted_metadata_get_volume_master_key(
      size_t user_password_length,
      const uint8_t *recovery_password,
      size_t recovery_password_length,
+     libfvde_executor_t *executor,
+     libcerror_error_t **error );
+
+int libfvde_encrypted_metadata_get_memory_usage(
+     libfvde_encrypted_metadata_t *encrypted_metadata,
+     size64_t *memory_usage,
      libcerror_error_t **error );
 
 int libfvde_encrypted_metadata_get_number_of_logical_volume_descriptors(
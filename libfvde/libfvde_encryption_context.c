@@ -30,6 +30,8 @@
 #include "libfvde_libcaes.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_libhmac.h"
 
 /* Creates an encryption context
  * Make sure the value encryption context is referencing, is set to NULL
@@ -108,98 +110,787 @@ int libfvde_encryption_context_initialize(
 
 		return( -1 );
 	}
-	if( libcaes_tweaked_context_initialize(
-	     &( ( *context )->decryption_context ),
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *context )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *context )->method          = method;
+	( *context )->reference_count = 1;
+
+	return( 1 );
+
+on_error:
+	if( *context != NULL )
+	{
+		memory_free(
+		 *context );
+
+		*context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the unused decryption contexts of an encryption context
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_free_decryption_contexts(
+     libfvde_encryption_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encryption_context_free_decryption_contexts";
+	int context_index     = 0;
+	int result            = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	for( context_index = 0;
+	     context_index < context->number_of_decryption_contexts;
+	     context_index++ )
+	{
+		if( libcaes_tweaked_context_free(
+		     &( context->decryption_contexts[ context_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable free decryption context: %d.",
+			 function,
+			 context_index );
+
+			result = -1;
+		}
+	}
+	context->number_of_decryption_contexts = 0;
+
+	return( result );
+}
+
+/* Frees an encryption context
+ * An encryption context can be shared, in which case only the reference is
+ * released and the context, including its expanded key schedules, is cleared
+ * and freed when its last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_free(
+     libfvde_encryption_context_t **context,
+     libcerror_error_t **error )
+{
+	libfvde_encryption_context_t *safe_context = NULL;
+	static char *function                      = "libfvde_encryption_context_free";
+	int reference_count                        = 0;
+	int result                                 = 1;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *context != NULL )
+	{
+		safe_context = *context;
+		*context     = NULL;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     safe_context->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_context->reference_count -= 1;
+
+		reference_count = safe_context->reference_count;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     safe_context->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( reference_count > 0 )
+		{
+			return( 1 );
+		}
+		if( libfvde_encryption_context_free_decryption_contexts(
+		     safe_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable free decryption contexts.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( safe_context->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( memory_set(
+		     safe_context,
+		     0,
+		     sizeof( libfvde_encryption_context_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 safe_context );
+	}
+	return( result );
+}
+
+/* Adds a reference to an encryption context
+ * Every reference must be released with libfvde_encryption_context_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_add_reference(
+     libfvde_encryption_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encryption_context_add_reference";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	context->reference_count += 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of references of an encryption context
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_get_reference_count(
+     libfvde_encryption_context_t *context,
+     int *reference_count,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encryption_context_get_reference_count";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference_count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference count.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*reference_count = context->reference_count;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Calculates the digest that identifies a key and tweak key combination
+ * The digest is used to look up contexts of which the key schedules were
+ * already expanded. Note that the context itself retains a copy of the keys,
+ * which is needed to expand the key schedules of additional decryption contexts
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_calculate_keys_digest(
+     uint32_t method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     uint8_t *keys_digest,
+     size_t keys_digest_size,
+     libcerror_error_t **error )
+{
+	uint8_t keys_data[ 32 ];
+
+	static char *function = "libfvde_encryption_context_calculate_keys_digest";
+	size_t key_byte_size  = 0;
+
+	if( method != LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported method.",
+		 function );
+
+		return( -1 );
+	}
+	key_byte_size = 16;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size < key_byte_size )
+	 || ( key_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( tweak_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tweak key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( tweak_key_size < key_byte_size )
+	 || ( tweak_key_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tweak key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys_digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys_digest_size != 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported keys digest size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     keys_data,
+	     key,
+	     key_byte_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key to keys data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( keys_data[ key_byte_size ] ),
+	     tweak_key,
+	     key_byte_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy tweak key to keys data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libhmac_sha256_calculate(
+	     keys_data,
+	     key_byte_size * 2,
+	     keys_digest,
+	     keys_digest_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to calculate SHA-256 of keys data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     keys_data,
+	     0,
+	     32 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear keys data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	memory_set(
+	 keys_data,
+	 0,
+	 32 );
+
+	return( -1 );
+}
+
+/* Compares the keys digest of an encryption context
+ * Returns 1 if the context uses the method and keys of the digest, 0 if not or -1 on error
+ */
+int libfvde_encryption_context_compare_keys_digest(
+     libfvde_encryption_context_t *context,
+     uint32_t method,
+     const uint8_t *keys_digest,
+     size_t keys_digest_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encryption_context_compare_keys_digest";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys_digest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys digest.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys_digest_size != 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported keys digest size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( context->keys_are_set == 0 )
+	 || ( context->method != method ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     context->keys_digest,
+	     keys_digest,
+	     32 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Sets the de- and encryption keys
+ * The keys must be set before the context is shared and are not changed afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_set_keys(
+     libfvde_encryption_context_t *context,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libcerror_error_t **error )
+{
+	libcaes_tweaked_context_t *decryption_context = NULL;
+	static char *function                         = "libfvde_encryption_context_set_keys";
+	size_t key_byte_size                          = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( tweak_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid tweak key.",
+		 function );
+
+		return( -1 );
+	}
+	if( tweak_key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid tweak key size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( context->method == LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS )
+	{
+		key_byte_size = 16;
+	}
+	if( key_size < key_byte_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( tweak_key_size < key_byte_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid tweak key value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_encryption_context_free_decryption_contexts(
+	     context,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize decryption context.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decryption contexts.",
 		 function );
 
 		goto on_error;
 	}
-	( *context )->method = method;
-
-	return( 1 );
+	context->keys_are_set = 0;
 
-on_error:
-	if( *context != NULL )
+	if( memory_copy(
+	     context->key,
+	     key,
+	     key_byte_size ) == NULL )
 	{
-		if( ( *context )->decryption_context != NULL )
-		{
-			libcaes_tweaked_context_free(
-			 &( ( *context )->decryption_context ),
-			 NULL );
-		}
-		memory_free(
-		 *context );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
 
-		*context = NULL;
+		goto on_error;
 	}
-	return( -1 );
-}
+	if( memory_copy(
+	     context->tweak_key,
+	     tweak_key,
+	     key_byte_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy tweak key.",
+		 function );
 
-/* Frees an encryption context
- * Returns 1 if successful or -1 on error
- */
-int libfvde_encryption_context_free(
-     libfvde_encryption_context_t **context,
-     libcerror_error_t **error )
-{
-	static char *function = "libfvde_encryption_context_free";
-	int result            = 1;
+		goto on_error;
+	}
+	context->key_bit_size = key_byte_size * 8;
+	context->keys_are_set = 1;
+
+	/* Expand the key schedules of the first decryption context up front
+	 * so that invalid keys are reported here
+	 */
+	if( libfvde_encryption_context_grab_decryption_context(
+	     context,
+	     &decryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab decryption context.",
+		 function );
 
-	if( context == NULL )
+		goto on_error;
+	}
+	if( libfvde_encryption_context_release_decryption_context(
+	     context,
+	     &decryption_context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid context.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release decryption context.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( *context != NULL )
+	if( libfvde_encryption_context_calculate_keys_digest(
+	     context->method,
+	     key,
+	     key_size,
+	     tweak_key,
+	     tweak_key_size,
+	     context->keys_digest,
+	     32,
+	     error ) != 1 )
 	{
-		if( libcaes_tweaked_context_free(
-		     &( ( *context )->decryption_context ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable free decryption context.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate keys digest.",
+		 function );
 
-			result = -1;
-		}
-		memory_free(
-		 *context );
+		goto on_error;
+	}
+	return( 1 );
 
-		*context = NULL;
+on_error:
+	if( decryption_context != NULL )
+	{
+		libcaes_tweaked_context_free(
+		 &decryption_context,
+		 NULL );
 	}
-	return( result );
+	libfvde_encryption_context_free_decryption_contexts(
+	 context,
+	 NULL );
+
+	memory_set(
+	 context->key,
+	 0,
+	 16 );
+
+	memory_set(
+	 context->tweak_key,
+	 0,
+	 16 );
+
+	context->key_bit_size = 0;
+	context->keys_are_set = 0;
+
+	return( -1 );
 }
 
-/* Sets the de- and encryption keys
+/* Grabs an unused decryption context
+ * A new decryption context is created when all decryption contexts are in use.
+ * The decryption context is only used by the caller until it is released
  * Returns 1 if successful or -1 on error
  */
-int libfvde_encryption_context_set_keys(
+int libfvde_encryption_context_grab_decryption_context(
      libfvde_encryption_context_t *context,
-     const uint8_t *key,
-     size_t key_size,
-     const uint8_t *tweak_key,
-     size_t tweak_key_size,
+     libcaes_tweaked_context_t **decryption_context,
      libcerror_error_t **error )
 {
-	static char *function = "libfvde_encryption_context_set_keys";
-	size_t key_bit_size   = 0;
-	size_t key_byte_size  = 0;
+	static char *function = "libfvde_encryption_context_grab_decryption_context";
 
 	if( context == NULL )
 	{
@@ -212,97 +903,227 @@ int libfvde_encryption_context_set_keys(
 
 		return( -1 );
 	}
-	if( key == NULL )
+	if( context->keys_are_set == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid context - missing keys.",
 		 function );
 
 		return( -1 );
 	}
-	if( key_size > (size_t) SSIZE_MAX )
+	if( decryption_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid key size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption context.",
 		 function );
 
 		return( -1 );
 	}
-	if( tweak_key == NULL )
+	if( *decryption_context != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid tweak key.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decryption context value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( tweak_key_size > (size_t) SSIZE_MAX )
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid tweak key size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	if( context->method == LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS )
+#endif
+	if( context->number_of_decryption_contexts > 0 )
 	{
-		key_byte_size = 16;
+		context->number_of_decryption_contexts -= 1;
+
+		*decryption_context = context->decryption_contexts[ context->number_of_decryption_contexts ];
+
+		context->decryption_contexts[ context->number_of_decryption_contexts ] = NULL;
 	}
-	if( key_size < key_byte_size )
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( *decryption_context != NULL )
+	{
+		return( 1 );
+	}
+	/* The keys are immutable once set so no lock is needed to expand them
+	 */
+	if( libcaes_tweaked_context_initialize(
+	     decryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize decryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_tweaked_context_set_keys(
+	     *decryption_context,
+	     LIBCAES_CRYPT_MODE_DECRYPT,
+	     context->key,
+	     context->key_bit_size,
+	     context->tweak_key,
+	     context->key_bit_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set keys in decryption context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decryption_context != NULL )
+	{
+		libcaes_tweaked_context_free(
+		 decryption_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases a decryption context grabbed with libfvde_encryption_context_grab_decryption_context
+ * The decryption context is kept for reuse or freed if enough are kept already
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_release_decryption_context(
+     libfvde_encryption_context_t *context,
+     libcaes_tweaked_context_t **decryption_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_encryption_context_release_decryption_context";
+
+	if( context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid key value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
 		 function );
 
 		return( -1 );
 	}
-	if( tweak_key_size < key_byte_size )
+	if( decryption_context == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid tweak key value too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption context.",
 		 function );
 
 		return( -1 );
 	}
-	key_bit_size = key_byte_size * 8;
+	if( *decryption_context == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	if( libcaes_tweaked_context_set_keys(
-	     context->decryption_context,
-	     LIBCAES_CRYPT_MODE_DECRYPT,
-	     key,
-	     key_bit_size,
-	     tweak_key,
-	     key_bit_size,
+		goto on_error;
+	}
+#endif
+	if( context->number_of_decryption_contexts < LIBFVDE_ENCRYPTION_CONTEXT_MAXIMUM_NUMBER_OF_DECRYPTION_CONTEXTS )
+	{
+		context->decryption_contexts[ context->number_of_decryption_contexts ] = *decryption_context;
+
+		context->number_of_decryption_contexts += 1;
+
+		*decryption_context = NULL;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     context->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set keys in decryption context.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
+#endif
+	if( *decryption_context != NULL )
+	{
+		if( libcaes_tweaked_context_free(
+		     decryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable free decryption context.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+on_error:
+	libcaes_tweaked_context_free(
+	 decryption_context,
+	 NULL );
+
+	return( -1 );
+#endif
 }
 
 /* De- or encrypts a block of data
@@ -320,8 +1141,10 @@ int libfvde_encryption_context_crypt(
 {
 	uint8_t tweak_value[ 16 ];
 
-	static char *function = "libfvde_encryption_context_crypt";
-	size_t data_offset    = 0;
+	libcaes_tweaked_context_t *decryption_context = NULL;
+	static char *function                         = "libfvde_encryption_context_crypt";
+	size_t data_offset                            = 0;
+	int result                                    = 0;
 
 	if( context == NULL )
 	{
@@ -418,16 +1241,35 @@ int libfvde_encryption_context_crypt(
 	 tweak_value,
 	 block_number );
 
-	if( libcaes_crypt_xts(
-	     context->decryption_context,
-	     LIBCAES_CRYPT_MODE_DECRYPT,
-	     tweak_value,
-	     16,
-	     &( input_data[ data_offset ] ),
-	     input_data_size,
-	     &( output_data[ data_offset ] ),
-	     output_data_size,
+	/* The AES backend can keep per call state in its cipher context,
+	 * hence every caller decrypts with a decryption context of its own
+	 */
+	if( libfvde_encryption_context_grab_decryption_context(
+	     context,
+	     &decryption_context,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab decryption context.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcaes_crypt_xts(
+	          decryption_context,
+	          LIBCAES_CRYPT_MODE_DECRYPT,
+	          tweak_value,
+	          16,
+	          &( input_data[ data_offset ] ),
+	          input_data_size,
+	          &( output_data[ data_offset ] ),
+	          output_data_size,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -435,9 +1277,25 @@ int libfvde_encryption_context_crypt(
 		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
 		 "%s: unable to decrypt data.",
 		 function );
+	}
+	if( libfvde_encryption_context_release_decryption_context(
+	     context,
+	     &decryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release decryption context.",
+		 function );
 
 		goto on_error;
 	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -28,11 +28,16 @@
 
 #include "libfvde_libcaes.h"
 #include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of unused decryption contexts kept for reuse
+ */
+#define LIBFVDE_ENCRYPTION_CONTEXT_MAXIMUM_NUMBER_OF_DECRYPTION_CONTEXTS	16
+
 typedef struct libfvde_encryption_context libfvde_encryption_context_t;
 
 struct libfvde_encryption_context
@@ -41,9 +46,46 @@ struct libfvde_encryption_context
 	 */
 	uint32_t method;
 
-	/* The AES-XTS decryption context
+	/* The key, immutable once set
+	 * This is retained to expand the key schedules of new decryption contexts
+	 */
+	uint8_t key[ 16 ];
+
+	/* The tweak key, immutable once set
+	 */
+	uint8_t tweak_key[ 16 ];
+
+	/* The key size in bits
+	 */
+	size_t key_bit_size;
+
+	/* The unused AES-XTS decryption contexts
+	 * Every decryption context contains its own expanded key schedules of
+	 * the key and tweak key and is used by a single caller at a time
+	 */
+	libcaes_tweaked_context_t *decryption_contexts[ LIBFVDE_ENCRYPTION_CONTEXT_MAXIMUM_NUMBER_OF_DECRYPTION_CONTEXTS ];
+
+	/* The number of unused decryption contexts
+	 */
+	int number_of_decryption_contexts;
+
+	/* The SHA-256 digest of the key and tweak key
 	 */
-	libcaes_tweaked_context_t *decryption_context;
+	uint8_t keys_digest[ 32 ];
+
+	/* Value to indicate the keys were set
+	 */
+	uint8_t keys_are_set;
+
+	/* The number of references
+	 */
+	int reference_count;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfvde_encryption_context_initialize(
@@ -55,6 +97,36 @@ int libfvde_encryption_context_free(
      libfvde_encryption_context_t **context,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_free_decryption_contexts(
+     libfvde_encryption_context_t *context,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_add_reference(
+     libfvde_encryption_context_t *context,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_get_reference_count(
+     libfvde_encryption_context_t *context,
+     int *reference_count,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_calculate_keys_digest(
+     uint32_t method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     uint8_t *keys_digest,
+     size_t keys_digest_size,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_compare_keys_digest(
+     libfvde_encryption_context_t *context,
+     uint32_t method,
+     const uint8_t *keys_digest,
+     size_t keys_digest_size,
+     libcerror_error_t **error );
+
 int libfvde_encryption_context_set_keys(
      libfvde_encryption_context_t *context,
      const uint8_t *key,
@@ -63,6 +135,16 @@ int libfvde_encryption_context_set_keys(
      size_t tweak_key_size,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_grab_decryption_context(
+     libfvde_encryption_context_t *context,
+     libcaes_tweaked_context_t **decryption_context,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_release_decryption_context(
+     libfvde_encryption_context_t *context,
+     libcaes_tweaked_context_t **decryption_context,
+     libcerror_error_t **error );
+
 int libfvde_encryption_context_crypt(
      libfvde_encryption_context_t *context,
      int mode,
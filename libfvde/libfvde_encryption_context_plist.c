@@ -27,11 +27,12 @@
 #include "libfvde_definitions.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
-#include "libfvde_libfplist.h"
 #include "libfvde_libhmac.h"
 #include "libfvde_libuna.h"
+#include "libfvde_passphrase_wrapped_kek.h"
 #include "libfvde_types.h"
 
 /* Creates an encryption context plist
@@ -148,65 +149,18 @@ int libfvde_encryption_context_plist_free(
 			memory_free(
 			 internal_plist->data_decrypted );
 		}
-		if( internal_plist->wrapped_volume_keys_property != NULL )
+		if( internal_plist->passphrase_wrapped_keks != NULL )
 		{
-			if( libfplist_property_free(
-			     &( internal_plist->wrapped_volume_keys_property ),
+			if( libcdata_array_free(
+			     &( internal_plist->passphrase_wrapped_keks ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free WrappedVolumeKeys property.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_plist->crypto_users_property != NULL )
-		{
-			if( libfplist_property_free(
-			     &( internal_plist->crypto_users_property ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free CryptoUsers property.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_plist->conversion_info_property != NULL )
-		{
-			if( libfplist_property_free(
-			     &( internal_plist->conversion_info_property ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free ConversionInfo property.",
-				 function );
-
-				result = -1;
-			}
-		}
-		if( internal_plist->property_list != NULL )
-		{
-			if( libfplist_property_list_free(
-			     &( internal_plist->property_list ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free property list.",
+				 "%s: unable to free passphrase wrapped KEKs array.",
 				 function );
 
 				result = -1;
@@ -258,6 +212,78 @@ int libfvde_encryption_context_plist_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the estimated memory usage of an encryption context plist
+ * The XML plist is scanned in place, hence only the plist file data
+ * and the cached passphrase wrapped KEKs are accounted for
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_plist_get_memory_usage(
+     libfvde_encryption_context_plist_t *plist,
+     size64_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
+	static char *function                                       = "libfvde_encryption_context_plist_get_memory_usage";
+	size64_t safe_memory_usage                                  = 0;
+	int number_of_passphrase_wrapped_keks                       = 0;
+
+	if( plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	safe_memory_usage = sizeof( libfvde_internal_encryption_context_plist_t );
+
+	if( internal_plist->data_encrypted != NULL )
+	{
+		safe_memory_usage += internal_plist->data_size;
+	}
+	if( internal_plist->data_decrypted != NULL )
+	{
+		safe_memory_usage += internal_plist->data_size;
+	}
+	if( internal_plist->passphrase_wrapped_keks != NULL )
+	{
+		if( libcdata_array_get_number_of_entries(
+		     internal_plist->passphrase_wrapped_keks,
+		     &number_of_passphrase_wrapped_keks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of passphrase wrapped KEKs.",
+			 function );
+
+			return( -1 );
+		}
+		safe_memory_usage += (size64_t) number_of_passphrase_wrapped_keks * sizeof( libfvde_passphrase_wrapped_kek_t );
+	}
+	*memory_usage = safe_memory_usage;
+
+	return( 1 );
+}
+
 /* Copies the unencrypted data of an encryption context plist
  * Returns 1 if successful or -1 on error
  */
@@ -472,6 +498,109 @@ on_error:
 	return( -1 );
 }
 
+/* Releases the unencrypted data, the XML plist elements and the cached passphrase wrapped KEKs
+ * of an encryption context plist
+ * Only data that was set with libfvde_encryption_context_plist_set_data is released,
+ * since it can be set again, decrypted data cannot be restored without the key
+ * Returns 1 if successful, 0 if the data cannot be released or -1 on error
+ */
+int libfvde_encryption_context_plist_release_data(
+     libfvde_encryption_context_plist_t *plist,
+     libcerror_error_t **error )
+{
+	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
+	static char *function                                       = "libfvde_encryption_context_plist_release_data";
+
+	if( plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
+
+	if( ( internal_plist->data_encrypted != NULL )
+	 || ( internal_plist->data_decrypted == NULL ) )
+	{
+		return( 0 );
+	}
+	memory_free(
+	 internal_plist->data_decrypted );
+
+	internal_plist->data_decrypted = NULL;
+	internal_plist->data_size      = 0;
+
+	if( memory_set(
+	     &( internal_plist->conversion_info_element ),
+	     0,
+	     sizeof( libfvde_plist_element_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear conversion info element.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( internal_plist->crypto_users_element ),
+	     0,
+	     sizeof( libfvde_plist_element_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear crypto users element.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &( internal_plist->wrapped_volume_keys_element ),
+	     0,
+	     sizeof( libfvde_plist_element_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear wrapped volume keys element.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_plist->passphrase_wrapped_keks != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_plist->passphrase_wrapped_keks ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free passphrase wrapped KEKs array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_plist->xml_data                       = NULL;
+	internal_plist->xml_data_size                  = 0;
+	internal_plist->number_of_crypto_users_entries = 0;
+
+	return( 1 );
+}
+
 /* Reads an encryption context plist file (EncryptedRoot.plist) using a Basic File IO (bfio) handle
  * Returns 1 if successful or -1 on error
  */
@@ -869,12 +998,6 @@ int libfvde_encryption_context_plist_decrypt(
 	return( result );
 
 on_error:
-	if( internal_plist->property_list != NULL )
-	{
-		libfplist_property_list_free(
-		 &( internal_plist->property_list ),
-		 NULL );
-	}
 	if( internal_plist->data_decrypted != NULL )
 	{
 		memory_free(
@@ -892,6 +1015,8 @@ on_error:
 }
 
 /* Reads the plist XML data
+ * The XML plist is scanned in place for the encryption context keys without building a property list,
+ * hence the data is referenced by the plist and must remain available while the plist is used
  * Returns 1 if successful, 0 if not or -1 on error
  */
 int libfvde_encryption_context_plist_read_xml(
@@ -900,10 +1025,22 @@ int libfvde_encryption_context_plist_read_xml(
      size_t data_size,
      libcerror_error_t **error )
 {
+	libfvde_plist_element_t conversion_info_element;
+	libfvde_plist_element_t crypto_users_element;
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t encryption_context_element;
+	libfvde_plist_element_t key_element;
+	libfvde_plist_element_t value_element;
+	libfvde_plist_element_t wrapped_volume_keys_element;
+
 	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
-	libfplist_property_t *encryption_context_property           = NULL;
-	libfplist_property_t *root_property                         = NULL;
 	static char *function                                       = "libfvde_encryption_context_plist_read_xml";
+	size_t data_offset                                          = 0;
+	size_t xml_length                                           = 0;
+	uint8_t found_encryption_context                            = 0;
+	uint8_t has_plist_root_element                              = 0;
+	uint8_t is_root_dict                                        = 1;
+	int number_of_crypto_users_entries                          = 0;
 	int result                                                  = 0;
 
 	if( plist == NULL )
@@ -942,7 +1079,7 @@ int libfvde_encryption_context_plist_read_xml(
 
 		return( -1 );
 	}
-	if( internal_plist->property_list != NULL )
+	if( internal_plist->xml_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -962,170 +1099,188 @@ int libfvde_encryption_context_plist_read_xml(
 		 data );
 	}
 #endif
-	if( internal_plist->data_size > (size64_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid plist file size value out of bounds.",
-		 function );
+	/* The XML data is stored as a string
+	 */
+	xml_length = strnlen(
+	              (char *) data,
+	              data_size );
+
+	result = libfvde_plist_scanner_read_element(
+	          data,
+	          xml_length,
+	          &data_offset,
+	          &dict_element,
+	          error );
 
-		goto on_error;
-	}
-	if( libfplist_property_list_initialize(
-	     &( internal_plist->property_list ),
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create property list.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read root element.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfplist_property_list_copy_from_byte_stream(
-	     internal_plist->property_list,
-	     data,
-	     data_size,
-	     error ) != 1 )
+	else if( result != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy property list from byte stream.",
-		 function );
+		if( dict_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_PLIST )
+		{
+			has_plist_root_element = 1;
 
-		goto on_error;
-	}
-	if( libfplist_property_list_get_root_property(
-	     internal_plist->property_list,
-	     &root_property,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root property.",
-		 function );
+			data_offset = dict_element.content_offset;
 
-		goto on_error;
-	}
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          root_property,
-	          (uint8_t *) "com.apple.corestorage.lvf.encryption.context",
-	          44,
-	          &encryption_context_property,
-	          error );
+			result = libfvde_plist_scanner_read_element(
+			          data,
+			          dict_element.content_offset + dict_element.content_size,
+			          &data_offset,
+			          &dict_element,
+			          error );
 
-	if( result == -1 )
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read plist sub element.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( result == 0 )
+	 || ( dict_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_DICT ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve encryption context property.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing root dict element.",
 		 function );
 
-		goto on_error;
-	}
-	else if( result == 0 )
-	{
-		encryption_context_property = root_property;
+		return( -1 );
 	}
-	else
+	/* Each dict is scanned once for all the keys of interest, where the keys
+	 * are contained in the encryption context dict if the root dict has one
+	 */
+	do
 	{
-		result = libfplist_property_list_has_plist_root_element(
-		          internal_plist->property_list,
-		          error );
+		found_encryption_context = 0;
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if property list has plist root element.",
-			 function );
+		conversion_info_element.type     = LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN;
+		crypto_users_element.type        = LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN;
+		wrapped_volume_keys_element.type = LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN;
 
-			goto on_error;
-		}
-		else if( result == 1 )
+		data_offset = dict_element.content_offset;
+
+		do
 		{
-			if( libfplist_property_free(
-			     &encryption_context_property,
-			     error ) != 1 )
+			result = libfvde_plist_scanner_read_dict_entry(
+			          data,
+			          xml_length,
+			          &dict_element,
+			          &data_offset,
+			          &key_element,
+			          &value_element,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free encryption context property.",
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read dict entry.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( libfplist_property_list_free(
-			     &( internal_plist->property_list ),
-			     error ) != 1 )
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( ( is_root_dict != 0 )
+			 && ( found_encryption_context == 0 )
+			 && ( libfvde_plist_scanner_compare_key(
+			       data,
+			       xml_length,
+			       &key_element,
+			       "com.apple.corestorage.lvf.encryption.context",
+			       44,
+			       NULL ) == 1 ) )
+			{
+				encryption_context_element = value_element;
+				found_encryption_context   = 1;
+			}
+			else if( ( conversion_info_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN )
+			      && ( libfvde_plist_scanner_compare_key(
+			            data,
+			            xml_length,
+			            &key_element,
+			            "ConversionInfo",
+			            14,
+			            NULL ) == 1 ) )
+			{
+				conversion_info_element = value_element;
+			}
+			else if( ( crypto_users_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN )
+			      && ( libfvde_plist_scanner_compare_key(
+			            data,
+			            xml_length,
+			            &key_element,
+			            "CryptoUsers",
+			            11,
+			            NULL ) == 1 ) )
+			{
+				crypto_users_element = value_element;
+			}
+			else if( ( wrapped_volume_keys_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN )
+			      && ( libfvde_plist_scanner_compare_key(
+			            data,
+			            xml_length,
+			            &key_element,
+			            "WrappedVolumeKeys",
+			            17,
+			            NULL ) == 1 ) )
+			{
+				wrapped_volume_keys_element = value_element;
+			}
+		}
+		while( result != 0 );
+
+		if( found_encryption_context != 0 )
+		{
+			if( has_plist_root_element != 0 )
+			{
+				return( 0 );
+			}
+			if( encryption_context_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_DICT )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free properyt list.",
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported encryption context element type.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			return( 0 );
+			dict_element = encryption_context_element;
+			is_root_dict = 0;
 		}
 	}
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          encryption_context_property,
-	          (uint8_t *) "ConversionInfo",
-	          14,
-	          &( internal_plist->conversion_info_property ),
-	          error );
+	while( found_encryption_context != 0 );
 
-	if( result == -1 )
+	if( crypto_users_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve ConversionInfo property.",
-		 function );
-
-		goto on_error;
-	}
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          encryption_context_property,
-	          (uint8_t *) "CryptoUsers",
-	          11,
-	          &( internal_plist->crypto_users_property ),
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve CryptoUsers property.",
-		 function );
-
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
-		if( libfplist_property_get_array_number_of_entries(
-		     internal_plist->crypto_users_property,
-		     &( internal_plist->number_of_crypto_users_entries ),
+		if( libfvde_plist_scanner_get_array_number_of_entries(
+		     data,
+		     xml_length,
+		     &crypto_users_element,
+		     &number_of_crypto_users_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1135,97 +1290,17 @@ int libfvde_encryption_context_plist_read_xml(
 			 "%s: unable to retrieve number of CryptoUsers entries.",
 			 function );
 
-			goto on_error;
-		}
-	}
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          encryption_context_property,
-	          (uint8_t *) "WrappedVolumeKeys",
-	          17,
-	          &( internal_plist->wrapped_volume_keys_property ),
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve WrappedVolumeKeys sub property.",
-		 function );
-
-		goto on_error;
-	}
-	if( encryption_context_property != root_property )
-	{
-		if( libfplist_property_free(
-		     &encryption_context_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free encryption context property.",
-			 function );
-
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libfplist_property_free(
-	     &root_property,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root property.",
-		 function );
+	internal_plist->xml_data                       = data;
+	internal_plist->xml_data_size                  = xml_length;
+	internal_plist->conversion_info_element        = conversion_info_element;
+	internal_plist->crypto_users_element           = crypto_users_element;
+	internal_plist->number_of_crypto_users_entries = number_of_crypto_users_entries;
+	internal_plist->wrapped_volume_keys_element    = wrapped_volume_keys_element;
 
-		goto on_error;
-	}
 	return( 1 );
-
-on_error:
-	if( internal_plist->wrapped_volume_keys_property != NULL )
-	{
-		libfplist_property_free(
-		 &( internal_plist->wrapped_volume_keys_property ),
-		 NULL );
-	}
-	if( internal_plist->crypto_users_property != NULL )
-	{
-		libfplist_property_free(
-		 &( internal_plist->crypto_users_property ),
-		 NULL );
-	}
-	if( internal_plist->conversion_info_property != NULL )
-	{
-		libfplist_property_free(
-		 &( internal_plist->conversion_info_property ),
-		 NULL );
-	}
-	if( ( encryption_context_property != NULL )
-	 && ( encryption_context_property != root_property ) )
-	{
-		libfplist_property_free(
-		 &encryption_context_property,
-		 NULL );
-	}
-	if( root_property != NULL )
-	{
-		libfplist_property_free(
-		 &root_property,
-		 NULL );
-	}
-	if( internal_plist->property_list != NULL )
-	{
-		libfplist_property_list_free(
-		 &( internal_plist->property_list ),
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the conversion status from the given plist data.
@@ -1237,10 +1312,12 @@ int libfvde_encryption_context_plist_get_conversion_status(
      size_t *conversion_status_size,
      libcerror_error_t **error )
 {
-	libfplist_property_t *sub_property                          = NULL;
+	libfvde_plist_element_t conversion_status_element;
+
 	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
+	uint8_t *safe_conversion_status                             = NULL;
 	static char *function                                       = "libfvde_encryption_context_plist_get_conversion_status";
-	int result                                                  = 0;
+	size_t safe_conversion_status_size                          = 0;
 
 	if( plist == NULL )
 	{
@@ -1288,84 +1365,121 @@ int libfvde_encryption_context_plist_get_conversion_status(
 
 		return( -1 );
 	}
-	if( internal_plist->conversion_info_property != NULL )
+	if( ( internal_plist->xml_data == NULL )
+	 || ( internal_plist->conversion_info_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN ) )
 	{
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     internal_plist->conversion_info_property,
-		     (uint8_t *) "ConversionStatus",
-		     16,
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve ConversionStatus sub property.",
-			 function );
+		return( 0 );
+	}
+	if( libfvde_plist_scanner_get_dict_value_by_key(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &( internal_plist->conversion_info_element ),
+	     "ConversionStatus",
+	     16,
+	     &conversion_status_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve ConversionStatus element.",
+		 function );
 
-			goto on_error;
-		}
-		if( libfplist_property_get_value_string(
-		     sub_property,
-		     conversion_status,
-		     conversion_status_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve conversation status.",
-			 function );
+		goto on_error;
+	}
+	if( conversion_status_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_STRING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ConversionStatus element type.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: conversion status:\n",
-			 function );
-			libcnotify_print_data(
-			 *conversion_status,
-			 *conversion_status_size,
-			 0 );
-		}
-#endif
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free ConversionStatus property.",
-			 function );
+		goto on_error;
+	}
+	if( libfvde_plist_scanner_get_string_size(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &conversion_status_element,
+	     &safe_conversion_status_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve conversion status size.",
+		 function );
 
-			goto on_error;
-		}
-		result = 1;
+		goto on_error;
 	}
-	return( result );
+	if( safe_conversion_status_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid conversion status size value exceeds maximum.",
+		 function );
 
-on_error:
-	if( sub_property != NULL )
+		goto on_error;
+	}
+	safe_conversion_status = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * safe_conversion_status_size );
+
+	if( safe_conversion_status == NULL )
 	{
-		libfplist_property_free(
-		 &sub_property,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create conversion status.",
+		 function );
+
+		goto on_error;
 	}
-	if( *conversion_status != NULL )
+	if( libfvde_plist_scanner_copy_string(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &conversion_status_element,
+	     safe_conversion_status,
+	     safe_conversion_status_size,
+	     error ) != 1 )
 	{
-		memory_free(
-		 *conversion_status );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy conversion status.",
+		 function );
 
-		*conversion_status = NULL;
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: conversion status:\n",
+		 function );
+		libcnotify_print_data(
+		 safe_conversion_status,
+		 safe_conversion_status_size,
+		 0 );
 	}
-	*conversion_status_size = 0;
+#endif
+	*conversion_status      = safe_conversion_status;
+	*conversion_status_size = safe_conversion_status_size;
 
+	return( 1 );
+
+on_error:
+	if( safe_conversion_status != NULL )
+	{
+		memory_free(
+		 safe_conversion_status );
+	}
 	return( -1 );
 }
 
@@ -1379,12 +1493,10 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
      size_t *passphrase_wrapped_kek_size,
      libcerror_error_t **error )
 {
-	libfplist_property_t *array_entry_property                  = NULL;
-	libfplist_property_t *sub_property                          = NULL;
+	libfvde_plist_element_t array_entry_element;
+
 	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
-	uint8_t *safe_passphrase_wrapped_kek                        = NULL;
 	static char *function                                       = "libfvde_encryption_context_plist_get_passphrase_wrapped_kek";
-	size_t safe_passphrase_wrapped_kek_size                     = 0;
 	int result                                                  = 0;
 
 	if( plist == NULL )
@@ -1400,13 +1512,14 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
 	}
 	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
 
-	if( internal_plist->crypto_users_property == NULL )
+	if( ( internal_plist->xml_data == NULL )
+	 || ( internal_plist->crypto_users_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid plist - missing XML plist crypto users property.",
+		 "%s: invalid plist - missing XML plist crypto users element.",
 		 function );
 
 		return( -1 );
@@ -1459,10 +1572,12 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
 	{
 		return( 0 );
 	}
-	if( libfplist_property_get_array_entry_by_index(
-	     internal_plist->crypto_users_property,
+	if( libfvde_plist_scanner_get_array_entry_by_index(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &( internal_plist->crypto_users_element ),
 	     passphrase_wrapped_kek_index,
-	     &array_entry_property,
+	     &array_entry_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1473,13 +1588,98 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
 		 function,
 		 passphrase_wrapped_kek_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          array_entry_property,
-	          (uint8_t *) "PassphraseWrappedKEKStruct",
+	result = libfvde_encryption_context_plist_get_crypto_user_passphrase_wrapped_kek(
+	          internal_plist,
+	          &array_entry_element,
+	          passphrase_wrapped_kek,
+	          passphrase_wrapped_kek_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve passphrase wrapped KEK of crypto user: %d.",
+		 function,
+		 passphrase_wrapped_kek_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the passphrase wrapped KEK of a crypto user dict element
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libfvde_encryption_context_plist_get_crypto_user_passphrase_wrapped_kek(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     const libfvde_plist_element_t *crypto_user_element,
+     uint8_t **passphrase_wrapped_kek,
+     size_t *passphrase_wrapped_kek_size,
+     libcerror_error_t **error )
+{
+	libfvde_plist_element_t value_element;
+
+	uint8_t *safe_passphrase_wrapped_kek    = NULL;
+	static char *function                   = "libfvde_encryption_context_plist_get_crypto_user_passphrase_wrapped_kek";
+	size_t safe_passphrase_wrapped_kek_size = 0;
+	int result                              = 0;
+
+	if( internal_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	if( crypto_user_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid crypto user element.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_kek_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          internal_plist->xml_data,
+	          internal_plist->xml_data_size,
+	          crypto_user_element,
+	          "PassphraseWrappedKEKStruct",
 	          26,
-	          &sub_property,
+	          &value_element,
 	          error );
 
 	if( result == -1 )
@@ -1488,134 +1688,410 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve PassphraseWrappedKEKStruct sub property.",
+		 "%s: unable to retrieve PassphraseWrappedKEKStruct element.",
 		 function );
 
 		goto on_error;
 	}
-	else if( result != 0 )
+	else if( result == 0 )
 	{
-		if( libfplist_property_get_value_data_size(
-		     sub_property,
-		     &safe_passphrase_wrapped_kek_size,
-		     error ) != 1 )
+		return( 0 );
+	}
+	if( libfvde_plist_scanner_get_data_size(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &value_element,
+	     &safe_passphrase_wrapped_kek_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve passphrase wrapped kek data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_passphrase_wrapped_kek_size == 0 )
+	 || ( safe_passphrase_wrapped_kek_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid passphrase wrapped kek data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_passphrase_wrapped_kek = (uint8_t *) memory_allocate(
+	                                           sizeof( uint8_t ) * safe_passphrase_wrapped_kek_size );
+
+	if( safe_passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create passphrase wrapped kek.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_plist_scanner_copy_data(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &value_element,
+	     safe_passphrase_wrapped_kek,
+	     safe_passphrase_wrapped_kek_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy passphrase wrapped kek data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: passphrase wrapped KEK:\n",
+		 function );
+		libcnotify_print_data(
+		 safe_passphrase_wrapped_kek,
+		 safe_passphrase_wrapped_kek_size,
+		 0 );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	*passphrase_wrapped_kek      = safe_passphrase_wrapped_kek;
+	*passphrase_wrapped_kek_size = safe_passphrase_wrapped_kek_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_passphrase_wrapped_kek != NULL )
+	{
+		memory_free(
+		 safe_passphrase_wrapped_kek );
+	}
+	return( -1 );
+}
+
+/* Reads the passphrase wrapped KEKs of the crypto users
+ * A crypto user without a passphrase wrapped KEK is ignored and one with
+ * a malformed passphrase wrapped KEK is skipped, so that it does not prevent
+ * the passphrase wrapped KEKs of the other crypto users from being used
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_plist_read_passphrase_wrapped_keks(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     libcdata_array_t *passphrase_wrapped_keks,
+     libcerror_error_t **error )
+{
+	libfvde_plist_element_t crypto_user_element;
+
+	libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek     = NULL;
+	libfvde_plist_element_t *previous_crypto_user_element        = NULL;
+	uint8_t *passphrase_wrapped_kek_data                         = NULL;
+	static char *function                                        = "libfvde_encryption_context_plist_read_passphrase_wrapped_keks";
+	size_t passphrase_wrapped_kek_data_size                      = 0;
+	int crypto_user_index                                        = 0;
+	int entry_index                                              = 0;
+	int result                                                   = 0;
+
+	if( internal_plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	if( passphrase_wrapped_keks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEKs array.",
+		 function );
+
+		return( -1 );
+	}
+	/* The crypto users are iterated rather than retrieved by index,
+	 * since every retrieval by index rescans the preceding array entries
+	 */
+	for( crypto_user_index = 0;
+	     crypto_user_index < internal_plist->number_of_crypto_users_entries;
+	     crypto_user_index++ )
+	{
+		result = libfvde_plist_scanner_get_array_next_entry(
+		          internal_plist->xml_data,
+		          internal_plist->xml_data_size,
+		          &( internal_plist->crypto_users_element ),
+		          previous_crypto_user_element,
+		          &crypto_user_element,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve passphrase wrapped kek data size.",
-			 function );
+			 "%s: unable to retrieve crypto users array entry: %d.",
+			 function,
+			 crypto_user_index );
 
 			goto on_error;
 		}
-		if( ( safe_passphrase_wrapped_kek_size == 0 )
-		 || ( safe_passphrase_wrapped_kek_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		else if( result == 0 )
+		{
+			break;
+		}
+		previous_crypto_user_element = &crypto_user_element;
+
+		result = libfvde_encryption_context_plist_get_crypto_user_passphrase_wrapped_kek(
+		          internal_plist,
+		          &crypto_user_element,
+		          &passphrase_wrapped_kek_data,
+		          &passphrase_wrapped_kek_data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			if( libfvde_passphrase_wrapped_kek_initialize(
+			     &passphrase_wrapped_kek,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create passphrase wrapped KEK: %d.",
+				 function,
+				 crypto_user_index );
+
+				goto on_error;
+			}
+			result = libfvde_passphrase_wrapped_kek_read_data(
+			          passphrase_wrapped_kek,
+			          passphrase_wrapped_kek_data,
+			          passphrase_wrapped_kek_data_size,
+			          error );
+
+			memory_free(
+			 passphrase_wrapped_kek_data );
+
+			passphrase_wrapped_kek_data = NULL;
+		}
+		if( result == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: skipping malformed passphrase wrapped KEK: %d.\n",
+				 function,
+				 crypto_user_index );
+
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( passphrase_wrapped_kek != NULL )
+			{
+				if( libfvde_passphrase_wrapped_kek_free(
+				     &passphrase_wrapped_kek,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free passphrase wrapped KEK: %d.",
+					 function,
+					 crypto_user_index );
+
+					goto on_error;
+				}
+			}
+			continue;
+		}
+		if( passphrase_wrapped_kek == NULL )
+		{
+			continue;
+		}
+		if( libcdata_array_append_entry(
+		     passphrase_wrapped_keks,
+		     &entry_index,
+		     (intptr_t *) passphrase_wrapped_kek,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid passphrase wrapped kek data size value exceeds maximum.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append passphrase wrapped KEK: %d to array.",
+			 function,
+			 crypto_user_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		safe_passphrase_wrapped_kek = (uint8_t *) memory_allocate(
-		                                           sizeof( uint8_t ) * safe_passphrase_wrapped_kek_size );
+		passphrase_wrapped_kek = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( passphrase_wrapped_kek != NULL )
+	{
+		libfvde_passphrase_wrapped_kek_free(
+		 &passphrase_wrapped_kek,
+		 NULL );
+	}
+	if( passphrase_wrapped_kek_data != NULL )
+	{
+		memory_free(
+		 passphrase_wrapped_kek_data );
+	}
+	libcdata_array_empty(
+	 passphrase_wrapped_keks,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves a copy of the passphrase wrapped KEKs
+ * The passphrase wrapped KEKs are read from the crypto users on the first call and cached,
+ * the copies are unwrapped by the caller, hence the cache does not contain unwrapped KEKs
+ * The plist is not locked, calls must be serialized by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+     libfvde_encryption_context_plist_t *plist,
+     libcdata_array_t **passphrase_wrapped_keks,
+     libcerror_error_t **error )
+{
+	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
+	static char *function                                       = "libfvde_encryption_context_plist_get_passphrase_wrapped_keks";
 
-		if( safe_passphrase_wrapped_kek == NULL )
+	if( plist == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid plist.",
+		 function );
+
+		return( -1 );
+	}
+	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
+
+	if( passphrase_wrapped_keks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEKs.",
+		 function );
+
+		return( -1 );
+	}
+	if( *passphrase_wrapped_keks != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid passphrase wrapped KEKs value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_plist->passphrase_wrapped_keks == NULL )
+	{
+		if( ( internal_plist->xml_data == NULL )
+		 || ( internal_plist->crypto_users_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create passphrase wrapped kek.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid plist - missing XML plist crypto users element.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfplist_property_get_value_data(
-		     sub_property,
-		     safe_passphrase_wrapped_kek,
-		     safe_passphrase_wrapped_kek_size,
+		if( libcdata_array_initialize(
+		     &( internal_plist->passphrase_wrapped_keks ),
+		     0,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve passphrase wrapped kek data.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create passphrase wrapped KEKs array.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: passphrase wrapped KEK:\n",
-			 function );
-			libcnotify_print_data(
-			 safe_passphrase_wrapped_kek,
-			 safe_passphrase_wrapped_kek_size,
-			 0 );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		if( libfplist_property_free(
-		     &sub_property,
+		if( libfvde_encryption_context_plist_read_passphrase_wrapped_keks(
+		     internal_plist,
+		     internal_plist->passphrase_wrapped_keks,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free PassphraseWrappedKEKStruct property.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read passphrase wrapped KEKs.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( libfplist_property_free(
-	     &array_entry_property,
+	if( libcdata_array_clone(
+	     passphrase_wrapped_keks,
+	     internal_plist->passphrase_wrapped_keks,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_clone,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free crypto users array entry: %d.",
-		 function,
-		 passphrase_wrapped_kek_index );
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy passphrase wrapped KEKs array.",
+		 function );
 
-		goto on_error;
-	}
-	if( result != 0 )
-	{
-		*passphrase_wrapped_kek      = safe_passphrase_wrapped_kek;
-		*passphrase_wrapped_kek_size = safe_passphrase_wrapped_kek_size;
+		return( -1 );
 	}
-	return( result );
+	return( 1 );
 
 on_error:
-	if( sub_property != NULL )
-	{
-		libfplist_property_free(
-		 &sub_property,
-		 NULL );
-	}
-	if( array_entry_property != NULL )
+	if( internal_plist->passphrase_wrapped_keks != NULL )
 	{
-		libfplist_property_free(
-		 &array_entry_property,
+		libcdata_array_free(
+		 &( internal_plist->passphrase_wrapped_keks ),
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
 		 NULL );
 	}
-	if( safe_passphrase_wrapped_kek != NULL )
-	{
-		memory_free(
-		 safe_passphrase_wrapped_kek );
-	}
 	return( -1 );
 }
 
@@ -1628,8 +2104,9 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
      size_t *kek_wrapped_volume_key_size,
      libcerror_error_t **error )
 {
-	libfplist_property_t *array_entry_property                  = NULL;
-	libfplist_property_t *sub_property                          = NULL;
+	libfvde_plist_element_t array_entry_element;
+	libfvde_plist_element_t value_element;
+
 	libfvde_internal_encryption_context_plist_t *internal_plist = NULL;
 	uint8_t *safe_kek_wrapped_volume_key                        = NULL;
 	static char *function                                       = "libfvde_encryption_context_plist_get_kek_wrapped_volume_key";
@@ -1648,13 +2125,14 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 	}
 	internal_plist = (libfvde_internal_encryption_context_plist_t *) plist;
 
-	if( internal_plist->wrapped_volume_keys_property == NULL )
+	if( ( internal_plist->xml_data == NULL )
+	 || ( internal_plist->wrapped_volume_keys_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid plist - missing XML plist wrapped volume keys property.",
+		 "%s: invalid plist - missing XML plist wrapped volume keys element.",
 		 function );
 
 		return( -1 );
@@ -1692,39 +2170,45 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 
 		return( -1 );
 	}
-	if( libfplist_property_get_array_entry_by_index(
-	     internal_plist->wrapped_volume_keys_property,
+	if( libfvde_plist_scanner_get_array_entry_by_index(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &( internal_plist->wrapped_volume_keys_element ),
 	     1,
-	     &array_entry_property,
+	     &array_entry_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve crypto users array entry: 1.",
+		 "%s: unable to retrieve wrapped volume keys array entry: 1.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfplist_property_get_sub_property_by_utf8_name(
-	     array_entry_property,
-	     (uint8_t *) "KEKWrappedVolumeKeyStruct",
+	if( libfvde_plist_scanner_get_dict_value_by_key(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &array_entry_element,
+	     "KEKWrappedVolumeKeyStruct",
 	     25,
-	     &sub_property,
+	     &value_element,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve KEKWrappedVolumeKeyStruct sub property.",
+		 "%s: unable to retrieve KEKWrappedVolumeKeyStruct element.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfplist_property_get_value_data_size(
-	     sub_property,
+	if( libfvde_plist_scanner_get_data_size(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &value_element,
 	     &safe_kek_wrapped_volume_key_size,
 	     error ) != 1 )
 	{
@@ -1742,12 +2226,12 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid kek wrapped volume key data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid kek wrapped volume key data size value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	safe_kek_wrapped_volume_key = (uint8_t *) memory_allocate(
 	                                           sizeof( uint8_t ) * safe_kek_wrapped_volume_key_size );
@@ -1763,8 +2247,10 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 
 		goto on_error;
 	}
-	if( libfplist_property_get_value_data(
-	     sub_property,
+	if( libfvde_plist_scanner_copy_data(
+	     internal_plist->xml_data,
+	     internal_plist->xml_data_size,
+	     &value_element,
 	     safe_kek_wrapped_volume_key,
 	     safe_kek_wrapped_volume_key_size,
 	     error ) != 1 )
@@ -1772,8 +2258,8 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve kek wrapped volume property.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy kek wrapped volume key data.",
 		 function );
 
 		goto on_error;
@@ -1791,50 +2277,12 @@ int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libfplist_property_free(
-	     &sub_property,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free KEKWrappedVolumeKeyStruct property.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfplist_property_free(
-	     &array_entry_property,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free crypto users array entry: 1.",
-		 function );
-
-		goto on_error;
-	}
 	*kek_wrapped_volume_key      = safe_kek_wrapped_volume_key;
 	*kek_wrapped_volume_key_size = safe_kek_wrapped_volume_key_size;
 
 	return( 1 );
 
 on_error:
-	if( sub_property != NULL )
-	{
-		libfplist_property_free(
-		 &sub_property,
-		 NULL );
-	}
-	if( array_entry_property != NULL )
-	{
-		libfplist_property_free(
-		 &array_entry_property,
-		 NULL );
-	}
 	if( safe_kek_wrapped_volume_key != NULL )
 	{
 		memory_free(
@@ -1842,4 +2290,3 @@ on_error:
 	}
 	return( -1 );
 }
-
@@ -28,8 +28,9 @@
 
 #include "libfvde_extern.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
-#include "libfvde_libfplist.h"
+#include "libfvde_plist_scanner.h"
 #include "libfvde_types.h"
 
 #if defined( __cplusplus )
@@ -52,25 +53,33 @@ struct libfvde_internal_encryption_context_plist
 	 */
         size64_t data_size;
 
-        /* The property list
+	/* The XML plist data, which is referenced and not copied
 	 */
-	libfplist_property_list_t *property_list;
+	const uint8_t *xml_data;
 
-        /* The XML plist conversion info property
+	/* The XML plist data size
 	 */
-	libfplist_property_t *conversion_info_property;
+	size_t xml_data_size;
 
-        /* The XML plist crypto users property
+	/* The XML plist conversion info element
 	 */
-	libfplist_property_t *crypto_users_property;
+	libfvde_plist_element_t conversion_info_element;
+
+	/* The XML plist crypto users element
+	 */
+	libfvde_plist_element_t crypto_users_element;
 
 	/* The number of crypto users array entries
 	 */
 	int number_of_crypto_users_entries;
 
-        /* The XML plist wrapped volume keys property
+	/* The XML plist wrapped volume keys element
 	 */
-	libfplist_property_t *wrapped_volume_keys_property;
+	libfvde_plist_element_t wrapped_volume_keys_element;
+
+	/* The passphrase wrapped KEKs, which are read from the crypto users once and cached
+	 */
+	libcdata_array_t *passphrase_wrapped_keks;
 };
 
 LIBFVDE_EXTERN \
@@ -89,6 +98,11 @@ int libfvde_encryption_context_plist_get_data_size(
      size64_t *data_size,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_plist_get_memory_usage(
+     libfvde_encryption_context_plist_t *plist,
+     size64_t *memory_usage,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 int libfvde_encryption_context_plist_copy_data(
      libfvde_encryption_context_plist_t *plist,
@@ -102,6 +116,10 @@ int libfvde_encryption_context_plist_set_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_plist_release_data(
+     libfvde_encryption_context_plist_t *plist,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 int libfvde_encryption_context_plist_read_file_io_handle(
      libfvde_encryption_context_plist_t *plist,
@@ -134,6 +152,23 @@ int libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
      size_t *passphrase_wrapped_kek_size,
      libcerror_error_t **error );
 
+int libfvde_encryption_context_plist_get_crypto_user_passphrase_wrapped_kek(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     const libfvde_plist_element_t *crypto_user_element,
+     uint8_t **passphrase_wrapped_kek,
+     size_t *passphrase_wrapped_kek_size,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_plist_read_passphrase_wrapped_keks(
+     libfvde_internal_encryption_context_plist_t *internal_plist,
+     libcdata_array_t *passphrase_wrapped_keks,
+     libcerror_error_t **error );
+
+int libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+     libfvde_encryption_context_plist_t *plist,
+     libcdata_array_t **passphrase_wrapped_keks,
+     libcerror_error_t **error );
+
 int libfvde_encryption_context_plist_get_kek_wrapped_volume_key(
      libfvde_encryption_context_plist_t *plist,
      uint8_t **kek_wrapped_volume_key,
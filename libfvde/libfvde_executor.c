@@ -0,0 +1,1118 @@
+/*
+ * Executor functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_executor.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_types.h"
+#include "libfvde_unused.h"
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Callback function to run a task from the thread pool of the executor
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_thread_pool_callback(
+     libfvde_executor_task_t *task,
+     libfvde_internal_executor_t *internal_executor LIBFVDE_ATTRIBUTE_UNUSED )
+{
+	LIBFVDE_UNREFERENCED_PARAMETER( internal_executor )
+
+	return( libfvde_executor_run_task(
+	         (intptr_t *) task ) );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Creates an executor with its own pool of threads
+ * Make sure the value executor is referencing, is set to NULL
+ * An executor with 0 threads runs the tasks on the thread that submits them
+ * Without multi-thread support the tasks are always run on the thread that submits them
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_initialize(
+     libfvde_executor_t **executor,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libfvde_internal_executor_t *internal_executor = NULL;
+	static char *function                          = "libfvde_executor_initialize";
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *executor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid executor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBFVDE_MAXIMUM_NUMBER_OF_EXECUTOR_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_executor = memory_allocate_structure(
+	                     libfvde_internal_executor_t );
+
+	if( internal_executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create executor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_executor,
+	     0,
+	     sizeof( libfvde_internal_executor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear executor.",
+		 function );
+
+		memory_free(
+		 internal_executor );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_executor->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_threads > 0 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( internal_executor->thread_pool ),
+		     NULL,
+		     number_of_threads,
+		     LIBFVDE_MAXIMUM_NUMBER_OF_QUEUED_EXECUTOR_TASKS,
+		     (int (*)(intptr_t *, void *)) &libfvde_executor_thread_pool_callback,
+		     (void *) internal_executor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	internal_executor->number_of_threads = number_of_threads;
+
+	*executor = (libfvde_executor_t *) internal_executor;
+
+	return( 1 );
+
+on_error:
+	if( internal_executor != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( internal_executor->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_executor->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 internal_executor );
+	}
+	return( -1 );
+}
+
+/* Creates an executor that schedules the tasks with functions of the host
+ * Make sure the value executor is referencing, is set to NULL
+ *
+ * The submit function must run the task, by calling task_function with task, exactly
+ * once and should return 1 if successful or -1 on error. The task can be run on any
+ * thread, including the thread that calls the submit function. The task does not block
+ * on other tasks.
+ *
+ * The wait function, if not NULL, is called before the library blocks until its
+ * submitted tasks have been run, e.g. when a logical volume is closed, and should
+ * return 1 if successful or -1 on error. A host that defers running tasks can use it
+ * to run the pending tasks.
+ *
+ * Without multi-thread support the tasks are run on the thread that submits them
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_initialize_with_callbacks(
+     libfvde_executor_t **executor,
+     intptr_t *host_data,
+     int (*submit_function)(
+            intptr_t *host_data,
+            int (*task_function)(
+                   intptr_t *task ),
+            intptr_t *task ),
+     int (*wait_function)(
+            intptr_t *host_data ),
+     libcerror_error_t **error )
+{
+	libfvde_internal_executor_t *internal_executor = NULL;
+	static char *function                          = "libfvde_executor_initialize_with_callbacks";
+
+	if( submit_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid submit function.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_executor_initialize(
+	     executor,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create executor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_executor = (libfvde_internal_executor_t *) *executor;
+
+	internal_executor->host_data       = host_data;
+	internal_executor->submit_function = submit_function;
+	internal_executor->wait_function   = wait_function;
+
+	return( 1 );
+}
+
+/* Frees an executor
+ * The executor cannot be freed while it is used by volumes
+ * The tasks queued on the thread pool of the executor are run before it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_free(
+     libfvde_executor_t **executor,
+     libcerror_error_t **error )
+{
+	libfvde_internal_executor_t *internal_executor = NULL;
+	static char *function                          = "libfvde_executor_free";
+	int result                                     = 1;
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *executor != NULL )
+	{
+		internal_executor = (libfvde_internal_executor_t *) *executor;
+
+		if( internal_executor->number_of_users != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid executor - still used by: %d volumes.",
+			 function,
+			 internal_executor->number_of_users );
+
+			return( -1 );
+		}
+		*executor = NULL;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( internal_executor->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( internal_executor->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_executor->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_executor );
+	}
+	return( result );
+}
+
+/* Retrieves the number of threads of the thread pool of the executor
+ * The number of threads is 0 for an executor that uses functions of the host
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_get_number_of_threads(
+     libfvde_executor_t *executor,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libfvde_internal_executor_t *internal_executor = NULL;
+	static char *function                          = "libfvde_executor_get_number_of_threads";
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_executor = (libfvde_internal_executor_t *) executor;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_executor->number_of_threads;
+
+	return( 1 );
+}
+
+/* Attaches a volume or logical volume to the executor
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_attach(
+     libfvde_executor_t *executor,
+     libcerror_error_t **error )
+{
+	libfvde_internal_executor_t *internal_executor = NULL;
+	static char *function                          = "libfvde_executor_attach";
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_executor = (libfvde_internal_executor_t *) executor;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_executor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_executor->number_of_users += 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_executor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Detaches a volume or logical volume from the executor
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_detach(
+     libfvde_executor_t *executor,
+     libcerror_error_t **error )
+{
+	libfvde_internal_executor_t *internal_executor = NULL;
+	static char *function                          = "libfvde_executor_detach";
+	int result                                     = 1;
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_executor = (libfvde_internal_executor_t *) executor;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_executor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_executor->number_of_users <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid executor - number of users value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_executor->number_of_users -= 1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_executor->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Creates a task group
+ * Make sure the value task_group is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_task_group_initialize(
+     libfvde_executor_task_group_t **task_group,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_executor_task_group_initialize";
+
+	if( task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task group.",
+		 function );
+
+		return( -1 );
+	}
+	if( *task_group != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid task group value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*task_group = memory_allocate_structure(
+	               libfvde_executor_task_group_t );
+
+	if( *task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create task group.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *task_group,
+	     0,
+	     sizeof( libfvde_executor_task_group_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear task group.",
+		 function );
+
+		memory_free(
+		 *task_group );
+
+		*task_group = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *task_group )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *task_group )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *task_group != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( ( *task_group )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *task_group )->mutex ),
+			 NULL );
+		}
+#endif
+		memory_free(
+		 *task_group );
+
+		*task_group = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a task group
+ * Use libfvde_executor_wait to make sure the tasks of the group have been run
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_task_group_free(
+     libfvde_executor_task_group_t **task_group,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_executor_task_group_free";
+	int result            = 1;
+
+	if( task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task group.",
+		 function );
+
+		return( -1 );
+	}
+	if( *task_group != NULL )
+	{
+		if( ( *task_group )->number_of_pending_tasks != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid task group - still has: %d pending tasks.",
+			 function,
+			 ( *task_group )->number_of_pending_tasks );
+
+			return( -1 );
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *task_group )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *task_group )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *task_group );
+
+		*task_group = NULL;
+	}
+	return( result );
+}
+
+/* Adds a pending task to the task group
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_task_group_add_pending_task(
+     libfvde_executor_task_group_t *task_group,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_executor_task_group_add_pending_task";
+
+	if( task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task group.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     task_group->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	task_group->number_of_pending_tasks += 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     task_group->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes a pending task from the task group
+ * The threads waiting on the task group are woken up when no tasks are pending
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_task_group_remove_pending_task(
+     libfvde_executor_task_group_t *task_group,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_executor_task_group_remove_pending_task";
+	int result            = 1;
+
+	if( task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task group.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     task_group->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	task_group->number_of_pending_tasks -= 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( task_group->number_of_pending_tasks == 0 )
+	{
+		if( libcthreads_condition_broadcast(
+		     task_group->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     task_group->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Runs a task
+ * This function is called by the thread pool of the executor or by the host,
+ * after which the task is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_run_task(
+     intptr_t *task )
+{
+	libfvde_executor_task_group_t *task_group = NULL;
+	libfvde_executor_task_t *executor_task    = NULL;
+	int result                                = 1;
+
+	if( task == NULL )
+	{
+		return( -1 );
+	}
+	executor_task = (libfvde_executor_task_t *) task;
+	task_group    = executor_task->task_group;
+
+	if( executor_task->callback_function(
+	     executor_task->value,
+	     executor_task->arguments ) != 1 )
+	{
+		result = -1;
+	}
+	memory_free(
+	 executor_task );
+
+	/* The task group is not used after the pending task is removed
+	 * since a thread waiting on the task group can free it
+	 */
+	if( libfvde_executor_task_group_remove_pending_task(
+	     task_group,
+	     NULL ) != 1 )
+	{
+		result = -1;
+	}
+	return( result );
+}
+
+/* Submits a task to the executor
+ * The callback function is called with the value and arguments on a thread of the executor
+ * If the task cannot be submitted the callback function is not called
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_submit(
+     libfvde_executor_t *executor,
+     libfvde_executor_task_group_t *task_group,
+     int (*callback_function)(
+            intptr_t *value,
+            void *arguments ),
+     intptr_t *value,
+     void *arguments,
+     libcerror_error_t **error )
+{
+	libfvde_executor_task_t *executor_task         = NULL;
+	static char *function                          = "libfvde_executor_submit";
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libfvde_internal_executor_t *internal_executor = NULL;
+	int result                                     = 0;
+#endif
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task group.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	executor_task = memory_allocate_structure(
+	                 libfvde_executor_task_t );
+
+	if( executor_task == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create task.",
+		 function );
+
+		return( -1 );
+	}
+	executor_task->task_group        = task_group;
+	executor_task->callback_function = callback_function;
+	executor_task->value             = value;
+	executor_task->arguments         = arguments;
+
+	if( libfvde_executor_task_group_add_pending_task(
+	     task_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add pending task to task group.",
+		 function );
+
+		memory_free(
+		 executor_task );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	internal_executor = (libfvde_internal_executor_t *) executor;
+
+	if( internal_executor->submit_function != NULL )
+	{
+		result = internal_executor->submit_function(
+		          internal_executor->host_data,
+		          &libfvde_executor_run_task,
+		          (intptr_t *) executor_task );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to submit task to host.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	else if( internal_executor->thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_push(
+		     internal_executor->thread_pool,
+		     (intptr_t *) executor_task,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push task onto thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+	/* Without threads the task is run by the submitting thread, the task
+	 * was submitted successfully regardless of the result of its callback function
+	 */
+	libfvde_executor_run_task(
+	 (intptr_t *) executor_task );
+
+	return( 1 );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+on_error:
+	/* The task was not handed to a thread, hence it is not run
+	 */
+	memory_free(
+	 executor_task );
+
+	libfvde_executor_task_group_remove_pending_task(
+	 task_group,
+	 NULL );
+
+	return( -1 );
+#endif
+}
+
+/* Waits until the tasks submitted with the task group have been run
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_executor_wait(
+     libfvde_executor_t *executor,
+     libfvde_executor_task_group_t *task_group,
+     libcerror_error_t **error )
+{
+	static char *function                          = "libfvde_executor_wait";
+	int result                                     = 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libfvde_internal_executor_t *internal_executor = NULL;
+#endif
+
+	if( executor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid executor.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_group == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task group.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	internal_executor = (libfvde_internal_executor_t *) executor;
+
+	if( internal_executor->wait_function != NULL )
+	{
+		if( internal_executor->wait_function(
+		     internal_executor->host_data ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for tasks of host.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     task_group->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( task_group->number_of_pending_tasks > 0 )
+	{
+		if( libcthreads_condition_wait(
+		     task_group->condition,
+		     task_group->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     task_group->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,205 @@
+/*
+ * Executor functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_EXECUTOR_H )
+#define _LIBFVDE_EXECUTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_extern.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_internal_executor libfvde_internal_executor_t;
+
+struct libfvde_internal_executor
+{
+	/* The number of threads of the thread pool of the executor
+	 */
+	int number_of_threads;
+
+	/* The host data
+	 */
+	intptr_t *host_data;
+
+	/* The host submit function
+	 */
+	int (*submit_function)(
+	       intptr_t *host_data,
+	       int (*task_function)(
+	              intptr_t *task ),
+	       intptr_t *task );
+
+	/* The host wait function
+	 */
+	int (*wait_function)(
+	       intptr_t *host_data );
+
+	/* The number of volumes and logical volumes that use the executor
+	 */
+	int number_of_users;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The thread pool
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libfvde_executor_task_group libfvde_executor_task_group_t;
+
+struct libfvde_executor_task_group
+{
+	/* The number of tasks that were submitted but have not yet been run
+	 */
+	int number_of_pending_tasks;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The completion condition
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+typedef struct libfvde_executor_task libfvde_executor_task_t;
+
+struct libfvde_executor_task
+{
+	/* The task group
+	 */
+	libfvde_executor_task_group_t *task_group;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       intptr_t *value,
+	       void *arguments );
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The arguments
+	 */
+	void *arguments;
+};
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_executor_thread_pool_callback(
+     libfvde_executor_task_t *task,
+     libfvde_internal_executor_t *internal_executor );
+
+#endif
+
+LIBFVDE_EXTERN \
+int libfvde_executor_initialize(
+     libfvde_executor_t **executor,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_executor_initialize_with_callbacks(
+     libfvde_executor_t **executor,
+     intptr_t *host_data,
+     int (*submit_function)(
+            intptr_t *host_data,
+            int (*task_function)(
+                   intptr_t *task ),
+            intptr_t *task ),
+     int (*wait_function)(
+            intptr_t *host_data ),
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_executor_free(
+     libfvde_executor_t **executor,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_executor_get_number_of_threads(
+     libfvde_executor_t *executor,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+int libfvde_executor_attach(
+     libfvde_executor_t *executor,
+     libcerror_error_t **error );
+
+int libfvde_executor_detach(
+     libfvde_executor_t *executor,
+     libcerror_error_t **error );
+
+int libfvde_executor_task_group_initialize(
+     libfvde_executor_task_group_t **task_group,
+     libcerror_error_t **error );
+
+int libfvde_executor_task_group_free(
+     libfvde_executor_task_group_t **task_group,
+     libcerror_error_t **error );
+
+int libfvde_executor_task_group_add_pending_task(
+     libfvde_executor_task_group_t *task_group,
+     libcerror_error_t **error );
+
+int libfvde_executor_task_group_remove_pending_task(
+     libfvde_executor_task_group_t *task_group,
+     libcerror_error_t **error );
+
+int libfvde_executor_run_task(
+     intptr_t *task );
+
+int libfvde_executor_submit(
+     libfvde_executor_t *executor,
+     libfvde_executor_task_group_t *task_group,
+     int (*callback_function)(
+            intptr_t *value,
+            void *arguments ),
+     intptr_t *value,
+     void *arguments,
+     libcerror_error_t **error );
+
+int libfvde_executor_wait(
+     libfvde_executor_t *executor,
+     libfvde_executor_task_group_t *task_group,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_EXECUTOR_H ) */
+
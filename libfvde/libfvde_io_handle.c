@@ -24,8 +24,13 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvde_encryption_context.h"
+#include "libfvde_executor.h"
 #include "libfvde_io_handle.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_memory_usage.h"
 
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
@@ -85,8 +90,55 @@ int libfvde_io_handle_initialize(
 		 "%s: unable to clear IO handle.",
 		 function );
 
+		memory_free(
+		 *io_handle );
+
+		*io_handle = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *io_handle )->encryption_contexts_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create encryption contexts array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_memory_usage_initialize(
+	     &( ( *io_handle )->memory_usage ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory usage.",
+		 function );
+
 		goto on_error;
 	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *io_handle )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *io_handle )->bytes_per_sector = 512;
 
 	return( 1 );
@@ -94,6 +146,19 @@ int libfvde_io_handle_initialize(
 on_error:
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->memory_usage != NULL )
+		{
+			libfvde_memory_usage_free(
+			 &( ( *io_handle )->memory_usage ),
+			 NULL );
+		}
+		if( ( *io_handle )->encryption_contexts_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *io_handle )->encryption_contexts_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *io_handle );
 
@@ -138,6 +203,64 @@ int libfvde_io_handle_free(
 
 			result = -1;
 		}
+		if( libcdata_array_free(
+		     &( ( *io_handle )->encryption_contexts_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_encryption_context_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free encryption contexts array.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *io_handle )->executor != NULL )
+		{
+			if( libfvde_executor_detach(
+			     ( *io_handle )->executor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to detach executor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libfvde_memory_usage_free(
+		     &( ( *io_handle )->memory_usage ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory usage.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *io_handle )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -147,14 +270,22 @@ int libfvde_io_handle_free(
 }
 
 /* Clears the IO handle
+ * The cached encryption contexts are released, the memory usage and executor are retained
  * Returns 1 if successful or -1 on error
  */
 int libfvde_io_handle_clear(
      libfvde_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libfvde_io_handle_clear";
-	int result            = 1;
+	libcdata_array_t *encryption_contexts_array = NULL;
+	libfvde_executor_t *executor                = NULL;
+	libfvde_memory_usage_t *memory_usage        = NULL;
+	static char *function                       = "libfvde_io_handle_clear";
+	int result                                  = 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_t *read_write_lock = NULL;
+#endif
 
 	if( io_handle == NULL )
 	{
@@ -167,6 +298,31 @@ int libfvde_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->encryption_contexts_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     io_handle->encryption_contexts_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_encryption_context_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty encryption contexts array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	encryption_contexts_array = io_handle->encryption_contexts_array;
+	memory_usage              = io_handle->memory_usage;
+	executor                  = io_handle->executor;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	read_write_lock = io_handle->read_write_lock;
+#endif
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -181,8 +337,498 @@ int libfvde_io_handle_clear(
 
 		result = -1;
 	}
+	io_handle->encryption_contexts_array = encryption_contexts_array;
+	io_handle->memory_usage              = memory_usage;
+	io_handle->executor                  = executor;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	io_handle->read_write_lock = read_write_lock;
+#endif
+
 	io_handle->bytes_per_sector = 512;
 
 	return( result );
 }
 
+/* Retrieves an encryption context for specific keys
+ * Encryption contexts are cached so that the key schedules of a key and tweak key
+ * combination are only expanded once. The encryption context is shared and
+ * must be released with libfvde_io_handle_release_encryption_context
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_io_handle_get_encryption_context(
+     libfvde_io_handle_t *io_handle,
+     uint32_t method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libfvde_encryption_context_t **encryption_context,
+     libcerror_error_t **error )
+{
+	uint8_t keys_digest[ 32 ];
+
+	libfvde_encryption_context_t *cached_encryption_context = NULL;
+	libfvde_encryption_context_t *new_encryption_context    = NULL;
+	static char *function                                   = "libfvde_io_handle_get_encryption_context";
+	int entry_index                                         = 0;
+	int number_of_encryption_contexts                       = 0;
+	int result                                              = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *encryption_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid encryption context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_encryption_context_calculate_keys_digest(
+	     method,
+	     key,
+	     key_size,
+	     tweak_key,
+	     tweak_key_size,
+	     keys_digest,
+	     32,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate keys digest.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->encryption_contexts_array,
+	     &number_of_encryption_contexts,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of encryption contexts.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_encryption_contexts;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     io_handle->encryption_contexts_array,
+		     entry_index,
+		     (intptr_t **) &cached_encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		result = libfvde_encryption_context_compare_keys_digest(
+		          cached_encryption_context,
+		          method,
+		          keys_digest,
+		          32,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare keys digest of encryption context: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		cached_encryption_context = NULL;
+	}
+	if( cached_encryption_context == NULL )
+	{
+		if( libfvde_encryption_context_initialize(
+		     &new_encryption_context,
+		     method,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_encryption_context_set_keys(
+		     new_encryption_context,
+		     key,
+		     key_size,
+		     tweak_key,
+		     tweak_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     io_handle->encryption_contexts_array,
+		     &entry_index,
+		     (intptr_t *) new_encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append encryption context to array.",
+			 function );
+
+			goto on_error;
+		}
+		cached_encryption_context = new_encryption_context;
+		new_encryption_context    = NULL;
+	}
+	if( libfvde_encryption_context_add_reference(
+	     cached_encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to encryption context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		libfvde_encryption_context_free(
+		 &cached_encryption_context,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	*encryption_context = cached_encryption_context;
+
+	return( 1 );
+
+on_error:
+	if( new_encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &new_encryption_context,
+		 NULL );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 io_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Releases an encryption context retrieved with libfvde_io_handle_get_encryption_context
+ * When the cache holds the last other reference the encryption context is removed
+ * from the cache and freed, so that key schedules of keys that are no longer used,
+ * such as those of a wrong password, are not retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_io_handle_release_encryption_context(
+     libfvde_io_handle_t *io_handle,
+     libfvde_encryption_context_t **encryption_context,
+     libcerror_error_t **error )
+{
+	libfvde_encryption_context_t *cached_encryption_context = NULL;
+	libfvde_encryption_context_t *last_encryption_context   = NULL;
+	static char *function                                   = "libfvde_io_handle_release_encryption_context";
+	int entry_index                                         = 0;
+	int number_of_encryption_contexts                       = 0;
+	int reference_count                                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *encryption_context == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     io_handle->encryption_contexts_array,
+	     &number_of_encryption_contexts,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of encryption contexts.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_encryption_contexts;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     io_handle->encryption_contexts_array,
+		     entry_index,
+		     (intptr_t **) &cached_encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( cached_encryption_context == *encryption_context )
+		{
+			break;
+		}
+		cached_encryption_context = NULL;
+	}
+	/* References are only added while the IO handle is locked, hence the reference
+	 * count cannot increase while it is being checked
+	 */
+	if( cached_encryption_context != NULL )
+	{
+		if( libfvde_encryption_context_get_reference_count(
+		     cached_encryption_context,
+		     &reference_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve reference count of encryption context.",
+			 function );
+
+			goto on_error;
+		}
+		if( reference_count > 2 )
+		{
+			cached_encryption_context = NULL;
+		}
+	}
+	if( cached_encryption_context != NULL )
+	{
+		/* Move the last entry into the slot of the evicted encryption context
+		 */
+		if( libcdata_array_get_entry_by_index(
+		     io_handle->encryption_contexts_array,
+		     number_of_encryption_contexts - 1,
+		     (intptr_t **) &last_encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context: %d.",
+			 function,
+			 number_of_encryption_contexts - 1 );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     io_handle->encryption_contexts_array,
+		     entry_index,
+		     (intptr_t *) last_encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set encryption context: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_resize(
+		     io_handle->encryption_contexts_array,
+		     number_of_encryption_contexts - 1,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize encryption contexts array.",
+			 function );
+
+			goto on_error;
+		}
+		/* Release the reference of the cache
+		 */
+		if( libfvde_encryption_context_free(
+		     &cached_encryption_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cached encryption context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfvde_encryption_context_free(
+	     encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free encryption context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 io_handle->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
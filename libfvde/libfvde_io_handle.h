@@ -26,7 +26,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfvde_encryption_context.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_memory_usage.h"
+#include "libfvde_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -52,9 +57,30 @@ struct libfvde_io_handle
 	 */
 	uint32_t metadata_size;
 
+	/* The encryption contexts array
+	 * This caches the expanded key schedules so that they can be shared
+	 */
+	libcdata_array_t *encryption_contexts_array;
+
+	/* The memory usage
+	 * This accounts the memory used by the volume and its logical volumes
+	 */
+	libfvde_memory_usage_t *memory_usage;
+
+	/* The executor
+	 * This schedules the parallel work of the volume and its logical volumes
+	 */
+	libfvde_executor_t *executor;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfvde_io_handle_initialize(
@@ -69,6 +95,21 @@ int libfvde_io_handle_clear(
      libfvde_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libfvde_io_handle_get_encryption_context(
+     libfvde_io_handle_t *io_handle,
+     uint32_t method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     libfvde_encryption_context_t **encryption_context,
+     libcerror_error_t **error );
+
+int libfvde_io_handle_release_encryption_context(
+     libfvde_io_handle_t *io_handle,
+     libfvde_encryption_context_t **encryption_context,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
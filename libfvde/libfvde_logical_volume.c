@@ -24,12 +24,17 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfvde_access_trace.h"
+#include "libfvde_block_cache.h"
+#include "libfvde_block_reference.h"
 #include "libfvde_definitions.h"
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_executor.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
 #include "libfvde_libcthreads.h"
@@ -37,18 +42,22 @@
 #include "libfvde_libuna.h"
 #include "libfvde_logical_volume.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_memory_usage.h"
 #include "libfvde_password.h"
+#include "libfvde_read_ahead.h"
+#include "libfvde_read_request.h"
 #include "libfvde_sector_data.h"
 #include "libfvde_segment_descriptor.h"
 #include "libfvde_types.h"
 #include "libfvde_volume_data_handle.h"
 
-/* Creates a logical volume
- * Make sure the value logical_volume is referencing, is set to NULL
+/* Creates the internal logical volume
+ * The internal logical volume contains the state that is shared by all handles of the logical volume
+ * Make sure the value internal_logical_volume is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_initialize(
-     libfvde_logical_volume_t **logical_volume,
+int libfvde_internal_logical_volume_initialize(
+     libfvde_internal_logical_volume_t **internal_logical_volume,
      libfvde_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
      libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
@@ -56,10 +65,10 @@ int libfvde_logical_volume_initialize(
      libfvde_encryption_context_plist_t *encrypted_root_plist,
      libcerror_error_t **error )
 {
-	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_initialize";
+	libfvde_internal_logical_volume_t *safe_internal_logical_volume = NULL;
+	static char *function                                           = "libfvde_internal_logical_volume_initialize";
 
-	if( logical_volume == NULL )
+	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -70,7 +79,7 @@ int libfvde_logical_volume_initialize(
 
 		return( -1 );
 	}
-	if( *logical_volume != NULL )
+	if( *internal_logical_volume != NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -106,10 +115,10 @@ int libfvde_logical_volume_initialize(
 /* TODO check if encrypted_metadata is set */
 /* TODO check if encrypted_root_plist is set */
 
-	internal_logical_volume = memory_allocate_structure(
-	                           libfvde_internal_logical_volume_t );
+	safe_internal_logical_volume = memory_allocate_structure(
+	                                libfvde_internal_logical_volume_t );
 
-	if( internal_logical_volume == NULL )
+	if( safe_internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -121,7 +130,7 @@ int libfvde_logical_volume_initialize(
 		goto on_error;
 	}
 	if( memory_set(
-	     internal_logical_volume,
+	     safe_internal_logical_volume,
 	     0,
 	     sizeof( libfvde_internal_logical_volume_t ) ) == NULL )
 	{
@@ -133,12 +142,12 @@ int libfvde_logical_volume_initialize(
 		 function );
 
 		memory_free(
-		 internal_logical_volume );
+		 safe_internal_logical_volume );
 
 		return( -1 );
 	}
 	if( libfvde_keyring_initialize(
-	      &( internal_logical_volume->keyring ),
+	      &( safe_internal_logical_volume->keyring ),
 	      error ) != 1 )
 	{
 		libcerror_error_set(
@@ -152,7 +161,7 @@ int libfvde_logical_volume_initialize(
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
-	     &( internal_logical_volume->read_write_lock ),
+	     &( safe_internal_logical_volume->read_write_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -165,44 +174,49 @@ int libfvde_logical_volume_initialize(
 		goto on_error;
 	}
 #endif
-	internal_logical_volume->io_handle                 = io_handle;
-	internal_logical_volume->file_io_pool              = file_io_pool;
-	internal_logical_volume->logical_volume_descriptor = logical_volume_descriptor;
-	internal_logical_volume->encrypted_metadata        = encrypted_metadata;
-	internal_logical_volume->encrypted_root_plist      = encrypted_root_plist;
-	internal_logical_volume->is_locked                 = 1;
+	safe_internal_logical_volume->io_handle                 = io_handle;
+	safe_internal_logical_volume->file_io_pool              = file_io_pool;
+	safe_internal_logical_volume->logical_volume_descriptor = logical_volume_descriptor;
+	safe_internal_logical_volume->encrypted_metadata        = encrypted_metadata;
+	safe_internal_logical_volume->encrypted_root_plist      = encrypted_root_plist;
+	safe_internal_logical_volume->maximum_pinned_size       = LIBFVDE_DEFAULT_MAXIMUM_PINNED_SIZE;
+	safe_internal_logical_volume->is_locked                 = 1;
+	safe_internal_logical_volume->reference_count           = 1;
 
-	*logical_volume = (libfvde_logical_volume_t *) internal_logical_volume;
+	*internal_logical_volume = safe_internal_logical_volume;
 
 	return( 1 );
 
 on_error:
-	if( internal_logical_volume != NULL )
+	if( safe_internal_logical_volume != NULL )
 	{
-		if( internal_logical_volume->keyring != NULL )
+		if( safe_internal_logical_volume->keyring != NULL )
 		{
 			libfvde_keyring_free(
-			 &( internal_logical_volume->keyring ),
+			 &( safe_internal_logical_volume->keyring ),
 			 NULL );
 		}
 		memory_free(
-		 internal_logical_volume );
+		 safe_internal_logical_volume );
 	}
 	return( -1 );
 }
 
-/* Frees a logical volume
+/* Frees the internal logical volume
+ * Only the reference is released, the internal logical volume is freed when
+ * its last reference is released
  * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_free(
-     libfvde_logical_volume_t **logical_volume,
+int libfvde_internal_logical_volume_free(
+     libfvde_internal_logical_volume_t **internal_logical_volume,
      libcerror_error_t **error )
 {
-	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_free";
-	int result                                                 = 1;
+	libfvde_internal_logical_volume_t *safe_internal_logical_volume = NULL;
+	static char *function                                           = "libfvde_internal_logical_volume_free";
+	int reference_count                                             = 0;
+	int result                                                      = 1;
 
-	if( logical_volume == NULL )
+	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -213,13 +227,156 @@ int libfvde_logical_volume_free(
 
 		return( -1 );
 	}
-	if( *logical_volume != NULL )
+	if( *internal_logical_volume != NULL )
 	{
-		internal_logical_volume = (libfvde_internal_logical_volume_t *) *logical_volume;
-		*logical_volume         = NULL;
+		safe_internal_logical_volume = *internal_logical_volume;
+		*internal_logical_volume     = NULL;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     safe_internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_internal_logical_volume->reference_count -= 1;
+
+		reference_count = safe_internal_logical_volume->reference_count;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     safe_internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( reference_count > 0 )
+		{
+			return( 1 );
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		/* Pending read requests are completed before the logical volume is closed
+		 */
+		if( safe_internal_logical_volume->read_thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( safe_internal_logical_volume->read_thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( safe_internal_logical_volume->read_task_group != NULL )
+		{
+			if( libfvde_executor_wait(
+			     safe_internal_logical_volume->read_executor,
+			     safe_internal_logical_volume->read_task_group,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to wait for read task group.",
+				 function );
+
+				result = -1;
+			}
+			else if( libfvde_executor_task_group_free(
+			          &( safe_internal_logical_volume->read_task_group ),
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read task group.",
+				 function );
+
+				result = -1;
+			}
+			if( libfvde_executor_detach(
+			     safe_internal_logical_volume->read_executor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to detach read executor.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( libfvde_internal_logical_volume_free_warm_cache(
+		     safe_internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free warm cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libfvde_internal_logical_volume_free_pinned_cache(
+		     safe_internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pinned cache.",
+			 function );
+
+			result = -1;
+		}
+		if( safe_internal_logical_volume->access_trace != NULL )
+		{
+			if( libfvde_access_trace_free(
+			     &( safe_internal_logical_volume->access_trace ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free access trace.",
+				 function );
 
+				result = -1;
+			}
+		}
 		if( libfvde_internal_logical_volume_close(
-		     internal_logical_volume,
+		     safe_internal_logical_volume,
 		     error ) != 0 )
 		{
 			libcerror_error_set(
@@ -232,7 +389,7 @@ int libfvde_logical_volume_free(
 			result = -1;
 		}
 		if( libfvde_keyring_free(
-		     &( internal_logical_volume->keyring ),
+		     &( safe_internal_logical_volume->keyring ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -246,7 +403,7 @@ int libfvde_logical_volume_free(
 		}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 		if( libcthreads_read_write_lock_free(
-		     &( internal_logical_volume->read_write_lock ),
+		     &( safe_internal_logical_volume->read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -262,36 +419,26 @@ int libfvde_logical_volume_free(
 		/* The io_handle, file_io_pool, logical_volume_descriptor, encrypted_metadata and encrypted_root_plist references are freed elsewhere
 		 */
 		memory_free(
-		 internal_logical_volume );
+		 safe_internal_logical_volume );
 	}
 	return( result );
 }
 
-/* Opens a logical volume for reading
+/* Creates a logical volume
+ * The logical volume is a handle with its own current offset, access advice and read-ahead
+ * that references the state shared by all handles of the internal logical volume
+ * Make sure the value logical_volume is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfvde_internal_logical_volume_open_read(
+int libfvde_logical_volume_initialize(
+     libfvde_logical_volume_t **logical_volume,
      libfvde_internal_logical_volume_t *internal_logical_volume,
-     libbfio_pool_t *file_io_pool,
      libcerror_error_t **error )
 {
-	uint8_t volume_header_data[ 512 ];
-
-	libfvde_segment_descriptor_t *segment_descriptor = NULL;
-	static char *function                            = "libfvde_internal_logical_volume_open_read";
-	size64_t segment_size                            = 0;
-	ssize_t read_count                               = 0;
-	off64_t segment_offset                           = 0;
-	off64_t volume_offset                            = 0;
-	uint64_t expected_logical_block_number           = 0;
-	uint32_t segment_flags                           = 0;
-	int file_io_pool_entry                           = 0;
-	int number_of_segment_descriptors                = 0;
-	int result                                       = 0;
-	int segment_descriptor_index                     = 0;
-	int segment_index                                = 0;
+	libfvde_logical_volume_handle_t *logical_volume_handle = NULL;
+	static char *function                                  = "libfvde_logical_volume_initialize";
 
-	if( internal_logical_volume == NULL )
+	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -302,104 +449,338 @@ int libfvde_internal_logical_volume_open_read(
 
 		return( -1 );
 	}
-	if( internal_logical_volume->io_handle == NULL )
+	if( *logical_volume != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid logical volume - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->volume_data_handle != NULL )
+	if( internal_logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid logical volume - volume data handle value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid internal logical volume.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_logical_volume->sectors_vector != NULL )
+	logical_volume_handle = memory_allocate_structure(
+	                         libfvde_logical_volume_handle_t );
+
+	if( logical_volume_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid logical volume - sectors vector value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create logical volume.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_logical_volume->sectors_cache != NULL )
+	if( memory_set(
+	     logical_volume_handle,
+	     0,
+	     sizeof( libfvde_logical_volume_handle_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid logical volume - sectors cache value already set.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear logical volume.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfvde_logical_volume_descriptor_get_first_block_number(
-	     internal_logical_volume->logical_volume_descriptor,
-	     (uint16_t *) &file_io_pool_entry,
-	     (uint64_t *) &volume_offset,
-	     error ) == -1 )
+	if( libfvde_internal_logical_volume_add_reference(
+	     internal_logical_volume,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve first block number from logical volume descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to internal logical volume.",
 		 function );
 
 		goto on_error;
 	}
-	volume_offset *= internal_logical_volume->io_handle->block_size;
+	logical_volume_handle->internal_logical_volume = internal_logical_volume;
+	logical_volume_handle->access_advice           = LIBFVDE_ACCESS_ADVICE_NORMAL;
 
-	if( libfvde_logical_volume_descriptor_get_size(
-	     internal_logical_volume->logical_volume_descriptor,
-	     &( internal_logical_volume->volume_size ),
-	     error ) != 1 )
+	*logical_volume = (libfvde_logical_volume_t *) logical_volume_handle;
+
+	return( 1 );
+
+on_error:
+	if( logical_volume_handle != NULL )
+	{
+		memory_free(
+		 logical_volume_handle );
+	}
+	return( -1 );
+}
+
+/* Frees a logical volume
+ * This releases the reference to the internal logical volume, which is freed
+ * when its last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_free(
+     libfvde_logical_volume_t **logical_volume,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle = NULL;
+	static char *function                                  = "libfvde_logical_volume_free";
+	int result                                             = 1;
+
+	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume size from descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-/* TODO remove after debugging unsupported format variants
-	if( internal_logical_volume->volume_size == 0 )
+	if( *logical_volume != NULL )
 	{
-		if( libfvde_logical_volume_descriptor_get_last_block_number(
-		     internal_logical_volume->logical_volume_descriptor,
-		     (uint16_t *) &file_io_pool_entry,
-		     (uint64_t *) &( internal_logical_volume->volume_size ),
-		     error ) == -1 )
+		logical_volume_handle = (libfvde_logical_volume_handle_t *) *logical_volume;
+		*logical_volume       = NULL;
+
+		/* The read-ahead is freed without holding the lock, since freeing it waits
+		 * for a pending prefetch, that needs the lock, to complete
+		 */
+		if( libfvde_internal_logical_volume_free_read_ahead(
+		     logical_volume_handle,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve last block number from logical volume descriptor.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		internal_logical_volume->volume_size *= internal_logical_volume->io_handle->block_size;
+		if( libfvde_internal_logical_volume_free(
+		     &( logical_volume_handle->internal_logical_volume ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release internal logical volume.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 logical_volume_handle );
 	}
-*/
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	return( result );
+}
+
+/* Adds a reference to the internal logical volume
+ * Every reference must be released with libfvde_internal_logical_volume_free
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_add_reference(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_add_reference";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_logical_volume->reference_count += 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Opens a logical volume for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_open_read(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libbfio_pool_t *file_io_pool,
+     libcerror_error_t **error )
+{
+	uint8_t volume_header_data[ 512 ];
+
+	libfvde_segment_descriptor_t *segment_descriptor = NULL;
+	static char *function                            = "libfvde_internal_logical_volume_open_read";
+	size64_t segment_size                            = 0;
+	ssize_t read_count                               = 0;
+	off64_t segment_offset                           = 0;
+	off64_t volume_offset                            = 0;
+	uint64_t expected_logical_block_number           = 0;
+	uint32_t segment_flags                           = 0;
+	int file_io_pool_entry                           = 0;
+	int number_of_segment_descriptors                = 0;
+	int result                                       = 0;
+	int segment_descriptor_index                     = 0;
+	int segment_index                                = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume - volume data handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->sectors_vector != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume - sectors vector value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->sectors_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume - sectors cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_logical_volume_descriptor_get_first_block_number(
+	     internal_logical_volume->logical_volume_descriptor,
+	     (uint16_t *) &file_io_pool_entry,
+	     (uint64_t *) &volume_offset,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first block number from logical volume descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	volume_offset *= internal_logical_volume->io_handle->block_size;
+
+	if( libfvde_logical_volume_descriptor_get_size(
+	     internal_logical_volume->logical_volume_descriptor,
+	     &( internal_logical_volume->volume_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume size from descriptor.",
+		 function );
+
+		result = -1;
+	}
+/* TODO remove after debugging unsupported format variants
+	if( internal_logical_volume->volume_size == 0 )
+	{
+		if( libfvde_logical_volume_descriptor_get_last_block_number(
+		     internal_logical_volume->logical_volume_descriptor,
+		     (uint16_t *) &file_io_pool_entry,
+		     (uint64_t *) &( internal_logical_volume->volume_size ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last block number from logical volume descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		internal_logical_volume->volume_size *= internal_logical_volume->io_handle->block_size;
+	}
+*/
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
 		 "Reading logical volume header at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
@@ -671,6 +1052,22 @@ int libfvde_internal_logical_volume_open_read(
 
 		goto on_error;
 	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_VECTOR,
+	     &( internal_logical_volume->sectors_vector_memory_size ),
+	     (size64_t) number_of_segment_descriptors * sizeof( libfvde_segment_descriptor_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sectors vector memory usage.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -704,8 +1101,9 @@ int libfvde_internal_logical_volume_open_read_keys(
 {
 	uint8_t tweak_key_data[ 32 ];
 
-	static char *function = "libfvde_internal_logical_volume_open_read_keys";
-	int result            = 0;
+	libfvde_encryption_context_plist_t *encryption_context_plist = NULL;
+	static char *function                                        = "libfvde_internal_logical_volume_open_read_keys";
+	int result                                                   = 0;
 
 	if( internal_logical_volume == NULL )
 	{
@@ -764,16 +1162,33 @@ int libfvde_internal_logical_volume_open_read_keys(
 	}
 	if( internal_logical_volume->volume_master_key_is_set == 0 )
 	{
-		if( internal_logical_volume->encrypted_metadata->encryption_context_plist_file_is_set != 0 )
+		result = libfvde_encrypted_metadata_get_encryption_context_plist(
+		          internal_logical_volume->encrypted_metadata,
+		          &encryption_context_plist,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context plist from encrypted metadata.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
 		{
 			result = libfvde_encrypted_metadata_get_volume_master_key(
 				  internal_logical_volume->encrypted_metadata,
-				  internal_logical_volume->encrypted_metadata->encryption_context_plist,
+				  encryption_context_plist,
 				  internal_logical_volume->keyring,
 			          internal_logical_volume->user_password,
 			          internal_logical_volume->user_password_size - 1,
 			          internal_logical_volume->recovery_password,
 			          internal_logical_volume->recovery_password_size - 1,
+			          internal_logical_volume->io_handle->executor,
 				  error );
 
 			if( result == -1 )
@@ -791,6 +1206,21 @@ int libfvde_internal_logical_volume_open_read_keys(
 			{
 				internal_logical_volume->volume_master_key_is_set = 1;
 			}
+			encryption_context_plist = NULL;
+
+			if( libfvde_encrypted_metadata_release_encryption_context_plist(
+			     internal_logical_volume->encrypted_metadata,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release encryption context plist.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		else if( internal_logical_volume->encrypted_root_plist != NULL )
 		{
@@ -802,6 +1232,7 @@ int libfvde_internal_logical_volume_open_read_keys(
 			          internal_logical_volume->user_password_size - 1,
 			          internal_logical_volume->recovery_password,
 			          internal_logical_volume->recovery_password_size - 1,
+			          internal_logical_volume->io_handle->executor,
 				  error );
 
 			if( result == -1 )
@@ -892,33 +1323,21 @@ int libfvde_internal_logical_volume_open_read_keys(
 			 0 );
 		}
 #endif
-		if( libfvde_encryption_context_initialize(
-		     &( internal_logical_volume->volume_data_handle->encryption_context ),
+		if( libfvde_io_handle_get_encryption_context(
+		     internal_logical_volume->io_handle,
 		     LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create encryption context.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfvde_encryption_context_set_keys(
-		     internal_logical_volume->volume_data_handle->encryption_context,
 		     internal_logical_volume->keyring->volume_master_key,
 		     128,
 		     internal_logical_volume->keyring->volume_tweak_key,
 		     128,
+		     &( internal_logical_volume->volume_data_handle->encryption_context ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set keys in encryption context.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve encryption context.",
 			 function );
 
 			goto on_error;
@@ -946,6 +1365,12 @@ int libfvde_internal_logical_volume_open_read_keys(
 	return( 0 );
 
 on_error:
+	if( encryption_context_plist != NULL )
+	{
+		libfvde_encrypted_metadata_release_encryption_context_plist(
+		 internal_logical_volume->encrypted_metadata,
+		 NULL );
+	}
 	memory_set(
 	 tweak_key_data,
 	 0,
@@ -1197,8 +1622,7 @@ int libfvde_internal_logical_volume_close(
 
 		return( -1 );
 	}
-	internal_logical_volume->current_offset = 0;
-	internal_logical_volume->is_locked      = 1;
+	internal_logical_volume->is_locked = 1;
 
 	if( internal_logical_volume->user_password != NULL )
 	{
@@ -1292,6 +1716,38 @@ int libfvde_internal_logical_volume_close(
 			result = -1;
 		}
 	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_VECTOR,
+	     &( internal_logical_volume->sectors_vector_memory_size ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sectors vector memory usage.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_CACHE,
+	     &( internal_logical_volume->sectors_cache_memory_size ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sectors cache memory usage.",
+		 function );
+
+		result = -1;
+	}
 	return( result );
 }
 
@@ -1406,6 +1862,7 @@ int libfvde_logical_volume_unlock(
      libfvde_logical_volume_t *logical_volume,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_unlock";
 	int result                                                 = 1;
@@ -1421,7 +1878,8 @@ int libfvde_logical_volume_unlock(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -1480,20 +1938,31 @@ int libfvde_logical_volume_unlock(
  * Returns the number of bytes read or -1 on error
  */
 ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libfvde_logical_volume_handle_t *logical_volume_handle,
          libbfio_pool_t *file_io_pool,
          void *buffer,
          size_t buffer_size,
          libcerror_error_t **error )
 {
-	libfvde_sector_data_t *sector_data = NULL;
-	static char *function              = "libfvde_internal_logical_volume_read_buffer_from_file_io_pool";
-	off64_t element_data_offset        = 0;
-	size_t buffer_offset               = 0;
-	size_t read_size                   = 0;
-	size_t sector_data_offset          = 0;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	libfvde_sector_data_t *sector_data                         = NULL;
+	uint8_t *read_ahead_data                                   = NULL;
+	uint8_t *pinned_cache_data                                 = NULL;
+	uint8_t *warm_cache_data                                   = NULL;
+	static char *function                                      = "libfvde_internal_logical_volume_read_buffer_from_file_io_pool";
+	off64_t element_data_offset                                = 0;
+	size_t buffer_offset                                       = 0;
+	size_t pinned_cache_data_size                              = 0;
+	size_t read_ahead_data_size                                = 0;
+	size_t warm_cache_data_size                                = 0;
+	size_t read_size                                           = 0;
+	size_t sector_data_offset                                  = 0;
+	ssize_t read_count                                         = 0;
+	uint32_t compaction_generation                             = 0;
+	uint8_t tolerate_read_errors                               = 0;
+	int result                                                 = 0;
 
-	if( internal_logical_volume == NULL )
+	if( logical_volume_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1504,6 +1973,19 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 
 		return( -1 );
 	}
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing internal logical volume.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_logical_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1526,7 +2008,7 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 
 		return( -1 );
 	}
-	if( internal_logical_volume->current_offset < 0 )
+	if( logical_volume_handle->current_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1572,15 +2054,374 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 	}
 	internal_logical_volume->io_handle->abort = 0;
 
-	if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+	if( (size64_t) logical_volume_handle->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
 	{
 		return( 0 );
 	}
-	if( (size64_t) buffer_size > ( internal_logical_volume->logical_volume_descriptor->size - internal_logical_volume->current_offset ) )
+	if( (size64_t) buffer_size > ( internal_logical_volume->logical_volume_descriptor->size - logical_volume_handle->current_offset ) )
+	{
+		buffer_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - logical_volume_handle->current_offset );
+	}
+	if( internal_logical_volume->volume_data_handle != NULL )
+	{
+		tolerate_read_errors = internal_logical_volume->volume_data_handle->tolerate_read_errors;
+	}
+	if( libfvde_memory_usage_get_compaction_generation(
+	     internal_logical_volume->io_handle->memory_usage,
+	     &compaction_generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compaction generation.",
+		 function );
+
+		return( -1 );
+	}
+	/* The memory budget requested the reconstructible state to be released
+	 */
+	if( compaction_generation != internal_logical_volume->compaction_generation )
+	{
+		if( libfvde_internal_logical_volume_compact(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to compact logical volume.",
+			 function );
+
+			return( -1 );
+		}
+		internal_logical_volume->compaction_generation = compaction_generation;
+	}
+	if( compaction_generation != logical_volume_handle->compaction_generation )
+	{
+		if( libfvde_internal_logical_volume_compact_handle(
+		     logical_volume_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to compact logical volume handle.",
+			 function );
+
+			return( -1 );
+		}
+		logical_volume_handle->compaction_generation = compaction_generation;
+	}
+	if( internal_logical_volume->access_trace != NULL )
+	{
+		if( libfvde_access_trace_append_range(
+		     internal_logical_volume->access_trace,
+		     logical_volume_handle->current_offset,
+		     (size64_t) buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append range to access trace.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Blocks of pinned ranges are served from the pinned cache
+	 */
+	if( ( internal_logical_volume->pinned_cache != NULL )
+	 && ( tolerate_read_errors == 0 ) )
+	{
+		while( buffer_offset < buffer_size )
+		{
+			result = libfvde_block_cache_get_data(
+			          internal_logical_volume->pinned_cache,
+			          logical_volume_handle->current_offset,
+			          &pinned_cache_data,
+			          &pinned_cache_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve pinned cache data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 logical_volume_handle->current_offset,
+				 logical_volume_handle->current_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			read_size = pinned_cache_data_size;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     pinned_cache_data,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy pinned cache data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += read_size;
+
+			logical_volume_handle->current_offset += (off64_t) read_size;
+		}
+		/* Blocks of which the read failed or that were unpinned while being read
+		 * are removed when their data is retrieved
+		 */
+		if( libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update pinned cache memory usage.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Blocks that were warmed up by replaying an access trace are served from the warm cache
+	 */
+	if( ( internal_logical_volume->warm_cache != NULL )
+	 && ( tolerate_read_errors == 0 ) )
+	{
+		while( buffer_offset < buffer_size )
+		{
+			result = libfvde_block_cache_get_data(
+			          internal_logical_volume->warm_cache,
+			          logical_volume_handle->current_offset,
+			          &warm_cache_data,
+			          &warm_cache_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve warm cache data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 logical_volume_handle->current_offset,
+				 logical_volume_handle->current_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			read_size = warm_cache_data_size;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     warm_cache_data,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy warm cache data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += read_size;
+
+			logical_volume_handle->current_offset += (off64_t) read_size;
+		}
+	}
+	/* Sequential reads are served from the read-ahead, which is refilled when exhausted,
+	 * other reads only use data that was read ahead or prefetched
+	 */
+	if( ( logical_volume_handle->read_ahead != NULL )
+	 && ( tolerate_read_errors == 0 ) )
+	{
+		while( buffer_offset < buffer_size )
+		{
+			result = libfvde_read_ahead_get_data(
+			          logical_volume_handle->read_ahead,
+			          logical_volume_handle->current_offset,
+			          &read_ahead_data,
+			          &read_ahead_data_size,
+			          error );
+
+			if( ( result == 0 )
+			 && ( logical_volume_handle->access_advice == LIBFVDE_ACCESS_ADVICE_SEQUENTIAL ) )
+			{
+				if( libfvde_internal_logical_volume_fill_read_ahead(
+				     logical_volume_handle,
+				     logical_volume_handle->current_offset,
+				     logical_volume_handle->read_ahead->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to fill read-ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 logical_volume_handle->current_offset,
+					 logical_volume_handle->current_offset );
+
+					return( -1 );
+				}
+				result = libfvde_read_ahead_get_data(
+				          logical_volume_handle->read_ahead,
+				          logical_volume_handle->current_offset,
+				          &read_ahead_data,
+				          &read_ahead_data_size,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve read-ahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 logical_volume_handle->current_offset,
+				 logical_volume_handle->current_offset );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			read_size = read_ahead_data_size;
+
+			if( read_size > ( buffer_size - buffer_offset ) )
+			{
+				read_size = buffer_size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+			     read_ahead_data,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data to buffer.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += read_size;
+
+			logical_volume_handle->current_offset += (off64_t) read_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+			/* Prefetch the data following the read-ahead, the prefetch is submitted
+			 * by the caller once the lock is released
+			 */
+			if( ( logical_volume_handle->access_advice == LIBFVDE_ACCESS_ADVICE_SEQUENTIAL )
+			 && ( logical_volume_handle->read_ahead->prefetch_read_request == NULL )
+			 && ( logical_volume_handle->read_ahead->is_prefetching == 0 ) )
+			{
+				element_data_offset = logical_volume_handle->read_ahead->data_offset
+				                    + logical_volume_handle->read_ahead->valid_data_size;
+
+				if( (size64_t) element_data_offset < internal_logical_volume->logical_volume_descriptor->size )
+				{
+					logical_volume_handle->read_ahead->prefetch_offset = element_data_offset;
+					logical_volume_handle->read_ahead->prefetch_size   = logical_volume_handle->read_ahead->data_size;
+				}
+			}
+#endif
+			if( internal_logical_volume->io_handle->abort != 0 )
+			{
+				return( (ssize_t) buffer_offset );
+			}
+		}
+	}
+	/* Data that is read once is not admitted into the sectors cache
+	 */
+	if( ( logical_volume_handle->access_advice == LIBFVDE_ACCESS_ADVICE_NOREUSE )
+	 && ( tolerate_read_errors == 0 )
+	 && ( buffer_offset < buffer_size ) )
+	{
+		read_count = libfvde_internal_logical_volume_read_buffer_at_offset_unbuffered(
+		              internal_logical_volume,
+		              &( ( (uint8_t *) buffer )[ buffer_offset ] ),
+		              buffer_size - buffer_offset,
+		              logical_volume_handle->current_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 logical_volume_handle->current_offset,
+			 logical_volume_handle->current_offset );
+
+			return( -1 );
+		}
+		buffer_offset += (size_t) read_count;
+
+		logical_volume_handle->current_offset += (off64_t) read_count;
+	}
+	/* The sectors cache is accounted at its capacity once it is used
+	 */
+	if( ( buffer_offset < buffer_size )
+	 && ( internal_logical_volume->sectors_cache_memory_size == 0 ) )
 	{
-		buffer_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - internal_logical_volume->current_offset );
+		if( libfvde_internal_logical_volume_set_accounted_memory_size(
+		     internal_logical_volume,
+		     LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_CACHE,
+		     &( internal_logical_volume->sectors_cache_memory_size ),
+		     (size64_t) LIBFVDE_MAXIMUM_CACHE_ENTRIES_SECTORS * ( sizeof( libfvde_sector_data_t ) + internal_logical_volume->io_handle->bytes_per_sector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sectors cache memory usage.",
+			 function );
+
+			return( -1 );
+		}
 	}
-	sector_data_offset = (size_t) ( internal_logical_volume->current_offset % internal_logical_volume->io_handle->bytes_per_sector );
+	sector_data_offset = (size_t) ( logical_volume_handle->current_offset % internal_logical_volume->io_handle->bytes_per_sector );
 
 	while( buffer_offset < buffer_size )
 	{
@@ -1588,7 +2429,7 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 		     internal_logical_volume->sectors_vector,
 		     (intptr_t *) file_io_pool,
 		     (libfdata_cache_t *) internal_logical_volume->sectors_cache,
-		     internal_logical_volume->current_offset,
+		     logical_volume_handle->current_offset,
 		     &element_data_offset,
 		     (intptr_t **) &sector_data,
 		     0,
@@ -1600,8 +2441,8 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
 			 function,
-			 internal_logical_volume->current_offset,
-			 internal_logical_volume->current_offset );
+			 logical_volume_handle->current_offset,
+			 logical_volume_handle->current_offset );
 
 			return( -1 );
 		}
@@ -1613,8 +2454,8 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
 			 function,
-			 internal_logical_volume->current_offset,
-			 internal_logical_volume->current_offset );
+			 logical_volume_handle->current_offset,
+			 logical_volume_handle->current_offset );
 
 			return( -1 );
 		}
@@ -1645,9 +2486,9 @@ ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
 		buffer_offset     += read_size;
 		sector_data_offset = 0;
 
-		internal_logical_volume->current_offset += (off64_t) read_size;
+		logical_volume_handle->current_offset += (off64_t) read_size;
 
-		if( (size64_t) internal_logical_volume->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
+		if( (size64_t) logical_volume_handle->current_offset >= internal_logical_volume->logical_volume_descriptor->size )
 		{
 			break;
 		}
@@ -1668,6 +2509,7 @@ ssize_t libfvde_logical_volume_read_buffer(
          size_t buffer_size,
          libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_read_buffer";
 	ssize_t read_count                                         = 0;
@@ -1683,7 +2525,8 @@ ssize_t libfvde_logical_volume_read_buffer(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -1701,7 +2544,7 @@ ssize_t libfvde_logical_volume_read_buffer(
 	}
 #endif
 	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-		      internal_logical_volume,
+		      logical_volume_handle,
 		      internal_logical_volume->file_io_pool,
 		      buffer,
 		      buffer_size,
@@ -1732,6 +2575,22 @@ ssize_t libfvde_logical_volume_read_buffer(
 
 		return( -1 );
 	}
+	if( read_count != -1 )
+	{
+		if( libfvde_internal_logical_volume_prefetch(
+		     logical_volume_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prefetch data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 #endif
 	return( read_count );
 }
@@ -1746,6 +2605,7 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_read_buffer_at_offset";
 	ssize_t read_count                                         = 0;
@@ -1761,7 +2621,8 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -1779,7 +2640,7 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
 	}
 #endif
 	if( libfvde_internal_logical_volume_seek_offset(
-	     internal_logical_volume,
+	     logical_volume_handle,
 	     offset,
 	     SEEK_SET,
 	     error ) == -1 )
@@ -1796,7 +2657,7 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
 	else
 	{
 		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-			      internal_logical_volume,
+			      logical_volume_handle,
 			      internal_logical_volume->file_io_pool,
 			      buffer,
 			      buffer_size,
@@ -1828,21 +2689,43 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
 
 		return( -1 );
 	}
+	if( read_count != -1 )
+	{
+		if( libfvde_internal_logical_volume_prefetch(
+		     logical_volume_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prefetch data.",
+			 function );
+
+			return( -1 );
+		}
+	}
 #endif
 	return( read_count );
 }
 
-/* Seeks a certain offset of the data
+/* Retrieves a block reference to the sector data at a specific offset
+ * The block reference refers to the decrypted data of the sector that contains the offset
+ * in the sectors cache, without copying it
  * This function is not multi-thread safe acquire write lock before call
- * Returns the offset if seek is successful or -1 on error
+ * Returns 1 if successful, 0 if the offset is beyond the end of the logical volume or -1 on error
  */
-off64_t libfvde_internal_logical_volume_seek_offset(
-         libfvde_internal_logical_volume_t *internal_logical_volume,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libfvde_internal_logical_volume_get_block_reference(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     libfvde_block_reference_t **block_reference,
+     libcerror_error_t **error )
 {
-	static char *function = "libfvde_internal_logical_volume_seek_offset";
+	libfvde_sector_data_t *sector_data = NULL;
+	static char *function              = "libfvde_internal_logical_volume_get_block_reference";
+	off64_t element_data_offset        = 0;
+	off64_t sector_offset              = 0;
+	size64_t data_size                 = 0;
 
 	if( internal_logical_volume == NULL )
 	{
@@ -1855,6 +2738,17 @@ off64_t libfvde_internal_logical_volume_seek_offset(
 
 		return( -1 );
 	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_logical_volume->logical_volume_descriptor == NULL )
 	{
 		libcerror_error_set(
@@ -1877,63 +2771,4768 @@ off64_t libfvde_internal_logical_volume_seek_offset(
 
 		return( -1 );
 	}
-	if( ( whence != SEEK_CUR )
-	 && ( whence != SEEK_END )
-	 && ( whence != SEEK_SET ) )
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported whence.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( whence == SEEK_CUR )
-	{	
-		offset += internal_logical_volume->current_offset;
-	}
-	else if( whence == SEEK_END )
-	{	
-		offset += (off64_t) internal_logical_volume->logical_volume_descriptor->size;
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( (size64_t) offset >= internal_logical_volume->logical_volume_descriptor->size )
 	{
-		libcnotify_printf(
-		 "%s: seeking media data offset: %" PRIi64 ".\n",
+		return( 0 );
+	}
+	if( internal_logical_volume->sectors_cache_memory_size == 0 )
+	{
+		if( libfvde_internal_logical_volume_set_accounted_memory_size(
+		     internal_logical_volume,
+		     LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_CACHE,
+		     &( internal_logical_volume->sectors_cache_memory_size ),
+		     (size64_t) LIBFVDE_MAXIMUM_CACHE_ENTRIES_SECTORS * ( sizeof( libfvde_sector_data_t ) + internal_logical_volume->io_handle->bytes_per_sector ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set sectors cache memory usage.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfdata_vector_get_element_value_at_offset(
+	     internal_logical_volume->sectors_vector,
+	     (intptr_t *) internal_logical_volume->file_io_pool,
+	     (libfdata_cache_t *) internal_logical_volume->sectors_cache,
+	     offset,
+	     &element_data_offset,
+	     (intptr_t **) &sector_data,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing sector data at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	sector_offset = offset - element_data_offset;
+	data_size     = (size64_t) sector_data->data_size;
+
+	/* The last sector can extend beyond the end of the logical volume
+	 */
+	if( data_size > ( internal_logical_volume->logical_volume_descriptor->size - (size64_t) sector_offset ) )
+	{
+		data_size = internal_logical_volume->logical_volume_descriptor->size - (size64_t) sector_offset;
+	}
+	/* The sector data is referenced so that it remains valid when it is evicted from the sectors cache
+	 */
+	if( libfvde_sector_data_add_reference(
+	     sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_block_reference_initialize(
+	     block_reference,
+	     internal_logical_volume,
+	     sector_data,
+	     sector_offset,
+	     (size_t) data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block reference.",
+		 function );
+
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+
+		return( -1 );
+	}
+	internal_logical_volume->reference_count += 1;
+
+	return( 1 );
+}
+
+/* Retrieves a block reference to the sector data at a specific offset
+ * The block reference refers to the decrypted data of the sector that contains the offset
+ * in the sectors cache, without copying it. The data remains valid until the block reference
+ * is freed, also when the sector is evicted from the sectors cache
+ * Returns 1 if successful, 0 if the offset is beyond the end of the logical volume or -1 on error
+ */
+int libfvde_logical_volume_get_block_reference(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     libfvde_block_reference_t **block_reference,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_block_reference";
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( block_reference == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reference.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reference != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block reference value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_internal_logical_volume_get_block_reference(
+	          internal_logical_volume,
+	          offset,
+	          block_reference,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve block reference at offset: %" PRIi64 " (0x%08 " PRIx64 ").",
 		 function,
+		 offset,
 		 offset );
 	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a reference to sector data retrieved by a block reference
+ * The sector data is freed when it was evicted from the sectors cache and
+ * this was its last reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_release_sector_data(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_release_sector_data";
+	int result            = 1;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfvde_sector_data_free(
+	     sector_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sector data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads data at a specific offset without using the sectors cache or the current offset
+ * The data is read directly into the buffer and encrypted data is read in chunks of
+ * LIBFVDE_READ_REQUEST_CHUNK_SIZE and decrypted per sector
+ * This function is not multi-thread safe acquire read lock before call
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_internal_logical_volume_read_buffer_at_offset_unbuffered(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	uint8_t *encrypted_data      = NULL;
+	uint8_t *sector_data         = NULL;
+	static char *function        = "libfvde_internal_logical_volume_read_buffer_at_offset_unbuffered";
+	size64_t bytes_per_sector    = 0;
+	size64_t segment_size        = 0;
+	size_t buffer_offset         = 0;
+	size_t chunk_offset          = 0;
+	size_t chunk_size            = 0;
+	size_t copy_offset           = 0;
+	size_t copy_size             = 0;
+	size_t data_offset           = 0;
+	size_t read_size             = 0;
+	ssize_t read_count           = 0;
+	off64_t chunk_start_offset   = 0;
+	off64_t segment_data_offset  = 0;
+	off64_t segment_file_offset  = 0;
+	off64_t segment_start_offset = 0;
+	off64_t sector_offset        = 0;
+	uint32_t segment_flags       = 0;
+	int number_of_segments       = 0;
+	int segment_file_index       = 0;
+	int segment_index            = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	bytes_per_sector = (size64_t) internal_logical_volume->io_handle->bytes_per_sector;
+
+	if( ( bytes_per_sector == 0 )
+	 || ( bytes_per_sector > (size64_t) LIBFVDE_READ_REQUEST_CHUNK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical volume - bytes per sector value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) offset >= internal_logical_volume->logical_volume_descriptor->size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( internal_logical_volume->logical_volume_descriptor->size - offset ) )
+	{
+		buffer_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - offset );
+	}
+	if( libfdata_vector_get_number_of_segments(
+	     internal_logical_volume->sectors_vector,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of segments from sectors vector.",
+		 function );
+
+		goto on_error;
+	}
+	while( buffer_offset < buffer_size )
+	{
+		/* The segments are contiguous and cover the logical volume from its start
+		 */
+		while( segment_index < number_of_segments )
+		{
+			if( libfdata_vector_get_segment_by_index(
+			     internal_logical_volume->sectors_vector,
+			     segment_index,
+			     &segment_file_index,
+			     &segment_file_offset,
+			     &segment_size,
+			     &segment_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve segment: %d from sectors vector.",
+				 function,
+				 segment_index );
+
+				goto on_error;
+			}
+			if( (size64_t) ( offset - segment_start_offset ) < segment_size )
+			{
+				break;
+			}
+			segment_start_offset += (off64_t) segment_size;
+
+			segment_index++;
+		}
+		if( segment_index >= number_of_segments )
+		{
+			break;
+		}
+		segment_data_offset = offset - segment_start_offset;
+
+		read_size = buffer_size - buffer_offset;
+
+		if( (size64_t) read_size > ( segment_size - segment_data_offset ) )
+		{
+			read_size = (size_t) ( segment_size - segment_data_offset );
+		}
+		if( ( segment_flags & LIBFVDE_RANGE_FLAG_IS_SPARSE ) != 0 )
+		{
+			if( memory_set(
+			     &( buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( ( segment_flags & LIBFVDE_RANGE_FLAG_IS_ENCRYPTED ) == 0 )
+		{
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              internal_logical_volume->file_io_pool,
+			              segment_file_index,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              segment_file_offset + segment_data_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 segment_file_offset + segment_data_offset,
+				 segment_file_offset + segment_data_offset );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( encrypted_data == NULL )
+			{
+				encrypted_data = (uint8_t *) memory_allocate(
+				                              sizeof( uint8_t ) * LIBFVDE_READ_REQUEST_CHUNK_SIZE );
+
+				if( encrypted_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create encrypted data.",
+					 function );
+
+					goto on_error;
+				}
+				sector_data = (uint8_t *) memory_allocate(
+				                           sizeof( uint8_t ) * (size_t) bytes_per_sector );
+
+				if( sector_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create sector data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* The data is decrypted per sector hence the chunk is aligned to the sectors
+			 * it overlaps, the segment size is a multiple of the sector size
+			 */
+			chunk_start_offset = segment_data_offset - ( segment_data_offset % bytes_per_sector );
+			chunk_size         = (size_t) ( segment_data_offset - chunk_start_offset ) + read_size;
+
+			if( ( chunk_size % bytes_per_sector ) != 0 )
+			{
+				chunk_size += (size_t) ( bytes_per_sector - ( chunk_size % bytes_per_sector ) );
+			}
+			if( chunk_size > (size_t) LIBFVDE_READ_REQUEST_CHUNK_SIZE )
+			{
+				chunk_size = (size_t) LIBFVDE_READ_REQUEST_CHUNK_SIZE;
+
+				read_size = chunk_size - (size_t) ( segment_data_offset - chunk_start_offset );
+			}
+			read_count = libbfio_pool_read_buffer_at_offset(
+			              internal_logical_volume->file_io_pool,
+			              segment_file_index,
+			              encrypted_data,
+			              chunk_size,
+			              segment_file_offset + chunk_start_offset,
+			              error );
+
+			if( read_count != (ssize_t) chunk_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read encrypted data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 segment_file_offset + chunk_start_offset,
+				 segment_file_offset + chunk_start_offset );
+
+				goto on_error;
+			}
+			copy_offset = (size_t) ( segment_data_offset - chunk_start_offset );
+			data_offset = buffer_offset;
+
+			for( chunk_offset = 0;
+			     chunk_offset < chunk_size;
+			     chunk_offset += (size_t) bytes_per_sector )
+			{
+				/* The tweak value is the index of the sector in the logical volume
+				 */
+				sector_offset = segment_start_offset + chunk_start_offset + chunk_offset;
+
+				copy_size = (size_t) bytes_per_sector - copy_offset;
+
+				if( copy_size > ( buffer_offset + read_size - data_offset ) )
+				{
+					copy_size = buffer_offset + read_size - data_offset;
+				}
+				if( ( copy_offset == 0 )
+				 && ( copy_size == (size_t) bytes_per_sector ) )
+				{
+					if( libfvde_encryption_context_crypt(
+					     internal_logical_volume->volume_data_handle->encryption_context,
+					     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+					     &( encrypted_data[ chunk_offset ] ),
+					     (size_t) bytes_per_sector,
+					     &( buffer[ data_offset ] ),
+					     (size_t) bytes_per_sector,
+					     (uint64_t) ( sector_offset / bytes_per_sector ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+						 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+						 "%s: unable to decrypt sector data.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else
+				{
+					if( libfvde_encryption_context_crypt(
+					     internal_logical_volume->volume_data_handle->encryption_context,
+					     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+					     &( encrypted_data[ chunk_offset ] ),
+					     (size_t) bytes_per_sector,
+					     sector_data,
+					     (size_t) bytes_per_sector,
+					     (uint64_t) ( sector_offset / bytes_per_sector ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+						 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+						 "%s: unable to decrypt sector data.",
+						 function );
+
+						goto on_error;
+					}
+					if( memory_copy(
+					     &( buffer[ data_offset ] ),
+					     &( sector_data[ copy_offset ] ),
+					     copy_size ) == NULL )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+						 "%s: unable to copy sector data to buffer.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				data_offset += copy_size;
+				copy_offset  = 0;
+			}
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+
+		if( internal_logical_volume->io_handle->abort != 0 )
+		{
+			break;
+		}
+	}
+	if( sector_data != NULL )
+	{
+		memory_set(
+		 sector_data,
+		 0,
+		 (size_t) bytes_per_sector );
+
+		memory_free(
+		 sector_data );
+	}
+	if( encrypted_data != NULL )
+	{
+		memory_free(
+		 encrypted_data );
+	}
+	return( (ssize_t) buffer_offset );
+
+on_error:
+	if( sector_data != NULL )
+	{
+		memory_set(
+		 sector_data,
+		 0,
+		 (size_t) bytes_per_sector );
+
+		memory_free(
+		 sector_data );
+	}
+	if( encrypted_data != NULL )
+	{
+		memory_free(
+		 encrypted_data );
+	}
+	return( -1 );
+}
+
+/* Reads data at a specific offset on behalf of a read request
+ * Unless read errors are tolerated multiple read requests are read concurrently,
+ * since the data is not cached and the current offset is not changed
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfvde_internal_logical_volume_read_request_buffer(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t read_request_handle;
+
+	static char *function        = "libfvde_internal_logical_volume_read_request_buffer";
+	ssize_t read_count           = 0;
+	uint8_t tolerate_read_errors = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	tolerate_read_errors = internal_logical_volume->volume_data_handle->tolerate_read_errors;
+
+	if( tolerate_read_errors == 0 )
+	{
+		read_count = libfvde_internal_logical_volume_read_buffer_at_offset_unbuffered(
+		              internal_logical_volume,
+		              buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( tolerate_read_errors == 0 )
+	{
+		return( read_count );
+	}
+	/* The read errors are recorded by the sector read function, hence
+	 * the data is read via the sectors cache
+	 */
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* A read request does not change the current offset or the read-ahead
+	 * of a logical volume handle, hence it is read using a handle of its own
+	 */
+	if( memory_set(
+	     &read_request_handle,
+	     0,
+	     sizeof( libfvde_logical_volume_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read request handle.",
+		 function );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_request_handle.internal_logical_volume = internal_logical_volume;
+		read_request_handle.current_offset          = offset;
+		read_request_handle.access_advice           = LIBFVDE_ACCESS_ADVICE_NORMAL;
+
+		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+			      &read_request_handle,
+			      internal_logical_volume->file_io_pool,
+			      buffer,
+			      buffer_size,
+			      error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer.",
+			 function );
+		}
+	}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Creates the read thread pool if it does not exist
+ * If the volume has an executor the read requests are submitted to the executor instead
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_create_read_thread_pool(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_create_read_thread_pool";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_logical_volume->read_thread_pool != NULL )
+	 || ( internal_logical_volume->read_task_group != NULL ) )
+	{
+		return( 1 );
+	}
+	if( internal_logical_volume->io_handle->executor != NULL )
+	{
+		if( libfvde_executor_task_group_initialize(
+		     &( internal_logical_volume->read_task_group ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read task group.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfvde_executor_attach(
+		     internal_logical_volume->io_handle->executor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to attach executor.",
+			 function );
+
+			libfvde_executor_task_group_free(
+			 &( internal_logical_volume->read_task_group ),
+			 NULL );
+
+			return( -1 );
+		}
+		internal_logical_volume->read_executor = internal_logical_volume->io_handle->executor;
+
+		return( 1 );
+	}
+	if( libcthreads_thread_pool_create(
+	     &( internal_logical_volume->read_thread_pool ),
+	     NULL,
+	     LIBFVDE_MAXIMUM_NUMBER_OF_READ_THREADS,
+	     LIBFVDE_MAXIMUM_NUMBER_OF_QUEUED_READ_REQUESTS,
+	     (int (*)(intptr_t *, void *)) &libfvde_internal_logical_volume_read_request_callback,
+	     (void *) internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Callback function to handle a read request from the read thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_read_request_callback(
+     libfvde_read_request_t *read_request,
+     libfvde_internal_logical_volume_t *internal_logical_volume )
+{
+	libfvde_internal_read_request_t *internal_read_request = NULL;
+	libcerror_error_t *error                               = NULL;
+	static char *function                                  = "libfvde_internal_logical_volume_read_request_callback";
+	ssize_t read_count                                     = 0;
+
+	if( read_request == NULL )
+	{
+		return( -1 );
+	}
+	internal_read_request = (libfvde_internal_read_request_t *) read_request;
+
+	read_count = libfvde_internal_logical_volume_read_request_buffer(
+	              internal_logical_volume,
+	              internal_read_request->buffer,
+	              internal_read_request->buffer_size,
+	              internal_read_request->offset,
+	              &error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_read_request->offset,
+		 internal_read_request->offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	/* The read request is completed regardless of the result of the read
+	 * otherwise a thread waiting for it would block indefinitely
+	 */
+	if( libfvde_read_request_set_complete(
+	     read_request,
+	     read_count,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read request complete.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Pushes a read request onto the read thread pool or submits it to the executor
+ * This function does not require the lock, since pushing can block until a read
+ * thread, that needs the lock, picks up a read request
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_push_read_request(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_push_read_request";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->read_task_group != NULL )
+	{
+		if( libfvde_executor_submit(
+		     internal_logical_volume->read_executor,
+		     internal_logical_volume->read_task_group,
+		     (int (*)(intptr_t *, void *)) &libfvde_internal_logical_volume_read_request_callback,
+		     (intptr_t *) read_request,
+		     (void *) internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to submit read request to executor.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libcthreads_thread_pool_push(
+	          internal_logical_volume->read_thread_pool,
+	          (intptr_t *) read_request,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read request onto read thread pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Submits an asynchronous read of data at a specific offset
+ * The buffer must remain valid until the read request is complete. The callback,
+ * if not NULL, is called from a read thread once the data is read and should not
+ * block. Alternatively use libfvde_read_request_is_complete or libfvde_read_request_wait
+ * Multiple read requests can be in flight, where the reading of one request overlaps
+ * the decryption of another. A read request does not change the current offset
+ * Without multi-thread support the read request is completed before this function returns
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_submit_read_buffer_at_offset(
+     libfvde_logical_volume_t *logical_volume,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            libfvde_read_request_t *read_request,
+            intptr_t *callback_data ),
+     intptr_t *callback_data,
+     libfvde_read_request_t **read_request,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	libfvde_read_request_t *safe_read_request                  = NULL;
+	static char *function                                      = "libfvde_logical_volume_submit_read_buffer_at_offset";
+
+#if !defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcerror_error_t *read_error                              = NULL;
+	ssize_t read_count                                         = 0;
+#endif
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( read_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read request.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_request != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read request value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_read_request_initialize(
+	     &safe_read_request,
+	     logical_volume,
+	     (uint8_t *) buffer,
+	     buffer_size,
+	     offset,
+	     callback,
+	     callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read request.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_internal_logical_volume_create_read_thread_pool(
+	     internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread pool.",
+		 function );
+
+		libcthreads_read_write_lock_release_for_write(
+		 internal_logical_volume->read_write_lock,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_read_request_set_pending(
+	     safe_read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read request pending.",
+		 function );
+
+		goto on_error;
+	}
+	/* The read request is pushed without holding the lock since pushing blocks
+	 * when the queue is full until a read thread, that needs the lock, picks up a read request
+	 */
+	if( libfvde_internal_logical_volume_push_read_request(
+	     internal_logical_volume,
+	     safe_read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push read request.",
+		 function );
+
+		/* The read request was not handed to a read thread
+		 */
+		( (libfvde_internal_read_request_t *) safe_read_request )->is_released = 1;
+
+		goto on_error;
+	}
+#else
+	if( libfvde_read_request_set_pending(
+	     safe_read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read request pending.",
+		 function );
+
+		goto on_error;
+	}
+	/* A failed read is reported by the read request
+	 */
+	read_count = libfvde_internal_logical_volume_read_request_buffer(
+	              internal_logical_volume,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              &read_error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_free(
+		 &read_error );
+	}
+	if( libfvde_read_request_set_complete(
+	     safe_read_request,
+	     read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read request complete.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*read_request = safe_read_request;
+
+	return( 1 );
+
+on_error:
+	if( safe_read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &safe_read_request,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Fills the read-ahead with the data at a specific offset
+ * At most the read-ahead data size of the data is read
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_fill_read_ahead(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_internal_logical_volume_fill_read_ahead";
+	ssize_t read_count                                         = 0;
+
+	if( logical_volume_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( logical_volume_handle->read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > logical_volume_handle->read_ahead->data_size ) )
+	{
+		size = logical_volume_handle->read_ahead->data_size;
+	}
+	read_count = libfvde_internal_logical_volume_read_buffer_at_offset_unbuffered(
+	              internal_logical_volume,
+	              logical_volume_handle->read_ahead->data,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read read-ahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	if( libfvde_read_ahead_set_data_range(
+	     logical_volume_handle->read_ahead,
+	     offset,
+	     (size_t) read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead data range.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+/* Submits a pending prefetch of the read-ahead to the read thread pool
+ * The lock is grabbed by this function since submitting a read request
+ * can block until a read thread, that needs the lock, picks up a read request
+ * Returns 1 if a prefetch was submitted, 0 if not or -1 on error
+ */
+int libfvde_internal_logical_volume_prefetch(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	libfvde_read_request_t *read_request                       = NULL;
+	static char *function                                      = "libfvde_internal_logical_volume_prefetch";
+	size_t prefetch_size                                       = 0;
+	off64_t prefetch_offset                                    = 0;
+	int result                                                 = 0;
+
+	if( logical_volume_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( logical_volume_handle->read_ahead != NULL )
+	 && ( logical_volume_handle->read_ahead->prefetch_offset >= 0 )
+	 && ( logical_volume_handle->read_ahead->prefetch_read_request != NULL ) )
+	{
+		/* A completed prefetch that was not used is superseded by the next prefetch
+		 */
+		result = libfvde_read_request_is_complete(
+		          logical_volume_handle->read_ahead->prefetch_read_request,
+		          error );
+
+		if( result == 1 )
+		{
+			result = libfvde_read_request_free(
+			          &( logical_volume_handle->read_ahead->prefetch_read_request ),
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free completed prefetch read request.",
+			 function );
+
+			libcthreads_read_write_lock_release_for_write(
+			 internal_logical_volume->read_write_lock,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( ( logical_volume_handle->read_ahead == NULL )
+	 || ( logical_volume_handle->read_ahead->prefetch_offset < 0 )
+	 || ( logical_volume_handle->read_ahead->prefetch_read_request != NULL )
+	 || ( logical_volume_handle->read_ahead->is_prefetching != 0 ) )
+	{
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	prefetch_offset = logical_volume_handle->read_ahead->prefetch_offset;
+	prefetch_size   = logical_volume_handle->read_ahead->prefetch_size;
+
+	if( ( prefetch_size == 0 )
+	 || ( prefetch_size > logical_volume_handle->read_ahead->data_size ) )
+	{
+		prefetch_size = logical_volume_handle->read_ahead->data_size;
+	}
+	logical_volume_handle->read_ahead->prefetch_offset = -1;
+	logical_volume_handle->read_ahead->is_prefetching  = 1;
+
+	if( libfvde_internal_logical_volume_create_read_thread_pool(
+	     internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread pool.",
+		 function );
+
+		logical_volume_handle->read_ahead->is_prefetching = 0;
+
+		libcthreads_read_write_lock_release_for_write(
+		 internal_logical_volume->read_write_lock,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	/* The prefetch data is not used by other functions while is_prefetching is set
+	 */
+	if( libfvde_read_request_initialize(
+	     &read_request,
+	     (libfvde_logical_volume_t *) logical_volume_handle,
+	     logical_volume_handle->read_ahead->prefetch_data,
+	     prefetch_size,
+	     prefetch_offset,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create prefetch read request.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_read_request_set_pending(
+	     read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefetch read request pending.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_internal_logical_volume_push_read_request(
+	     internal_logical_volume,
+	     read_request,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push prefetch read request.",
+		 function );
+
+		( (libfvde_internal_read_request_t *) read_request )->is_released = 1;
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		/* The read request is owned by the read thread pool at this point
+		 * and cannot be released until it completes
+		 */
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+
+		return( -1 );
+	}
+	logical_volume_handle->read_ahead->prefetch_read_request = read_request;
+	logical_volume_handle->read_ahead->is_prefetching        = 0;
+
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     NULL ) == 1 )
+	{
+		logical_volume_handle->read_ahead->is_prefetching = 0;
+
+		libcthreads_read_write_lock_release_for_write(
+		 internal_logical_volume->read_write_lock,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+/* Sets the memory size accounted for state of the logical volume
+ * The difference with the previously accounted size is added to or removed from the memory usage
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_set_accounted_memory_size(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     int usage_type,
+     size64_t *accounted_size,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_set_accounted_memory_size";
+	int result            = 1;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( accounted_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid accounted size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == *accounted_size )
+	{
+		return( 1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > *accounted_size )
+	{
+		result = libfvde_memory_usage_add_used_size(
+		          internal_logical_volume->io_handle->memory_usage,
+		          usage_type,
+		          size - *accounted_size,
+		          error );
+	}
+	else if( size < *accounted_size )
+	{
+		result = libfvde_memory_usage_remove_used_size(
+		          internal_logical_volume->io_handle->memory_usage,
+		          usage_type,
+		          *accounted_size - size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	*accounted_size = size;
+
+	return( 1 );
+}
+
+/* Empties the sectors cache
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_empty_sectors_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_empty_sectors_cache";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->sectors_cache == NULL )
+	{
+		return( 1 );
+	}
+	if( libfcache_cache_empty(
+	     internal_logical_volume->sectors_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty sectors cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_CACHE,
+	     &( internal_logical_volume->sectors_cache_memory_size ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sectors cache memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the read-ahead
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_create_read_ahead(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_internal_logical_volume_create_read_ahead";
+	size64_t memory_size                                       = 0;
+
+	if( logical_volume_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( logical_volume_handle->read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume - read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_read_ahead_initialize(
+	     &( logical_volume_handle->read_ahead ),
+	     LIBFVDE_READ_AHEAD_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	memory_size = sizeof( libfvde_read_ahead_t ) + LIBFVDE_READ_AHEAD_SIZE;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The prefetch data has the same size as the read-ahead data
+	 */
+	memory_size += LIBFVDE_READ_AHEAD_SIZE;
+#endif
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	     &( logical_volume_handle->read_ahead_memory_size ),
+	     memory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( logical_volume_handle->read_ahead != NULL )
+	{
+		libfvde_read_ahead_free(
+		 &( logical_volume_handle->read_ahead ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the read-ahead
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_free_read_ahead(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_internal_logical_volume_free_read_ahead";
+
+	if( logical_volume_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( logical_volume_handle->read_ahead == NULL )
+	{
+		return( 1 );
+	}
+	if( libfvde_read_ahead_free(
+	     &( logical_volume_handle->read_ahead ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	     &( logical_volume_handle->read_ahead_memory_size ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the warm cache
+ * The warm cache is accounted at its capacity
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_create_warm_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_create_warm_cache";
+	size64_t memory_size  = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->warm_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume - warm cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_block_cache_initialize(
+	     &( internal_logical_volume->warm_cache ),
+	     LIBFVDE_ACCESS_TRACE_BLOCK_SIZE,
+	     LIBFVDE_MAXIMUM_NUMBER_OF_WARM_CACHE_BLOCKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create warm cache.",
+		 function );
+
+		return( -1 );
+	}
+	memory_size = sizeof( libfvde_block_cache_t )
+	            + ( (size64_t) LIBFVDE_MAXIMUM_NUMBER_OF_WARM_CACHE_BLOCKS * ( sizeof( libfvde_block_cache_entry_t ) + LIBFVDE_ACCESS_TRACE_BLOCK_SIZE ) );
+
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_WARM_CACHE,
+	     &( internal_logical_volume->warm_cache_memory_size ),
+	     memory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set warm cache memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_logical_volume->warm_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &( internal_logical_volume->warm_cache ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the warm cache
+ * Pending read requests of the warm cache are waited for, hence the read thread pool
+ * must be joined or the warm cache must not contain blocks that are being read
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_free_warm_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_free_warm_cache";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->warm_cache == NULL )
+	{
+		return( 1 );
+	}
+	if( libfvde_block_cache_free(
+	     &( internal_logical_volume->warm_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free warm cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_WARM_CACHE,
+	     &( internal_logical_volume->warm_cache_memory_size ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set warm cache memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates the pinned cache
+ * The pinned cache can hold up to the maximum pinned size of data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_create_pinned_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfvde_internal_logical_volume_create_pinned_cache";
+	int maximum_number_of_entries = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->pinned_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid logical volume - pinned cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_entries = (int) ( internal_logical_volume->maximum_pinned_size / LIBFVDE_PINNED_BLOCK_SIZE );
+
+	if( libfvde_block_cache_initialize(
+	     &( internal_logical_volume->pinned_cache ),
+	     LIBFVDE_PINNED_BLOCK_SIZE,
+	     maximum_number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create pinned cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+	     internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pinned cache memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_logical_volume->pinned_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &( internal_logical_volume->pinned_cache ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the pinned cache
+ * Pending read requests of the pinned cache are waited for, hence the read thread pool
+ * must be joined or the pinned cache must not contain blocks that are being read
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_free_pinned_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_free_pinned_cache";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->pinned_cache == NULL )
+	{
+		return( 1 );
+	}
+	if( libfvde_block_cache_free(
+	     &( internal_logical_volume->pinned_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free pinned cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+	     internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pinned cache memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the memory size accounted for the pinned cache
+ * Unlike the warm cache the pinned cache is accounted by the blocks it holds
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_update_pinned_cache_memory_size";
+	size64_t memory_size  = 0;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->pinned_cache != NULL )
+	{
+		memory_size = sizeof( libfvde_block_cache_t )
+		            + ( (size64_t) internal_logical_volume->pinned_cache->maximum_number_of_entries * sizeof( libfvde_block_cache_entry_t ) )
+		            + ( (size64_t) internal_logical_volume->pinned_cache->number_of_entries * LIBFVDE_PINNED_BLOCK_SIZE );
+	}
+	if( libfvde_internal_logical_volume_set_accounted_memory_size(
+	     internal_logical_volume,
+	     LIBFVDE_MEMORY_USAGE_TYPE_PINNED,
+	     &( internal_logical_volume->pinned_cache_memory_size ),
+	     memory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set pinned cache memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Unreserves the blocks of a range that failed to be pinned
+ * Blocks that were reserved but of which the read request was not submitted are never filled
+ * and are removed, the references to the other blocks of the range are released
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_unreserve_pinned_blocks(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t first_block_offset,
+     uint8_t **blocks_data,
+     int number_of_blocks,
+     int first_unsubmitted_block_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_unreserve_pinned_blocks";
+	off64_t block_offset  = 0;
+	int block_index       = 0;
+	int result            = 1;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->pinned_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing pinned cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( blocks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid blocks data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of blocks value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_unsubmitted_block_index < 0 )
+	 || ( first_unsubmitted_block_index > number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first unsubmitted block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	block_offset = first_block_offset + ( (off64_t) first_unsubmitted_block_index * LIBFVDE_PINNED_BLOCK_SIZE );
+
+	for( block_index = first_unsubmitted_block_index;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( blocks_data[ block_index ] != NULL )
+		{
+			if( libfvde_block_cache_remove_block(
+			     internal_logical_volume->pinned_cache,
+			     block_offset,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove pinned cache block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				result = -1;
+			}
+			blocks_data[ block_index ] = NULL;
+		}
+		block_offset += LIBFVDE_PINNED_BLOCK_SIZE;
+	}
+	if( libfvde_block_cache_release_range(
+	     internal_logical_volume->pinned_cache,
+	     first_block_offset,
+	     (size64_t) number_of_blocks * LIBFVDE_PINNED_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to release range from pinned cache.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+	     internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update pinned cache memory usage.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Compacts the logical volume by releasing shared state that can be reconstructed
+ * The sectors cache is emptied
+ * Blocks of the warm cache are released, except for those that are still being read
+ * The pinned cache is not released, since its blocks are held until they are unpinned
+ * The encryption context plist is released, unless it is in use, and rebuilt on next access
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_compact(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_compact";
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_internal_logical_volume_empty_sectors_cache(
+	     internal_logical_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty sectors cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->warm_cache != NULL )
+	{
+		if( libfvde_block_cache_empty(
+		     internal_logical_volume->warm_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty warm cache.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_logical_volume->warm_cache->number_of_entries == 0 )
+		{
+			if( libfvde_internal_logical_volume_free_warm_cache(
+			     internal_logical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free warm cache.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( internal_logical_volume->encrypted_metadata != NULL )
+	{
+		if( libfvde_encrypted_metadata_compact(
+		     internal_logical_volume->encrypted_metadata,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to compact encrypted metadata.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compacts the logical volume on request of the memory budget
+ * This allows logical volumes that are not being read to release their shared state
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_compact_on_request(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfvde_internal_logical_volume_compact_on_request";
+	uint32_t compaction_generation = 0;
+	int result                     = 1;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_memory_usage_get_compaction_generation(
+	     internal_logical_volume->io_handle->memory_usage,
+	     &compaction_generation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve compaction generation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( compaction_generation != internal_logical_volume->compaction_generation )
+	{
+		if( libfvde_internal_logical_volume_compact(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to compact logical volume.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			internal_logical_volume->compaction_generation = compaction_generation;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Compacts the logical volume handle by releasing state that can be reconstructed
+ * The read-ahead is freed, unless a prefetch into the read-ahead is pending,
+ * in which case its data is invalidated
+ * The read-ahead is recreated when sequential or will-need access is advised again
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_logical_volume_compact_handle(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_internal_logical_volume_compact_handle";
+	int result            = 1;
+
+	if( logical_volume_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume_handle->read_ahead == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( ( logical_volume_handle->read_ahead->prefetch_read_request != NULL )
+	 || ( logical_volume_handle->read_ahead->is_prefetching != 0 ) )
+	{
+		result = libfvde_read_ahead_set_data_range(
+		          logical_volume_handle->read_ahead,
+		          0,
+		          0,
+		          error );
+	}
+	else
+#endif
+	{
+		result = libfvde_internal_logical_volume_free_read_ahead(
+		          logical_volume_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Advises the expected access pattern of the logical volume
+ * The advice is one of the LIBFVDE_ACCESS_ADVICE values, where normal, sequential,
+ * random and no-reuse apply to the whole logical volume and will-need and
+ * don't-need apply to the range defined by offset and size
+ * Only sequential access refills the read-ahead, normal, random and no-reuse
+ * cancel a read-ahead that is pending
+ * Will-need reads ahead at most LIBFVDE_READ_AHEAD_SIZE bytes of the range,
+ * where a size of 0 extends the range to the end of the logical volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_advise(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     size64_t size,
+     int advice,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_advise";
+	size_t read_ahead_size                                     = 0;
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( advice != LIBFVDE_ACCESS_ADVICE_NORMAL )
+	 && ( advice != LIBFVDE_ACCESS_ADVICE_SEQUENTIAL )
+	 && ( advice != LIBFVDE_ACCESS_ADVICE_RANDOM )
+	 && ( advice != LIBFVDE_ACCESS_ADVICE_WILLNEED )
+	 && ( advice != LIBFVDE_ACCESS_ADVICE_DONTNEED )
+	 && ( advice != LIBFVDE_ACCESS_ADVICE_NOREUSE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported advice: %d.",
+		 function,
+		 advice );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( advice == LIBFVDE_ACCESS_ADVICE_SEQUENTIAL )
+	 || ( advice == LIBFVDE_ACCESS_ADVICE_WILLNEED ) )
+	{
+		if( logical_volume_handle->read_ahead == NULL )
+		{
+			if( libfvde_internal_logical_volume_create_read_ahead(
+			     logical_volume_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create read-ahead.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		switch( advice )
+		{
+			case LIBFVDE_ACCESS_ADVICE_NORMAL:
+			case LIBFVDE_ACCESS_ADVICE_SEQUENTIAL:
+			case LIBFVDE_ACCESS_ADVICE_RANDOM:
+			case LIBFVDE_ACCESS_ADVICE_NOREUSE:
+				logical_volume_handle->access_advice = advice;
+
+				/* Data that was read ahead remains available but the read-ahead
+				 * is no longer refilled
+				 */
+				if( ( advice != LIBFVDE_ACCESS_ADVICE_SEQUENTIAL )
+				 && ( logical_volume_handle->read_ahead != NULL ) )
+				{
+					logical_volume_handle->read_ahead->prefetch_offset = -1;
+				}
+				break;
+
+			case LIBFVDE_ACCESS_ADVICE_WILLNEED:
+				/* The data of a locked logical volume cannot be read ahead
+				 */
+				if( ( internal_logical_volume->is_locked != 0 )
+				 || ( (size64_t) offset >= internal_logical_volume->logical_volume_descriptor->size ) )
+				{
+					break;
+				}
+				read_ahead_size = logical_volume_handle->read_ahead->data_size;
+
+				if( ( size != 0 )
+				 && ( size < (size64_t) read_ahead_size ) )
+				{
+					read_ahead_size = (size_t) size;
+				}
+				if( (size64_t) read_ahead_size > ( internal_logical_volume->logical_volume_descriptor->size - offset ) )
+				{
+					read_ahead_size = (size_t) ( internal_logical_volume->logical_volume_descriptor->size - offset );
+				}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+				logical_volume_handle->read_ahead->prefetch_offset = offset;
+				logical_volume_handle->read_ahead->prefetch_size   = read_ahead_size;
+#else
+				if( libfvde_internal_logical_volume_fill_read_ahead(
+				     logical_volume_handle,
+				     offset,
+				     read_ahead_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to fill read-ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 offset,
+					 offset );
+
+					result = -1;
+				}
+#endif
+				break;
+
+			case LIBFVDE_ACCESS_ADVICE_DONTNEED:
+				if( logical_volume_handle->read_ahead != NULL )
+				{
+					if( libfvde_read_ahead_invalidate(
+					     logical_volume_handle->read_ahead,
+					     offset,
+					     size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to invalidate read-ahead.",
+						 function );
+
+						result = -1;
+					}
+				}
+				/* The sectors cache does not support removing individual sectors
+				 */
+				if( result == 1 )
+				{
+					if( libfvde_internal_logical_volume_empty_sectors_cache(
+					     internal_logical_volume,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to empty sectors cache.",
+						 function );
+
+						result = -1;
+					}
+				}
+				break;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( result == 1 )
+	 && ( advice == LIBFVDE_ACCESS_ADVICE_WILLNEED ) )
+	{
+		if( libfvde_internal_logical_volume_prefetch(
+		     logical_volume_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prefetch data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
+}
+
+/* Starts recording the blocks that are read from the logical volume
+ * An access trace that is already being recorded is restarted
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_start_access_trace(
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_start_access_trace";
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->access_trace != NULL )
+	{
+		if( libfvde_access_trace_free(
+		     &( internal_logical_volume->access_trace ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free access trace.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfvde_access_trace_initialize(
+		     &( internal_logical_volume->access_trace ),
+		     LIBFVDE_ACCESS_TRACE_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create access trace.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the access trace data
+ * Returns 1 if successful, 0 if no access trace is being recorded or -1 on error
+ */
+int libfvde_logical_volume_get_access_trace_size(
+     libfvde_logical_volume_t *logical_volume,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_access_trace_size";
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->access_trace != NULL )
+	{
+		result = libfvde_access_trace_get_data_size(
+		          internal_logical_volume->access_trace,
+		          data_size,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access trace data size.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Copies the access trace data
+ * The access trace data can be replayed with libfvde_logical_volume_replay_access_trace
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_copy_access_trace(
+     libfvde_logical_volume_t *logical_volume,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_copy_access_trace";
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->access_trace == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing access trace.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfvde_access_trace_write_data(
+	          internal_logical_volume->access_trace,
+	          data,
+	          data_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy access trace data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Replays an access trace to warm up the blocks that were read in a previous session
+ * The blocks are submitted, in the order they were read, as asynchronous read requests
+ * into the warm cache until the warm cache is full, reads of the logical volume use
+ * the blocks once their read requests have completed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_replay_access_trace(
+     libfvde_logical_volume_t *logical_volume,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfvde_access_trace_t *access_trace                       = NULL;
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	libfvde_read_request_t *read_request                       = NULL;
+	uint8_t *block_data                                        = NULL;
+	static char *function                                      = "libfvde_logical_volume_replay_access_trace";
+	size64_t volume_size                                       = 0;
+	size_t read_size                                           = 0;
+	off64_t block_offset                                       = 0;
+	uint64_t block_number                                      = 0;
+	uint8_t warm_cache_is_full                                 = 0;
+	int block_number_index                                     = 0;
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	volume_size = internal_logical_volume->logical_volume_descriptor->size;
+
+	if( libfvde_access_trace_initialize(
+	     &access_trace,
+	     LIBFVDE_ACCESS_TRACE_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create access trace.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_access_trace_read_data(
+	     access_trace,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read access trace.",
+		 function );
+
+		goto on_error;
+	}
+	for( block_number_index = 0;
+	     block_number_index < access_trace->number_of_block_numbers;
+	     block_number_index++ )
+	{
+		block_number = access_trace->block_numbers[ block_number_index ];
+
+		/* Blocks beyond the end of the logical volume are ignored
+		 */
+		if( block_number > ( volume_size / LIBFVDE_ACCESS_TRACE_BLOCK_SIZE ) )
+		{
+			continue;
+		}
+		block_offset = (off64_t) ( block_number * LIBFVDE_ACCESS_TRACE_BLOCK_SIZE );
+
+		if( (size64_t) block_offset >= volume_size )
+		{
+			continue;
+		}
+		read_size = LIBFVDE_ACCESS_TRACE_BLOCK_SIZE;
+
+		if( (size64_t) read_size > ( volume_size - block_offset ) )
+		{
+			read_size = (size_t) ( volume_size - block_offset );
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		result = 1;
+
+		/* The data of a locked logical volume cannot be read
+		 */
+		if( internal_logical_volume->is_locked != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid logical volume - volume is locked.",
+			 function );
+
+			result = -1;
+		}
+		else if( internal_logical_volume->warm_cache == NULL )
+		{
+			if( libfvde_internal_logical_volume_create_warm_cache(
+			     internal_logical_volume,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create warm cache.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			result = libfvde_block_cache_reserve_block(
+			          internal_logical_volume->warm_cache,
+			          block_offset,
+			          &block_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to reserve warm cache block: %" PRIu64 ".",
+				 function,
+				 block_number );
+			}
+			else if( result == 0 )
+			{
+				if( internal_logical_volume->warm_cache->number_of_entries >= internal_logical_volume->warm_cache->maximum_number_of_entries )
+				{
+					warm_cache_is_full = 1;
+				}
+			}
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( warm_cache_is_full != 0 )
+		{
+			break;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		/* The block data is not used by other functions while the block is being filled
+		 * and the read request is submitted without holding the lock
+		 */
+		result = libfvde_logical_volume_submit_read_buffer_at_offset(
+		          logical_volume,
+		          block_data,
+		          read_size,
+		          block_offset,
+		          NULL,
+		          NULL,
+		          &read_request,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to submit read request of warm cache block: %" PRIu64 ".",
+			 function,
+			 block_number );
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result != 1 )
+		{
+			libfvde_block_cache_remove_block(
+			 internal_logical_volume->warm_cache,
+			 block_offset,
+			 NULL );
+		}
+		else if( libfvde_block_cache_set_read_request(
+		          internal_logical_volume->warm_cache,
+		          block_offset,
+		          read_request,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read request of warm cache block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			result = -1;
+		}
+		else
+		{
+			/* The read request is now managed by the warm cache
+			 */
+			read_request = NULL;
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_logical_volume->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libfvde_access_trace_free(
+	     &access_trace,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free access trace.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* A read request that is not managed by the warm cache is waited for
+	 * without holding the lock
+	 */
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	if( access_trace != NULL )
+	{
+		libfvde_access_trace_free(
+		 &access_trace,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the maximum size of the data held by the pinned cache
+ * A maximum pinned size of 0 disables pinning
+ * The maximum pinned size can only be changed when no ranges are pinned
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_set_maximum_pinned_size(
+     libfvde_logical_volume_t *logical_volume,
+     size64_t maximum_pinned_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_set_maximum_pinned_size";
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( ( maximum_pinned_size / LIBFVDE_PINNED_BLOCK_SIZE ) > (size64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum pinned size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->pinned_cache != NULL )
+	{
+		if( internal_logical_volume->pinned_cache->number_of_entries != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid logical volume - pinned cache contains blocks.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfvde_internal_logical_volume_free_pinned_cache(
+		          internal_logical_volume,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free pinned cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_logical_volume->maximum_pinned_size = maximum_pinned_size;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Pins a range of the logical volume
+ * The blocks that contain the range are read into the pinned cache by the read thread pool
+ * or executor and are held, regardless of compaction, until the range is unpinned
+ * Pinning fails if the blocks that are not yet pinned exceed the maximum pinned size
+ * A block is pinned once for every range that contains it and is held until all these ranges are unpinned
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_pin_range(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	libfvde_read_request_t *read_request                       = NULL;
+	uint8_t **blocks_data                                      = NULL;
+	static char *function                                      = "libfvde_logical_volume_pin_range";
+	size64_t number_of_blocks                                  = 0;
+	size64_t volume_size                                       = 0;
+	size_t read_size                                           = 0;
+	off64_t block_offset                                       = 0;
+	off64_t first_block_offset                                 = 0;
+	off64_t range_end_offset                                   = 0;
+	int block_index                                            = 0;
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	volume_size = internal_logical_volume->logical_volume_descriptor->size;
+
+	/* The part of the range beyond the end of the logical volume is ignored
+	 */
+	if( ( size == 0 )
+	 || ( (size64_t) offset >= volume_size ) )
+	{
+		return( 1 );
+	}
+	range_end_offset = offset + (off64_t) size;
+
+	if( (size64_t) range_end_offset > volume_size )
+	{
+		range_end_offset = (off64_t) volume_size;
+	}
+	first_block_offset = offset - ( offset % LIBFVDE_PINNED_BLOCK_SIZE );
+	number_of_blocks   = ( (size64_t) ( range_end_offset - first_block_offset ) + LIBFVDE_PINNED_BLOCK_SIZE - 1 ) / LIBFVDE_PINNED_BLOCK_SIZE;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = 1;
+
+	/* The data of a locked logical volume cannot be read
+	 */
+	if( internal_logical_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - volume is locked.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_logical_volume->maximum_pinned_size < LIBFVDE_PINNED_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid range - exceeds maximum pinned size.",
+		 function );
+
+		result = -1;
+	}
+	else if( internal_logical_volume->pinned_cache == NULL )
+	{
+		if( libfvde_internal_logical_volume_create_pinned_cache(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create pinned cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libfvde_block_cache_remove_stale_blocks(
+		     internal_logical_volume->pinned_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove stale blocks from pinned cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( number_of_blocks > (size64_t) internal_logical_volume->pinned_cache->maximum_number_of_entries )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid range - exceeds maximum pinned size.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		blocks_data = (uint8_t **) memory_allocate(
+		                            sizeof( uint8_t * ) * (size_t) number_of_blocks );
+
+		if( blocks_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create blocks data.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The range is either pinned as a whole or not at all, hence all its blocks
+	 * are reserved while holding the lock
+	 */
+	if( result == 1 )
+	{
+		result = libfvde_block_cache_reserve_range(
+		          internal_logical_volume->pinned_cache,
+		          first_block_offset,
+		          (int) number_of_blocks,
+		          blocks_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reserve range in pinned cache.",
+			 function );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid range - exceeds maximum pinned size.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+		          internal_logical_volume,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update pinned cache memory usage.",
+			 function );
+
+			libfvde_internal_logical_volume_unreserve_pinned_blocks(
+			 internal_logical_volume,
+			 first_block_offset,
+			 blocks_data,
+			 (int) number_of_blocks,
+			 0,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result != 1 )
+	{
+		if( blocks_data != NULL )
+		{
+			memory_free(
+			 blocks_data );
+		}
+		return( -1 );
+	}
+	block_offset = first_block_offset;
+
+	for( block_index = 0;
+	     block_index < (int) number_of_blocks;
+	     block_index++ )
+	{
+		/* A block that was already pinned is not read again
+		 */
+		if( blocks_data[ block_index ] != NULL )
+		{
+			read_size = LIBFVDE_PINNED_BLOCK_SIZE;
+
+			if( (size64_t) read_size > ( volume_size - block_offset ) )
+			{
+				read_size = (size_t) ( volume_size - block_offset );
+			}
+			/* The block data is not used by other functions while the block is being filled
+			 * and the read request is submitted without holding the lock
+			 */
+			if( libfvde_logical_volume_submit_read_buffer_at_offset(
+			     logical_volume,
+			     blocks_data[ block_index ],
+			     read_size,
+			     block_offset,
+			     NULL,
+			     NULL,
+			     &read_request,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to submit read request of pinned cache block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				goto on_error;
+			}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_grab_for_write(
+			     internal_logical_volume->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			result = libfvde_block_cache_set_read_request(
+			          internal_logical_volume->pinned_cache,
+			          block_offset,
+			          read_request,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set read request of pinned cache block at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 block_offset,
+				 block_offset );
+
+				result = -1;
+			}
+			else
+			{
+				/* The read request is now managed by the pinned cache
+				 */
+				read_request = NULL;
+			}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+			if( libcthreads_read_write_lock_release_for_write(
+			     internal_logical_volume->read_write_lock,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release read/write lock for writing.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+		}
+		block_offset += LIBFVDE_PINNED_BLOCK_SIZE;
+	}
+	memory_free(
+	 blocks_data );
+
+	return( 1 );
+
+on_error:
+	/* A read request that is not managed by the pinned cache is waited for
+	 * without holding the lock, before its block is removed
+	 */
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	if( blocks_data != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_logical_volume->read_write_lock,
+		     NULL ) == 1 )
+		{
+#endif
+			libfvde_internal_logical_volume_unreserve_pinned_blocks(
+			 internal_logical_volume,
+			 first_block_offset,
+			 blocks_data,
+			 (int) number_of_blocks,
+			 block_index,
+			 NULL );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+			libcthreads_read_write_lock_release_for_write(
+			 internal_logical_volume->read_write_lock,
+			 NULL );
+		}
+#endif
+		memory_free(
+		 blocks_data );
+	}
+	return( -1 );
+}
+
+/* Unpins a range of the logical volume
+ * The blocks that contain the range are released from the pinned cache,
+ * where blocks that are still being read are released once their read completes
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_unpin_range(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_unpin_range";
+	off64_t first_block_offset                                 = 0;
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) ( INT64_MAX - offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	first_block_offset = offset - ( offset % LIBFVDE_PINNED_BLOCK_SIZE );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_logical_volume->pinned_cache != NULL )
+	{
+		if( libfvde_block_cache_release_range(
+		     internal_logical_volume->pinned_cache,
+		     first_block_offset,
+		     (size64_t) ( offset - first_block_offset ) + size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to release range from pinned cache.",
+			 function );
+
+			result = -1;
+		}
+		else if( libfvde_block_cache_remove_stale_blocks(
+		          internal_logical_volume->pinned_cache,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove stale blocks from pinned cache.",
+			 function );
+
+			result = -1;
+		}
+		if( libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update pinned cache memory usage.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Seeks a certain offset of the data
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfvde_internal_logical_volume_seek_offset(
+         libfvde_logical_volume_handle_t *logical_volume_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_internal_logical_volume_seek_offset";
+
+	if( logical_volume_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing internal logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_logical_volume->is_locked != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - volume is locked.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{	
+		offset += logical_volume_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{	
+		offset += (off64_t) internal_logical_volume->logical_volume_descriptor->size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: seeking media data offset: %" PRIi64 ".\n",
+		 function,
+		 offset );
+	}
+#endif
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Seeks a certain offset of the data
+ * Returns the offset if seek is successful or -1 on error
+ */
+off64_t libfvde_logical_volume_seek_offset(
+         libfvde_logical_volume_t *logical_volume,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_seek_offset";
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	offset = libfvde_internal_logical_volume_seek_offset(
+	          logical_volume_handle,
+	          offset,
+	          whence,
+	          error );
+
+	if( offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset.",
+		 function );
+
+		offset = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( offset );
+}
+
+/* Retrieves the current offset of the data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_get_offset(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_offset";
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*offset = logical_volume_handle->current_offset;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the logical volume identifier
+ * The identifier is a UUID and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_logical_volume_get_identifier(
+     libfvde_logical_volume_t *logical_volume,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_identifier";
+	int result                                                 = 1;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfvde_logical_volume_descriptor_get_identifier(
+	     internal_logical_volume->logical_volume_descriptor,
+	     uuid_data,
+	     uuid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve logical volume identifier from descriptor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfvde_logical_volume_get_utf8_name_size(
+     libfvde_logical_volume_t *logical_volume,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_utf8_name_size";
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_logical_volume_descriptor_get_utf8_name_size(
+	          internal_logical_volume->logical_volume_descriptor,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of UTF-8 volume group name from descriptor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfvde_logical_volume_get_utf8_name(
+     libfvde_logical_volume_t *logical_volume,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_utf8_name";
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-	if( offset < 0 )
+	result = libfvde_logical_volume_descriptor_get_utf8_name(
+	          internal_logical_volume->logical_volume_descriptor,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid offset value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 volume group name from descriptor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	internal_logical_volume->current_offset = offset;
+#endif
+	return( result );
+}
 
-	return( offset );
+/* Retrieves the size of the UTF-16 encoded name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfvde_logical_volume_get_utf16_name_size(
+     libfvde_logical_volume_t *logical_volume,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_utf16_name_size";
+	int result                                                 = 0;
+
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_logical_volume_descriptor_get_utf16_name_size(
+	          internal_logical_volume->logical_volume_descriptor,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of UTF-16 volume group name from descriptor.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_logical_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
 }
 
-/* Seeks a certain offset of the data
- * Returns the offset if seek is successful or -1 on error
+/* Retrieves the UTF-16 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-off64_t libfvde_logical_volume_seek_offset(
-         libfvde_logical_volume_t *logical_volume,
-         off64_t offset,
-         int whence,
-         libcerror_error_t **error )
+int libfvde_logical_volume_get_utf16_name(
+     libfvde_logical_volume_t *logical_volume,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_seek_offset";
+	static char *function                                      = "libfvde_logical_volume_get_utf16_name";
+	int result                                                 = 0;
 
 	if( logical_volume == NULL )
 	{
@@ -1946,7 +7545,8 @@ off64_t libfvde_logical_volume_seek_offset(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -1963,22 +7563,22 @@ off64_t libfvde_logical_volume_seek_offset(
 		return( -1 );
 	}
 #endif
-	offset = libfvde_internal_logical_volume_seek_offset(
-	          internal_logical_volume,
-	          offset,
-	          whence,
+	result = libfvde_logical_volume_descriptor_get_utf16_name(
+	          internal_logical_volume->logical_volume_descriptor,
+	          utf16_string,
+	          utf16_string_size,
 	          error );
 
-	if( offset == -1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 volume group name from descriptor.",
 		 function );
 
-		offset = -1;
+		result = -1;
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -1995,19 +7595,20 @@ off64_t libfvde_logical_volume_seek_offset(
 		return( -1 );
 	}
 #endif
-	return( offset );
+	return( result );
 }
 
-/* Retrieves the current offset of the data
+/* Retrieves the volume size
  * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_get_offset(
+int libfvde_logical_volume_get_size(
      libfvde_logical_volume_t *logical_volume,
-     off64_t *offset,
+     size64_t *size,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_offset";
+	static char *function                                      = "libfvde_logical_volume_get_size";
 
 	if( logical_volume == NULL )
 	{
@@ -2020,19 +7621,20 @@ int libfvde_logical_volume_get_offset(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
-
-	if( offset == NULL )
+	if( size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid offset.",
+		 "%s: invalid size.",
 		 function );
 
 		return( -1 );
 	}
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -2048,7 +7650,7 @@ int libfvde_logical_volume_get_offset(
 		return( -1 );
 	}
 #endif
-	*offset = internal_logical_volume->current_offset;
+	*size = internal_logical_volume->volume_size;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -2068,19 +7670,17 @@ int libfvde_logical_volume_get_offset(
 	return( 1 );
 }
 
-/* Retrieves the logical volume identifier
- * The identifier is a UUID and is 16 bytes of size
- * Returns 1 if successful or -1 on error
+/* Determines if the logical volume is locked
+ * Returns 1 if locked, 0 if not or -1 on error
  */
-int libfvde_logical_volume_get_identifier(
+int libfvde_logical_volume_is_locked(
      libfvde_logical_volume_t *logical_volume,
-     uint8_t *uuid_data,
-     size_t uuid_data_size,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_identifier";
-	int result                                                 = 1;
+	static char *function                                      = "libfvde_logical_volume_is_locked";
+	uint8_t is_locked                                          = 0;
 
 	if( logical_volume == NULL )
 	{
@@ -2093,7 +7693,8 @@ int libfvde_logical_volume_get_identifier(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
@@ -2110,21 +7711,8 @@ int libfvde_logical_volume_get_identifier(
 		return( -1 );
 	}
 #endif
-	if( libfvde_logical_volume_descriptor_get_identifier(
-	     internal_logical_volume->logical_volume_descriptor,
-	     uuid_data,
-	     uuid_data_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume identifier from descriptor.",
-		 function );
+	is_locked = internal_logical_volume->is_locked;
 
-		result = -1;
-	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -2140,21 +7728,24 @@ int libfvde_logical_volume_get_identifier(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( is_locked );
 }
 
-/* Retrieves the size of the UTF-8 encoded name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the read error tolerance
+ * If read errors are tolerated, a failed read is retried at progressively smaller granularity
+ * and data that cannot be read is filled with the fill byte and recorded as a read error
+ * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_get_utf8_name_size(
+int libfvde_logical_volume_set_read_error_tolerance(
      libfvde_logical_volume_t *logical_volume,
-     size_t *utf8_string_size,
+     uint8_t tolerate_read_errors,
+     uint8_t fill_byte,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_utf8_name_size";
-	int result                                                 = 0;
+	static char *function                                      = "libfvde_logical_volume_set_read_error_tolerance";
+	int result                                                 = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -2167,8 +7758,24 @@ int libfvde_logical_volume_get_utf8_name_size(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
 
+		return( -1 );
+	}
+	if( tolerate_read_errors != 0 )
+	{
+		tolerate_read_errors = 1;
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_logical_volume->read_write_lock,
@@ -2184,21 +7791,29 @@ int libfvde_logical_volume_get_utf8_name_size(
 		return( -1 );
 	}
 #endif
-	result = libfvde_logical_volume_descriptor_get_utf8_name_size(
-	          internal_logical_volume->logical_volume_descriptor,
-	          utf8_string_size,
-	          error );
-
-	if( result == -1 )
+	if( ( internal_logical_volume->volume_data_handle->tolerate_read_errors != tolerate_read_errors )
+	 || ( internal_logical_volume->volume_data_handle->read_error_fill_byte != fill_byte ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of UTF-8 volume group name from descriptor.",
-		 function );
+		/* Make sure sectors read with the previous settings are not reused
+		 */
+		if( libfvde_internal_logical_volume_empty_sectors_cache(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty sectors cache.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
+		if( result == 1 )
+		{
+			internal_logical_volume->volume_data_handle->tolerate_read_errors = tolerate_read_errors;
+			internal_logical_volume->volume_data_handle->read_error_fill_byte = fill_byte;
+		}
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -2216,21 +7831,20 @@ int libfvde_logical_volume_get_utf8_name_size(
 	}
 #endif
 	return( result );
-}
-
-/* Retrieves the UTF-8 encoded name
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+}
+
+/* Retrieves the number of read errors
+ * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_get_utf8_name(
+int libfvde_logical_volume_get_number_of_read_errors(
      libfvde_logical_volume_t *logical_volume,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     int *number_of_read_errors,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_utf8_name";
-	int result                                                 = 0;
+	static char *function                                      = "libfvde_logical_volume_get_number_of_read_errors";
+	int result                                                 = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -2243,10 +7857,22 @@ int libfvde_logical_volume_get_utf8_name(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2254,31 +7880,28 @@ int libfvde_logical_volume_get_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfvde_logical_volume_descriptor_get_utf8_name(
-	          internal_logical_volume->logical_volume_descriptor,
-	          utf8_string,
-	          utf8_string_size,
-	          error );
-
-	if( result == -1 )
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_logical_volume->volume_data_handle->read_errors,
+	     number_of_read_errors,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 volume group name from descriptor.",
+		 "%s: unable to retrieve number of read errors.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2286,7 +7909,7 @@ int libfvde_logical_volume_get_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2295,18 +7918,24 @@ int libfvde_logical_volume_get_utf8_name(
 	return( result );
 }
 
-/* Retrieves the size of the UTF-16 encoded name
- * The returned size includes the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves a read error
+ * The offset and size are relative to the start of the logical volume
+ * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_get_utf16_name_size(
+int libfvde_logical_volume_get_read_error_by_index(
      libfvde_logical_volume_t *logical_volume,
-     size_t *utf16_string_size,
+     int read_error_index,
+     off64_t *offset,
+     size64_t *size,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_utf16_name_size";
-	int result                                                 = 0;
+	static char *function                                      = "libfvde_logical_volume_get_read_error_by_index";
+	intptr_t *range_value                                      = NULL;
+	uint64_t range_size                                        = 0;
+	uint64_t range_start                                       = 0;
+	int result                                                 = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -2319,10 +7948,44 @@ int libfvde_logical_volume_get_utf16_name_size(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->volume_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing volume data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2330,30 +7993,37 @@ int libfvde_logical_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfvde_logical_volume_descriptor_get_utf16_name_size(
-	          internal_logical_volume->logical_volume_descriptor,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+	if( libcdata_range_list_get_range_by_index(
+	     internal_logical_volume->volume_data_handle->read_errors,
+	     read_error_index,
+	     &range_start,
+	     &range_size,
+	     &range_value,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of UTF-16 volume group name from descriptor.",
-		 function );
+		 "%s: unable to retrieve read error: %d.",
+		 function,
+		 read_error_index );
 
 		result = -1;
 	}
+	else
+	{
+		*offset = (off64_t) range_start;
+		*size   = (size64_t) range_size;
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2361,7 +8031,7 @@ int libfvde_logical_volume_get_utf16_name_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2370,19 +8040,20 @@ int libfvde_logical_volume_get_utf16_name_size(
 	return( result );
 }
 
-/* Retrieves the UTF-16 encoded name
- * The size should include the end of string character
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the number of extents
+ * An extent is a range of the logical volume that is mapped onto a physical volume,
+ * ranges that are not mapped are sparse and are not returned as an extent
+ * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_get_utf16_name(
+int libfvde_logical_volume_get_number_of_extents(
      libfvde_logical_volume_t *logical_volume,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     int *number_of_extents,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_utf16_name";
-	int result                                                 = 0;
+	static char *function                                      = "libfvde_logical_volume_get_number_of_extents";
+	int result                                                 = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -2395,10 +8066,33 @@ int libfvde_logical_volume_get_utf16_name(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_extents == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of extents.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2406,31 +8100,28 @@ int libfvde_logical_volume_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libfvde_logical_volume_descriptor_get_utf16_name(
-	          internal_logical_volume->logical_volume_descriptor,
-	          utf16_string,
-	          utf16_string_size,
-	          error );
-
-	if( result == -1 )
+	if( libfvde_logical_volume_descriptor_get_number_of_segment_descriptors(
+	     internal_logical_volume->logical_volume_descriptor,
+	     number_of_extents,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 volume group name from descriptor.",
+		 "%s: unable to retrieve number of segment descriptors.",
 		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2438,7 +8129,7 @@ int libfvde_logical_volume_get_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2447,16 +8138,28 @@ int libfvde_logical_volume_get_utf16_name(
 	return( result );
 }
 
-/* Retrieves the volume size
+/* Retrieves a specific extent
+ * The extents are sorted by logical offset and do not overlap. The extent offset
+ * is relative to the start of the logical volume and the physical volume offset
+ * relative to the start of the physical volume
  * Returns 1 if successful or -1 on error
  */
-int libfvde_logical_volume_get_size(
+int libfvde_logical_volume_get_extent_by_index(
      libfvde_logical_volume_t *logical_volume,
-     size64_t *size,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_get_size";
+	libfvde_segment_descriptor_t *segment_descriptor           = NULL;
+	static char *function                                      = "libfvde_logical_volume_get_extent_by_index";
+	uint64_t physical_block_number                             = 0;
+	uint32_t block_size                                        = 0;
+	int result                                                 = 1;
 
 	if( logical_volume == NULL )
 	{
@@ -2469,78 +8172,75 @@ int libfvde_logical_volume_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
+
+	if( internal_logical_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
-
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_logical_volume->logical_volume_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid logical volume - missing logical volume descriptor.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*size = internal_logical_volume->volume_size;
-
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_logical_volume->read_write_lock,
-	     error ) != 1 )
+	if( extent_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent offset.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Determines if the logical volume is locked
- * Returns 1 if locked, 0 if not or -1 on error
- */
-int libfvde_logical_volume_is_locked(
-     libfvde_logical_volume_t *logical_volume,
-     libcerror_error_t **error )
-{
-	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
-	static char *function                                      = "libfvde_logical_volume_is_locked";
-	uint8_t is_locked                                          = 0;
+	if( extent_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent size.",
+		 function );
 
-	if( logical_volume == NULL )
+		return( -1 );
+	}
+	if( physical_volume_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid logical volume.",
+		 "%s: invalid physical volume index.",
 		 function );
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	if( physical_volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical volume offset.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -2556,8 +8256,63 @@ int libfvde_logical_volume_is_locked(
 		return( -1 );
 	}
 #endif
-	is_locked = internal_logical_volume->is_locked;
+	if( libfvde_logical_volume_descriptor_get_segment_descriptor_by_index(
+	     internal_logical_volume->logical_volume_descriptor,
+	     extent_index,
+	     &segment_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve segment descriptor: %d.",
+		 function,
+		 extent_index );
+
+		result = -1;
+	}
+	else if( segment_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing segment descriptor: %d.",
+		 function,
+		 extent_index );
+
+		result = -1;
+	}
+	else
+	{
+		block_size            = internal_logical_volume->io_handle->block_size;
+		physical_block_number = internal_logical_volume->logical_volume_descriptor->base_physical_block_number
+		                      + segment_descriptor->physical_block_number;
+
+		if( ( block_size == 0 )
+		 || ( segment_descriptor->logical_block_number > ( (uint64_t) INT64_MAX / block_size ) )
+		 || ( segment_descriptor->number_of_blocks > ( (uint64_t) INT64_MAX / block_size ) )
+		 || ( physical_block_number > ( (uint64_t) INT64_MAX / block_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid segment descriptor: %d value out of bounds.",
+			 function,
+			 extent_index );
 
+			result = -1;
+		}
+		else
+		{
+			*extent_offset          = (off64_t) ( segment_descriptor->logical_block_number * block_size );
+			*extent_size            = (size64_t) ( segment_descriptor->number_of_blocks * block_size );
+			*physical_volume_index  = (int) segment_descriptor->physical_volume_index;
+			*physical_volume_offset = (off64_t) ( physical_block_number * block_size );
+		}
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_logical_volume->read_write_lock,
@@ -2573,7 +8328,7 @@ int libfvde_logical_volume_is_locked(
 		return( -1 );
 	}
 #endif
-	return( is_locked );
+	return( result );
 }
 
 /* Sets the key
@@ -2586,6 +8341,7 @@ int libfvde_logical_volume_set_key(
      size_t volume_master_key_size,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_set_key";
 	int result                                                 = 1;
@@ -2601,7 +8357,8 @@ int libfvde_logical_volume_set_key(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 	if( internal_logical_volume->keyring == NULL )
 	{
@@ -2697,6 +8454,7 @@ int libfvde_logical_volume_set_utf8_password(
      size_t utf8_string_length,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_set_utf8_password";
 	int result                                                 = 1;
@@ -2712,7 +8470,8 @@ int libfvde_logical_volume_set_utf8_password(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -2807,6 +8566,7 @@ int libfvde_logical_volume_set_utf16_password(
      size_t utf16_string_length,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_set_utf16_password";
 	int result                                                 = 1;
@@ -2822,7 +8582,8 @@ int libfvde_logical_volume_set_utf16_password(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -2917,6 +8678,7 @@ int libfvde_logical_volume_set_utf8_recovery_password(
      size_t utf8_string_length,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_set_utf8_recovery_password";
 	int result                                                 = 1;
@@ -2932,7 +8694,8 @@ int libfvde_logical_volume_set_utf8_recovery_password(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -3027,6 +8790,7 @@ int libfvde_logical_volume_set_utf16_recovery_password(
      size_t utf16_string_length,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_set_utf16_recovery_password";
 	int result                                                 = 1;
@@ -3042,7 +8806,8 @@ int libfvde_logical_volume_set_utf16_recovery_password(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
@@ -3136,6 +8901,7 @@ int libfvde_logical_volume_get_logical_volume_descriptor(
      libfvde_logical_volume_descriptor_t **logical_volume_descriptor,
      libcerror_error_t **error )
 {
+	libfvde_logical_volume_handle_t *logical_volume_handle     = NULL;
 	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
 	static char *function                                      = "libfvde_logical_volume_get_logical_volume_descriptor";
 
@@ -3150,7 +8916,8 @@ int libfvde_logical_volume_get_logical_volume_descriptor(
 
 		return( -1 );
 	}
-	internal_logical_volume = (libfvde_internal_logical_volume_t *) logical_volume;
+	logical_volume_handle   = (libfvde_logical_volume_handle_t *) logical_volume;
+	internal_logical_volume = logical_volume_handle->internal_logical_volume;
 
 	if( logical_volume_descriptor == NULL )
 	{
@@ -26,8 +26,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfvde_access_trace.h"
+#include "libfvde_block_cache.h"
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_executor.h"
 #include "libfvde_extern.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_keyring.h"
@@ -37,6 +40,8 @@
 #include "libfvde_libfcache.h"
 #include "libfvde_libfdata.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_read_ahead.h"
+#include "libfvde_sector_data.h"
 #include "libfvde_types.h"
 #include "libfvde_volume_data_handle.h"
 
@@ -68,10 +73,6 @@ struct libfvde_internal_logical_volume
 	 */
 	libfvde_encryption_context_plist_t *encrypted_root_plist;
 
-	/* The current offset
-	 */
-	off64_t current_offset;
-
 	/* The volume size
 	 */
 	size64_t volume_size;
@@ -88,6 +89,42 @@ struct libfvde_internal_logical_volume
 	 */
 	libfcache_cache_t *sectors_cache;
 
+	/* The access trace that records the blocks that are read
+	 */
+	libfvde_access_trace_t *access_trace;
+
+	/* The warm cache that is filled by replaying an access trace
+	 */
+	libfvde_block_cache_t *warm_cache;
+
+	/* The pinned cache that holds the blocks of the pinned ranges
+	 */
+	libfvde_block_cache_t *pinned_cache;
+
+	/* The maximum size of the data held by the pinned cache
+	 */
+	size64_t maximum_pinned_size;
+
+	/* The memory size accounted for the sectors vector
+	 */
+	size64_t sectors_vector_memory_size;
+
+	/* The memory size accounted for the sectors cache
+	 */
+	size64_t sectors_cache_memory_size;
+
+	/* The memory size accounted for the warm cache
+	 */
+	size64_t warm_cache_memory_size;
+
+	/* The memory size accounted for the pinned cache
+	 */
+	size64_t pinned_cache_memory_size;
+
+	/* The compaction generation of the memory budget that was last handled
+	 */
+	uint32_t compaction_generation;
+
 	/* Value to indicate if the logical volume is locked
 	 */
 	uint8_t is_locked;
@@ -116,15 +153,62 @@ struct libfvde_internal_logical_volume
 	 */
 	size_t recovery_password_size;
 
+	/* The number of references to the logical volume
+	 */
+	int reference_count;
+
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The thread pool that handles the asynchronous read requests
+	 */
+	libcthreads_thread_pool_t *read_thread_pool;
+
+	/* The executor that handles the asynchronous read requests
+	 * This is used instead of the read thread pool if the volume has an executor
+	 */
+	libfvde_executor_t *read_executor;
+
+	/* The task group of the asynchronous read requests submitted to the executor
+	 */
+	libfvde_executor_task_group_t *read_task_group;
 #endif
 };
 
-int libfvde_logical_volume_initialize(
-     libfvde_logical_volume_t **logical_volume,
+typedef struct libfvde_logical_volume_handle libfvde_logical_volume_handle_t;
+
+struct libfvde_logical_volume_handle
+{
+	/* The internal logical volume
+	 * Contains the state that is shared by all handles of the logical volume
+	 */
+	libfvde_internal_logical_volume_t *internal_logical_volume;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The access advice
+	 */
+	int access_advice;
+
+	/* The read-ahead
+	 */
+	libfvde_read_ahead_t *read_ahead;
+
+	/* The memory size accounted for the read-ahead
+	 */
+	size64_t read_ahead_memory_size;
+
+	/* The compaction generation of the memory budget that was last handled
+	 */
+	uint32_t compaction_generation;
+};
+
+int libfvde_internal_logical_volume_initialize(
+     libfvde_internal_logical_volume_t **internal_logical_volume,
      libfvde_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
      libfvde_logical_volume_descriptor_t *logical_volume_descriptor,
@@ -132,11 +216,24 @@ int libfvde_logical_volume_initialize(
      libfvde_encryption_context_plist_t *encrypted_root_plist,
      libcerror_error_t **error );
 
+int libfvde_internal_logical_volume_free(
+     libfvde_internal_logical_volume_t **internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_logical_volume_initialize(
+     libfvde_logical_volume_t **logical_volume,
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 int libfvde_logical_volume_free(
      libfvde_logical_volume_t **logical_volume,
      libcerror_error_t **error );
 
+int libfvde_internal_logical_volume_add_reference(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
 int libfvde_internal_logical_volume_open_read(
      libfvde_internal_logical_volume_t *internal_logical_volume,
      libbfio_pool_t *file_io_pool,
@@ -174,7 +271,7 @@ int libfvde_logical_volume_unlock(
      libcerror_error_t **error );
 
 ssize_t libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-         libfvde_internal_logical_volume_t *internal_logical_volume,
+         libfvde_logical_volume_handle_t *logical_volume_handle,
          libbfio_pool_t *file_io_pool,
          void *buffer,
          size_t buffer_size,
@@ -195,8 +292,196 @@ ssize_t libfvde_logical_volume_read_buffer_at_offset(
          off64_t offset,
          libcerror_error_t **error );
 
-off64_t libfvde_internal_logical_volume_seek_offset(
+int libfvde_internal_logical_volume_get_block_reference(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t offset,
+     libfvde_block_reference_t **block_reference,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_block_reference(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     libfvde_block_reference_t **block_reference,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_release_sector_data(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libfvde_sector_data_t **sector_data,
+     libcerror_error_t **error );
+
+ssize_t libfvde_internal_logical_volume_read_buffer_at_offset_unbuffered(
          libfvde_internal_logical_volume_t *internal_logical_volume,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+ssize_t libfvde_internal_logical_volume_read_request_buffer(
+         libfvde_internal_logical_volume_t *internal_logical_volume,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_internal_logical_volume_create_read_thread_pool(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_read_request_callback(
+     libfvde_read_request_t *read_request,
+     libfvde_internal_logical_volume_t *internal_logical_volume );
+
+int libfvde_internal_logical_volume_push_read_request(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_submit_read_buffer_at_offset(
+     libfvde_logical_volume_t *logical_volume,
+     void *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            libfvde_read_request_t *read_request,
+            intptr_t *callback_data ),
+     intptr_t *callback_data,
+     libfvde_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_fill_read_ahead(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     off64_t offset,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+
+int libfvde_internal_logical_volume_prefetch(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT ) */
+
+int libfvde_internal_logical_volume_set_accounted_memory_size(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     int usage_type,
+     size64_t *accounted_size,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_empty_sectors_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_create_read_ahead(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_free_read_ahead(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_create_warm_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_free_warm_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_create_pinned_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_free_pinned_cache(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_update_pinned_cache_memory_size(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_unreserve_pinned_blocks(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     off64_t first_block_offset,
+     uint8_t **blocks_data,
+     int number_of_blocks,
+     int first_unsubmitted_block_index,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_compact(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_compact_handle(
+     libfvde_logical_volume_handle_t *logical_volume_handle,
+     libcerror_error_t **error );
+
+int libfvde_internal_logical_volume_compact_on_request(
+     libfvde_internal_logical_volume_t *internal_logical_volume,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_advise(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     size64_t size,
+     int advice,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_start_access_trace(
+     libfvde_logical_volume_t *logical_volume,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_access_trace_size(
+     libfvde_logical_volume_t *logical_volume,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_copy_access_trace(
+     libfvde_logical_volume_t *logical_volume,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_replay_access_trace(
+     libfvde_logical_volume_t *logical_volume,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_set_maximum_pinned_size(
+     libfvde_logical_volume_t *logical_volume,
+     size64_t maximum_pinned_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_pin_range(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_unpin_range(
+     libfvde_logical_volume_t *logical_volume,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+off64_t libfvde_internal_logical_volume_seek_offset(
+         libfvde_logical_volume_handle_t *logical_volume_handle,
          off64_t offset,
          int whence,
          libcerror_error_t **error );
@@ -258,6 +543,43 @@ int libfvde_logical_volume_is_locked(
      libfvde_logical_volume_t *logical_volume,
      libcerror_error_t **error );
 
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_set_read_error_tolerance(
+     libfvde_logical_volume_t *logical_volume,
+     uint8_t tolerate_read_errors,
+     uint8_t fill_byte,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_number_of_read_errors(
+     libfvde_logical_volume_t *logical_volume,
+     int *number_of_read_errors,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_read_error_by_index(
+     libfvde_logical_volume_t *logical_volume,
+     int read_error_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_number_of_extents(
+     libfvde_logical_volume_t *logical_volume,
+     int *number_of_extents,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_logical_volume_get_extent_by_index(
+     libfvde_logical_volume_t *logical_volume,
+     int extent_index,
+     off64_t *extent_offset,
+     size64_t *extent_size,
+     int *physical_volume_index,
+     off64_t *physical_volume_offset,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 int libfvde_logical_volume_set_key(
      libfvde_logical_volume_t *logical_volume,
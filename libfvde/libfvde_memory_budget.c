@@ -0,0 +1,1380 @@
+/*
+ * Memory budget functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_libcdata.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_memory_budget.h"
+#include "libfvde_memory_usage.h"
+#include "libfvde_types.h"
+
+/* Creates a memory budget
+ * Make sure the value memory_budget is referencing, is set to NULL
+ * A maximum size of 0 represents a memory budget that is not bounded
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_initialize(
+     libfvde_memory_budget_t **memory_budget,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_initialize";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_budget != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory budget value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = memory_allocate_structure(
+	                          libfvde_internal_memory_budget_t );
+
+	if( internal_memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory budget.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_memory_budget,
+	     0,
+	     sizeof( libfvde_internal_memory_budget_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory budget.",
+		 function );
+
+		memory_free(
+		 internal_memory_budget );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_memory_budget->memory_usages_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory usages array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_memory_budget->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_memory_budget->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_memory_budget->maximum_size = maximum_size;
+
+	*memory_budget = (libfvde_memory_budget_t *) internal_memory_budget;
+
+	return( 1 );
+
+on_error:
+	if( internal_memory_budget != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( internal_memory_budget->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_memory_budget->mutex ),
+			 NULL );
+		}
+#endif
+		if( internal_memory_budget->memory_usages_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_memory_budget->memory_usages_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_memory_budget );
+	}
+	return( -1 );
+}
+
+/* Frees a memory budget
+ * The memory budget cannot be freed while it is used by volumes
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_free(
+     libfvde_memory_budget_t **memory_budget,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_free";
+	int result                                               = 1;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_budget != NULL )
+	{
+		internal_memory_budget = (libfvde_internal_memory_budget_t *) *memory_budget;
+
+		if( internal_memory_budget->number_of_volumes != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid memory budget - still used by: %d volumes.",
+			 function,
+			 internal_memory_budget->number_of_volumes );
+
+			return( -1 );
+		}
+		*memory_budget = NULL;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_memory_budget->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_memory_budget->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The memory usages are not owned by the memory budget
+		 */
+		if( libcdata_array_free(
+		     &( internal_memory_budget->memory_usages_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory usages array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_memory_budget );
+	}
+	return( result );
+}
+
+/* Retrieves the maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_get_maximum_size(
+     libfvde_memory_budget_t *memory_budget,
+     size64_t *maximum_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_get_maximum_size";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_size = internal_memory_budget->maximum_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum size
+ * A maximum size of 0 represents a memory budget that is not bounded
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_set_maximum_size(
+     libfvde_memory_budget_t *memory_budget,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_set_maximum_size";
+	int type_index                                           = 0;
+	size64_t used_size                                       = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_memory_budget->maximum_size = maximum_size;
+
+	for( type_index = 0;
+	     type_index < LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES;
+	     type_index++ )
+	{
+		used_size += internal_memory_budget->used_sizes[ type_index ];
+	}
+	/* Lowering the maximum size below the used size requests compaction
+	 */
+	if( ( maximum_size != 0 )
+	 && ( used_size > maximum_size ) )
+	{
+		internal_memory_budget->compaction_generation += 1;
+	}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the used size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_get_used_size(
+     libfvde_memory_budget_t *memory_budget,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_get_used_size";
+	int type_index                                           = 0;
+	size64_t safe_used_size                                  = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( type_index = 0;
+	     type_index < LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES;
+	     type_index++ )
+	{
+		safe_used_size += internal_memory_budget->used_sizes[ type_index ];
+	}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*used_size = safe_used_size;
+
+	return( 1 );
+}
+
+/* Retrieves the used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_get_used_size_by_type(
+     libfvde_memory_budget_t *memory_budget,
+     int usage_type,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_get_used_size_by_type";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*used_size = internal_memory_budget->used_sizes[ usage_type - 1 ];
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of volumes that use the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_get_number_of_volumes(
+     libfvde_memory_budget_t *memory_budget,
+     int *number_of_volumes,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_get_number_of_volumes";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( number_of_volumes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of volumes.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_volumes = internal_memory_budget->number_of_volumes;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Requests the volumes that use the memory budget to release reconstructible data
+ * The logical volumes of the volumes are compacted directly, so that logical volumes
+ * that are not being read release their shared data as well. The read-ahead of
+ * a logical volume is released on its next read
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_request_compaction(
+     libfvde_memory_budget_t *memory_budget,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	libfvde_memory_usage_t *memory_usage                     = NULL;
+	static char *function                                    = "libfvde_memory_budget_request_compaction";
+	int entry_index                                          = 0;
+	int number_of_memory_usages                              = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_memory_budget->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_memory_budget->compaction_generation += 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_memory_budget->memory_usages_array,
+	     &number_of_memory_usages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of memory usages.",
+		 function );
+
+		goto on_error;
+	}
+	/* The read/write lock prevents volumes from being detached, and subsequently freed,
+	 * while they are compacted
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_memory_usages;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_memory_budget->memory_usages_array,
+		     entry_index,
+		     (intptr_t **) &memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libfvde_memory_usage_compact(
+		     memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compact volume: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_memory_budget->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_memory_budget->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Attaches a volume to the memory budget
+ * The used size of the volume is added separately, which requests compaction when
+ * the maximum size is exceeded
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_attach_volume(
+     libfvde_memory_budget_t *memory_budget,
+     libfvde_memory_usage_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_attach_volume";
+	int entry_index                                          = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_memory_budget->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_append_entry(
+	     internal_memory_budget->memory_usages_array,
+	     &entry_index,
+	     (intptr_t *) memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append memory usage to array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_memory_budget->number_of_volumes += 1;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_memory_budget->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_memory_budget->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Detaches a volume from the memory budget
+ * Detaching waits for a compaction of the volume that is in progress
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_detach_volume(
+     libfvde_memory_budget_t *memory_budget,
+     libfvde_memory_usage_t *memory_usage,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	libfvde_memory_usage_t *attached_memory_usage            = NULL;
+	static char *function                                    = "libfvde_memory_budget_detach_volume";
+	int entry_index                                          = 0;
+	int number_of_memory_usages                              = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_memory_budget->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_memory_budget->memory_usages_array,
+	     &number_of_memory_usages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of memory usages.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_memory_usages;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_memory_budget->memory_usages_array,
+		     entry_index,
+		     (intptr_t **) &attached_memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( attached_memory_usage == memory_usage )
+		{
+			break;
+		}
+	}
+	if( entry_index >= number_of_memory_usages )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory usage - not attached to memory budget.",
+		 function );
+
+		goto on_error;
+	}
+	/* Move the last entry into the slot of the detached memory usage
+	 */
+	if( libcdata_array_get_entry_by_index(
+	     internal_memory_budget->memory_usages_array,
+	     number_of_memory_usages - 1,
+	     (intptr_t **) &attached_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory usage: %d.",
+		 function,
+		 number_of_memory_usages - 1 );
+
+		goto on_error;
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_memory_budget->memory_usages_array,
+	     entry_index,
+	     (intptr_t *) attached_memory_usage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory usage: %d.",
+		 function,
+		 entry_index );
+
+		goto on_error;
+	}
+	if( libcdata_array_resize(
+	     internal_memory_budget->memory_usages_array,
+	     number_of_memory_usages - 1,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize memory usages array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( internal_memory_budget->number_of_volumes > 0 )
+	{
+		internal_memory_budget->number_of_volumes -= 1;
+	}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_memory_budget->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_memory_budget->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Adds used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_add_used_size(
+     libfvde_memory_budget_t *memory_budget,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_add_used_size";
+	int type_index                                           = 0;
+	size64_t used_size                                       = 0;
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_memory_budget->used_sizes[ usage_type - 1 ] += size;
+
+	if( internal_memory_budget->maximum_size != 0 )
+	{
+		for( type_index = 0;
+		     type_index < LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES;
+		     type_index++ )
+		{
+			used_size += internal_memory_budget->used_sizes[ type_index ];
+		}
+		/* Compaction is requested for every addition while the used size
+		 * exceeds the maximum size, so that volumes that already compacted
+		 * release the data they cached since
+		 */
+		if( ( size > 0 )
+		 && ( used_size > internal_memory_budget->maximum_size ) )
+		{
+			internal_memory_budget->compaction_generation += 1;
+		}
+	}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Removes used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_remove_used_size(
+     libfvde_memory_budget_t *memory_budget,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_remove_used_size";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( size > internal_memory_budget->used_sizes[ usage_type - 1 ] )
+	{
+		internal_memory_budget->used_sizes[ usage_type - 1 ] = 0;
+	}
+	else
+	{
+		internal_memory_budget->used_sizes[ usage_type - 1 ] -= size;
+	}
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the compaction generation
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_budget_get_compaction_generation(
+     libfvde_memory_budget_t *memory_budget,
+     uint32_t *compaction_generation,
+     libcerror_error_t **error )
+{
+	libfvde_internal_memory_budget_t *internal_memory_budget = NULL;
+	static char *function                                    = "libfvde_memory_budget_get_compaction_generation";
+
+	if( memory_budget == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_budget = (libfvde_internal_memory_budget_t *) memory_budget;
+
+	if( compaction_generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compaction generation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*compaction_generation = internal_memory_budget->compaction_generation;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     internal_memory_budget->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,158 @@
+/*
+ * Memory budget functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_MEMORY_BUDGET_H )
+#define _LIBFVDE_MEMORY_BUDGET_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_extern.h"
+#include "libfvde_libcdata.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_memory_usage.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_internal_memory_budget libfvde_internal_memory_budget_t;
+
+struct libfvde_internal_memory_budget
+{
+	/* The maximum size or 0 if not bounded
+	 */
+	size64_t maximum_size;
+
+	/* The used size per memory usage type
+	 */
+	size64_t used_sizes[ LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ];
+
+	/* The number of volumes that use the memory budget
+	 */
+	int number_of_volumes;
+
+	/* The memory usages array
+	 * Contains the memory usages of the volumes that use the memory budget
+	 */
+	libcdata_array_t *memory_usages_array;
+
+	/* The compaction generation, which is increased every time used size
+	 * is added while the used size exceeds the maximum size or compaction is requested
+	 */
+	uint32_t compaction_generation;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The read/write lock
+	 * This protects the memory usages array and is held while the volumes are compacted
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_initialize(
+     libfvde_memory_budget_t **memory_budget,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_free(
+     libfvde_memory_budget_t **memory_budget,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_get_maximum_size(
+     libfvde_memory_budget_t *memory_budget,
+     size64_t *maximum_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_set_maximum_size(
+     libfvde_memory_budget_t *memory_budget,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_get_used_size(
+     libfvde_memory_budget_t *memory_budget,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_get_used_size_by_type(
+     libfvde_memory_budget_t *memory_budget,
+     int usage_type,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_get_number_of_volumes(
+     libfvde_memory_budget_t *memory_budget,
+     int *number_of_volumes,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_memory_budget_request_compaction(
+     libfvde_memory_budget_t *memory_budget,
+     libcerror_error_t **error );
+
+int libfvde_memory_budget_attach_volume(
+     libfvde_memory_budget_t *memory_budget,
+     libfvde_memory_usage_t *memory_usage,
+     libcerror_error_t **error );
+
+int libfvde_memory_budget_detach_volume(
+     libfvde_memory_budget_t *memory_budget,
+     libfvde_memory_usage_t *memory_usage,
+     libcerror_error_t **error );
+
+int libfvde_memory_budget_add_used_size(
+     libfvde_memory_budget_t *memory_budget,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_memory_budget_remove_used_size(
+     libfvde_memory_budget_t *memory_budget,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_memory_budget_get_compaction_generation(
+     libfvde_memory_budget_t *memory_budget,
+     uint32_t *compaction_generation,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_MEMORY_BUDGET_H ) */
+
@@ -0,0 +1,1047 @@
+/*
+ * Memory usage functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_memory_budget.h"
+#include "libfvde_memory_usage.h"
+#include "libfvde_types.h"
+
+/* Creates a memory usage
+ * Make sure the value memory_usage is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_initialize(
+     libfvde_memory_usage_t **memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_initialize";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_usage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory usage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_usage = memory_allocate_structure(
+	                 libfvde_memory_usage_t );
+
+	if( *memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory usage.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_usage,
+	     0,
+	     sizeof( libfvde_memory_usage_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory usage.",
+		 function );
+
+		memory_free(
+		 *memory_usage );
+
+		*memory_usage = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *memory_usage )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *memory_usage != NULL )
+	{
+		memory_free(
+		 *memory_usage );
+
+		*memory_usage = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory usage
+ * The used size is removed from the memory budget if set
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_free(
+     libfvde_memory_usage_t **memory_usage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_free";
+	int result            = 1;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_usage != NULL )
+	{
+		if( libfvde_memory_usage_set_memory_budget(
+		     *memory_usage,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to detach memory budget.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *memory_usage )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *memory_usage );
+
+		*memory_usage = NULL;
+	}
+	return( result );
+}
+
+/* Sets the memory budget
+ * The used size is moved from the previous to the new memory budget
+ * The memory budgets are attached and detached without holding the mutex,
+ * since the memory budget can compact the volume while it is attached
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_set_memory_budget(
+     libfvde_memory_usage_t *memory_usage,
+     libfvde_memory_budget_t *memory_budget,
+     libcerror_error_t **error )
+{
+	libfvde_memory_budget_t *previous_memory_budget = NULL;
+	static char *function                           = "libfvde_memory_usage_set_memory_budget";
+	int type_index                                  = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_budget != NULL )
+	{
+		if( libfvde_memory_budget_attach_volume(
+		     memory_budget,
+		     memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to attach volume to memory budget.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	previous_memory_budget = memory_usage->memory_budget;
+
+	for( type_index = 0;
+	     type_index < LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES;
+	     type_index++ )
+	{
+		if( previous_memory_budget != NULL )
+		{
+			if( libfvde_memory_budget_remove_used_size(
+			     previous_memory_budget,
+			     type_index + 1,
+			     memory_usage->used_sizes[ type_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove used size from memory budget.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( memory_budget != NULL )
+		{
+			if( libfvde_memory_budget_add_used_size(
+			     memory_budget,
+			     type_index + 1,
+			     memory_usage->used_sizes[ type_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add used size to memory budget.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	memory_usage->memory_budget = memory_budget;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( previous_memory_budget != NULL )
+	{
+		if( libfvde_memory_budget_detach_volume(
+		     previous_memory_budget,
+		     memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to detach volume from memory budget.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 memory_usage->mutex,
+	 NULL );
+#endif
+	if( ( memory_budget != NULL )
+	 && ( memory_usage->memory_budget != memory_budget ) )
+	{
+		libfvde_memory_budget_detach_volume(
+		 memory_budget,
+		 memory_usage,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Adds used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_add_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_add_used_size";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	memory_usage->used_sizes[ usage_type - 1 ] += size;
+
+	if( memory_usage->memory_budget != NULL )
+	{
+		if( libfvde_memory_budget_add_used_size(
+		     memory_usage->memory_budget,
+		     usage_type,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add used size to memory budget.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 memory_usage->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Removes used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_remove_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_remove_used_size";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( size > memory_usage->used_sizes[ usage_type - 1 ] )
+	{
+		size = memory_usage->used_sizes[ usage_type - 1 ];
+	}
+	memory_usage->used_sizes[ usage_type - 1 ] -= size;
+
+	if( memory_usage->memory_budget != NULL )
+	{
+		if( libfvde_memory_budget_remove_used_size(
+		     memory_usage->memory_budget,
+		     usage_type,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to remove used size from memory budget.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 memory_usage->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_set_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfvde_memory_usage_set_used_size";
+	size64_t previous_size = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	previous_size = memory_usage->used_sizes[ usage_type - 1 ];
+
+	memory_usage->used_sizes[ usage_type - 1 ] = size;
+
+	if( memory_usage->memory_budget != NULL )
+	{
+		if( size > previous_size )
+		{
+			if( libfvde_memory_budget_add_used_size(
+			     memory_usage->memory_budget,
+			     usage_type,
+			     size - previous_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to add used size to memory budget.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( size < previous_size )
+		{
+			if( libfvde_memory_budget_remove_used_size(
+			     memory_usage->memory_budget,
+			     usage_type,
+			     previous_size - size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to remove used size from memory budget.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 memory_usage->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the used size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_get_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfvde_memory_usage_get_used_size";
+	size64_t safe_used_size = 0;
+	int type_index          = 0;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( type_index = 0;
+	     type_index < LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES;
+	     type_index++ )
+	{
+		safe_used_size += memory_usage->used_sizes[ type_index ];
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*used_size = safe_used_size;
+
+	return( 1 );
+}
+
+/* Retrieves the used size of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_get_used_size_by_type(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_get_used_size_by_type";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( usage_type < LIBFVDE_MEMORY_USAGE_TYPE_METADATA )
+	 || ( usage_type > LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported usage type: %d.",
+		 function,
+		 usage_type );
+
+		return( -1 );
+	}
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*used_size = memory_usage->used_sizes[ usage_type - 1 ];
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the compaction generation of the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_get_compaction_generation(
+     libfvde_memory_usage_t *memory_usage,
+     uint32_t *compaction_generation,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_get_compaction_generation";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	if( compaction_generation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compaction generation.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_usage->memory_budget == NULL )
+	{
+		*compaction_generation = 0;
+	}
+	else
+	{
+		if( libfvde_memory_budget_get_compaction_generation(
+		     memory_usage->memory_budget,
+		     compaction_generation,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve compaction generation from memory budget.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_mutex_release(
+	 memory_usage->mutex,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Sets the compact function
+ * The compact function is called with the compact value when the memory budget requests compaction
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_set_compact_function(
+     libfvde_memory_usage_t *memory_usage,
+     intptr_t *compact_value,
+     int (*compact_function)(
+            intptr_t *compact_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_memory_usage_set_compact_function";
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	memory_usage->compact_value    = compact_value;
+	memory_usage->compact_function = compact_function;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Compacts the volume that uses the memory usage
+ * The compact function is called without holding the mutex, since compaction
+ * releases used size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_memory_usage_compact(
+     libfvde_memory_usage_t *memory_usage,
+     libcerror_error_t **error )
+{
+	intptr_t *compact_value = NULL;
+	static char *function   = "libfvde_memory_usage_compact";
+
+	int (*compact_function)(
+	       intptr_t *compact_value,
+	       libcerror_error_t **error ) = NULL;
+
+	if( memory_usage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory usage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	compact_value    = memory_usage->compact_value;
+	compact_function = memory_usage->compact_function;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_usage->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( compact_function != NULL )
+	{
+		if( compact_function(
+		     compact_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compact volume.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
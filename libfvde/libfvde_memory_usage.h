@@ -0,0 +1,132 @@
+/*
+ * Memory usage functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_MEMORY_USAGE_H )
+#define _LIBFVDE_MEMORY_USAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_memory_usage libfvde_memory_usage_t;
+
+struct libfvde_memory_usage
+{
+	/* The memory budget or NULL if not set
+	 */
+	libfvde_memory_budget_t *memory_budget;
+
+	/* The used size per memory usage type
+	 */
+	size64_t used_sizes[ LIBFVDE_MEMORY_USAGE_NUMBER_OF_TYPES ];
+
+	/* The compact value
+	 */
+	intptr_t *compact_value;
+
+	/* The compact function
+	 * This function is called when the memory budget requests compaction
+	 */
+	int (*compact_function)(
+	       intptr_t *compact_value,
+	       libcerror_error_t **error );
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libfvde_memory_usage_initialize(
+     libfvde_memory_usage_t **memory_usage,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_free(
+     libfvde_memory_usage_t **memory_usage,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_set_memory_budget(
+     libfvde_memory_usage_t *memory_usage,
+     libfvde_memory_budget_t *memory_budget,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_add_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_remove_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_set_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_get_used_size(
+     libfvde_memory_usage_t *memory_usage,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_get_used_size_by_type(
+     libfvde_memory_usage_t *memory_usage,
+     int usage_type,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_get_compaction_generation(
+     libfvde_memory_usage_t *memory_usage,
+     uint32_t *compaction_generation,
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_set_compact_function(
+     libfvde_memory_usage_t *memory_usage,
+     intptr_t *compact_value,
+     int (*compact_function)(
+            intptr_t *compact_value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libfvde_memory_usage_compact(
+     libfvde_memory_usage_t *memory_usage,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_MEMORY_USAGE_H ) */
+
@@ -27,16 +27,17 @@
 #include <types.h>
 
 #include "libfvde_checksum.h"
+#include "libfvde_definitions.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
 #include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
-#include "libfvde_libfplist.h"
 #include "libfvde_libuna.h"
 #include "libfvde_metadata.h"
 #include "libfvde_metadata_block.h"
 #include "libfvde_physical_volume_descriptor.h"
+#include "libfvde_plist_scanner.h"
 
 #include "fvde_metadata.h"
 
@@ -734,6 +735,7 @@ int libfvde_metadata_read_type_0x0011(
 }
 
 /* Reads the volume group (XML) plist
+ * The root dict is scanned in a single pass for the keys of interest without building a property list
  * Returns 1 if successful or -1 on error
  */
 int libfvde_metadata_read_volume_group_plist(
@@ -742,21 +744,25 @@ int libfvde_metadata_read_volume_group_plist(
      size_t xml_plist_data_size,
      libcerror_error_t **error )
 {
-	libfplist_property_t *array_entry_property                       = NULL;
-	libfplist_property_t *root_property                              = NULL;
-	libfplist_property_t *sub_property                               = NULL;
-	libfplist_property_list_t *property_list                         = NULL;
+	libfvde_plist_element_t array_entry_element;
+	libfvde_plist_element_t identifier_element;
+	libfvde_plist_element_t key_element;
+	libfvde_plist_element_t name_element;
+	libfvde_plist_element_t physical_volumes_element;
+	libfvde_plist_element_t root_element;
+	libfvde_plist_element_t value_element;
+
 	libfvde_physical_volume_descriptor_t *physical_volume_descriptor = NULL;
 	static char *function                                            = "libfvde_metadata_read_volume_group_plist";
+	size_t array_end_offset                                          = 0;
+	size_t data_offset                                               = 0;
 	size_t xml_length                                                = 0;
+	uint8_t found_identifier                                         = 0;
+	uint8_t found_name                                               = 0;
+	uint8_t found_physical_volumes                                   = 0;
 	int entry_index                                                  = 0;
-	int number_of_entries                                            = 0;
 	int physical_volume_descriptor_index                             = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *string                                                  = NULL;
-	size_t string_size                                               = 0;
-#endif
+	int result                                                       = 0;
 
 	if( metadata == NULL )
 	{
@@ -819,246 +825,272 @@ int libfvde_metadata_read_volume_group_plist(
 			 (char *) xml_plist_data );
 		}
 #endif
-/* TODO for now determine the XML string length */
-/* TODO refactor this to a separate function */
+		/* The XML data is stored as a string
+		 */
 		xml_length = strnlen(
 			      (char *) xml_plist_data,
 		              xml_plist_data_size );
 
-		if( libfplist_property_list_initialize(
-		     &property_list,
+		if( libfvde_plist_scanner_get_root_dict(
+		     xml_plist_data,
+		     xml_length,
+		     &root_element,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create property list.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root dict element.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_list_copy_from_byte_stream(
-		     property_list,
-		     xml_plist_data,
-		     xml_length + 1,
-		     error ) != 1 )
+		/* The root dict is scanned once for all the keys of interest
+		 */
+		data_offset = root_element.content_offset;
+
+		do
+		{
+			result = libfvde_plist_scanner_read_dict_entry(
+			          xml_plist_data,
+			          xml_length,
+			          &root_element,
+			          &data_offset,
+			          &key_element,
+			          &value_element,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read root dict entry.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( ( found_identifier == 0 )
+			 && ( libfvde_plist_scanner_compare_key(
+			       xml_plist_data,
+			       xml_length,
+			       &key_element,
+			       "com.apple.corestorage.lvg.uuid",
+			       30,
+			       NULL ) == 1 ) )
+			{
+				identifier_element = value_element;
+				found_identifier   = 1;
+			}
+			else if( ( found_name == 0 )
+			      && ( libfvde_plist_scanner_compare_key(
+			            xml_plist_data,
+			            xml_length,
+			            &key_element,
+			            "com.apple.corestorage.lvg.name",
+			            30,
+			            NULL ) == 1 ) )
+			{
+				name_element = value_element;
+				found_name   = 1;
+			}
+			else if( ( found_physical_volumes == 0 )
+			      && ( libfvde_plist_scanner_compare_key(
+			            xml_plist_data,
+			            xml_length,
+			            &key_element,
+			            "com.apple.corestorage.lvg.physicalVolumes",
+			            41,
+			            NULL ) == 1 ) )
+			{
+				physical_volumes_element = value_element;
+				found_physical_volumes   = 1;
+			}
+		}
+		while( ( found_identifier == 0 )
+		    || ( found_name == 0 )
+		    || ( found_physical_volumes == 0 ) );
+
+		if( found_identifier == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy property list from byte stream.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve com.apple.corestorage.lvg.uuid element.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_list_get_root_property(
-		     property_list,
-		     &root_property,
-		     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: logical volume group identifier\t: %.*s\n",
+			 function,
+			 (int) identifier_element.content_size,
+			 (char *) &( xml_plist_data[ identifier_element.content_offset ] ) );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( found_name == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve root property.",
+			 "%s: unable to retrieve com.apple.corestorage.lvg.name element.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lvg.uuid",
-		     30,
-		     &sub_property,
-		     error ) != 1 )
+		if( found_physical_volumes == 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lvg.uuid sub property.",
+			 "%s: unable to retrieve com.apple.corestorage.lvg.physicalVolumes element.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfplist_property_get_value_string(
-			     sub_property,
-			     &string,
-			     &string_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve logical volume group identifier.",
-				 function );
-
-				goto on_error;
-			}
-			libcnotify_printf(
-			 "%s: logical volume group identifier\t: %s\n",
-			 function,
-			 string );
-
-			memory_free(
-			 string );
-
-			string = NULL;
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
+		if( name_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_STRING )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lvg.uuid property.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported com.apple.corestorage.lvg.name element type.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lvg.name",
-		     30,
-		     &sub_property,
+		if( libfvde_plist_scanner_get_string_size(
+		     xml_plist_data,
+		     xml_length,
+		     &name_element,
+		     &( metadata->volume_group_name_size ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lvg.name sub property.",
+			 "%s: unable to retrieve logical volume group name size.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_get_value_string(
-		     sub_property,
-		     &( metadata->volume_group_name ),
-		     &( metadata->volume_group_name_size ),
-		     error ) != 1 )
+		if( ( metadata->volume_group_name_size == 0 )
+		 || ( metadata->volume_group_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve logical volume group name.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid logical volume group name size value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: logical volume group name\t\t: %s\n",
-			 function,
-			 metadata->volume_group_name );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		metadata->volume_group_name = (uint8_t *) memory_allocate(
+		                                           sizeof( uint8_t ) * metadata->volume_group_name_size );
 
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
+		if( metadata->volume_group_name == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lvg.uuid property.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create logical volume group name.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_get_sub_property_by_utf8_name(
-		     root_property,
-		     (uint8_t *) "com.apple.corestorage.lvg.physicalVolumes",
-		     41,
-		     &sub_property,
+		if( libfvde_plist_scanner_copy_string(
+		     xml_plist_data,
+		     xml_length,
+		     &name_element,
+		     metadata->volume_group_name,
+		     metadata->volume_group_name_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve com.apple.corestorage.lvg.physicalVolumes sub property.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy logical volume group name.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfplist_property_get_array_number_of_entries(
-		     sub_property,
-		     &number_of_entries,
-		     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: logical volume group name\t\t: %s\n",
+			 function,
+			 metadata->volume_group_name );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		if( physical_volumes_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of physical volumes array entries.",
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported com.apple.corestorage.lvg.physicalVolumes element type.",
 			 function );
 
 			goto on_error;
 		}
+		array_end_offset = physical_volumes_element.content_offset + physical_volumes_element.content_size;
+		data_offset      = physical_volumes_element.content_offset;
+
 		for( entry_index = 0;
-		     entry_index < number_of_entries;
+		     data_offset < array_end_offset;
 		     entry_index++ )
 		{
-			if( libfplist_property_get_array_entry_by_index(
-			     sub_property,
-			     entry_index,
-			     &array_entry_property,
-			     error ) != 1 )
+			result = libfvde_plist_scanner_read_element(
+			          xml_plist_data,
+			          array_end_offset,
+			          &data_offset,
+			          &array_entry_element,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve physical volumes array entry: %d.",
+				 "%s: unable to read physical volumes array entry: %d.",
 				 function,
 				 entry_index );
 
 				goto on_error;
 			}
+			else if( result == 0 )
+			{
+				break;
+			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
-				if( libfplist_property_get_value_string(
-				     array_entry_property,
-				     &string,
-				     &string_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve physical volume: %d identifier.",
-					 function,
-					 entry_index );
-
-					goto on_error;
-				}
 				libcnotify_printf(
-				 "%s: physical volume: %d identifier\t\t: %s\n",
+				 "%s: physical volume: %d identifier\t\t: %.*s\n",
 				 function,
 				 entry_index + 1,
-				 string );
-
-				memory_free(
-				 string );
-
-				string = NULL;
+				 (int) array_entry_element.content_size,
+				 (char *) &( xml_plist_data[ array_entry_element.content_offset ] ) );
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
@@ -1076,8 +1108,10 @@ int libfvde_metadata_read_volume_group_plist(
 
 				goto on_error;
 			}
-			if( libfplist_property_value_uuid_string_copy_to_byte_stream(
-			     array_entry_property,
+			if( libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+			     xml_plist_data,
+			     xml_length,
+			     &array_entry_element,
 			     physical_volume_descriptor->identifier,
 			     16,
 			     error ) != 1 )
@@ -1109,60 +1143,6 @@ int libfvde_metadata_read_volume_group_plist(
 				goto on_error;
 			}
 			physical_volume_descriptor = NULL;
-
-			if( libfplist_property_free(
-			     &array_entry_property,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free physical volumes array entry: %d.",
-				 function,
-				 entry_index );
-
-				goto on_error;
-			}
-		}
-		if( libfplist_property_free(
-		     &sub_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free com.apple.corestorage.lvg.physicalVolumes property.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfplist_property_free(
-		     &root_property,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free root property.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfplist_property_list_free(
-		     &property_list,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free property list.",
-			 function );
-
-			goto on_error;
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1175,43 +1155,12 @@ int libfvde_metadata_read_volume_group_plist(
 	return( 1 );
 
 on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( string != NULL )
-	{
-		memory_free(
-		 string );
-	}
-#endif
 	if( physical_volume_descriptor != NULL )
 	{
 		libfvde_physical_volume_descriptor_free(
 		 &physical_volume_descriptor,
 		 NULL );
 	}
-	if( array_entry_property != NULL )
-	{
-		libfplist_property_free(
-		 &array_entry_property,
-		 NULL );
-	}
-	if( sub_property != NULL )
-	{
-		libfplist_property_free(
-		 &sub_property,
-		 NULL );
-	}
-	if( root_property != NULL )
-	{
-		libfplist_property_free(
-		 &root_property,
-		 NULL );
-	}
-	if( property_list != NULL )
-	{
-		libfplist_property_list_free(
-		 &property_list,
-		 NULL );
-	}
 	if( metadata->volume_group_name != NULL )
 	{
 		memory_free(
@@ -0,0 +1,597 @@
+/*
+ * Passphrase wrapped KEK functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_encrypted_metadata.h"
+#include "libfvde_encryption_context.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcnotify.h"
+#include "libfvde_passphrase_wrapped_kek.h"
+#include "libfvde_password.h"
+
+/* Creates a passphrase wrapped KEK
+ * Make sure the value passphrase_wrapped_kek is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_passphrase_wrapped_kek_initialize(
+     libfvde_passphrase_wrapped_kek_t **passphrase_wrapped_kek,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_passphrase_wrapped_kek_initialize";
+
+	if( passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( *passphrase_wrapped_kek != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid passphrase wrapped KEK value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*passphrase_wrapped_kek = memory_allocate_structure(
+	                           libfvde_passphrase_wrapped_kek_t );
+
+	if( *passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create passphrase wrapped KEK.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *passphrase_wrapped_kek,
+	     0,
+	     sizeof( libfvde_passphrase_wrapped_kek_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear passphrase wrapped KEK.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *passphrase_wrapped_kek != NULL )
+	{
+		memory_free(
+		 *passphrase_wrapped_kek );
+
+		*passphrase_wrapped_kek = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a passphrase wrapped KEK
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_passphrase_wrapped_kek_free(
+     libfvde_passphrase_wrapped_kek_t **passphrase_wrapped_kek,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_passphrase_wrapped_kek_free";
+	int result            = 1;
+
+	if( passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( *passphrase_wrapped_kek != NULL )
+	{
+		if( memory_set(
+		     *passphrase_wrapped_kek,
+		     0,
+		     sizeof( libfvde_passphrase_wrapped_kek_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear passphrase wrapped KEK.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *passphrase_wrapped_kek );
+
+		*passphrase_wrapped_kek = NULL;
+	}
+	return( result );
+}
+
+/* Clones a passphrase wrapped KEK
+ * Only the salt, number of iterations and wrapped KEK are copied, an unwrapped KEK is not
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_passphrase_wrapped_kek_clone(
+     libfvde_passphrase_wrapped_kek_t **destination_passphrase_wrapped_kek,
+     libfvde_passphrase_wrapped_kek_t *source_passphrase_wrapped_kek,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_passphrase_wrapped_kek_clone";
+
+	if( destination_passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_passphrase_wrapped_kek != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination passphrase wrapped KEK value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_passphrase_wrapped_kek == NULL )
+	{
+		*destination_passphrase_wrapped_kek = NULL;
+
+		return( 1 );
+	}
+	if( libfvde_passphrase_wrapped_kek_initialize(
+	     destination_passphrase_wrapped_kek,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *destination_passphrase_wrapped_kek )->salt,
+	     source_passphrase_wrapped_kek->salt,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy salt.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *destination_passphrase_wrapped_kek )->wrapped_kek,
+	     source_passphrase_wrapped_kek->wrapped_kek,
+	     24 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy wrapped KEK.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_passphrase_wrapped_kek )->number_of_iterations = source_passphrase_wrapped_kek->number_of_iterations;
+
+	return( 1 );
+
+on_error:
+	libfvde_passphrase_wrapped_kek_free(
+	 destination_passphrase_wrapped_kek,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads a passphrase wrapped KEK
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_passphrase_wrapped_kek_read_data(
+     libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_passphrase_wrapped_kek_read_data";
+	uint32_t value_size   = 0;
+	uint32_t value_type   = 0;
+
+	if( passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size != 284 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 0 ] ),
+	 value_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 value_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: value type\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_type );
+
+		libcnotify_printf(
+		 "%s: value size\t\t: %" PRIu32 "\n",
+		 function,
+		 value_size );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( value_type != 0x00000003UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     passphrase_wrapped_kek->salt,
+	     &( data[ 8 ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy salt.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 value_type );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 28 ] ),
+	 value_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 168 ] ),
+	 passphrase_wrapped_kek->number_of_iterations );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: salt:\n",
+		 function );
+		libcnotify_print_data(
+		 passphrase_wrapped_kek->salt,
+		 16,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: value type\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_type );
+
+		libcnotify_printf(
+		 "%s: value size\t\t: %" PRIu32 "\n",
+		 function,
+		 value_size );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( value_type != 0x00000010UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size != 24 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     passphrase_wrapped_kek->wrapped_kek,
+	     &( data[ 32 ] ),
+	     24 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: encrypted volume key wrapped KEK:\n",
+		 function );
+		libcnotify_print_data(
+		 passphrase_wrapped_kek->wrapped_kek,
+		 24,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: number of iterations\t: %" PRIu32 "\n",
+		 function,
+		 passphrase_wrapped_kek->number_of_iterations );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Unwraps the KEK using a password
+ * This function does not modify shared state and can be called concurrently
+ * for different passphrase wrapped KEKs
+ * Returns 1 if successful, 0 if the password does not match or -1 on error
+ */
+int libfvde_passphrase_wrapped_kek_unwrap(
+     libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek,
+     const uint8_t *password,
+     size_t password_size,
+     libcerror_error_t **error )
+{
+	uint8_t passphrase_key[ 16 ];
+	uint8_t volume_key_wrapped_kek[ 24 ];
+
+	static char *function = "libfvde_passphrase_wrapped_kek_unwrap";
+	int result            = 0;
+
+	if( passphrase_wrapped_kek == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid passphrase wrapped KEK.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_password_pbkdf2(
+	     password,
+	     password_size,
+	     passphrase_wrapped_kek->salt,
+	     16,
+	     passphrase_wrapped_kek->number_of_iterations,
+	     passphrase_key,
+	     16,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine password key.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: passphrase key:\n",
+		 function );
+		libcnotify_print_data(
+		 passphrase_key,
+		 16,
+		 0 );
+	}
+#endif
+	if( libfvde_encryption_aes_key_unwrap(
+	     passphrase_key,
+	     16 * 8,
+	     passphrase_wrapped_kek->wrapped_kek,
+	     24,
+	     volume_key_wrapped_kek,
+	     24,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to retrieve volume key wrapped KEK.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     passphrase_key,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear passphrase key.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: volume key wrapped KEK:\n",
+		 function );
+		libcnotify_print_data(
+		 volume_key_wrapped_kek,
+		 24,
+		 0 );
+	}
+#endif
+	if( memory_compare(
+	     volume_key_wrapped_kek,
+	     libfvde_encrypted_metadata_wrapped_kek_initialization_vector,
+	     8 ) == 0 )
+	{
+		if( memory_copy(
+		     passphrase_wrapped_kek->kek,
+		     &( volume_key_wrapped_kek[ 8 ] ),
+		     16 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy KEK.",
+			 function );
+
+			goto on_error;
+		}
+		passphrase_wrapped_kek->kek_is_set = 1;
+
+		result = 1;
+	}
+	if( memory_set(
+	     volume_key_wrapped_kek,
+	     0,
+	     24 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume key wrapped KEK.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	memory_set(
+	 volume_key_wrapped_kek,
+	 0,
+	 24 );
+
+	memory_set(
+	 passphrase_key,
+	 0,
+	 16 );
+
+	return( -1 );
+}
+
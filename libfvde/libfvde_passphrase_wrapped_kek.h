@@ -0,0 +1,90 @@
+/*
+ * Passphrase wrapped KEK functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_PASSPHRASE_WRAPPED_KEK_H )
+#define _LIBFVDE_PASSPHRASE_WRAPPED_KEK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_passphrase_wrapped_kek libfvde_passphrase_wrapped_kek_t;
+
+struct libfvde_passphrase_wrapped_kek
+{
+	/* The salt
+	 */
+	uint8_t salt[ 16 ];
+
+	/* The number of iterations
+	 */
+	uint32_t number_of_iterations;
+
+	/* The wrapped key encryption key (KEK)
+	 */
+	uint8_t wrapped_kek[ 24 ];
+
+	/* The unwrapped key encryption key (KEK)
+	 */
+	uint8_t kek[ 16 ];
+
+	/* Value to indicate the KEK was unwrapped
+	 */
+	uint8_t kek_is_set;
+};
+
+int libfvde_passphrase_wrapped_kek_initialize(
+     libfvde_passphrase_wrapped_kek_t **passphrase_wrapped_kek,
+     libcerror_error_t **error );
+
+int libfvde_passphrase_wrapped_kek_free(
+     libfvde_passphrase_wrapped_kek_t **passphrase_wrapped_kek,
+     libcerror_error_t **error );
+
+int libfvde_passphrase_wrapped_kek_clone(
+     libfvde_passphrase_wrapped_kek_t **destination_passphrase_wrapped_kek,
+     libfvde_passphrase_wrapped_kek_t *source_passphrase_wrapped_kek,
+     libcerror_error_t **error );
+
+int libfvde_passphrase_wrapped_kek_read_data(
+     libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_passphrase_wrapped_kek_unwrap(
+     libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek,
+     const uint8_t *password,
+     size_t password_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_PASSPHRASE_WRAPPED_KEK_H ) */
+
@@ -0,0 +1,2180 @@
+/*
+ * Streaming (XML) plist scanner functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_plist_scanner.h"
+
+/* Skips a tag, processing instruction, comment or declaration
+ * The data offset should point to the '<' of the markup and is set to the offset directly after the markup
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_skip_markup(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *is_empty_element,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfvde_plist_scanner_skip_markup";
+	size_t safe_data_offset = 0;
+	uint8_t quote_character = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_empty_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid is empty element.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	if( ( safe_data_offset >= data_size )
+	 || ( data[ safe_data_offset ] != (uint8_t) '<' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid data offset - missing markup start.",
+		 function );
+
+		return( -1 );
+	}
+	*is_empty_element = 0;
+
+	if( ( ( data_size - safe_data_offset ) >= 4 )
+	 && ( data[ safe_data_offset + 1 ] == (uint8_t) '!' )
+	 && ( data[ safe_data_offset + 2 ] == (uint8_t) '-' )
+	 && ( data[ safe_data_offset + 3 ] == (uint8_t) '-' ) )
+	{
+		/* Comments can contain '>' so look for "-->"
+		 */
+		for( safe_data_offset += 4;
+		     ( safe_data_offset + 2 ) < data_size;
+		     safe_data_offset++ )
+		{
+			if( ( data[ safe_data_offset ] == (uint8_t) '-' )
+			 && ( data[ safe_data_offset + 1 ] == (uint8_t) '-' )
+			 && ( data[ safe_data_offset + 2 ] == (uint8_t) '>' ) )
+			{
+				*data_offset      = safe_data_offset + 3;
+				*is_empty_element = 1;
+
+				return( 1 );
+			}
+		}
+	}
+	else
+	{
+		for( safe_data_offset += 1;
+		     safe_data_offset < data_size;
+		     safe_data_offset++ )
+		{
+			if( quote_character != 0 )
+			{
+				if( data[ safe_data_offset ] == quote_character )
+				{
+					quote_character = 0;
+				}
+			}
+			else if( ( data[ safe_data_offset ] == (uint8_t) '"' )
+			      || ( data[ safe_data_offset ] == (uint8_t) '\'' ) )
+			{
+				quote_character = data[ safe_data_offset ];
+			}
+			else if( data[ safe_data_offset ] == (uint8_t) '>' )
+			{
+				if( ( data[ *data_offset + 1 ] == (uint8_t) '?' )
+				 || ( data[ *data_offset + 1 ] == (uint8_t) '!' )
+				 || ( data[ safe_data_offset - 1 ] == (uint8_t) '/' ) )
+				{
+					*is_empty_element = 1;
+				}
+				*data_offset = safe_data_offset + 1;
+
+				return( 1 );
+			}
+			else if( data[ safe_data_offset ] == 0 )
+			{
+				break;
+			}
+		}
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+	 "%s: invalid data - missing markup end.",
+	 function );
+
+	return( -1 );
+}
+
+/* Determines the element type from the element name
+ * Returns the element type
+ */
+uint8_t libfvde_plist_scanner_get_element_type(
+         const uint8_t *name,
+         size_t name_length )
+{
+	if( name == NULL )
+	{
+		return( LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN );
+	}
+	switch( name_length )
+	{
+		case 3:
+			if( narrow_string_compare(
+			     (char *) name,
+			     "key",
+			     3 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_KEY );
+			}
+			break;
+
+		case 4:
+			if( narrow_string_compare(
+			     (char *) name,
+			     "data",
+			     4 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_DATA );
+			}
+			else if( narrow_string_compare(
+			          (char *) name,
+			          "dict",
+			          4 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_DICT );
+			}
+			else if( narrow_string_compare(
+			          (char *) name,
+			          "true",
+			          4 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_TRUE );
+			}
+			break;
+
+		case 5:
+			if( narrow_string_compare(
+			     (char *) name,
+			     "array",
+			     5 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY );
+			}
+			else if( narrow_string_compare(
+			          (char *) name,
+			          "false",
+			          5 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_FALSE );
+			}
+			else if( narrow_string_compare(
+			          (char *) name,
+			          "plist",
+			          5 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_PLIST );
+			}
+			break;
+
+		case 6:
+			if( narrow_string_compare(
+			     (char *) name,
+			     "string",
+			     6 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_STRING );
+			}
+			break;
+
+		case 7:
+			if( narrow_string_compare(
+			     (char *) name,
+			     "integer",
+			     7 ) == 0 )
+			{
+				return( LIBFVDE_PLIST_ELEMENT_TYPE_INTEGER );
+			}
+			break;
+
+		default:
+			break;
+	}
+	return( LIBFVDE_PLIST_ELEMENT_TYPE_UNKNOWN );
+}
+
+/* Reads the next element
+ * The data size should be the end of the area to scan, for example the end of the content of the parent element
+ * The data offset is set to the offset directly after the element
+ * Returns 1 if successful, 0 if no more elements or -1 on error
+ */
+int libfvde_plist_scanner_read_element(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libfvde_plist_element_t *element,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfvde_plist_scanner_read_element";
+	size_t content_end       = 0;
+	size_t content_offset    = 0;
+	size_t name_length       = 0;
+	size_t name_offset       = 0;
+	size_t safe_data_offset  = 0;
+	uint8_t is_empty_element = 0;
+	int depth                = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	safe_data_offset = *data_offset;
+
+	/* Skip white space, processing instructions, comments and declarations
+	 */
+	while( safe_data_offset < data_size )
+	{
+		if( ( data[ safe_data_offset ] == (uint8_t) ' ' )
+		 || ( data[ safe_data_offset ] == (uint8_t) '\t' )
+		 || ( data[ safe_data_offset ] == (uint8_t) '\n' )
+		 || ( data[ safe_data_offset ] == (uint8_t) '\r' ) )
+		{
+			safe_data_offset++;
+
+			continue;
+		}
+		if( ( data[ safe_data_offset ] == 0 )
+		 || ( data[ safe_data_offset ] != (uint8_t) '<' ) )
+		{
+			break;
+		}
+		if( ( safe_data_offset + 1 ) >= data_size )
+		{
+			break;
+		}
+		if( ( data[ safe_data_offset + 1 ] != (uint8_t) '?' )
+		 && ( data[ safe_data_offset + 1 ] != (uint8_t) '!' ) )
+		{
+			break;
+		}
+		if( libfvde_plist_scanner_skip_markup(
+		     data,
+		     data_size,
+		     &safe_data_offset,
+		     &is_empty_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to skip markup.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( safe_data_offset >= data_size )
+	 || ( data[ safe_data_offset ] == 0 ) )
+	{
+		*data_offset = safe_data_offset;
+
+		return( 0 );
+	}
+	if( data[ safe_data_offset ] != (uint8_t) '<' )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported character data at offset: %" PRIzd ".",
+		 function,
+		 safe_data_offset );
+
+		return( -1 );
+	}
+	/* The end tag of the parent element
+	 */
+	if( ( ( safe_data_offset + 1 ) < data_size )
+	 && ( data[ safe_data_offset + 1 ] == (uint8_t) '/' ) )
+	{
+		*data_offset = safe_data_offset;
+
+		return( 0 );
+	}
+	name_offset = safe_data_offset + 1;
+
+	for( name_length = 0;
+	     ( name_offset + name_length ) < data_size;
+	     name_length++ )
+	{
+		if( ( data[ name_offset + name_length ] == (uint8_t) ' ' )
+		 || ( data[ name_offset + name_length ] == (uint8_t) '\t' )
+		 || ( data[ name_offset + name_length ] == (uint8_t) '\n' )
+		 || ( data[ name_offset + name_length ] == (uint8_t) '\r' )
+		 || ( data[ name_offset + name_length ] == (uint8_t) '/' )
+		 || ( data[ name_offset + name_length ] == (uint8_t) '>' ) )
+		{
+			break;
+		}
+	}
+	if( libfvde_plist_scanner_skip_markup(
+	     data,
+	     data_size,
+	     &safe_data_offset,
+	     &is_empty_element,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to skip start tag.",
+		 function );
+
+		return( -1 );
+	}
+	content_offset = safe_data_offset;
+
+	if( is_empty_element == 0 )
+	{
+		/* Scan for the matching end tag, nested elements are skipped
+		 * without being interpreted
+		 */
+		depth = 1;
+
+		while( safe_data_offset < data_size )
+		{
+			if( data[ safe_data_offset ] == 0 )
+			{
+				break;
+			}
+			if( data[ safe_data_offset ] != (uint8_t) '<' )
+			{
+				safe_data_offset++;
+
+				continue;
+			}
+			if( ( ( safe_data_offset + 1 ) < data_size )
+			 && ( data[ safe_data_offset + 1 ] == (uint8_t) '/' ) )
+			{
+				content_end = safe_data_offset;
+
+				if( libfvde_plist_scanner_skip_markup(
+				     data,
+				     data_size,
+				     &safe_data_offset,
+				     &is_empty_element,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to skip end tag.",
+					 function );
+
+					return( -1 );
+				}
+				depth--;
+
+				if( depth == 0 )
+				{
+					break;
+				}
+			}
+			else
+			{
+				if( libfvde_plist_scanner_skip_markup(
+				     data,
+				     data_size,
+				     &safe_data_offset,
+				     &is_empty_element,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to skip nested markup.",
+					 function );
+
+					return( -1 );
+				}
+				if( is_empty_element == 0 )
+				{
+					depth++;
+				}
+			}
+		}
+		if( depth != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data - missing end tag.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( content_end + 2 + name_length ) >= data_size )
+		 || ( memory_compare(
+		       &( data[ content_end + 2 ] ),
+		       &( data[ name_offset ] ),
+		       name_length ) != 0 )
+		 || ( ( data[ content_end + 2 + name_length ] != (uint8_t) '>' )
+		  &&  ( data[ content_end + 2 + name_length ] != (uint8_t) ' ' )
+		  &&  ( data[ content_end + 2 + name_length ] != (uint8_t) '\t' )
+		  &&  ( data[ content_end + 2 + name_length ] != (uint8_t) '\n' )
+		  &&  ( data[ content_end + 2 + name_length ] != (uint8_t) '\r' ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid data - mismatch in end tag.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		content_end = content_offset;
+	}
+	element->type           = libfvde_plist_scanner_get_element_type(
+	                           &( data[ name_offset ] ),
+	                           name_length );
+	element->content_offset = content_offset;
+	element->content_size   = content_end - content_offset;
+	element->end_offset     = safe_data_offset;
+
+	*data_offset = safe_data_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the root dict element
+ * The root dict element either is the first element or contained in the plist element
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfvde_plist_scanner_get_root_dict(
+     const uint8_t *data,
+     size_t data_size,
+     libfvde_plist_element_t *dict_element,
+     libcerror_error_t **error )
+{
+	libfvde_plist_element_t root_element;
+
+	static char *function = "libfvde_plist_scanner_get_root_dict";
+	size_t data_offset    = 0;
+	int result            = 0;
+
+	if( dict_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dict element.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_plist_scanner_read_element(
+	          data,
+	          data_size,
+	          &data_offset,
+	          &root_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read root element.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( root_element.type == LIBFVDE_PLIST_ELEMENT_TYPE_PLIST )
+	{
+		data_offset = root_element.content_offset;
+
+		result = libfvde_plist_scanner_read_element(
+		          data,
+		          root_element.content_offset + root_element.content_size,
+		          &data_offset,
+		          &root_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read plist sub element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( root_element.type != LIBFVDE_PLIST_ELEMENT_TYPE_DICT )
+	{
+		return( 0 );
+	}
+	dict_element->type           = root_element.type;
+	dict_element->content_offset = root_element.content_offset;
+	dict_element->content_size   = root_element.content_size;
+	dict_element->end_offset     = root_element.end_offset;
+
+	return( 1 );
+}
+
+/* Determines if a key element contains a specific key
+ * Returns 1 if the key matches, 0 if not or -1 on error
+ */
+int libfvde_plist_scanner_compare_key(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *key_element,
+     const char *key,
+     size_t key_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_compare_key";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key element.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_element->type != LIBFVDE_PLIST_ELEMENT_TYPE_KEY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_element->content_offset > data_size )
+	 || ( key_element->content_size > ( data_size - key_element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_element->content_size == key_length )
+	 && ( memory_compare(
+	       &( data[ key_element->content_offset ] ),
+	       key,
+	       key_length ) == 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the next key and value element of a dict element
+ * The data offset should be set to the content offset of the dict element before reading the first entry
+ * and is set to the offset directly after the value element
+ * Returns 1 if successful, 0 if no more entries or -1 on error
+ */
+int libfvde_plist_scanner_read_dict_entry(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *dict_element,
+     size_t *data_offset,
+     libfvde_plist_element_t *key_element,
+     libfvde_plist_element_t *value_element,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_read_dict_entry";
+	size_t content_end    = 0;
+	int result            = 0;
+
+	if( dict_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dict element.",
+		 function );
+
+		return( -1 );
+	}
+	if( dict_element->type != LIBFVDE_PLIST_ELEMENT_TYPE_DICT )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported dict element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( dict_element->content_offset > data_size )
+	 || ( dict_element->content_size > ( data_size - dict_element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid dict element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	content_end = dict_element->content_offset + dict_element->content_size;
+
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *data_offset < dict_element->content_offset )
+	 || ( *data_offset > content_end ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key element.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value element.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_plist_scanner_read_element(
+	          data,
+	          content_end,
+	          data_offset,
+	          key_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read key element.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( key_element->type != LIBFVDE_PLIST_ELEMENT_TYPE_KEY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported dict sub element - expected key.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvde_plist_scanner_read_element(
+	          data,
+	          content_end,
+	          data_offset,
+	          value_element,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read value element.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value element of a specific key in a dict element
+ * Only the direct sub elements of the dict are considered
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libfvde_plist_scanner_get_dict_value_by_key(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *dict_element,
+     const char *key,
+     size_t key_length,
+     libfvde_plist_element_t *value_element,
+     libcerror_error_t **error )
+{
+	libfvde_plist_element_t key_element;
+
+	static char *function = "libfvde_plist_scanner_get_dict_value_by_key";
+	size_t data_offset    = 0;
+	int result            = 0;
+
+	if( dict_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dict element.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = dict_element->content_offset;
+
+	do
+	{
+		result = libfvde_plist_scanner_read_dict_entry(
+		          data,
+		          data_size,
+		          dict_element,
+		          &data_offset,
+		          &key_element,
+		          value_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read dict entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libfvde_plist_scanner_compare_key(
+		          data,
+		          data_size,
+		          &key_element,
+		          key,
+		          key_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	while( result == 0 );
+
+	return( 0 );
+}
+
+/* Retrieves the number of entries of an array element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_get_array_number_of_entries(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *array_element,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfvde_plist_element_t entry_element;
+
+	static char *function = "libfvde_plist_scanner_get_array_number_of_entries";
+	size_t content_end    = 0;
+	size_t data_offset    = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( array_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array element.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_element->type != LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported array element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( array_element->content_offset > data_size )
+	 || ( array_element->content_size > ( data_size - array_element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	content_end = array_element->content_offset + array_element->content_size;
+	data_offset = array_element->content_offset;
+
+	while( data_offset < content_end )
+	{
+		if( entry_index == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfvde_plist_scanner_read_element(
+		          data,
+		          content_end,
+		          &data_offset,
+		          &entry_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read array entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		entry_index++;
+	}
+	*number_of_entries = entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry element of an array element
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfvde_plist_scanner_get_array_entry_by_index(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *array_element,
+     int entry_index,
+     libfvde_plist_element_t *entry_element,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_get_array_entry_by_index";
+	size_t content_end    = 0;
+	size_t data_offset    = 0;
+	int array_entry_index = 0;
+	int result            = 0;
+
+	if( array_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array element.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_element->type != LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported array element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( array_element->content_offset > data_size )
+	 || ( array_element->content_size > ( data_size - array_element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry element.",
+		 function );
+
+		return( -1 );
+	}
+	content_end = array_element->content_offset + array_element->content_size;
+	data_offset = array_element->content_offset;
+
+	for( array_entry_index = 0;
+	     data_offset < content_end;
+	     array_entry_index++ )
+	{
+		result = libfvde_plist_scanner_read_element(
+		          data,
+		          content_end,
+		          &data_offset,
+		          entry_element,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read array entry: %d.",
+			 function,
+			 array_entry_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( array_entry_index == entry_index )
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the entry element of an array element that follows a previous entry element
+ * If previous_entry_element is NULL the first entry element is retrieved
+ * The scan continues from the end offset of the previous entry element, so that iterating
+ * the entries does not rescan the preceding entries as libfvde_plist_scanner_get_array_entry_by_index does
+ * The previous and entry element can be the same element
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libfvde_plist_scanner_get_array_next_entry(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *array_element,
+     const libfvde_plist_element_t *previous_entry_element,
+     libfvde_plist_element_t *entry_element,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_get_array_next_entry";
+	size_t content_end    = 0;
+	size_t data_offset    = 0;
+	int result            = 0;
+
+	if( array_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array element.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_element->type != LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported array element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( array_element->content_offset > data_size )
+	 || ( array_element->content_size > ( data_size - array_element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid array element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry element.",
+		 function );
+
+		return( -1 );
+	}
+	content_end = array_element->content_offset + array_element->content_size;
+
+	if( previous_entry_element == NULL )
+	{
+		data_offset = array_element->content_offset;
+	}
+	else
+	{
+		if( ( previous_entry_element->end_offset < array_element->content_offset )
+		 || ( previous_entry_element->end_offset > content_end ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid previous entry element - end offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset = previous_entry_element->end_offset;
+	}
+	if( data_offset >= content_end )
+	{
+		return( 0 );
+	}
+	result = libfvde_plist_scanner_read_element(
+	          data,
+	          content_end,
+	          &data_offset,
+	          entry_element,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read array entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Decodes the character data of an element
+ * If string is NULL only the size of the decoded string is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_decode_string(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *string,
+     size_t string_size,
+     size_t *decoded_size,
+     libcerror_error_t **error )
+{
+	uint8_t utf8_character[ 4 ];
+
+	static char *function = "libfvde_plist_scanner_decode_string";
+	size_t character_size = 0;
+	size_t content_end    = 0;
+	size_t data_offset    = 0;
+	size_t entity_length  = 0;
+	size_t safe_size      = 0;
+	size_t string_index   = 0;
+	uint32_t code_point   = 0;
+	uint8_t byte_value    = 0;
+	uint8_t numeric_base  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->content_offset > data_size )
+	 || ( element->content_size > ( data_size - element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded size.",
+		 function );
+
+		return( -1 );
+	}
+	content_end = element->content_offset + element->content_size;
+
+	for( data_offset = element->content_offset;
+	     data_offset < content_end;
+	     data_offset += entity_length )
+	{
+		if( data[ data_offset ] == (uint8_t) '<' )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported element content - not character data.",
+			 function );
+
+			return( -1 );
+		}
+		if( data[ data_offset ] != (uint8_t) '&' )
+		{
+			utf8_character[ 0 ] = data[ data_offset ];
+			character_size      = 1;
+			entity_length       = 1;
+		}
+		else
+		{
+			for( entity_length = 1;
+			     ( data_offset + entity_length ) < content_end;
+			     entity_length++ )
+			{
+				if( data[ data_offset + entity_length ] == (uint8_t) ';' )
+				{
+					break;
+				}
+			}
+			if( ( data_offset + entity_length ) >= content_end )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid entity - missing end.",
+				 function );
+
+				return( -1 );
+			}
+			entity_length += 1;
+			character_size = 1;
+
+			if( ( entity_length == 5 )
+			 && ( memory_compare(
+			       &( data[ data_offset ] ),
+			       "&amp;",
+			       5 ) == 0 ) )
+			{
+				utf8_character[ 0 ] = (uint8_t) '&';
+			}
+			else if( ( entity_length == 4 )
+			      && ( memory_compare(
+			            &( data[ data_offset ] ),
+			            "&lt;",
+			            4 ) == 0 ) )
+			{
+				utf8_character[ 0 ] = (uint8_t) '<';
+			}
+			else if( ( entity_length == 4 )
+			      && ( memory_compare(
+			            &( data[ data_offset ] ),
+			            "&gt;",
+			            4 ) == 0 ) )
+			{
+				utf8_character[ 0 ] = (uint8_t) '>';
+			}
+			else if( ( entity_length == 6 )
+			      && ( memory_compare(
+			            &( data[ data_offset ] ),
+			            "&quot;",
+			            6 ) == 0 ) )
+			{
+				utf8_character[ 0 ] = (uint8_t) '"';
+			}
+			else if( ( entity_length == 6 )
+			      && ( memory_compare(
+			            &( data[ data_offset ] ),
+			            "&apos;",
+			            6 ) == 0 ) )
+			{
+				utf8_character[ 0 ] = (uint8_t) '\'';
+			}
+			else if( ( entity_length > 3 )
+			      && ( data[ data_offset + 1 ] == (uint8_t) '#' ) )
+			{
+				/* Numeric character reference: &#DDD; or &#xHHH;
+				 */
+				code_point   = 0;
+				numeric_base = 10;
+				string_index = 2;
+
+				if( ( data[ data_offset + 2 ] == (uint8_t) 'x' )
+				 || ( data[ data_offset + 2 ] == (uint8_t) 'X' ) )
+				{
+					numeric_base = 16;
+					string_index = 3;
+				}
+				if( string_index >= ( entity_length - 1 ) )
+				{
+					code_point = 0x00110000UL;
+				}
+				while( string_index < ( entity_length - 1 ) )
+				{
+					byte_value = data[ data_offset + string_index ];
+
+					if( ( byte_value >= (uint8_t) '0' )
+					 && ( byte_value <= (uint8_t) '9' ) )
+					{
+						byte_value -= (uint8_t) '0';
+					}
+					else if( ( numeric_base == 16 )
+					      && ( byte_value >= (uint8_t) 'a' )
+					      && ( byte_value <= (uint8_t) 'f' ) )
+					{
+						byte_value -= (uint8_t) 'a' - 10;
+					}
+					else if( ( numeric_base == 16 )
+					      && ( byte_value >= (uint8_t) 'A' )
+					      && ( byte_value <= (uint8_t) 'F' ) )
+					{
+						byte_value -= (uint8_t) 'A' - 10;
+					}
+					else
+					{
+						code_point = 0x00110000UL;
+
+						break;
+					}
+					code_point = ( code_point * numeric_base ) + byte_value;
+
+					if( code_point > 0x0010ffffUL )
+					{
+						break;
+					}
+					string_index++;
+				}
+				if( ( code_point == 0 )
+				 || ( code_point > 0x0010ffffUL )
+				 || ( ( code_point >= 0x0000d800UL )
+				  &&  ( code_point <= 0x0000dfffUL ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported numeric character reference.",
+					 function );
+
+					return( -1 );
+				}
+				if( code_point < 0x00000080UL )
+				{
+					utf8_character[ 0 ] = (uint8_t) code_point;
+				}
+				else if( code_point < 0x00000800UL )
+				{
+					utf8_character[ 0 ] = (uint8_t) ( 0xc0 | ( code_point >> 6 ) );
+					utf8_character[ 1 ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+					character_size      = 2;
+				}
+				else if( code_point < 0x00010000UL )
+				{
+					utf8_character[ 0 ] = (uint8_t) ( 0xe0 | ( code_point >> 12 ) );
+					utf8_character[ 1 ] = (uint8_t) ( 0x80 | ( ( code_point >> 6 ) & 0x3f ) );
+					utf8_character[ 2 ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+					character_size      = 3;
+				}
+				else
+				{
+					utf8_character[ 0 ] = (uint8_t) ( 0xf0 | ( code_point >> 18 ) );
+					utf8_character[ 1 ] = (uint8_t) ( 0x80 | ( ( code_point >> 12 ) & 0x3f ) );
+					utf8_character[ 2 ] = (uint8_t) ( 0x80 | ( ( code_point >> 6 ) & 0x3f ) );
+					utf8_character[ 3 ] = (uint8_t) ( 0x80 | ( code_point & 0x3f ) );
+					character_size      = 4;
+				}
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported entity.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( string != NULL )
+		{
+			if( character_size > ( string_size - safe_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: string is too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( string[ safe_size ] ),
+			     utf8_character,
+			     character_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy character.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		safe_size += character_size;
+	}
+	*decoded_size = safe_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the string of a string or key element
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_get_string_size(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_get_string_size";
+	size_t decoded_size   = 0;
+
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_decode_string(
+	     data,
+	     data_size,
+	     element,
+	     NULL,
+	     0,
+	     &decoded_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine decoded string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = decoded_size + 1;
+
+	return( 1 );
+}
+
+/* Copies the string of a string or key element
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_copy_string(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_copy_string";
+	size_t decoded_size   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_decode_string(
+	     data,
+	     data_size,
+	     element,
+	     string,
+	     string_size - 1,
+	     &decoded_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to decode string.",
+		 function );
+
+		return( -1 );
+	}
+	string[ decoded_size ] = 0;
+
+	return( 1 );
+}
+
+/* Copies an UUID string of a string element to a byte stream
+ * The byte stream is stored in big-endian
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_copy_uuid_string_to_byte_stream";
+	size_t byte_index     = 0;
+	size_t data_offset    = 0;
+	size_t string_index   = 0;
+	uint8_t byte_value    = 0;
+	uint8_t nibble        = 0;
+	uint8_t nibble_index  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->content_offset > data_size )
+	 || ( element->content_size > ( data_size - element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element->type != LIBFVDE_PLIST_ELEMENT_TYPE_STRING )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid byte stream size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The UUID string is formatted as: XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX
+	 */
+	if( element->content_size != 36 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UUID string size.",
+		 function );
+
+		return( -1 );
+	}
+	data_offset = element->content_offset;
+
+	for( string_index = 0;
+	     string_index < 36;
+	     string_index++ )
+	{
+		byte_value = data[ data_offset + string_index ];
+
+		if( ( string_index == 8 )
+		 || ( string_index == 13 )
+		 || ( string_index == 18 )
+		 || ( string_index == 23 ) )
+		{
+			if( byte_value != (uint8_t) '-' )
+			{
+				break;
+			}
+			continue;
+		}
+		if( ( byte_value >= (uint8_t) '0' )
+		 && ( byte_value <= (uint8_t) '9' ) )
+		{
+			nibble = byte_value - (uint8_t) '0';
+		}
+		else if( ( byte_value >= (uint8_t) 'a' )
+		      && ( byte_value <= (uint8_t) 'f' ) )
+		{
+			nibble = byte_value - (uint8_t) 'a' + 10;
+		}
+		else if( ( byte_value >= (uint8_t) 'A' )
+		      && ( byte_value <= (uint8_t) 'F' ) )
+		{
+			nibble = byte_value - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			break;
+		}
+		if( nibble_index == 0 )
+		{
+			byte_stream[ byte_index ] = (uint8_t) ( nibble << 4 );
+			nibble_index              = 1;
+		}
+		else
+		{
+			byte_stream[ byte_index++ ] |= nibble;
+			nibble_index                 = 0;
+		}
+	}
+	if( string_index != 36 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UUID string character at index: %" PRIzd ".",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the base64 encoded content of a data element
+ * Whitespace in the content is ignored
+ * If byte stream is NULL only the size of the decoded data is determined
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_decode_data(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *decoded_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfvde_plist_scanner_decode_data";
+	size_t content_end          = 0;
+	size_t data_offset          = 0;
+	size_t number_of_characters = 0;
+	size_t safe_size            = 0;
+	uint32_t value_32bit        = 0;
+	uint8_t byte_value          = 0;
+	uint8_t number_of_bits      = 0;
+	uint8_t number_of_padding   = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element->content_offset > data_size )
+	 || ( element->content_size > ( data_size - element->content_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element - content value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element->type != LIBFVDE_PLIST_ELEMENT_TYPE_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported element type.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded size.",
+		 function );
+
+		return( -1 );
+	}
+	content_end = element->content_offset + element->content_size;
+
+	for( data_offset = element->content_offset;
+	     data_offset < content_end;
+	     data_offset++ )
+	{
+		byte_value = data[ data_offset ];
+
+		if( ( byte_value == (uint8_t) ' ' )
+		 || ( byte_value == (uint8_t) '\t' )
+		 || ( byte_value == (uint8_t) '\n' )
+		 || ( byte_value == (uint8_t) '\r' ) )
+		{
+			continue;
+		}
+		number_of_characters++;
+
+		if( byte_value == (uint8_t) '=' )
+		{
+			number_of_padding++;
+
+			continue;
+		}
+		/* Only padding is allowed after the first padding character
+		 */
+		if( number_of_padding != 0 )
+		{
+			break;
+		}
+		if( ( byte_value >= (uint8_t) 'A' )
+		 && ( byte_value <= (uint8_t) 'Z' ) )
+		{
+			byte_value -= (uint8_t) 'A';
+		}
+		else if( ( byte_value >= (uint8_t) 'a' )
+		      && ( byte_value <= (uint8_t) 'z' ) )
+		{
+			byte_value -= (uint8_t) 'a' - 26;
+		}
+		else if( ( byte_value >= (uint8_t) '0' )
+		      && ( byte_value <= (uint8_t) '9' ) )
+		{
+			byte_value -= (uint8_t) '0' - 52;
+		}
+		else if( byte_value == (uint8_t) '+' )
+		{
+			byte_value = 62;
+		}
+		else if( byte_value == (uint8_t) '/' )
+		{
+			byte_value = 63;
+		}
+		else
+		{
+			break;
+		}
+		value_32bit     = ( value_32bit << 6 ) | byte_value;
+		number_of_bits += 6;
+
+		if( number_of_bits >= 8 )
+		{
+			number_of_bits -= 8;
+
+			if( byte_stream != NULL )
+			{
+				if( safe_size >= byte_stream_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: byte stream is too small.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream[ safe_size ] = (uint8_t) ( ( value_32bit >> number_of_bits ) & 0xff );
+			}
+			safe_size++;
+		}
+	}
+	if( data_offset < content_end )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base64 character at offset: %" PRIzd ".",
+		 function,
+		 data_offset );
+
+		return( -1 );
+	}
+	/* The base64 characters are padded to a multiple of 4
+	 */
+	if( ( ( number_of_characters % 4 ) != 0 )
+	 || ( number_of_padding > 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported base64 padding.",
+		 function );
+
+		return( -1 );
+	}
+	*decoded_size = safe_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the decoded data of a data element
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_get_data_size(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     size_t *decoded_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_get_data_size";
+
+	if( decoded_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decoded data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_decode_data(
+	     data,
+	     data_size,
+	     element,
+	     NULL,
+	     0,
+	     decoded_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine decoded data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the decoded data of a data element to a byte stream
+ * The byte stream size should be the size of the decoded data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_plist_scanner_copy_data(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_plist_scanner_copy_data";
+	size_t decoded_size   = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_plist_scanner_decode_data(
+	     data,
+	     data_size,
+	     element,
+	     byte_stream,
+	     byte_stream_size,
+	     &decoded_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to decode data.",
+		 function );
+
+		return( -1 );
+	}
+	if( decoded_size != byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
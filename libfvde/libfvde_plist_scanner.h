@@ -0,0 +1,193 @@
+/*
+ * Streaming (XML) plist scanner functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_PLIST_SCANNER_H )
+#define _LIBFVDE_PLIST_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_plist_element libfvde_plist_element_t;
+
+/* The plist element only references the plist data,
+ * no data is copied and nothing is allocated
+ */
+struct libfvde_plist_element
+{
+	/* The element type
+	 */
+	uint8_t type;
+
+	/* The content offset, relative to the start of the plist data
+	 */
+	size_t content_offset;
+
+	/* The content size
+	 */
+	size_t content_size;
+
+	/* The offset directly after the end of the element
+	 */
+	size_t end_offset;
+};
+
+int libfvde_plist_scanner_skip_markup(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     uint8_t *is_empty_element,
+     libcerror_error_t **error );
+
+uint8_t libfvde_plist_scanner_get_element_type(
+         const uint8_t *name,
+         size_t name_length );
+
+int libfvde_plist_scanner_read_element(
+     const uint8_t *data,
+     size_t data_size,
+     size_t *data_offset,
+     libfvde_plist_element_t *element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_root_dict(
+     const uint8_t *data,
+     size_t data_size,
+     libfvde_plist_element_t *dict_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_compare_key(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *key_element,
+     const char *key,
+     size_t key_length,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_read_dict_entry(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *dict_element,
+     size_t *data_offset,
+     libfvde_plist_element_t *key_element,
+     libfvde_plist_element_t *value_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_dict_value_by_key(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *dict_element,
+     const char *key,
+     size_t key_length,
+     libfvde_plist_element_t *value_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_array_number_of_entries(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *array_element,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_array_entry_by_index(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *array_element,
+     int entry_index,
+     libfvde_plist_element_t *entry_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_array_next_entry(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *array_element,
+     const libfvde_plist_element_t *previous_entry_element,
+     libfvde_plist_element_t *entry_element,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_decode_string(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *string,
+     size_t string_size,
+     size_t *decoded_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_string_size(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_copy_string(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_decode_data(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *decoded_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_get_data_size(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     size_t *decoded_data_size,
+     libcerror_error_t **error );
+
+int libfvde_plist_scanner_copy_data(
+     const uint8_t *data,
+     size_t data_size,
+     const libfvde_plist_element_t *element,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_PLIST_SCANNER_H ) */
+
@@ -0,0 +1,463 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+#include "libfvde_read_ahead.h"
+#include "libfvde_read_request.h"
+
+/* Creates a read-ahead
+ * Make sure the value read_ahead is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_ahead_initialize(
+     libfvde_read_ahead_t **read_ahead,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_ahead_initialize";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*read_ahead = memory_allocate_structure(
+	               libfvde_read_ahead_t );
+
+	if( *read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_ahead,
+	     0,
+	     sizeof( libfvde_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read-ahead.",
+		 function );
+
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *read_ahead )->data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * data_size );
+
+	if( ( *read_ahead )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	( *read_ahead )->prefetch_data = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * data_size );
+
+	if( ( *read_ahead )->prefetch_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create prefetch data.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *read_ahead )->data_size       = data_size;
+	( *read_ahead )->prefetch_offset = -1;
+	( *read_ahead )->prefetch_size   = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *read_ahead != NULL )
+	{
+		if( ( *read_ahead )->data != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->data );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read-ahead
+ * A pending prefetch is waited for, hence the read thread pool must be joined
+ * or the logical volume lock released before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_ahead_free(
+     libfvde_read_ahead_t **read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_ahead_free";
+	int result            = 1;
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_ahead != NULL )
+	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( ( *read_ahead )->prefetch_read_request != NULL )
+		{
+			if( libfvde_read_request_free(
+			     &( ( *read_ahead )->prefetch_read_request ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free prefetch read request.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *read_ahead )->prefetch_data != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->prefetch_data );
+		}
+#endif
+		if( ( *read_ahead )->data != NULL )
+		{
+			memory_free(
+			 ( *read_ahead )->data );
+		}
+		memory_free(
+		 *read_ahead );
+
+		*read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Sets the range of the data that was read
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_ahead_set_data_range(
+     libfvde_read_ahead_t *read_ahead,
+     off64_t data_offset,
+     size_t valid_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_ahead_set_data_range";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( valid_data_size > read_ahead->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid valid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_ahead->data_offset     = data_offset;
+	read_ahead->valid_data_size = valid_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the data at a specific offset
+ * A completed prefetch that contains the offset replaces the current data
+ * Returns 1 if successful, 0 if the offset is not read ahead or -1 on error
+ */
+int libfvde_read_ahead_get_data(
+     libfvde_read_ahead_t *read_ahead,
+     off64_t offset,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfvde_read_ahead_get_data";
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	uint8_t *prefetch_data  = NULL;
+	ssize_t read_count      = 0;
+	off64_t prefetch_offset = 0;
+	int result              = 0;
+#endif
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset >= read_ahead->data_offset )
+	 && ( (size64_t) ( offset - read_ahead->data_offset ) < (size64_t) read_ahead->valid_data_size ) )
+	{
+		*data      = &( read_ahead->data[ offset - read_ahead->data_offset ] );
+		*data_size = read_ahead->valid_data_size - (size_t) ( offset - read_ahead->data_offset );
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( read_ahead->prefetch_read_request == NULL )
+	{
+		return( 0 );
+	}
+	result = libfvde_read_request_get_read_count(
+	          read_ahead->prefetch_read_request,
+	          &read_count,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch read count.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* The prefetch is still pending
+		 */
+		return( 0 );
+	}
+	if( libfvde_read_request_get_offset(
+	     read_ahead->prefetch_read_request,
+	     &prefetch_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve prefetch offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_read_request_free(
+	     &( read_ahead->prefetch_read_request ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free prefetch read request.",
+		 function );
+
+		return( -1 );
+	}
+	/* A prefetch that failed or does not contain the offset is discarded
+	 */
+	if( ( read_count <= 0 )
+	 || ( offset < prefetch_offset )
+	 || ( (size64_t) ( offset - prefetch_offset ) >= (size64_t) read_count ) )
+	{
+		return( 0 );
+	}
+	prefetch_data             = read_ahead->prefetch_data;
+	read_ahead->prefetch_data = read_ahead->data;
+	read_ahead->data          = prefetch_data;
+
+	read_ahead->data_offset     = prefetch_offset;
+	read_ahead->valid_data_size = (size_t) read_count;
+
+	*data      = &( read_ahead->data[ offset - read_ahead->data_offset ] );
+	*data_size = read_ahead->valid_data_size - (size_t) ( offset - read_ahead->data_offset );
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Invalidates the data that overlaps with a specific range
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_read_ahead_invalidate(
+     libfvde_read_ahead_t *read_ahead,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_read_ahead_invalidate";
+
+	if( read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_ahead->valid_data_size > 0 )
+	 && ( (size64_t) offset < (size64_t) read_ahead->data_offset + read_ahead->valid_data_size )
+	 && ( (size64_t) read_ahead->data_offset < (size64_t) offset + size ) )
+	{
+		read_ahead->valid_data_size = 0;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,113 @@
+/*
+ * Read-ahead functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_READ_AHEAD_H )
+#define _LIBFVDE_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_read_ahead libfvde_read_ahead_t;
+
+struct libfvde_read_ahead
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the data relative to the start of the logical volume
+	 */
+	off64_t data_offset;
+
+	/* The number of bytes of data that are valid
+	 */
+	size_t valid_data_size;
+
+	/* The offset of the next prefetch or -1 if no prefetch is needed
+	 */
+	off64_t prefetch_offset;
+
+	/* The size of the next prefetch, at most the data size
+	 */
+	size_t prefetch_size;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The prefetch data
+	 */
+	uint8_t *prefetch_data;
+
+	/* The prefetch read request
+	 */
+	libfvde_read_request_t *prefetch_read_request;
+
+	/* Value to indicate the prefetch data is in use by a prefetch that is being submitted
+	 */
+	uint8_t is_prefetching;
+#endif
+};
+
+int libfvde_read_ahead_initialize(
+     libfvde_read_ahead_t **read_ahead,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfvde_read_ahead_free(
+     libfvde_read_ahead_t **read_ahead,
+     libcerror_error_t **error );
+
+int libfvde_read_ahead_set_data_range(
+     libfvde_read_ahead_t *read_ahead,
+     off64_t data_offset,
+     size_t valid_data_size,
+     libcerror_error_t **error );
+
+int libfvde_read_ahead_get_data(
+     libfvde_read_ahead_t *read_ahead,
+     off64_t offset,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libfvde_read_ahead_invalidate(
+     libfvde_read_ahead_t *read_ahead,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_READ_AHEAD_H ) */
+
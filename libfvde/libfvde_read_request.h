@@ -0,0 +1,144 @@
+/*
+ * Read request functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_READ_REQUEST_H )
+#define _LIBFVDE_READ_REQUEST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_extern.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcthreads.h"
+#include "libfvde_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_internal_read_request libfvde_internal_read_request_t;
+
+struct libfvde_internal_read_request
+{
+	/* The logical volume
+	 */
+	libfvde_logical_volume_t *logical_volume;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset
+	 */
+	off64_t offset;
+
+	/* The completion callback
+	 */
+	void (*callback)(
+	       libfvde_read_request_t *read_request,
+	       intptr_t *callback_data );
+
+	/* The completion callback data
+	 */
+	intptr_t *callback_data;
+
+	/* The number of bytes read or -1 on error
+	 */
+	ssize_t read_count;
+
+	/* Value to indicate the read request is complete
+	 */
+	uint8_t is_complete;
+
+	/* Value to indicate the read request is not referenced by the library
+	 */
+	uint8_t is_released;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The completion condition
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libfvde_read_request_initialize(
+     libfvde_read_request_t **read_request,
+     libfvde_logical_volume_t *logical_volume,
+     uint8_t *buffer,
+     size_t buffer_size,
+     off64_t offset,
+     void (*callback)(
+            libfvde_read_request_t *read_request,
+            intptr_t *callback_data ),
+     intptr_t *callback_data,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_request_free(
+     libfvde_read_request_t **read_request,
+     libcerror_error_t **error );
+
+int libfvde_read_request_set_pending(
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+int libfvde_read_request_set_complete(
+     libfvde_read_request_t *read_request,
+     ssize_t read_count,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_request_is_complete(
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_request_wait(
+     libfvde_read_request_t *read_request,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_request_get_read_count(
+     libfvde_read_request_t *read_request,
+     ssize_t *read_count,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_read_request_get_offset(
+     libfvde_read_request_t *read_request,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_READ_REQUEST_H ) */
+
@@ -28,6 +28,7 @@
 #include "libfvde_definitions.h"
 #include "libfvde_encryption_context.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
 #include "libfvde_sector_data.h"
@@ -124,7 +125,8 @@ int libfvde_sector_data_initialize(
 
 		goto on_error;
 	}
-	( *sector_data )->data_size = data_size;
+	( *sector_data )->data_size       = data_size;
+	( *sector_data )->reference_count = 1;
 
 	return( 1 );
 
@@ -140,6 +142,8 @@ on_error:
 }
 
 /* Frees sector data
+ * Sector data that is referenced by a block reference is only released and
+ * freed when its last reference is released
  * Returns 1 if successful or -1 on error
  */
 int libfvde_sector_data_free(
@@ -162,6 +166,14 @@ int libfvde_sector_data_free(
 	}
 	if( *sector_data != NULL )
 	{
+		( *sector_data )->reference_count -= 1;
+
+		if( ( *sector_data )->reference_count > 0 )
+		{
+			*sector_data = NULL;
+
+			return( 1 );
+		}
 		if( ( *sector_data )->data != NULL )
 		{
 			if( memory_set(
@@ -189,6 +201,44 @@ int libfvde_sector_data_free(
 	return( result );
 }
 
+/* Adds a reference to sector data
+ * Every reference must be released with libfvde_sector_data_free
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_sector_data_add_reference(
+     libfvde_sector_data_t *sector_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_sector_data_add_reference";
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data->reference_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sector data - reference count value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sector_data->reference_count += 1;
+
+	return( 1 );
+}
+
 /* Reads sector data
  * Returns 1 if successful or -1 on error
  */
@@ -254,6 +304,23 @@ int libfvde_sector_data_read(
 
 			goto on_error;
 		}
+		/* Clear the encrypted data so that a partial or failed read does not
+		 * decrypt uninitialized memory
+		 */
+		if( memory_set(
+		     encrypted_data,
+		     0,
+		     sizeof( uint8_t ) * sector_data->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear encrypted data.",
+			 function );
+
+			goto on_error;
+		}
 		read_count = libbfio_pool_read_buffer_at_offset(
 			      file_io_pool,
 			      file_io_pool_entry,
@@ -367,3 +434,436 @@ on_error:
 	return( -1 );
 }
 
+/* Reads data, where a failed read is retried at progressively smaller granularity
+ * Data that cannot be read at LIBFVDE_MINIMUM_READ_RETRY_SIZE granularity is recorded
+ * in the read errors range list, relative to the range offset
+ * Returns 1 if successful, 0 if some of the data could not be read or -1 on error
+ */
+int libfvde_sector_data_read_data_with_retry(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     uint64_t range_offset,
+     libcdata_range_list_t *read_errors,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "libfvde_sector_data_read_data_with_retry";
+	size_t data_offset            = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+	int read_result               = 0;
+	int result                    = 1;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_errors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read errors.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_pool_read_buffer_at_offset(
+	              file_io_pool,
+	              file_io_pool_entry,
+	              data,
+	              data_size,
+	              file_offset,
+	              &read_error );
+
+	if( read_count == (ssize_t) data_size )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: unable to read: %" PRIzd " bytes of data at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+		 function,
+		 data_size,
+		 file_offset,
+		 file_offset );
+
+		if( read_error != NULL )
+		{
+			libcnotify_print_error_backtrace(
+			 read_error );
+		}
+	}
+#endif
+	libcerror_error_free(
+	 &read_error );
+
+	read_size = data_size / 2;
+
+	if( read_size < LIBFVDE_MINIMUM_READ_RETRY_SIZE )
+	{
+		if( libcdata_range_list_insert_range(
+		     read_errors,
+		     range_offset,
+		     (uint64_t) data_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert read error range.",
+			 function );
+
+			return( -1 );
+		}
+		return( 0 );
+	}
+	while( data_offset < data_size )
+	{
+		if( read_size > ( data_size - data_offset ) )
+		{
+			read_size = data_size - data_offset;
+		}
+		read_result = libfvde_sector_data_read_data_with_retry(
+		               file_io_pool,
+		               file_io_pool_entry,
+		               &( data[ data_offset ] ),
+		               read_size,
+		               file_offset + (off64_t) data_offset,
+		               range_offset + (uint64_t) data_offset,
+		               read_errors,
+		               error );
+
+		if( read_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset + (off64_t) data_offset,
+			 file_offset + (off64_t) data_offset );
+
+			return( -1 );
+		}
+		else if( read_result == 0 )
+		{
+			result = 0;
+		}
+		data_offset += read_size;
+	}
+	return( result );
+}
+
+/* Reads sector data, where unreadable data is filled with the fill byte
+ * Unreadable data is recorded in the read errors range list, relative to the read errors offset
+ * Returns 1 if successful, 0 if some of the sector data could not be read or -1 on error
+ */
+int libfvde_sector_data_read_with_error_tolerance(
+     libfvde_sector_data_t *sector_data,
+     libfvde_encryption_context_t *encryption_context,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint64_t block_number,
+     uint8_t is_encrypted,
+     uint8_t fill_byte,
+     libcdata_range_list_t *read_errors,
+     uint64_t read_errors_offset,
+     libcerror_error_t **error )
+{
+	libcdata_range_list_t *sector_read_errors = NULL;
+	uint8_t *encrypted_data                   = NULL;
+	uint8_t *read_data                        = NULL;
+	static char *function                     = "libfvde_sector_data_read_with_error_tolerance";
+	uint64_t range_size                       = 0;
+	uint64_t range_start                      = 0;
+	intptr_t *range_value                     = NULL;
+	int number_of_ranges                      = 0;
+	int range_index                           = 0;
+	int result                                = 0;
+
+	if( sector_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sector data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sector_data->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid sector data - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_errors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read errors.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_initialize(
+	     &sector_read_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sector read errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( is_encrypted != 0 )
+	{
+		encrypted_data = (uint8_t *) memory_allocate(
+		                              sizeof( uint8_t ) * sector_data->data_size );
+
+		if( encrypted_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create encrypted data.",
+			 function );
+
+			goto on_error;
+		}
+		/* Clear the encrypted data so that a partial or failed read does not
+		 * decrypt uninitialized memory
+		 */
+		if( memory_set(
+		     encrypted_data,
+		     0,
+		     sizeof( uint8_t ) * sector_data->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear encrypted data.",
+			 function );
+
+			goto on_error;
+		}
+		read_data = encrypted_data;
+	}
+	else
+	{
+		read_data = sector_data->data;
+	}
+	result = libfvde_sector_data_read_data_with_retry(
+	          file_io_pool,
+	          file_io_pool_entry,
+	          read_data,
+	          sector_data->data_size,
+	          file_offset,
+	          0,
+	          sector_read_errors,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sector data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	if( is_encrypted != 0 )
+	{
+		if( libfvde_encryption_context_crypt(
+		     encryption_context,
+		     LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		     encrypted_data,
+		     sector_data->data_size,
+		     sector_data->data,
+		     sector_data->data_size,
+		     block_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 encrypted_data );
+
+		encrypted_data = NULL;
+	}
+	if( result == 0 )
+	{
+		/* The unreadable ranges are filled after decryption so that the fill pattern
+		 * is not scrambled by the decryption
+		 */
+		if( libcdata_range_list_get_number_of_elements(
+		     sector_read_errors,
+		     &number_of_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sector read error ranges.",
+			 function );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcdata_range_list_get_range_by_index(
+			     sector_read_errors,
+			     range_index,
+			     &range_start,
+			     &range_size,
+			     &range_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sector read error range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			if( ( range_start > (uint64_t) sector_data->data_size )
+			 || ( range_size > ( (uint64_t) sector_data->data_size - range_start ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid sector read error range: %d value out of bounds.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			if( memory_set(
+			     &( ( sector_data->data )[ range_start ] ),
+			     fill_byte,
+			     (size_t) range_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to fill unreadable sector data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libcdata_range_list_insert_range(
+			     read_errors,
+			     read_errors_offset + range_start,
+			     range_size,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert read error range.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libcdata_range_list_free(
+	     &sector_read_errors,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sector read errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( encrypted_data != NULL )
+	{
+		memory_free(
+		 encrypted_data );
+	}
+	if( sector_read_errors != NULL )
+	{
+		libcdata_range_list_free(
+		 &sector_read_errors,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -28,6 +28,7 @@
 
 #include "libfvde_encryption_context.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 
 #if defined( __cplusplus )
@@ -45,6 +46,10 @@ struct libfvde_sector_data
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The number of references
+	 */
+	int reference_count;
 };
 
 int libfvde_sector_data_initialize(
@@ -56,6 +61,10 @@ int libfvde_sector_data_free(
      libfvde_sector_data_t **sector_data,
      libcerror_error_t **error );
 
+int libfvde_sector_data_add_reference(
+     libfvde_sector_data_t *sector_data,
+     libcerror_error_t **error );
+
 int libfvde_sector_data_read(
      libfvde_sector_data_t *sector_data,
      libfvde_encryption_context_t *encryption_context,
@@ -66,6 +75,29 @@ int libfvde_sector_data_read(
      uint8_t is_encrypted,
      libcerror_error_t **error );
 
+int libfvde_sector_data_read_data_with_retry(
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     uint8_t *data,
+     size_t data_size,
+     off64_t file_offset,
+     uint64_t range_offset,
+     libcdata_range_list_t *read_errors,
+     libcerror_error_t **error );
+
+int libfvde_sector_data_read_with_error_tolerance(
+     libfvde_sector_data_t *sector_data,
+     libfvde_encryption_context_t *encryption_context,
+     libbfio_pool_t *file_io_pool,
+     int file_io_pool_entry,
+     off64_t file_offset,
+     uint64_t block_number,
+     uint8_t is_encrypted,
+     uint8_t fill_byte,
+     libcdata_range_list_t *read_errors,
+     uint64_t read_errors_offset,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
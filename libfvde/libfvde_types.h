@@ -35,18 +35,28 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfvde_block_reference {}		libfvde_block_reference_t;
 typedef struct libfvde_encryption_context_plist {}	libfvde_encryption_context_plist_t;
+typedef struct libfvde_executor {}			libfvde_executor_t;
 typedef struct libfvde_logical_volume {}		libfvde_logical_volume_t;
+typedef struct libfvde_memory_budget {}			libfvde_memory_budget_t;
 typedef struct libfvde_physical_volume {}		libfvde_physical_volume_t;
+typedef struct libfvde_read_request {}			libfvde_read_request_t;
 typedef struct libfvde_volume {}			libfvde_volume_t;
 typedef struct libfvde_volume_group {}			libfvde_volume_group_t;
+typedef struct libfvde_volume_scanner {}		libfvde_volume_scanner_t;
 
 #else
+typedef intptr_t libfvde_block_reference_t;
 typedef intptr_t libfvde_encryption_context_plist_t;
+typedef intptr_t libfvde_executor_t;
 typedef intptr_t libfvde_logical_volume_t;
+typedef intptr_t libfvde_memory_budget_t;
 typedef intptr_t libfvde_physical_volume_t;
+typedef intptr_t libfvde_read_request_t;
 typedef intptr_t libfvde_volume_t;
 typedef intptr_t libfvde_volume_group_t;
+typedef intptr_t libfvde_volume_scanner_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
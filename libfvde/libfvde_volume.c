@@ -31,13 +31,17 @@
 #include "libfvde_definitions.h"
 #include "libfvde_encrypted_metadata.h"
 #include "libfvde_encryption_context_plist.h"
+#include "libfvde_executor.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcnotify.h"
 #include "libfvde_libcthreads.h"
 #include "libfvde_logical_volume.h"
 #include "libfvde_logical_volume_descriptor.h"
+#include "libfvde_memory_budget.h"
+#include "libfvde_memory_usage.h"
 #include "libfvde_metadata.h"
 #include "libfvde_password.h"
 #include "libfvde_volume.h"
@@ -123,6 +127,20 @@ int libfvde_volume_initialize(
 
 		goto on_error;
 	}
+	if( libcdata_array_initialize(
+	     &( internal_volume->logical_volumes_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volumes array.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_volume->read_write_lock ),
@@ -138,6 +156,21 @@ int libfvde_volume_initialize(
 		goto on_error;
 	}
 #endif
+	if( libfvde_memory_usage_set_compact_function(
+	     internal_volume->io_handle->memory_usage,
+	     (intptr_t *) internal_volume,
+	     (int (*)(intptr_t *, libcerror_error_t **)) &libfvde_internal_volume_compact,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set compact function.",
+		 function );
+
+		goto on_error;
+	}
 	*volume = (libfvde_volume_t *) internal_volume;
 
 	return( 1 );
@@ -145,6 +178,27 @@ int libfvde_volume_initialize(
 on_error:
 	if( internal_volume != NULL )
 	{
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+		if( internal_volume->read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( internal_volume->read_write_lock ),
+			 NULL );
+		}
+#endif
+		if( internal_volume->logical_volumes_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_volume->logical_volumes_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_volume->io_handle != NULL )
+		{
+			libfvde_io_handle_free(
+			 &( internal_volume->io_handle ),
+			 NULL );
+		}
 		memory_free(
 		 internal_volume );
 	}
@@ -177,6 +231,22 @@ int libfvde_volume_free(
 	{
 		internal_volume = (libfvde_internal_volume_t *) *volume;
 
+		/* Detach the memory budget first so that it no longer compacts the volume
+		 */
+		if( libfvde_memory_usage_set_memory_budget(
+		     internal_volume->io_handle->memory_usage,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to detach memory budget.",
+			 function );
+
+			result = -1;
+		}
 		if( ( internal_volume->file_io_handle != NULL )
 		 || ( internal_volume->physical_volume_file_io_pool != NULL ) )
 		{
@@ -285,6 +355,20 @@ int libfvde_volume_free(
 				result = -1;
 			}
 		}
+		if( libcdata_array_free(
+		     &( internal_volume->logical_volumes_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_internal_logical_volume_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volumes array.",
+			 function );
+
+			result = -1;
+		}
 		if( libfvde_io_handle_free(
 		     &( internal_volume->io_handle ),
 		     error ) != 1 )
@@ -1970,6 +2054,20 @@ int libfvde_volume_close(
 			result = -1;
 		}
 	}
+	if( libcdata_array_empty(
+	     internal_volume->logical_volumes_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_internal_logical_volume_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty logical volumes array.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_volume->legacy_file_io_pool != NULL )
 	{
 		if( libbfio_pool_remove_handle(
@@ -2014,6 +2112,19 @@ int libfvde_volume_close(
 			result = -1;
 		}
 	}
+	if( libfvde_internal_volume_update_metadata_memory_usage(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update metadata memory usage.",
+		 function );
+
+		result = -1;
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -2040,6 +2151,7 @@ int libfvde_internal_volume_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
 	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
 	libfvde_metadata_t *metadata                                   = NULL;
 	libfvde_metadata_t *safe_metadata                              = NULL;
@@ -2386,14 +2498,28 @@ int libfvde_internal_volume_open_read(
 				}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-				if( libfvde_logical_volume_initialize(
-				      &( internal_volume->legacy_logical_volume ),
+				if( libfvde_internal_logical_volume_initialize(
+				      &internal_logical_volume,
 				      internal_volume->io_handle,
 				      internal_volume->legacy_file_io_pool,
 				      logical_volume_descriptor,
 				      internal_volume->encrypted_metadata1,
 				      internal_volume->encrypted_root_plist,
 				      error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create internal logical volume.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfvde_logical_volume_initialize(
+				      &( internal_volume->legacy_logical_volume ),
+				      internal_logical_volume,
+				      error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
@@ -2459,7 +2585,7 @@ int libfvde_internal_volume_open_read(
 					}
 				}
 				if( libfvde_internal_logical_volume_open_read(
-				     (libfvde_internal_logical_volume_t *) internal_volume->legacy_logical_volume,
+				     internal_logical_volume,
 				     internal_volume->legacy_file_io_pool,
 				     error ) != 1 )
 				{
@@ -2472,6 +2598,21 @@ int libfvde_internal_volume_open_read(
 
 					goto on_error;
 				}
+				/* The legacy logical volume holds its own reference to the internal logical volume
+				 */
+				if( libfvde_internal_logical_volume_free(
+				     &internal_logical_volume,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release internal logical volume.",
+					 function );
+
+					goto on_error;
+				}
 			}
 		}
 	}
@@ -2484,6 +2625,12 @@ on_error:
 		 &( internal_volume->legacy_logical_volume ),
 		 NULL );
 	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
 	if( internal_volume->legacy_file_io_pool != NULL )
 	{
 		libbfio_pool_free(
@@ -2887,6 +3034,19 @@ int libfvde_internal_volume_open_read_physical_volume_files(
 			goto on_error;
 		}
 	}
+	if( libfvde_internal_volume_update_metadata_memory_usage(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update metadata memory usage.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -3221,6 +3381,19 @@ int libfvde_volume_read_encrypted_root_plist_file_io_handle(
 
 		goto on_error;
 	}
+	if( libfvde_internal_volume_update_metadata_memory_usage(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update metadata memory usage.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_volume->read_write_lock,
@@ -3328,6 +3501,7 @@ int libfvde_volume_get_volume_group(
 #endif
 	if( libfvde_volume_group_initialize(
 	      volume_group,
+	      volume,
 	      internal_volume->io_handle,
 	      internal_volume->physical_volume_file_io_pool,
 	      internal_volume->volume_header,
@@ -3363,21 +3537,25 @@ int libfvde_volume_get_volume_group(
 	return( result );
 }
 
-/* The following functions have been deprecated and will be removed
- */
-
-/* Unlocks the volume
- * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+/* Retrieves a specific logical volume
+ * The internal logical volume is opened on first retrieval and kept by the volume,
+ * every retrieval returns a new logical volume that references it
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
  */
-int libfvde_volume_unlock(
-     libfvde_volume_t *volume,
+int libfvde_internal_volume_get_logical_volume_by_index(
+     libfvde_internal_volume_t *internal_volume,
+     int volume_index,
+     libfvde_logical_volume_t **logical_volume,
      libcerror_error_t **error )
 {
-	libfvde_internal_volume_t *internal_volume = NULL;
-	static char *function                      = "libfvde_volume_unlock";
-	int result                                 = 1;
+	libfvde_internal_logical_volume_t *cached_logical_volume       = NULL;
+	libfvde_internal_logical_volume_t *new_logical_volume          = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	static char *function                                          = "libfvde_internal_volume_get_logical_volume_by_index";
+	int number_of_entries                                          = 0;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3388,66 +3566,189 @@ int libfvde_volume_unlock(
 
 		return( -1 );
 	}
-	internal_volume = (libfvde_internal_volume_t *) volume;
-
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( volume_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid volume index value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libfvde_logical_volume_unlock(
-	          internal_volume->legacy_logical_volume,
-	          error );
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
 
-	if( result == -1 )
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->logical_volumes_array,
+	     &number_of_entries,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to unlock volume.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from logical volumes array.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_volume->read_write_lock,
+	if( volume_index < number_of_entries )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume->logical_volumes_array,
+		     volume_index,
+		     (intptr_t **) &cached_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d from array.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+	}
+	if( cached_logical_volume == NULL )
+	{
+		if( libfvde_encrypted_metadata_get_logical_volume_descriptor_by_index(
+		     internal_volume->encrypted_metadata1,
+		     volume_index,
+		     &logical_volume_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume descriptor: %d from encrypted metadata.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		if( libfvde_internal_logical_volume_initialize(
+		      &new_logical_volume,
+		      internal_volume->io_handle,
+		      internal_volume->physical_volume_file_io_pool,
+		      logical_volume_descriptor,
+		      internal_volume->encrypted_metadata1,
+		      internal_volume->encrypted_root_plist,
+		      error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create internal logical volume.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_internal_logical_volume_open_read(
+		     new_logical_volume,
+		     internal_volume->physical_volume_file_io_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read logical volume.",
+			 function );
+
+			goto on_error;
+		}
+		if( volume_index >= number_of_entries )
+		{
+			if( libcdata_array_resize(
+			     internal_volume->logical_volumes_array,
+			     volume_index + 1,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_internal_logical_volume_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize logical volumes array.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_volume->logical_volumes_array,
+		     volume_index,
+		     (intptr_t *) new_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set logical volume: %d in array.",
+			 function,
+			 volume_index );
+
+			goto on_error;
+		}
+		/* The logical volumes array takes over management of the internal logical volume
+		 */
+		cached_logical_volume = new_logical_volume;
+		new_logical_volume    = NULL;
+	}
+	if( libfvde_logical_volume_initialize(
+	     logical_volume,
+	     cached_logical_volume,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create logical volume: %d.",
+		 function,
+		 volume_index );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	return( 1 );
+
+on_error:
+	if( new_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &new_logical_volume,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Determines if the volume is locked
- * Returns 1 if locked, 0 if not or -1 on error
+/* Retrieves the transaction identifier of the metadata
+ * This is the transaction identifier of the most recent metadata copy, which is used
+ * to determine the logical volume layout
+ * Returns 1 if successful or -1 on error
  */
-int libfvde_volume_is_locked(
+int libfvde_volume_get_transaction_identifier(
      libfvde_volume_t *volume,
+     uint64_t *transaction_identifier,
      libcerror_error_t **error )
 {
 	libfvde_internal_volume_t *internal_volume = NULL;
-	static char *function                      = "libfvde_volume_is_locked";
-	int result                                 = 0;
+	static char *function                      = "libfvde_volume_get_transaction_identifier";
 
 	if( volume == NULL )
 	{
@@ -3462,10 +3763,166 @@ int libfvde_volume_is_locked(
 	}
 	internal_volume = (libfvde_internal_volume_t *) volume;
 
-#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume->read_write_lock,
-	     error ) != 1 )
+	if( internal_volume->metadata == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( transaction_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*transaction_identifier = internal_volume->metadata->transaction_identifier;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* The following functions have been deprecated and will be removed
+ */
+
+/* Unlocks the volume
+ * Returns 1 if the volume is unlocked, 0 if not or -1 on error
+ */
+int libfvde_volume_unlock(
+     libfvde_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_unlock";
+	int result                                 = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfvde_logical_volume_unlock(
+	          internal_volume->legacy_logical_volume,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unlock volume.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determines if the volume is locked
+ * Returns 1 if locked, 0 if not or -1 on error
+ */
+int libfvde_volume_is_locked(
+     libfvde_volume_t *volume,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_is_locked";
+	int result                                 = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -3510,6 +3967,557 @@ int libfvde_volume_is_locked(
 	return( result );
 }
 
+/* Updates the metadata memory usage of the volume
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_volume_update_metadata_memory_usage(
+     libfvde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfvde_internal_volume_update_metadata_memory_usage";
+	size64_t memory_usage  = 0;
+	size64_t metadata_size = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume->encrypted_metadata1 != NULL )
+	{
+		if( libfvde_encrypted_metadata_get_memory_usage(
+		     internal_volume->encrypted_metadata1,
+		     &memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of encrypted metadata 1.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_size += memory_usage;
+	}
+	if( internal_volume->encrypted_metadata2 != NULL )
+	{
+		if( libfvde_encrypted_metadata_get_memory_usage(
+		     internal_volume->encrypted_metadata2,
+		     &memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of encrypted metadata 2.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_size += memory_usage;
+	}
+	if( internal_volume->encrypted_root_plist != NULL )
+	{
+		if( libfvde_encryption_context_plist_get_memory_usage(
+		     internal_volume->encrypted_root_plist,
+		     &memory_usage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory usage of encrypted root plist.",
+			 function );
+
+			return( -1 );
+		}
+		metadata_size += memory_usage;
+	}
+	if( libfvde_memory_usage_set_used_size(
+	     internal_volume->io_handle->memory_usage,
+	     LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	     metadata_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set metadata memory usage.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the memory budget
+ * The memory used by the volume and its logical volumes is accounted in the budget
+ * A budget of NULL detaches the volume from its current budget
+ * The read/write lock is not held, since the memory budget can compact the volume
+ * while the memory usage is moved from one budget to the other
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_set_memory_budget(
+     libfvde_volume_t *volume,
+     libfvde_memory_budget_t *memory_budget,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_memory_budget";
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+	if( libfvde_memory_usage_set_memory_budget(
+	     internal_volume->io_handle->memory_usage,
+	     memory_budget,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory budget.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compacts the logical volumes of the volume on request of the memory budget
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_internal_volume_compact(
+     libfvde_internal_volume_t *internal_volume,
+     libcerror_error_t **error )
+{
+	libfvde_internal_logical_volume_t *internal_logical_volume = NULL;
+	static char *function                                      = "libfvde_internal_volume_compact";
+	int entry_index                                            = 0;
+	int number_of_entries                                      = 0;
+
+	if( internal_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume->logical_volumes_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from logical volumes array.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_volume->logical_volumes_array,
+		     entry_index,
+		     (intptr_t **) &internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: %d from array.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* Logical volumes are only opened on first retrieval
+		 */
+		if( internal_logical_volume == NULL )
+		{
+			continue;
+		}
+		if( libfvde_internal_logical_volume_compact_on_request(
+		     internal_logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to compact logical volume: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_volume->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the memory usage
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_get_memory_usage(
+     libfvde_volume_t *volume,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_get_memory_usage";
+	int result                                 = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfvde_internal_volume_update_metadata_memory_usage(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update metadata memory usage.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfvde_memory_usage_get_used_size(
+	          internal_volume->io_handle->memory_usage,
+	          used_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve used size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the memory usage of a specific memory usage type
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_get_memory_usage_by_type(
+     libfvde_volume_t *volume,
+     int usage_type,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_get_memory_usage_by_type";
+	int result                                 = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfvde_internal_volume_update_metadata_memory_usage(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update metadata memory usage.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfvde_memory_usage_get_used_size_by_type(
+	          internal_volume->io_handle->memory_usage,
+	          usage_type,
+	          used_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve used size of usage type: %d.",
+		 function,
+		 usage_type );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the executor
+ * The parallel work of the volume and its logical volumes is scheduled with the executor
+ * An executor of NULL detaches the volume from its current executor, after which
+ * the library uses its own threads
+ * Logical volumes that already started parallel work keep using their executor
+ * until they are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_set_executor(
+     libfvde_volume_t *volume,
+     libfvde_executor_t *executor,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_t *internal_volume = NULL;
+	static char *function                      = "libfvde_volume_set_executor";
+	int result                                 = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) volume;
+
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_volume->io_handle->executor != executor )
+	{
+		if( executor != NULL )
+		{
+			if( libfvde_executor_attach(
+			     executor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to attach executor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( result == 1 )
+		 && ( internal_volume->io_handle->executor != NULL ) )
+		{
+			if( libfvde_executor_detach(
+			     internal_volume->io_handle->executor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to detach executor.",
+				 function );
+
+				if( executor != NULL )
+				{
+					libfvde_executor_detach(
+					 executor,
+					 NULL );
+				}
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			internal_volume->io_handle->executor = executor;
+		}
+	}
+#if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Reads data at the current offset into a buffer
  * Returns the number of bytes read or -1 on error
  */
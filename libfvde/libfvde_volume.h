@@ -32,6 +32,7 @@
 #include "libfvde_io_handle.h"
 #include "libfvde_logical_volume.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libcthreads.h"
 #include "libfvde_libuna.h"
@@ -107,6 +108,11 @@ struct libfvde_internal_volume
 	 */
 	libfvde_logical_volume_t *legacy_logical_volume;
 
+	/* The logical volumes array
+	 * Contains the internal logical volumes that have been opened, by index
+	 */
+	libcdata_array_t *logical_volumes_array;
+
         /* The volume master key for backwards compatibility
 	 */
         uint8_t legacy_volume_master_key[ 16 ];
@@ -270,6 +276,18 @@ int libfvde_volume_get_volume_group(
      libfvde_volume_group_t **volume_group,
      libcerror_error_t **error );
 
+int libfvde_internal_volume_get_logical_volume_by_index(
+     libfvde_internal_volume_t *internal_volume,
+     int volume_index,
+     libfvde_logical_volume_t **logical_volume,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_get_transaction_identifier(
+     libfvde_volume_t *volume,
+     uint64_t *transaction_identifier,
+     libcerror_error_t **error );
+
 /* The following functions have been deprecated and will be removed
  */
 
@@ -283,6 +301,39 @@ int libfvde_volume_is_locked(
      libfvde_volume_t *volume,
      libcerror_error_t **error );
 
+int libfvde_internal_volume_update_metadata_memory_usage(
+     libfvde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+int libfvde_internal_volume_compact(
+     libfvde_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_memory_budget(
+     libfvde_volume_t *volume,
+     libfvde_memory_budget_t *memory_budget,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_get_memory_usage(
+     libfvde_volume_t *volume,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_get_memory_usage_by_type(
+     libfvde_volume_t *volume,
+     int usage_type,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_set_executor(
+     libfvde_volume_t *volume,
+     libfvde_executor_t *executor,
+     libcerror_error_t **error );
+
 LIBFVDE_EXTERN \
 ssize_t libfvde_volume_read_buffer(
          libfvde_volume_t *volume,
@@ -28,6 +28,7 @@
 #include "libfvde_encryption_context.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libfdata.h"
 #include "libfvde_sector_data.h"
@@ -112,6 +113,19 @@ int libfvde_volume_data_handle_initialize(
 
 		return( -1 );
 	}
+	if( libcdata_range_list_initialize(
+	     &( ( *volume_data_handle )->read_errors ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read errors range list.",
+		 function );
+
+		goto on_error;
+	}
 	( *volume_data_handle )->io_handle             = io_handle;
 	( *volume_data_handle )->logical_volume_offset = logical_volume_offset;
 
@@ -153,7 +167,8 @@ int libfvde_volume_data_handle_free(
 	{
 		if( ( *volume_data_handle )->encryption_context != NULL )
 		{
-			if( libfvde_encryption_context_free(
+			if( libfvde_io_handle_release_encryption_context(
+			     ( *volume_data_handle )->io_handle,
 			     &( ( *volume_data_handle )->encryption_context ),
 			     error ) != 1 )
 			{
@@ -161,12 +176,26 @@ int libfvde_volume_data_handle_free(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free encryption context.",
+				 "%s: unable to release encryption context.",
 				 function );
 
 				result = -1;
 			}
 		}
+		if( libcdata_range_list_free(
+		     &( ( *volume_data_handle )->read_errors ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read errors range list.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *volume_data_handle );
 
@@ -251,6 +280,31 @@ int libfvde_volume_data_handle_read_sector(
 			goto on_error;
 		}
 	}
+	else if( volume_data_handle->tolerate_read_errors != 0 )
+	{
+		if( libfvde_sector_data_read_with_error_tolerance(
+		     sector_data,
+		     volume_data_handle->encryption_context,
+		     file_io_pool,
+		     element_data_file_index,
+		     element_data_offset,
+		     (uint64_t) element_index,
+		     volume_data_handle->is_encrypted,
+		     volume_data_handle->read_error_fill_byte,
+		     volume_data_handle->read_errors,
+		     (uint64_t) element_index * volume_data_handle->io_handle->bytes_per_sector,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read sector data.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	else
 	{
 		if( libfvde_sector_data_read(
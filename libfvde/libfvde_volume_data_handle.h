@@ -29,6 +29,7 @@
 #include "libfvde_encryption_context.h"
 #include "libfvde_io_handle.h"
 #include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
 #include "libfvde_libcerror.h"
 #include "libfvde_libfdata.h"
 
@@ -55,6 +56,18 @@ struct libfvde_volume_data_handle
 	/* Value to indicate the logical volume is encrypted
 	 */
 	uint8_t is_encrypted;
+
+	/* Value to indicate read errors should be tolerated
+	 */
+	uint8_t tolerate_read_errors;
+
+	/* The byte value used to fill unreadable data
+	 */
+	uint8_t read_error_fill_byte;
+
+	/* The read errors, ranges relative to the start of the logical volume
+	 */
+	libcdata_range_list_t *read_errors;
 };
 
 int libfvde_volume_data_handle_initialize(
@@ -34,6 +34,7 @@
 #include "libfvde_physical_volume.h"
 #include "libfvde_physical_volume_descriptor.h"
 #include "libfvde_types.h"
+#include "libfvde_volume.h"
 #include "libfvde_volume_group.h"
 #include "libfvde_volume_header.h"
 
@@ -43,6 +44,7 @@
  */
 int libfvde_volume_group_initialize(
      libfvde_volume_group_t **volume_group,
+     libfvde_volume_t *volume,
      libfvde_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
      libfvde_volume_header_t *volume_header,
@@ -76,6 +78,17 @@ int libfvde_volume_group_initialize(
 
 		return( -1 );
 	}
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -148,6 +161,7 @@ int libfvde_volume_group_initialize(
 		goto on_error;
 	}
 #endif
+	internal_volume_group->volume               = volume;
 	internal_volume_group->io_handle            = io_handle;
 	internal_volume_group->file_io_pool         = file_io_pool;
 	internal_volume_group->volume_header        = volume_header;
@@ -210,7 +224,7 @@ int libfvde_volume_group_free(
 			result = -1;
 		}
 #endif
-		/* The volume_header and metadata references are freed elsewhere
+		/* The volume, volume_header and metadata references are freed elsewhere
 		 */
 		memory_free(
 		 internal_volume_group );
@@ -869,6 +883,10 @@ int libfvde_volume_group_get_number_of_logical_volumes(
 }
 
 /* Retrieves a specific logical volume
+ * The logical volume is opened on first retrieval and kept by the volume, every
+ * retrieval returns a new logical volume with its own current offset and read-ahead
+ * that shares the decrypted data and unlocked state of the same index.
+ * Every retrieved logical volume must be freed with libfvde_logical_volume_free
  * Returns 1 if successful or -1 on error
  */
 int libfvde_volume_group_get_logical_volume_by_index(
@@ -877,10 +895,10 @@ int libfvde_volume_group_get_logical_volume_by_index(
      libfvde_logical_volume_t **logical_volume,
      libcerror_error_t **error )
 {
-	libfvde_internal_volume_group_t *internal_volume_group         = NULL;
-	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
-	static char *function                                          = "libfvde_volume_group_get_logical_volume_by_index";
-	int result                                                     = 1;
+	libfvde_internal_volume_t *internal_volume             = NULL;
+	libfvde_internal_volume_group_t *internal_volume_group = NULL;
+	static char *function                                  = "libfvde_volume_group_get_logical_volume_by_index";
+	int result                                             = 1;
 
 	if( volume_group == NULL )
 	{
@@ -895,6 +913,19 @@ int libfvde_volume_group_get_logical_volume_by_index(
 	}
 	internal_volume_group = (libfvde_internal_volume_group_t *) volume_group;
 
+	if( internal_volume_group->volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume group - missing volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfvde_internal_volume_t *) internal_volume_group->volume;
+
 	if( logical_volume == NULL )
 	{
 		libcerror_error_set(
@@ -917,86 +948,49 @@ int libfvde_volume_group_get_logical_volume_by_index(
 
 		return( -1 );
 	}
+	/* The logical volumes are kept by the volume so that they are shared by all volume groups
+	 */
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_volume_group->read_write_lock,
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfvde_encrypted_metadata_get_logical_volume_descriptor_by_index(
-	     internal_volume_group->encrypted_metadata,
+	if( libfvde_internal_volume_get_logical_volume_by_index(
+	     internal_volume,
 	     volume_index,
-	     &logical_volume_descriptor,
+	     logical_volume,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve logical volume descriptor: %d from encrypted metadata.",
+		 "%s: unable to retrieve logical volume: %d.",
 		 function,
 		 volume_index );
 
 		result = -1;
 	}
-	else
-	{
-		if( libfvde_logical_volume_initialize(
-		      logical_volume,
-		      internal_volume_group->io_handle,
-		      internal_volume_group->file_io_pool,
-		      logical_volume_descriptor,
-		      internal_volume_group->encrypted_metadata,
-		      internal_volume_group->encrypted_root_plist,
-		      error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create logical volume.",
-			 function );
-
-			result = -1;
-		}
-		else if( libfvde_internal_logical_volume_open_read(
-		          (libfvde_internal_logical_volume_t *) *logical_volume,
-		          internal_volume_group->file_io_pool,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read logical volume.",
-			 function );
-
-			libfvde_logical_volume_free(
-			 logical_volume,
-			 NULL );
-
-			result = -1;
-		}
-	}
 #if defined( HAVE_LIBFVDE_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_volume_group->read_write_lock,
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
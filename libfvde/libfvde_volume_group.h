@@ -45,6 +45,10 @@ typedef struct libfvde_internal_volume_group libfvde_internal_volume_group_t;
 
 struct libfvde_internal_volume_group
 {
+	/* The volume
+	 */
+	libfvde_volume_t *volume;
+
 	/* The IO handle
 	 */
 	libfvde_io_handle_t *io_handle;
@@ -78,6 +82,7 @@ struct libfvde_internal_volume_group
 
 int libfvde_volume_group_initialize(
      libfvde_volume_group_t **volume_group,
+     libfvde_volume_t *volume,
      libfvde_io_handle_t *io_handle,
      libbfio_pool_t *file_io_pool,
      libfvde_volume_header_t *volume_header,
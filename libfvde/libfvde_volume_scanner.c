@@ -0,0 +1,1395 @@
+/*
+ * Volume scanner functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfvde_definitions.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_libcnotify.h"
+#include "libfvde_types.h"
+#include "libfvde_volume_header.h"
+#include "libfvde_volume_scanner.h"
+
+#include "fvde_volume.h"
+
+/* Creates a volume scanner entry
+ * Make sure the value entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_entry_initialize(
+     libfvde_volume_scanner_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_scanner_entry_initialize";
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = memory_allocate_structure(
+	          libfvde_volume_scanner_entry_t );
+
+	if( *entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *entry,
+	     0,
+	     sizeof( libfvde_volume_scanner_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+
+		return( -1 );
+	}
+	if( libfvde_volume_header_initialize(
+	     &( ( *entry )->volume_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *entry != NULL )
+	{
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a volume scanner entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_entry_free(
+     libfvde_volume_scanner_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_scanner_entry_free";
+	int result            = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->volume_header != NULL )
+		{
+			if( libfvde_volume_header_free(
+			     &( ( *entry )->volume_header ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free volume header.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( result );
+}
+
+/* Creates a volume scanner
+ * Make sure the value volume_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_initialize(
+     libfvde_volume_scanner_t **volume_scanner,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_initialize";
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid volume scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner = memory_allocate_structure(
+	                           libfvde_internal_volume_scanner_t );
+
+	if( internal_volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create volume scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_volume_scanner,
+	     0,
+	     sizeof( libfvde_internal_volume_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear volume scanner.",
+		 function );
+
+		memory_free(
+		 internal_volume_scanner );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_volume_scanner->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &( internal_volume_scanner->read_errors ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	*volume_scanner = (libfvde_volume_scanner_t *) internal_volume_scanner;
+
+	return( 1 );
+
+on_error:
+	if( internal_volume_scanner != NULL )
+	{
+		if( internal_volume_scanner->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_volume_scanner->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_volume_scanner );
+	}
+	return( -1 );
+}
+
+/* Frees a volume scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_free(
+     libfvde_volume_scanner_t **volume_scanner,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_free";
+	int result                                                 = 1;
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_scanner != NULL )
+	{
+		internal_volume_scanner = (libfvde_internal_volume_scanner_t *) *volume_scanner;
+		*volume_scanner         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_volume_scanner->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_volume_scanner_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_range_list_free(
+		     &( internal_volume_scanner->read_errors ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read errors range list.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_volume_scanner->buffer != NULL )
+		{
+			memory_free(
+			 internal_volume_scanner->buffer );
+		}
+		memory_free(
+		 internal_volume_scanner );
+	}
+	return( result );
+}
+
+/* Signals the volume scanner to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_signal_abort(
+     libfvde_volume_scanner_t *volume_scanner,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_signal_abort";
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner = (libfvde_internal_volume_scanner_t *) volume_scanner;
+
+	internal_volume_scanner->abort = 1;
+
+	return( 1 );
+}
+
+/* Scans data for volume headers
+ * Only offsets that are a multiple of LIBFVDE_VOLUME_SCANNER_ALIGNMENT are considered,
+ * so the candidate test costs a single 32-bit compare per sector. Candidates are
+ * confirmed by reading the volume header, which validates the CRC-32C checksum
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_scan_data(
+     libfvde_internal_volume_scanner_t *internal_volume_scanner,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *header_error       = NULL;
+	libfvde_volume_scanner_entry_t *entry = NULL;
+	const uint8_t *sector_data            = NULL;
+	static char *function                 = "libfvde_volume_scanner_scan_data";
+	size_t sector_offset                  = 0;
+	int entry_index                       = 0;
+	int result                            = 0;
+
+	if( internal_volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( ( data_offset % LIBFVDE_VOLUME_SCANNER_ALIGNMENT ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_offset = 0;
+	     ( sector_offset + sizeof( fvde_volume_header_t ) ) <= data_size;
+	     sector_offset += LIBFVDE_VOLUME_SCANNER_ALIGNMENT )
+	{
+		sector_data = &( data[ sector_offset ] );
+
+		/* Format version 1 and block type 0x0010 stored as little-endian
+		 */
+		if( ( sector_data[ 8 ] != 0x01 )
+		 || ( sector_data[ 9 ] != 0x00 )
+		 || ( sector_data[ 10 ] != 0x10 )
+		 || ( sector_data[ 11 ] != 0x00 ) )
+		{
+			continue;
+		}
+		if( ( ( (fvde_volume_header_t *) sector_data )->core_storage_signature[ 0 ] != (uint8_t) 'C' )
+		 || ( ( (fvde_volume_header_t *) sector_data )->core_storage_signature[ 1 ] != (uint8_t) 'S' ) )
+		{
+			continue;
+		}
+		if( libfvde_volume_scanner_entry_initialize(
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		entry->volume_offset = data_offset + (off64_t) sector_offset;
+
+		/* A candidate that does not validate, for example due to a checksum
+		 * mismatch, is not a volume header
+		 */
+		result = libfvde_volume_header_read_data(
+		          entry->volume_header,
+		          sector_data,
+		          sizeof( fvde_volume_header_t ),
+		          &header_error );
+
+		if( result != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: rejected volume header candidate at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 entry->volume_offset,
+				 entry->volume_offset );
+
+				libcnotify_print_error_backtrace(
+				 header_error );
+			}
+#endif
+			libcerror_error_free(
+			 &header_error );
+
+			if( libfvde_volume_scanner_entry_free(
+			     &entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libcdata_array_append_entry(
+		     internal_volume_scanner->entries_array,
+		     &entry_index,
+		     (intptr_t *) entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to array.",
+			 function );
+
+			goto on_error;
+		}
+		entry = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		libfvde_volume_scanner_entry_free(
+		 &entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data sector by sector into the read buffer
+ * Sectors that cannot be read are filled with 0-byte values and recorded as read errors
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_read_sectors(
+     libfvde_internal_volume_scanner_t *internal_volume_scanner,
+     libbfio_handle_t *file_io_handle,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error = NULL;
+	static char *function         = "libfvde_volume_scanner_read_sectors";
+	size_t buffer_offset          = 0;
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+
+	if( internal_volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_volume_scanner->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume scanner - missing read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) LIBFVDE_VOLUME_SCANNER_READ_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	while( buffer_offset < data_size )
+	{
+		read_size = LIBFVDE_VOLUME_SCANNER_ALIGNMENT;
+
+		if( read_size > ( data_size - buffer_offset ) )
+		{
+			read_size = data_size - buffer_offset;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( internal_volume_scanner->buffer[ buffer_offset ] ),
+		              read_size,
+		              data_offset + (off64_t) buffer_offset,
+		              &read_error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read sector at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 data_offset + (off64_t) buffer_offset,
+				 data_offset + (off64_t) buffer_offset );
+
+				if( read_error != NULL )
+				{
+					libcnotify_print_error_backtrace(
+					 read_error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 &read_error );
+
+			if( memory_set(
+			     &( internal_volume_scanner->buffer[ buffer_offset ] ),
+			     0,
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear sector data.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdata_range_list_insert_range(
+			     internal_volume_scanner->read_errors,
+			     (uint64_t) data_offset + buffer_offset,
+			     (uint64_t) read_size,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert read error range.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += read_size;
+	}
+	return( 1 );
+}
+
+/* Scans a file IO handle for volume headers
+ * The data is read sequentially in large reads, previous results are discarded
+ * Data that cannot be read is skipped and recorded as a read error
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_scan_file_io_handle(
+     libfvde_volume_scanner_t *volume_scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *read_error                              = NULL;
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_scan_file_io_handle";
+	size64_t file_size                                         = 0;
+	size_t read_size                                           = 0;
+	ssize_t read_count                                         = 0;
+	off64_t file_offset                                        = 0;
+	uint8_t file_io_handle_opened                              = 0;
+	int file_io_handle_is_open                                 = 0;
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner = (libfvde_internal_volume_scanner_t *) volume_scanner;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner->abort = 0;
+
+	if( libcdata_array_empty(
+	     internal_volume_scanner->entries_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_volume_scanner_entry_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty entries array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_empty(
+	     internal_volume_scanner->read_errors,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty read errors range list.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_volume_scanner->buffer == NULL )
+	{
+		internal_volume_scanner->buffer = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * LIBFVDE_VOLUME_SCANNER_READ_SIZE );
+
+		if( internal_volume_scanner->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) file_offset < file_size )
+	{
+		if( internal_volume_scanner->abort != 0 )
+		{
+			break;
+		}
+		read_size = LIBFVDE_VOLUME_SCANNER_READ_SIZE;
+
+		if( (size64_t) read_size > ( file_size - file_offset ) )
+		{
+			read_size = (size_t) ( file_size - file_offset );
+		}
+		if( read_size < sizeof( fvde_volume_header_t ) )
+		{
+			break;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              internal_volume_scanner->buffer,
+		              read_size,
+		              file_offset,
+		              &read_error );
+
+		/* Retry a read that failed or was short sector by sector,
+		 * so that only the sectors that cannot be read are skipped
+		 */
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_free(
+			 &read_error );
+
+			if( libfvde_volume_scanner_read_sectors(
+			     internal_volume_scanner,
+			     file_io_handle,
+			     read_size,
+			     file_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sectors at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+		}
+		/* The read size is a multiple of the alignment except at the end of the file,
+		 * hence a volume header never straddles two reads
+		 */
+		if( libfvde_volume_scanner_scan_data(
+		     internal_volume_scanner,
+		     internal_volume_scanner->buffer,
+		     read_size,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		file_offset += (off64_t) read_size;
+	}
+	if( file_io_handle_opened != 0 )
+	{
+		file_io_handle_opened = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of volume headers found
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_number_of_volume_headers(
+     libfvde_volume_scanner_t *volume_scanner,
+     int *number_of_volume_headers,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_get_number_of_volume_headers";
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner = (libfvde_internal_volume_scanner_t *) volume_scanner;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_volume_scanner->entries_array,
+	     number_of_volume_headers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_entry_by_index(
+     libfvde_internal_volume_scanner_t *internal_volume_scanner,
+     int volume_header_index,
+     libfvde_volume_scanner_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfvde_volume_scanner_get_entry_by_index";
+
+	if( internal_volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_volume_scanner->entries_array,
+	     volume_header_index,
+	     (intptr_t **) entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	if( *entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the offset of a specific volume header
+ * This is the offset of the physical volume to use with the volume open functions
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_volume_header_offset(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     off64_t *volume_offset,
+     libcerror_error_t **error )
+{
+	libfvde_volume_scanner_entry_t *entry = NULL;
+	static char *function                 = "libfvde_volume_scanner_get_volume_header_offset";
+
+	if( volume_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_scanner_get_entry_by_index(
+	     (libfvde_internal_volume_scanner_t *) volume_scanner,
+	     volume_header_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	*volume_offset = entry->volume_offset;
+
+	return( 1 );
+}
+
+/* Retrieves the physical volume size of a specific volume header
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_physical_volume_size(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfvde_volume_scanner_entry_t *entry = NULL;
+	static char *function                 = "libfvde_volume_scanner_get_physical_volume_size";
+
+	if( libfvde_volume_scanner_get_entry_by_index(
+	     (libfvde_internal_volume_scanner_t *) volume_scanner,
+	     volume_header_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	if( libfvde_volume_header_get_physical_volume_size(
+	     entry->volume_header,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the physical volume identifier of a specific volume header
+ * The identifier is a UUID and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_physical_volume_identifier(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_volume_scanner_entry_t *entry = NULL;
+	static char *function                 = "libfvde_volume_scanner_get_physical_volume_identifier";
+
+	if( libfvde_volume_scanner_get_entry_by_index(
+	     (libfvde_internal_volume_scanner_t *) volume_scanner,
+	     volume_header_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	if( libfvde_volume_header_get_physical_volume_identifier(
+	     entry->volume_header,
+	     uuid_data,
+	     uuid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical volume identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the volume group identifier of a specific volume header
+ * The identifier is a UUID and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_volume_group_identifier(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error )
+{
+	libfvde_volume_scanner_entry_t *entry = NULL;
+	static char *function                 = "libfvde_volume_scanner_get_volume_group_identifier";
+
+	if( libfvde_volume_scanner_get_entry_by_index(
+	     (libfvde_internal_volume_scanner_t *) volume_scanner,
+	     volume_header_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	if( libfvde_volume_header_get_volume_group_identifier(
+	     entry->volume_header,
+	     uuid_data,
+	     uuid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific metadata offset of a specific volume header
+ * The offset is relative to the start of the scanned data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_metadata_offset(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     int metadata_index,
+     off64_t *metadata_offset,
+     libcerror_error_t **error )
+{
+	libfvde_volume_scanner_entry_t *entry = NULL;
+	static char *function                 = "libfvde_volume_scanner_get_metadata_offset";
+
+	if( ( metadata_index < 0 )
+	 || ( metadata_index >= 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_scanner_get_entry_by_index(
+	     (libfvde_internal_volume_scanner_t *) volume_scanner,
+	     volume_header_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 volume_header_index );
+
+		return( -1 );
+	}
+	if( entry->volume_header->metadata_offsets[ metadata_index ] > (uint64_t) ( INT64_MAX - entry->volume_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata: %d offset value out of bounds.",
+		 function,
+		 metadata_index );
+
+		return( -1 );
+	}
+	*metadata_offset = entry->volume_offset + (off64_t) entry->volume_header->metadata_offsets[ metadata_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the number of read errors encountered during the scan
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_number_of_read_errors(
+     libfvde_volume_scanner_t *volume_scanner,
+     int *number_of_read_errors,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_get_number_of_read_errors";
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner = (libfvde_internal_volume_scanner_t *) volume_scanner;
+
+	if( libcdata_range_list_get_number_of_elements(
+	     internal_volume_scanner->read_errors,
+	     number_of_read_errors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of read errors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific read error
+ * The offset and size are relative to the start of the scanned data
+ * Returns 1 if successful or -1 on error
+ */
+int libfvde_volume_scanner_get_read_error_by_index(
+     libfvde_volume_scanner_t *volume_scanner,
+     int read_error_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libfvde_internal_volume_scanner_t *internal_volume_scanner = NULL;
+	static char *function                                      = "libfvde_volume_scanner_get_read_error_by_index";
+	intptr_t *range_value                                      = NULL;
+	uint64_t range_size                                        = 0;
+	uint64_t range_start                                       = 0;
+
+	if( volume_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume scanner.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume_scanner = (libfvde_internal_volume_scanner_t *) volume_scanner;
+
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_range_list_get_range_by_index(
+	     internal_volume_scanner->read_errors,
+	     read_error_index,
+	     &range_start,
+	     &range_size,
+	     &range_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read error: %d.",
+		 function,
+		 read_error_index );
+
+		return( -1 );
+	}
+	*offset = (off64_t) range_start;
+	*size   = (size64_t) range_size;
+
+	return( 1 );
+}
+
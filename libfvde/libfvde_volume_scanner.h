@@ -0,0 +1,186 @@
+/*
+ * Volume scanner functions
+ *
+ * Copyright (C) 2011-2025, Omar Choudary <choudary.omar@gmail.com>,
+ *                          Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFVDE_VOLUME_SCANNER_H )
+#define _LIBFVDE_VOLUME_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfvde_extern.h"
+#include "libfvde_libbfio.h"
+#include "libfvde_libcdata.h"
+#include "libfvde_libcerror.h"
+#include "libfvde_types.h"
+#include "libfvde_volume_header.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfvde_volume_scanner_entry libfvde_volume_scanner_entry_t;
+
+struct libfvde_volume_scanner_entry
+{
+	/* The offset of the volume header
+	 */
+	off64_t volume_offset;
+
+	/* The volume header
+	 */
+	libfvde_volume_header_t *volume_header;
+};
+
+typedef struct libfvde_internal_volume_scanner libfvde_internal_volume_scanner_t;
+
+struct libfvde_internal_volume_scanner
+{
+	/* The entries of the volume headers found
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The ranges of the data that could not be read
+	 */
+	libcdata_range_list_t *read_errors;
+
+	/* The read buffer
+	 */
+	uint8_t *buffer;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int libfvde_volume_scanner_entry_initialize(
+     libfvde_volume_scanner_entry_t **entry,
+     libcerror_error_t **error );
+
+int libfvde_volume_scanner_entry_free(
+     libfvde_volume_scanner_entry_t **entry,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_initialize(
+     libfvde_volume_scanner_t **volume_scanner,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_free(
+     libfvde_volume_scanner_t **volume_scanner,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_signal_abort(
+     libfvde_volume_scanner_t *volume_scanner,
+     libcerror_error_t **error );
+
+int libfvde_volume_scanner_scan_data(
+     libfvde_internal_volume_scanner_t *internal_volume_scanner,
+     const uint8_t *data,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error );
+
+int libfvde_volume_scanner_read_sectors(
+     libfvde_internal_volume_scanner_t *internal_volume_scanner,
+     libbfio_handle_t *file_io_handle,
+     size_t data_size,
+     off64_t data_offset,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_scan_file_io_handle(
+     libfvde_volume_scanner_t *volume_scanner,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_number_of_volume_headers(
+     libfvde_volume_scanner_t *volume_scanner,
+     int *number_of_volume_headers,
+     libcerror_error_t **error );
+
+int libfvde_volume_scanner_get_entry_by_index(
+     libfvde_internal_volume_scanner_t *internal_volume_scanner,
+     int volume_header_index,
+     libfvde_volume_scanner_entry_t **entry,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_volume_header_offset(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     off64_t *volume_offset,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_physical_volume_size(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_physical_volume_identifier(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_volume_group_identifier(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     uint8_t *uuid_data,
+     size_t uuid_data_size,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_metadata_offset(
+     libfvde_volume_scanner_t *volume_scanner,
+     int volume_header_index,
+     int metadata_index,
+     off64_t *metadata_offset,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_number_of_read_errors(
+     libfvde_volume_scanner_t *volume_scanner,
+     int *number_of_read_errors,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_scanner_get_read_error_by_index(
+     libfvde_volume_scanner_t *volume_scanner,
+     int read_error_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFVDE_VOLUME_SCANNER_H ) */
+
@@ -0,0 +1,75 @@
+/*
+ * OSS-Fuzz target for the libfvde deflate decompression performance
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_budget.h"
+#include "ossfuzz_libfvde.h"
+
+#include "../libfvde/libfvde_deflate.h"
+
+/* The maximum uncompressed data size
+ */
+#define OSSFUZZ_DEFLATE_MAXIMUM_UNCOMPRESSED_DATA_SIZE	( 16 * 1024 * 1024 )
+
+/* The time budget in milliseconds
+ */
+#define OSSFUZZ_DEFLATE_TIME_BUDGET			1000
+
+/* The uncompressed data is not allocated per input
+ * so that the time budget only covers the decompression
+ */
+static uint8_t ossfuzz_uncompressed_data[ OSSFUZZ_DEFLATE_MAXIMUM_UNCOMPRESSED_DATA_SIZE ];
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	ossfuzz_budget_t budget;
+
+	size_t uncompressed_data_size = OSSFUZZ_DEFLATE_MAXIMUM_UNCOMPRESSED_DATA_SIZE;
+
+	ossfuzz_budget_start(
+	 &budget,
+	 "deflate_fuzzer",
+	 OSSFUZZ_DEFLATE_TIME_BUDGET,
+	 0 );
+
+	libfvde_deflate_decompress_zlib(
+	 data,
+	 size,
+	 ossfuzz_uncompressed_data,
+	 &uncompressed_data_size,
+	 NULL );
+
+	ossfuzz_budget_check_time(
+	 &budget );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
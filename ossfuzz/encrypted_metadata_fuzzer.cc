@@ -0,0 +1,171 @@
+/*
+ * OSS-Fuzz target for the libfvde encrypted metadata parsing performance
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_budget.h"
+#include "ossfuzz_libfvde.h"
+
+#include "../libfvde/libfvde_checksum.h"
+#include "../libfvde/libfvde_encrypted_metadata.h"
+#include "../libfvde/libfvde_io_handle.h"
+#include "../libfvde/libfvde_metadata_block.h"
+
+/* The input is parsed as a sequence of decrypted 8192 byte metadata blocks
+ */
+#define OSSFUZZ_METADATA_BLOCK_SIZE			8192
+
+/* The time budget in milliseconds
+ */
+#define OSSFUZZ_ENCRYPTED_METADATA_TIME_BUDGET		1000
+
+/* The memory budget in bytes
+ */
+#define OSSFUZZ_ENCRYPTED_METADATA_MEMORY_BUDGET	( 64 * 1024 * 1024 )
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	uint8_t block_data[ OSSFUZZ_METADATA_BLOCK_SIZE ];
+
+	ossfuzz_budget_t budget;
+
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_io_handle_t *io_handle                   = NULL;
+	libfvde_metadata_block_t *metadata_block         = NULL;
+	size64_t memory_usage                            = 0;
+	size_t data_offset                               = 0;
+	uint32_t checksum                                = 0;
+
+	ossfuzz_budget_start(
+	 &budget,
+	 "encrypted_metadata_fuzzer",
+	 OSSFUZZ_ENCRYPTED_METADATA_TIME_BUDGET,
+	 OSSFUZZ_ENCRYPTED_METADATA_MEMORY_BUDGET );
+
+	if( libfvde_io_handle_initialize(
+	     &io_handle,
+	     NULL ) != 1 )
+	{
+		return( 0 );
+	}
+	if( libfvde_metadata_block_initialize(
+	     &metadata_block,
+	     NULL ) != 1 )
+	{
+		goto on_error_io_handle;
+	}
+	if( libfvde_encrypted_metadata_initialize(
+	     &encrypted_metadata,
+	     NULL ) != 1 )
+	{
+		goto on_error_metadata_block;
+	}
+	while( ( size - data_offset ) >= OSSFUZZ_METADATA_BLOCK_SIZE )
+	{
+		memcpy(
+		 block_data,
+		 &( data[ data_offset ] ),
+		 OSSFUZZ_METADATA_BLOCK_SIZE );
+
+		data_offset += OSSFUZZ_METADATA_BLOCK_SIZE;
+
+		/* Fix up the block header so that the fuzz engine does not need
+		 * to solve the checksum to reach the block type specific parsing
+		 */
+		block_data[ 4 ]  = 0xff;
+		block_data[ 5 ]  = 0xff;
+		block_data[ 6 ]  = 0xff;
+		block_data[ 7 ]  = 0xff;
+		block_data[ 48 ] = 0x00;
+		block_data[ 49 ] = 0x20;
+		block_data[ 50 ] = 0x00;
+		block_data[ 51 ] = 0x00;
+
+		if( libfvde_checksum_calculate_weak_crc32(
+		     &checksum,
+		     &( block_data[ 8 ] ),
+		     OSSFUZZ_METADATA_BLOCK_SIZE - 8,
+		     0xffffffffUL,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+		block_data[ 0 ] = (uint8_t) ( checksum & 0xff );
+		block_data[ 1 ] = (uint8_t) ( ( checksum >> 8 ) & 0xff );
+		block_data[ 2 ] = (uint8_t) ( ( checksum >> 16 ) & 0xff );
+		block_data[ 3 ] = (uint8_t) ( ( checksum >> 24 ) & 0xff );
+
+		if( libfvde_metadata_block_read_data(
+		     metadata_block,
+		     block_data,
+		     OSSFUZZ_METADATA_BLOCK_SIZE,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+		if( libfvde_encrypted_metadata_read_metadata_block(
+		     encrypted_metadata,
+		     io_handle,
+		     metadata_block,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+	}
+	if( libfvde_encrypted_metadata_get_memory_usage(
+	     encrypted_metadata,
+	     &memory_usage,
+	     NULL ) == 1 )
+	{
+		ossfuzz_budget_check_memory(
+		 &budget,
+		 (uint64_t) memory_usage );
+	}
+	libfvde_encrypted_metadata_free(
+	 &encrypted_metadata,
+	 NULL );
+
+	ossfuzz_budget_check_time(
+	 &budget );
+
+on_error_metadata_block:
+	libfvde_metadata_block_free(
+	 &metadata_block,
+	 NULL );
+
+on_error_io_handle:
+	libfvde_io_handle_free(
+	 &io_handle,
+	 NULL );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,140 @@
+/*
+ * Per-input time and memory budget for the OSS-Fuzz targets
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_budget.h"
+
+/* Retrieves the current monotonic time in nanoseconds
+ */
+static uint64_t ossfuzz_budget_get_time(
+                 void )
+{
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+}
+
+/* Retrieves a budget from an environment variable
+ * Returns the value of the environment variable or the default budget if not set
+ */
+static uint64_t ossfuzz_budget_get_environment_value(
+                 const char *name,
+                 uint64_t default_budget )
+{
+	const char *value_string = getenv(
+	                            name );
+
+	if( value_string == NULL )
+	{
+		return( default_budget );
+	}
+	return( (uint64_t) strtoull(
+	                    value_string,
+	                    NULL,
+	                    10 ) );
+}
+
+/* Starts the budget of a fuzz input
+ */
+void ossfuzz_budget_start(
+      ossfuzz_budget_t *budget,
+      const char *name,
+      uint64_t time_budget,
+      uint64_t memory_budget )
+{
+	budget->name          = name;
+	budget->time_budget   = ossfuzz_budget_get_environment_value(
+	                         "OSSFUZZ_TIME_BUDGET",
+	                         time_budget );
+	budget->memory_budget = ossfuzz_budget_get_environment_value(
+	                         "OSSFUZZ_MEMORY_BUDGET",
+	                         memory_budget );
+	budget->start_time    = ossfuzz_budget_get_time();
+}
+
+/* Checks if the fuzz input stayed within the time budget
+ * Aborts if the budget was exceeded so that the fuzz engine records the input
+ */
+void ossfuzz_budget_check_time(
+      ossfuzz_budget_t *budget )
+{
+	uint64_t elapsed_time = 0;
+
+	if( budget->time_budget == 0 )
+	{
+		return;
+	}
+	elapsed_time = ( ossfuzz_budget_get_time() - budget->start_time ) / 1000000UL;
+
+	if( elapsed_time > budget->time_budget )
+	{
+		fprintf(
+		 stderr,
+		 "%s: input exceeded time budget: %llu ms (budget: %llu ms)\n",
+		 budget->name,
+		 (unsigned long long) elapsed_time,
+		 (unsigned long long) budget->time_budget );
+
+		abort();
+	}
+}
+
+/* Checks if the fuzz input stayed within the memory budget
+ * Aborts if the budget was exceeded so that the fuzz engine records the input
+ */
+void ossfuzz_budget_check_memory(
+      ossfuzz_budget_t *budget,
+      uint64_t memory_usage )
+{
+	if( budget->memory_budget == 0 )
+	{
+		return;
+	}
+	if( memory_usage > budget->memory_budget )
+	{
+		fprintf(
+		 stderr,
+		 "%s: input exceeded memory budget: %llu bytes (budget: %llu bytes)\n",
+		 budget->name,
+		 (unsigned long long) memory_usage,
+		 (unsigned long long) budget->memory_budget );
+
+		abort();
+	}
+}
+
+} /* extern "C" */
+
@@ -0,0 +1,75 @@
+/*
+ * Per-input time and memory budget for the OSS-Fuzz targets
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _OSSFUZZ_BUDGET_H )
+#define _OSSFUZZ_BUDGET_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct ossfuzz_budget ossfuzz_budget_t;
+
+/* The budget of a single fuzz input
+ * The budgets can be overridden with the OSSFUZZ_TIME_BUDGET (in milliseconds)
+ * and OSSFUZZ_MEMORY_BUDGET (in bytes) environment variables, where 0 disables the check
+ */
+struct ossfuzz_budget
+{
+	/* The name of the fuzz target
+	 */
+	const char *name;
+
+	/* The start time in nanoseconds
+	 */
+	uint64_t start_time;
+
+	/* The time budget in milliseconds
+	 */
+	uint64_t time_budget;
+
+	/* The memory budget in bytes
+	 */
+	uint64_t memory_budget;
+};
+
+void ossfuzz_budget_start(
+      ossfuzz_budget_t *budget,
+      const char *name,
+      uint64_t time_budget,
+      uint64_t memory_budget );
+
+void ossfuzz_budget_check_time(
+      ossfuzz_budget_t *budget );
+
+void ossfuzz_budget_check_memory(
+      ossfuzz_budget_t *budget,
+      uint64_t memory_usage );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _OSSFUZZ_BUDGET_H ) */
+
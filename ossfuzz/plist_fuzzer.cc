@@ -0,0 +1,108 @@
+/*
+ * OSS-Fuzz target for the libfvde plist readers performance
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Note that some of the OSS-Fuzz engines use C++
+ */
+extern "C" {
+
+#include "ossfuzz_budget.h"
+#include "ossfuzz_libfvde.h"
+
+#include "../libfvde/libfvde_encryption_context_plist.h"
+#include "../libfvde/libfvde_metadata.h"
+
+/* The time budget in milliseconds
+ */
+#define OSSFUZZ_PLIST_TIME_BUDGET	1000
+
+/* The memory budget in bytes
+ */
+#define OSSFUZZ_PLIST_MEMORY_BUDGET	( 64 * 1024 * 1024 )
+
+int LLVMFuzzerTestOneInput(
+     const uint8_t *data,
+     size_t size )
+{
+	ossfuzz_budget_t budget;
+
+	libfvde_encryption_context_plist_t *plist = NULL;
+	libfvde_metadata_t *metadata              = NULL;
+	size64_t memory_usage                     = 0;
+
+	ossfuzz_budget_start(
+	 &budget,
+	 "plist_fuzzer",
+	 OSSFUZZ_PLIST_TIME_BUDGET,
+	 OSSFUZZ_PLIST_MEMORY_BUDGET );
+
+	/* The encryption context plist is scanned in place
+	 */
+	if( libfvde_encryption_context_plist_initialize(
+	     &plist,
+	     NULL ) == 1 )
+	{
+		if( libfvde_encryption_context_plist_read_xml(
+		     plist,
+		     data,
+		     size,
+		     NULL ) == 1 )
+		{
+			if( libfvde_encryption_context_plist_get_memory_usage(
+			     plist,
+			     &memory_usage,
+			     NULL ) == 1 )
+			{
+				ossfuzz_budget_check_memory(
+				 &budget,
+				 (uint64_t) memory_usage );
+			}
+		}
+		libfvde_encryption_context_plist_free(
+		 &plist,
+		 NULL );
+	}
+	/* The volume group plist is read using the plist scanner
+	 */
+	if( libfvde_metadata_initialize(
+	     &metadata,
+	     NULL ) == 1 )
+	{
+		libfvde_metadata_read_volume_group_plist(
+		 metadata,
+		 data,
+		 size,
+		 NULL );
+
+		libfvde_metadata_free(
+		 &metadata,
+		 NULL );
+	}
+	ossfuzz_budget_check_time(
+	 &budget );
+
+	return( 0 );
+}
+
+} /* extern "C" */
+
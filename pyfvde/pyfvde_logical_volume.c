@@ -73,6 +73,57 @@ PyMethodDef pyfvde_logical_volume_object_methods[] = {
 	  "\n"
 	  "Retrieves the current offset of the data." },
 
+	{ "advise",
+	  (PyCFunction) pyfvde_logical_volume_advise,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "advise(offset, size, advice) -> None\n"
+	  "\n"
+	  "Advises the expected access pattern of the data, where advice is one of:\n"
+	  "normal, sequential, random, willneed, dontneed or noreuse.\n"
+	  "Willneed reads ahead at most 1 MiB of the range, random stops reading ahead." },
+
+	{ "start_access_trace",
+	  (PyCFunction) pyfvde_logical_volume_start_access_trace,
+	  METH_NOARGS,
+	  "start_access_trace() -> None\n"
+	  "\n"
+	  "Starts recording the blocks that are read from the logical volume." },
+
+	{ "get_access_trace",
+	  (PyCFunction) pyfvde_logical_volume_get_access_trace,
+	  METH_NOARGS,
+	  "get_access_trace() -> Bytes or None\n"
+	  "\n"
+	  "Retrieves the recorded access trace." },
+
+	{ "replay_access_trace",
+	  (PyCFunction) pyfvde_logical_volume_replay_access_trace,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "replay_access_trace(data) -> None\n"
+	  "\n"
+	  "Replays a previously recorded access trace to warm up the cache." },
+
+	{ "set_maximum_pinned_size",
+	  (PyCFunction) pyfvde_logical_volume_set_maximum_pinned_size,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_maximum_pinned_size(size) -> None\n"
+	  "\n"
+	  "Sets the maximum size of the data held for pinned ranges." },
+
+	{ "pin_range",
+	  (PyCFunction) pyfvde_logical_volume_pin_range,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "pin_range(offset, size) -> None\n"
+	  "\n"
+	  "Pins a range of the data, which is read in the background and held until it is unpinned." },
+
+	{ "unpin_range",
+	  (PyCFunction) pyfvde_logical_volume_unpin_range,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "unpin_range(offset, size) -> None\n"
+	  "\n"
+	  "Unpins a range of the data." },
+
 	{ "read",
 	  (PyCFunction) pyfvde_logical_volume_read_buffer,
 	  METH_VARARGS | METH_KEYWORDS,
@@ -1025,6 +1076,570 @@ PyObject *pyfvde_logical_volume_get_offset(
 	return( integer_object );
 }
 
+/* Advises the expected access pattern of the data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_advise(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	char *advice_string         = NULL;
+	static char *function       = "pyfvde_logical_volume_advise";
+	static char *keyword_list[] = { "offset", "size", "advice", NULL };
+	unsigned long long size     = 0;
+	off64_t offset              = 0;
+	size_t string_length        = 0;
+	int advice                  = -1;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "LKs",
+	     keyword_list,
+	     &offset,
+	     &size,
+	     &advice_string ) == 0 )
+	{
+		return( NULL );
+	}
+	string_length = narrow_string_length(
+	                 advice_string );
+
+	if( string_length == 6 )
+	{
+		if( narrow_string_compare(
+		     advice_string,
+		     "normal",
+		     6 ) == 0 )
+		{
+			advice = LIBFVDE_ACCESS_ADVICE_NORMAL;
+		}
+		else if( narrow_string_compare(
+		          advice_string,
+		          "random",
+		          6 ) == 0 )
+		{
+			advice = LIBFVDE_ACCESS_ADVICE_RANDOM;
+		}
+	}
+	else if( string_length == 7 )
+	{
+		if( narrow_string_compare(
+		     advice_string,
+		     "noreuse",
+		     7 ) == 0 )
+		{
+			advice = LIBFVDE_ACCESS_ADVICE_NOREUSE;
+		}
+	}
+	else if( string_length == 8 )
+	{
+		if( narrow_string_compare(
+		     advice_string,
+		     "willneed",
+		     8 ) == 0 )
+		{
+			advice = LIBFVDE_ACCESS_ADVICE_WILLNEED;
+		}
+		else if( narrow_string_compare(
+		          advice_string,
+		          "dontneed",
+		          8 ) == 0 )
+		{
+			advice = LIBFVDE_ACCESS_ADVICE_DONTNEED;
+		}
+	}
+	else if( string_length == 10 )
+	{
+		if( narrow_string_compare(
+		     advice_string,
+		     "sequential",
+		     10 ) == 0 )
+		{
+			advice = LIBFVDE_ACCESS_ADVICE_SEQUENTIAL;
+		}
+	}
+	if( advice == -1 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported advice: %s.",
+		 function,
+		 advice_string );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_advise(
+	          pyfvde_logical_volume->logical_volume,
+	          offset,
+	          (size64_t) size,
+	          advice,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to advise access pattern.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Starts recording an access trace
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_start_access_trace(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments PYFVDE_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfvde_logical_volume_start_access_trace";
+	int result               = 0;
+
+	PYFVDE_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_start_access_trace(
+	          pyfvde_logical_volume->logical_volume,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to start access trace.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the access trace
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_get_access_trace(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments PYFVDE_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	char *data               = NULL;
+	static char *function    = "pyfvde_logical_volume_get_access_trace";
+	size_t data_size         = 0;
+	int result               = 0;
+
+	PYFVDE_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_get_access_trace_size(
+	          pyfvde_logical_volume->logical_volume,
+	          &data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve access trace size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( ( result == 0 )
+	      || ( data_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid access trace size value exceeds maximum.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) data_size );
+
+	data = PyBytes_AsString(
+	        string_object );
+#else
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) data_size );
+
+	data = PyString_AsString(
+	        string_object );
+#endif
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_copy_access_trace(
+	          pyfvde_logical_volume->logical_volume,
+	          (uint8_t *) data,
+	          data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to copy access trace.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 (PyObject *) string_object );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Replays an access trace
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_replay_access_trace(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	char *data                  = NULL;
+	static char *function       = "pyfvde_logical_volume_replay_access_trace";
+	static char *keyword_list[] = { "data", NULL };
+	Py_ssize_t data_size        = 0;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &string_object ) == 0 )
+	{
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	data = PyBytes_AsString(
+	        string_object );
+
+	data_size = PyBytes_Size(
+	             string_object );
+#else
+	data = PyString_AsString(
+	        string_object );
+
+	data_size = PyString_Size(
+	             string_object );
+#endif
+	if( ( data == NULL )
+	 || ( data_size < 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported access trace object type.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_replay_access_trace(
+	          pyfvde_logical_volume->logical_volume,
+	          (uint8_t *) data,
+	          (size_t) data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to replay access trace.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Sets the maximum pinned size
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_set_maximum_pinned_size(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_logical_volume_set_maximum_pinned_size";
+	static char *keyword_list[] = { "size", NULL };
+	unsigned long long size     = 0;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "K",
+	     keyword_list,
+	     &size ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          pyfvde_logical_volume->logical_volume,
+	          (size64_t) size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set maximum pinned size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Pins a range
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_pin_range(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_logical_volume_pin_range";
+	static char *keyword_list[] = { "offset", "size", NULL };
+	unsigned long long size     = 0;
+	off64_t offset              = 0;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "LK",
+	     keyword_list,
+	     &offset,
+	     &size ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_pin_range(
+	          pyfvde_logical_volume->logical_volume,
+	          offset,
+	          (size64_t) size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to pin range.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Unpins a range
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfvde_logical_volume_unpin_range(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyfvde_logical_volume_unpin_range";
+	static char *keyword_list[] = { "offset", "size", NULL };
+	unsigned long long size     = 0;
+	off64_t offset              = 0;
+	int result                  = 0;
+
+	if( pyfvde_logical_volume == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "LK",
+	     keyword_list,
+	     &offset,
+	     &size ) == 0 )
+	{
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfvde_logical_volume_unpin_range(
+	          pyfvde_logical_volume->logical_volume,
+	          offset,
+	          (size64_t) size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfvde_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to unpin range.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Retrieves the logical volume identifier
  * Returns a Python object if successful or NULL on error
  */
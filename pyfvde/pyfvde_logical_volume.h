@@ -85,6 +85,39 @@ PyObject *pyfvde_logical_volume_get_offset(
            pyfvde_logical_volume_t *pyfvde_logical_volume,
            PyObject *arguments );
 
+PyObject *pyfvde_logical_volume_advise(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfvde_logical_volume_start_access_trace(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments );
+
+PyObject *pyfvde_logical_volume_get_access_trace(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments );
+
+PyObject *pyfvde_logical_volume_replay_access_trace(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfvde_logical_volume_set_maximum_pinned_size(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfvde_logical_volume_pin_range(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfvde_logical_volume_unpin_range(
+           pyfvde_logical_volume_t *pyfvde_logical_volume,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfvde_logical_volume_get_identifier(
            pyfvde_logical_volume_t *pyfvde_logical_volume,
            PyObject *arguments );
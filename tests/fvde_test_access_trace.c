@@ -0,0 +1,1277 @@
+/*
+ * Library access_trace type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_access_trace.h"
+
+/* The access trace of the blocks: 0, 3, 4, 0 and 1000
+ */
+uint8_t fvde_test_access_trace_data1[ 26 ] = {
+	0x66, 0x76, 0x64, 0x65, 0x74, 0x72, 0x61, 0x63, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x00, 0x06, 0x02, 0x07, 0xd0, 0x0f };
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_access_trace_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_access_trace_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_access_trace_t *access_trace = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace",
+	 access_trace );
+
+	result = libfvde_access_trace_free(
+	          &access_trace,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "access_trace",
+	 access_trace );
+
+	/* Test error cases
+	 */
+	result = libfvde_access_trace_initialize(
+	          NULL,
+	          65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	access_trace = (libfvde_access_trace_t *) 0x12345678UL;
+
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	access_trace = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	/* Test libfvde_access_trace_initialize with malloc failing
+	 */
+	fvde_test_malloc_attempts_before_fail = 0;
+
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	if( fvde_test_malloc_attempts_before_fail != -1 )
+	{
+		fvde_test_malloc_attempts_before_fail = -1;
+
+		if( access_trace != NULL )
+		{
+			libfvde_access_trace_free(
+			 &access_trace,
+			 NULL );
+		}
+	}
+	else
+	{
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "access_trace",
+		 access_trace );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libfvde_access_trace_initialize with memset failing
+	 */
+	fvde_test_memset_attempts_before_fail = 0;
+
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	if( fvde_test_memset_attempts_before_fail != -1 )
+	{
+		fvde_test_memset_attempts_before_fail = -1;
+
+		if( access_trace != NULL )
+		{
+			libfvde_access_trace_free(
+			 &access_trace,
+			 NULL );
+		}
+	}
+	else
+	{
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "access_trace",
+		 access_trace );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_trace != NULL )
+	{
+		libfvde_access_trace_free(
+		 &access_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_access_trace_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_access_trace_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_access_trace_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_access_trace_append_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_access_trace_append_range(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_access_trace_t *access_trace = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace",
+	 access_trace );
+
+	/* Test regular cases
+	 */
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          0,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          50,
+	          10,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          3 * 65536,
+	          2 * 65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          1000 * 65536,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "access_trace->number_of_block_numbers",
+	 access_trace->number_of_block_numbers,
+	 5 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 0 ]",
+	 access_trace->block_numbers[ 0 ],
+	 (uint64_t) 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 1 ]",
+	 access_trace->block_numbers[ 1 ],
+	 (uint64_t) 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 2 ]",
+	 access_trace->block_numbers[ 2 ],
+	 (uint64_t) 4 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 3 ]",
+	 access_trace->block_numbers[ 3 ],
+	 (uint64_t) 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 4 ]",
+	 access_trace->block_numbers[ 4 ],
+	 (uint64_t) 1000 );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          2000 * 65536,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "access_trace->number_of_block_numbers",
+	 access_trace->number_of_block_numbers,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libfvde_access_trace_append_range(
+	          NULL,
+	          0,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          -1,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_access_trace_free(
+	          &access_trace,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "access_trace",
+	 access_trace );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_trace != NULL )
+	{
+		libfvde_access_trace_free(
+		 &access_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_access_trace_get_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_access_trace_get_data_size(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_access_trace_t *access_trace = NULL;
+	size_t data_size                     = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace",
+	 access_trace );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          0,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          50,
+	          10,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          3 * 65536,
+	          2 * 65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          1000 * 65536,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_access_trace_get_data_size(
+	          access_trace,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 26 );
+
+	/* Test error cases
+	 */
+	result = libfvde_access_trace_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_get_data_size(
+	          access_trace,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_access_trace_free(
+	          &access_trace,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "access_trace",
+	 access_trace );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_trace != NULL )
+	{
+		libfvde_access_trace_free(
+		 &access_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_access_trace_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_access_trace_write_data(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_access_trace_t *access_trace = NULL;
+	uint8_t data[ 32 ];
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace",
+	 access_trace );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          0,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          50,
+	          10,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          3 * 65536,
+	          2 * 65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_access_trace_append_range(
+	          access_trace,
+	          1000 * 65536,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_access_trace_write_data(
+	          access_trace,
+	          data,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          fvde_test_access_trace_data1,
+	          26 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_access_trace_write_data(
+	          NULL,
+	          data,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_write_data(
+	          access_trace,
+	          NULL,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_write_data(
+	          access_trace,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_write_data(
+	          access_trace,
+	          data,
+	          25,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_access_trace_free(
+	          &access_trace,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "access_trace",
+	 access_trace );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_trace != NULL )
+	{
+		libfvde_access_trace_free(
+		 &access_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_access_trace_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_access_trace_read_data(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfvde_access_trace_t *access_trace = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          65536,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace",
+	 access_trace );
+
+	/* Test regular cases
+	 */
+	result = libfvde_access_trace_read_data(
+	          access_trace,
+	          fvde_test_access_trace_data1,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "access_trace->number_of_block_numbers",
+	 access_trace->number_of_block_numbers,
+	 5 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 0 ]",
+	 access_trace->block_numbers[ 0 ],
+	 (uint64_t) 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 1 ]",
+	 access_trace->block_numbers[ 1 ],
+	 (uint64_t) 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 2 ]",
+	 access_trace->block_numbers[ 2 ],
+	 (uint64_t) 4 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 3 ]",
+	 access_trace->block_numbers[ 3 ],
+	 (uint64_t) 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "access_trace->block_numbers[ 4 ]",
+	 access_trace->block_numbers[ 4 ],
+	 (uint64_t) 1000 );
+
+	/* Test error cases
+	 */
+	result = libfvde_access_trace_read_data(
+	          NULL,
+	          fvde_test_access_trace_data1,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_read_data(
+	          access_trace,
+	          NULL,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_read_data(
+	          access_trace,
+	          fvde_test_access_trace_data1,
+	          19,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_access_trace_read_data(
+	          access_trace,
+	          fvde_test_access_trace_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is truncated
+	 */
+	result = libfvde_access_trace_read_data(
+	          access_trace,
+	          fvde_test_access_trace_data1,
+	          25,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_access_trace_free(
+	          &access_trace,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "access_trace",
+	 access_trace );
+
+	/* Test error case where the block size differs
+	 */
+	result = libfvde_access_trace_initialize(
+	          &access_trace,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace",
+	 access_trace );
+
+	result = libfvde_access_trace_read_data(
+	          access_trace,
+	          fvde_test_access_trace_data1,
+	          26,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_access_trace_free(
+	          &access_trace,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "access_trace",
+	 access_trace );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_trace != NULL )
+	{
+		libfvde_access_trace_free(
+		 &access_trace,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_access_trace_initialize",
+	 fvde_test_access_trace_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_access_trace_free",
+	 fvde_test_access_trace_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_access_trace_append_range",
+	 fvde_test_access_trace_append_range );
+
+	FVDE_TEST_RUN(
+	 "libfvde_access_trace_get_data_size",
+	 fvde_test_access_trace_get_data_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_access_trace_write_data",
+	 fvde_test_access_trace_write_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_access_trace_read_data",
+	 fvde_test_access_trace_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,3034 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_block_cache.h"
+#include "../libfvde/libfvde_read_request.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvde_block_cache_t *block_cache = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 2;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_initialize(
+	          NULL,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libfvde_block_cache_t *) 0x12345678UL;
+
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	block_cache = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          0,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_block_cache_initialize with malloc failing
+		 */
+		fvde_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvde_block_cache_initialize(
+		          &block_cache,
+		          4096,
+		          2,
+		          &error );
+
+		if( fvde_test_malloc_attempts_before_fail != -1 )
+		{
+			fvde_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libfvde_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_block_cache_initialize with memset failing
+		 */
+		fvde_test_memset_attempts_before_fail = test_number;
+
+		result = libfvde_block_cache_initialize(
+		          &block_cache,
+		          4096,
+		          2,
+		          &error );
+
+		if( fvde_test_memset_attempts_before_fail != -1 )
+		{
+			fvde_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libfvde_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_find_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_find_entry(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvde_block_cache_t *block_cache = NULL;
+	uint8_t *data                      = NULL;
+	int entry_index                    = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          8192,
+	          &entry_index,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          4096,
+	          &entry_index,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          12288,
+	          &entry_index,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_find_entry(
+	          NULL,
+	          8192,
+	          &entry_index,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_find_entry(
+	          block_cache,
+	          8192,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_reserve_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_reserve_block(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvde_block_cache_t *block_cache = NULL;
+	uint8_t *data                      = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 2 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 0 ].offset",
+	 block_cache->entries[ 0 ].offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 1 ].offset",
+	 block_cache->entries[ 1 ].offset,
+	 (int64_t) 8192 );
+
+	/* Test reserve block when the cache is full
+	 */
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          4096,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_reserve_block(
+	          NULL,
+	          12288,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          -4096,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          100,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          12288,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_remove_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_remove_block(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvde_block_cache_t *block_cache = NULL;
+	uint8_t *data                      = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_remove_block(
+	          block_cache,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 0 ].offset",
+	 block_cache->entries[ 0 ].offset,
+	 (int64_t) 8192 );
+
+	result = libfvde_block_cache_remove_block(
+	          block_cache,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_remove_block(
+	          NULL,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_reserve_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_reserve_range(
+     void )
+{
+	uint8_t *blocks_data[ 3 ];
+
+	libcerror_error_t *error           = NULL;
+	libfvde_block_cache_t *block_cache = NULL;
+	uint8_t *data                      = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          0,
+	          3,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 3 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "blocks_data[ 0 ]",
+	 blocks_data[ 0 ] );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "blocks_data[ 1 ]",
+	 blocks_data[ 1 ] );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "blocks_data[ 2 ]",
+	 blocks_data[ 2 ] );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 0 ].reference_count",
+	 block_cache->entries[ 0 ].reference_count,
+	 2 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 1 ].reference_count",
+	 block_cache->entries[ 1 ].reference_count,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 2 ].reference_count",
+	 block_cache->entries[ 2 ].reference_count,
+	 1 );
+
+	/* Test that nothing is reserved when the cache has no room for all the blocks of a range
+	 */
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          8192,
+	          3,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 2 ].reference_count",
+	 block_cache->entries[ 2 ].reference_count,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_reserve_range(
+	          NULL,
+	          0,
+	          3,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          -1,
+	          3,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          1,
+	          3,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          0,
+	          0,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          0,
+	          3,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_set_read_request function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_set_read_request(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfvde_block_cache_t *block_cache         = NULL;
+	libfvde_logical_volume_t *logical_volume   = (libfvde_logical_volume_t *) 0x12345678UL;
+	libfvde_read_request_t *read_request       = NULL;
+	libfvde_read_request_t *saved_read_request = NULL;
+	uint8_t *data                              = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          8192,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          8192,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The read request is now managed by the block cache
+	 */
+	saved_read_request = read_request;
+	read_request       = NULL;
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_set_read_request(
+	          NULL,
+	          8192,
+	          saved_read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          8192,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          8192,
+	          saved_read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          0,
+	          saved_read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_read_request_set_complete(
+	          saved_read_request,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = NULL;
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* A pending read request is completed so that freeing the block cache does not wait
+	 */
+	if( saved_read_request != NULL )
+	{
+		libfvde_read_request_set_complete(
+		 saved_read_request,
+		 -1,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_release_range function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_release_range(
+     void )
+{
+	uint8_t *blocks_data[ 1 ];
+
+	libcerror_error_t *error                   = NULL;
+	libfvde_block_cache_t *block_cache         = NULL;
+	libfvde_logical_volume_t *logical_volume   = (libfvde_logical_volume_t *) 0x12345678UL;
+	libfvde_read_request_t *read_request       = NULL;
+	libfvde_read_request_t *saved_read_request = NULL;
+	uint8_t *data                              = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_set_complete(
+	          read_request,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          0,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_request = NULL;
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          4096,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          4096,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          4096,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = read_request;
+	read_request       = NULL;
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          12288,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_release_range(
+	          block_cache,
+	          0,
+	          12288,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 0 ].offset",
+	 block_cache->entries[ 0 ].offset,
+	 (int64_t) 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 0 ].is_stale",
+	 block_cache->entries[ 0 ].is_stale,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 1 ].offset",
+	 block_cache->entries[ 1 ].offset,
+	 (int64_t) 8192 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 1 ].is_stale",
+	 block_cache->entries[ 1 ].is_stale,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 2 ].offset",
+	 block_cache->entries[ 2 ].offset,
+	 (int64_t) 12288 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 2 ].is_stale",
+	 block_cache->entries[ 2 ].is_stale,
+	 0 );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 1 ].is_stale",
+	 block_cache->entries[ 1 ].is_stale,
+	 0 );
+
+	/* Test a block that is referenced by overlapping ranges
+	 */
+	result = libfvde_block_cache_reserve_range(
+	          block_cache,
+	          12288,
+	          1,
+	          blocks_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "blocks_data[ 0 ]",
+	 blocks_data[ 0 ] );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 2 ].reference_count",
+	 block_cache->entries[ 2 ].reference_count,
+	 2 );
+
+	result = libfvde_block_cache_release_range(
+	          block_cache,
+	          12288,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 2 ].offset",
+	 block_cache->entries[ 2 ].offset,
+	 (int64_t) 12288 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 2 ].reference_count",
+	 block_cache->entries[ 2 ].reference_count,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 2 ].is_stale",
+	 block_cache->entries[ 2 ].is_stale,
+	 0 );
+
+	result = libfvde_block_cache_release_range(
+	          block_cache,
+	          12288,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->entries[ 2 ].reference_count",
+	 block_cache->entries[ 2 ].reference_count,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 2 ].is_stale",
+	 block_cache->entries[ 2 ].is_stale,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_release_range(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_release_range(
+	          block_cache,
+	          -1,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_read_request_set_complete(
+	          saved_read_request,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = NULL;
+
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* A pending read request is completed so that freeing the block cache does not wait
+	 */
+	if( saved_read_request != NULL )
+	{
+		libfvde_read_request_set_complete(
+		 saved_read_request,
+		 -1,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_remove_stale_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_remove_stale_blocks(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfvde_block_cache_t *block_cache         = NULL;
+	libfvde_logical_volume_t *logical_volume   = (libfvde_logical_volume_t *) 0x12345678UL;
+	libfvde_read_request_t *read_request       = NULL;
+	libfvde_read_request_t *saved_read_request = NULL;
+	uint8_t *data                              = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          0,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = read_request;
+	read_request       = NULL;
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          4096,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_release_range(
+	          block_cache,
+	          0,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_remove_stale_blocks(
+	          block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 2 );
+
+	result = libfvde_read_request_set_complete(
+	          saved_read_request,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = NULL;
+
+	result = libfvde_block_cache_remove_stale_blocks(
+	          block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 0 ].offset",
+	 block_cache->entries[ 0 ].offset,
+	 (int64_t) 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "block_cache->entries[ 0 ].is_stale",
+	 block_cache->entries[ 0 ].is_stale,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_remove_stale_blocks(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* A pending read request is completed so that freeing the block cache does not wait
+	 */
+	if( saved_read_request != NULL )
+	{
+		libfvde_read_request_set_complete(
+		 saved_read_request,
+		 -1,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_get_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfvde_block_cache_t *block_cache         = NULL;
+	libfvde_logical_volume_t *logical_volume   = (libfvde_logical_volume_t *) 0x12345678UL;
+	libfvde_read_request_t *read_request       = NULL;
+	libfvde_read_request_t *saved_read_request = NULL;
+	uint8_t *data                              = NULL;
+	uint8_t *cache_data                        = NULL;
+	size_t cache_data_size                     = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          8192,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          8192,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = read_request;
+	read_request       = NULL;
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          0,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_set_complete(
+	          read_request,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          0,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_request = NULL;
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          4096,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Test get data of a block of which the read request is pending
+	 */
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          8292,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_set_complete(
+	          saved_read_request,
+	          4000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = NULL;
+
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          8292,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_data",
+	 cache_data );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "cache_data_size",
+	 cache_data_size,
+	 (size_t) 3900 );
+
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          12192,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get data of a block that is reserved but not being read
+	 */
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          4096,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get data of a block that is not cached
+	 */
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          16384,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test get data of a block of which the read failed
+	 */
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          0,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_get_data(
+	          NULL,
+	          8192,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          -1,
+	          &cache_data,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          8192,
+	          NULL,
+	          &cache_data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_block_cache_get_data(
+	          block_cache,
+	          8192,
+	          &cache_data,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* A pending read request is completed so that freeing the block cache does not wait
+	 */
+	if( saved_read_request != NULL )
+	{
+		libfvde_read_request_set_complete(
+		 saved_read_request,
+		 -1,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_block_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_block_cache_empty(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libfvde_block_cache_t *block_cache         = NULL;
+	libfvde_logical_volume_t *logical_volume   = (libfvde_logical_volume_t *) 0x12345678UL;
+	libfvde_read_request_t *read_request       = NULL;
+	libfvde_read_request_t *saved_read_request = NULL;
+	uint8_t *data                              = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_block_cache_initialize(
+	          &block_cache,
+	          4096,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          0,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          4096,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          4096,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          4096,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = read_request;
+	read_request       = NULL;
+
+	result = libfvde_block_cache_reserve_block(
+	          block_cache,
+	          8192,
+	          &data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_initialize(
+	          &read_request,
+	          logical_volume,
+	          data,
+	          4096,
+	          8192,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "read_request",
+	 read_request );
+
+	result = libfvde_read_request_set_pending(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_set_complete(
+	          read_request,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_block_cache_set_read_request(
+	          block_cache,
+	          8192,
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_request = NULL;
+
+	block_cache->entries[ 0 ].is_filling = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_block_cache_empty(
+	          block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The block of which the read request is pending is retained
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "block_cache->entries[ 0 ].offset",
+	 block_cache->entries[ 0 ].offset,
+	 (int64_t) 4096 );
+
+	result = libfvde_read_request_set_complete(
+	          saved_read_request,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	saved_read_request = NULL;
+
+	result = libfvde_block_cache_empty(
+	          block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_block_cache_empty(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	/* A pending read request is completed so that freeing the block cache does not wait
+	 */
+	if( saved_read_request != NULL )
+	{
+		libfvde_read_request_set_complete(
+		 saved_read_request,
+		 -1,
+		 NULL );
+	}
+	if( block_cache != NULL )
+	{
+		libfvde_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_initialize",
+	 fvde_test_block_cache_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_free",
+	 fvde_test_block_cache_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_find_entry",
+	 fvde_test_block_cache_find_entry );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_reserve_block",
+	 fvde_test_block_cache_reserve_block );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_reserve_range",
+	 fvde_test_block_cache_reserve_range );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_set_read_request",
+	 fvde_test_block_cache_set_read_request );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_remove_block",
+	 fvde_test_block_cache_remove_block );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_release_range",
+	 fvde_test_block_cache_release_range );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_remove_stale_blocks",
+	 fvde_test_block_cache_remove_stale_blocks );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_get_data",
+	 fvde_test_block_cache_get_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_block_cache_empty",
+	 fvde_test_block_cache_empty );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
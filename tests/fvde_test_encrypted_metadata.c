@@ -19,14 +19,18 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_functions.h"
+#include "fvde_test_libbfio.h"
 #include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
@@ -34,9 +38,16 @@
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_checksum.h"
+#include "../libfvde/libfvde_definitions.h"
 #include "../libfvde/libfvde_encrypted_metadata.h"
 #include "../libfvde/libfvde_io_handle.h"
+#include "../libfvde/libfvde_libcaes.h"
 #include "../libfvde/libfvde_logical_volume_descriptor.h"
+#include "../libfvde/libfvde_metadata_block.h"
+
+uint8_t fvde_test_encrypted_metadata_xml_plist_data[ 52 ] =
+	"<dict><key>ConversionInfo</key><dict></dict></dict>";
 
 uint8_t fvde_test_encrypted_metadata_block_data_0x0010[ 368 ] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xc7, 0xb0, 0xe0, 0xff, 0xff, 0xff, 0xff,
@@ -4194,18 +4205,38 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfvde_encrypted_metadata_read_from_file_io_handle function
+/* Tests the libfvde_encrypted_metadata_read_metadata_block function
  * Returns 1 if successful or 0 if not
  */
-int fvde_test_encrypted_metadata_read_from_file_io_handle(
+int fvde_test_encrypted_metadata_read_metadata_block(
      void )
 {
 	libcerror_error_t *error                         = NULL;
 	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_io_handle_t *io_handle                   = NULL;
+	libfvde_metadata_block_t *metadata_block         = NULL;
+	int number_of_logical_volume_descriptors         = 0;
 	int result                                       = 0;
 
 	/* Initialize test
 	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfvde_encrypted_metadata_initialize(
 	          &encrypted_metadata,
 	          &error );
@@ -4223,18 +4254,90 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 	 "error",
 	 error );
 
+	result = libfvde_metadata_block_initialize(
+	          &metadata_block,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_block",
+	 metadata_block );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	metadata_block->type      = 0x0105;
+	metadata_block->data      = fvde_test_encrypted_metadata_block_data_0x0105;
+	metadata_block->data_size = 32;
+
+	/* Test regular cases
+	 */
+	result = libfvde_encrypted_metadata_read_metadata_block(
+	          encrypted_metadata,
+	          io_handle,
+	          metadata_block,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          encrypted_metadata->logical_volume_descriptors,
+	          &number_of_logical_volume_descriptors,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_logical_volume_descriptors",
+	 number_of_logical_volume_descriptors,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Unsupported block types are ignored
+	 */
+	metadata_block->type = 0xffff;
+
+	result = libfvde_encrypted_metadata_read_metadata_block(
+	          encrypted_metadata,
+	          io_handle,
+	          metadata_block,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libfvde_encrypted_metadata_read_from_file_io_handle(
-	          NULL,
-	          NULL,
-	          NULL,
-	          0,
-	          0,
-	          NULL,
-	          0,
+	metadata_block->type = 0x0105;
+
+	result = libfvde_encrypted_metadata_read_metadata_block(
 	          NULL,
-	          0,
+	          io_handle,
+	          metadata_block,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -4249,16 +4352,10 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	result = libfvde_encrypted_metadata_read_metadata_block(
 	          encrypted_metadata,
+	          io_handle,
 	          NULL,
-	          NULL,
-	          0,
-	          0,
-	          NULL,
-	          0,
-	          NULL,
-	          0,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -4275,6 +4372,23 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 
 	/* Clean up
 	 */
+	result = libfvde_metadata_block_free(
+	          &metadata_block,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "metadata_block",
+	 metadata_block );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfvde_encrypted_metadata_free(
 	          &encrypted_metadata,
 	          &error );
@@ -4292,6 +4406,23 @@ int fvde_test_encrypted_metadata_read_from_file_io_handle(
 	 "error",
 	 error );
 
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -4300,103 +4431,1182 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( metadata_block != NULL )
+	{
+		libfvde_metadata_block_free(
+		 &metadata_block,
+		 NULL );
+	}
 	if( encrypted_metadata != NULL )
 	{
 		libfvde_encrypted_metadata_free(
 		 &encrypted_metadata,
 		 NULL );
 	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
-
-/* The main program
+/* Writes an AES-XTS encrypted metadata block
+ * A block type of 0 writes a LVFwiped metadata block otherwise a metadata block
+ * with the specified number of segment descriptor entries
+ * Returns 1 if successful or -1 on error
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fvde_test_encrypted_metadata_write_metadata_block(
+     uint8_t *data,
+     uint64_t block_number,
+     uint16_t block_type,
+     uint32_t number_of_entries,
+     const uint8_t *key,
+     const uint8_t *tweak_key,
+     libcerror_error_t **error )
 {
-	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
-	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+	uint8_t block_data[ 8192 ];
+	uint8_t tweak_value[ 16 ];
+
+	libcaes_tweaked_context_t *encryption_context = NULL;
+	size_t block_data_offset                      = 0;
+	uint32_t calculated_checksum                  = 0;
+	uint32_t entry_index                          = 0;
+	int result                                    = -1;
+
+	memory_set(
+	 block_data,
+	 0,
+	 8192 );
+
+	memory_set(
+	 tweak_value,
+	 0,
+	 16 );
+
+	if( block_type == 0 )
+	{
+		memory_copy(
+		 block_data,
+		 "LVFwiped",
+		 8 );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( block_data[ 4 ] ),
+		 0xffffffffUL );
 
-#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+		byte_stream_copy_from_uint16_little_endian(
+		 &( block_data[ 10 ] ),
+		 block_type );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_initialize",
-	 fvde_test_encrypted_metadata_initialize );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( block_data[ 64 ] ),
+		 number_of_entries );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_free",
-	 fvde_test_encrypted_metadata_free );
+		block_data_offset = 64 + 8;
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0010",
-	 fvde_test_encrypted_metadata_read_type_0x0010 );
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( block_data[ block_data_offset + 8 ] ),
+			 (uint64_t) entry_index * 16 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0011",
-	 fvde_test_encrypted_metadata_read_type_0x0011 );
+			byte_stream_copy_from_uint32_little_endian(
+			 &( block_data[ block_data_offset + 16 ] ),
+			 16 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0012",
-	 fvde_test_encrypted_metadata_read_type_0x0012 );
+			byte_stream_copy_from_uint64_little_endian(
+			 &( block_data[ block_data_offset + 32 ] ),
+			 (uint64_t) entry_index * 16 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0013",
-	 fvde_test_encrypted_metadata_read_type_0x0013 );
+			block_data_offset += 40;
+		}
+	}
+	byte_stream_copy_from_uint16_little_endian(
+	 &( block_data[ 8 ] ),
+	 1 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0014",
-	 fvde_test_encrypted_metadata_read_type_0x0014 );
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_data[ 48 ] ),
+	 8192 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0016",
-	 fvde_test_encrypted_metadata_read_type_0x0016 );
+	if( block_type != 0 )
+	{
+		if( libfvde_checksum_calculate_weak_crc32(
+		     &calculated_checksum,
+		     &( block_data[ 8 ] ),
+		     8184,
+		     0xffffffffUL,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( block_data[ 0 ] ),
+		 calculated_checksum );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 tweak_value,
+	 block_number );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0017",
-	 fvde_test_encrypted_metadata_read_type_0x0017 );
+	if( libcaes_tweaked_context_initialize(
+	     &encryption_context,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcaes_tweaked_context_set_keys(
+	     encryption_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     key,
+	     128,
+	     tweak_key,
+	     128,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcaes_crypt_xts(
+	     encryption_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     tweak_value,
+	     16,
+	     block_data,
+	     8192,
+	     data,
+	     8192,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	result = 1;
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0018",
-	 fvde_test_encrypted_metadata_read_type_0x0018 );
+on_error:
+	if( encryption_context != NULL )
+	{
+		libcaes_tweaked_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( result );
+}
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0019",
-	 fvde_test_encrypted_metadata_read_type_0x0019 );
+/* Tests the libfvde_encrypted_metadata_read_from_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_read_from_file_io_handle(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x001a",
-	 fvde_test_encrypted_metadata_read_type_0x001a );
+	uint8_t tweak_key_data[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x001c",
-	 fvde_test_encrypted_metadata_read_type_0x001c );
+	libbfio_handle_t *file_io_handle                 = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	libfvde_io_handle_t *io_handle                   = NULL;
+	uint8_t *metadata_data                           = NULL;
+	uint64_t block_number                            = 0;
+	uint16_t block_type                              = 0;
+	uint32_t number_of_block_entries                 = 0;
+	int number_of_entries                            = 0;
+	int result                                       = 0;
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x001d",
-	 fvde_test_encrypted_metadata_read_type_0x001d );
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0021",
-	 fvde_test_encrypted_metadata_read_type_0x0021 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0022",
-	 fvde_test_encrypted_metadata_read_type_0x0022 );
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	/* TODO: add tests for libfvde_encrypted_metadata_read_type_0x0024 */
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FVDE_TEST_RUN(
-	 "libfvde_encrypted_metadata_read_type_0x0025",
-	 fvde_test_encrypted_metadata_read_type_0x0025 );
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use encrypted metadata that spans 2 read windows followed by trailing data.
+	 * Metadata blocks 63 and 64, at either side of the read window boundary,
+	 * contain 1 and 2 segment descriptors respectively and all other metadata
+	 * blocks are LVFwiped
+	 */
+	metadata_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * ( ( 2 * LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE ) + 512 ) );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_data",
+	 metadata_data );
+
+	memory_set(
+	 metadata_data,
+	 0xff,
+	 sizeof( uint8_t ) * ( ( 2 * LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE ) + 512 ) );
+
+	for( block_number = 0;
+	     block_number < ( ( 2 * LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE ) / 8192 );
+	     block_number++ )
+	{
+		block_type              = 0;
+		number_of_block_entries = 0;
+
+		if( block_number == ( ( LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE / 8192 ) - 1 ) )
+		{
+			block_type              = 0x0304;
+			number_of_block_entries = 1;
+		}
+		else if( block_number == ( LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE / 8192 ) )
+		{
+			block_type              = 0x0304;
+			number_of_block_entries = 2;
+		}
+		result = fvde_test_encrypted_metadata_write_metadata_block(
+		          &( metadata_data[ block_number * 8192 ] ),
+		          block_number,
+		          block_type,
+		          number_of_block_entries,
+		          key_data,
+		          tweak_key_data,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          metadata_data,
+	          ( 2 * LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE ) + 512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          ( 2 * LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE ) + 512,
+	          key_data,
+	          128,
+	          tweak_key_data,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The segment descriptors of metadata block 64 in the second read window
+	 * replace those of metadata block 63
+	 */
+	result = libcdata_array_get_number_of_entries(
+	          encrypted_metadata->segment_descriptors_0x0304,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypted metadata that ends at the read window boundary
+	 */
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE,
+	          key_data,
+	          128,
+	          tweak_key_data,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          encrypted_metadata->segment_descriptors_0x0304,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test encrypted metadata where metadata block 64 crosses the end of
+	 * the encrypted metadata and is ignored as trailing data
+	 */
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE + 4096,
+	          key_data,
+	          128,
+	          tweak_key_data,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          encrypted_metadata->segment_descriptors_0x0304,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test encrypted metadata size exceeding the data
+	 */
+	result = libfvde_encrypted_metadata_read_from_file_io_handle(
+	          encrypted_metadata,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          ( 2 * LIBFVDE_ENCRYPTED_METADATA_READ_WINDOW_SIZE ) + 8192,
+	          key_data,
+	          128,
+	          tweak_key_data,
+	          128,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvde_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 metadata_data );
+
+	metadata_data = NULL;
+
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( metadata_data != NULL )
+	{
+		memory_free(
+		 metadata_data );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encrypted_metadata_get_encryption_context_plist function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_get_encryption_context_plist(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata             = NULL;
+	libfvde_encryption_context_plist_t *encryption_context_plist = NULL;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encrypted_metadata_get_encryption_context_plist(
+	          encrypted_metadata,
+	          &encryption_context_plist,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context_plist",
+	 encryption_context_plist );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_get_encryption_context_plist(
+	          NULL,
+	          &encryption_context_plist,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encrypted_metadata_get_encryption_context_plist(
+	          encrypted_metadata,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test incomplete compressed data is not decompressed
+	 */
+	encrypted_metadata->compressed_data = (uint8_t *) memory_allocate(
+	                                                   sizeof( uint8_t ) * 16 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata->compressed_data",
+	 encrypted_metadata->compressed_data );
+
+	encrypted_metadata->compressed_data_size              = 16;
+	encrypted_metadata->compressed_data_object_identifier = 1;
+	encrypted_metadata->uncompressed_data_size            = 64;
+
+	result = libfvde_encrypted_metadata_decompress_encryption_context_plist_data(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata->compressed_data",
+	 encrypted_metadata->compressed_data );
+
+	/* Test invalid uncompressed data size
+	 */
+	encrypted_metadata->compressed_data_object_identifier = 0;
+	encrypted_metadata->uncompressed_data_size            = 0;
+
+	result = libfvde_encrypted_metadata_decompress_encryption_context_plist_data(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encrypted_metadata_release_encryption_context_plist function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_release_encryption_context_plist(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_release_encryption_context_plist(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test release without a retrieved encryption context plist
+	 */
+	result = libfvde_encrypted_metadata_release_encryption_context_plist(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encrypted_metadata_compact function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encrypted_metadata_compact(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfvde_encrypted_metadata_t *encrypted_metadata             = NULL;
+	libfvde_encryption_context_plist_t *encryption_context_plist = NULL;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encrypted_metadata_initialize(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	encrypted_metadata->encryption_context_plist_data = (uint8_t *) memory_allocate(
+	                                                                 sizeof( uint8_t ) * 52 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata->encryption_context_plist_data",
+	 encrypted_metadata->encryption_context_plist_data );
+
+	memory_copy(
+	 encrypted_metadata->encryption_context_plist_data,
+	 fvde_test_encrypted_metadata_xml_plist_data,
+	 52 );
+
+	encrypted_metadata->encryption_context_plist_data_size = 52;
+
+	/* Test regular cases
+	 */
+	result = libfvde_encrypted_metadata_get_encryption_context_plist(
+	          encrypted_metadata,
+	          &encryption_context_plist,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context_plist",
+	 encryption_context_plist );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encrypted_metadata->encryption_context_plist_reference_count",
+	 encrypted_metadata->encryption_context_plist_reference_count,
+	 1 );
+
+	/* Test the encryption context plist is not released while in use
+	 */
+	result = libfvde_encrypted_metadata_compact(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encrypted_metadata->encryption_context_plist_file_is_set",
+	 encrypted_metadata->encryption_context_plist_file_is_set,
+	 1 );
+
+	result = libfvde_encrypted_metadata_release_encryption_context_plist(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encrypted_metadata->encryption_context_plist_reference_count",
+	 encrypted_metadata->encryption_context_plist_reference_count,
+	 0 );
+
+	/* Test the encryption context plist is released when not in use
+	 */
+	result = libfvde_encrypted_metadata_compact(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encrypted_metadata->encryption_context_plist_file_is_set",
+	 encrypted_metadata->encryption_context_plist_file_is_set,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encrypted_metadata->encryption_context_plist_data",
+	 encrypted_metadata->encryption_context_plist_data );
+
+	/* Test the encryption context plist is rebuilt on next access
+	 */
+	encryption_context_plist = NULL;
+
+	result = libfvde_encrypted_metadata_get_encryption_context_plist(
+	          encrypted_metadata,
+	          &encryption_context_plist,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context_plist",
+	 encryption_context_plist );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encrypted_metadata->encryption_context_plist_file_is_set",
+	 encrypted_metadata->encryption_context_plist_file_is_set,
+	 1 );
+
+	result = libfvde_encrypted_metadata_release_encryption_context_plist(
+	          encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encrypted_metadata_compact(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encrypted_metadata_free(
+	          &encrypted_metadata,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encrypted_metadata",
+	 encrypted_metadata );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encrypted_metadata != NULL )
+	{
+		libfvde_encrypted_metadata_free(
+		 &encrypted_metadata,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_initialize",
+	 fvde_test_encrypted_metadata_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_free",
+	 fvde_test_encrypted_metadata_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0010",
+	 fvde_test_encrypted_metadata_read_type_0x0010 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0011",
+	 fvde_test_encrypted_metadata_read_type_0x0011 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0012",
+	 fvde_test_encrypted_metadata_read_type_0x0012 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0013",
+	 fvde_test_encrypted_metadata_read_type_0x0013 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0014",
+	 fvde_test_encrypted_metadata_read_type_0x0014 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0016",
+	 fvde_test_encrypted_metadata_read_type_0x0016 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0017",
+	 fvde_test_encrypted_metadata_read_type_0x0017 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0018",
+	 fvde_test_encrypted_metadata_read_type_0x0018 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0019",
+	 fvde_test_encrypted_metadata_read_type_0x0019 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x001a",
+	 fvde_test_encrypted_metadata_read_type_0x001a );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x001c",
+	 fvde_test_encrypted_metadata_read_type_0x001c );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x001d",
+	 fvde_test_encrypted_metadata_read_type_0x001d );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0021",
+	 fvde_test_encrypted_metadata_read_type_0x0021 );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0022",
+	 fvde_test_encrypted_metadata_read_type_0x0022 );
+
+	/* TODO: add tests for libfvde_encrypted_metadata_read_type_0x0024 */
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_type_0x0025",
+	 fvde_test_encrypted_metadata_read_type_0x0025 );
 
 	FVDE_TEST_RUN(
 	 "libfvde_encrypted_metadata_read_type_0x0105",
@@ -4422,10 +5632,26 @@ int main(
 	 "libfvde_encrypted_metadata_read_type_0x0505",
 	 fvde_test_encrypted_metadata_read_type_0x0505 );
 
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_read_metadata_block",
+	 fvde_test_encrypted_metadata_read_metadata_block );
+
 	FVDE_TEST_RUN(
 	 "libfvde_encrypted_metadata_read_from_file_io_handle",
 	 fvde_test_encrypted_metadata_read_from_file_io_handle );
 
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_get_encryption_context_plist",
+	 fvde_test_encrypted_metadata_get_encryption_context_plist );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_release_encryption_context_plist",
+	 fvde_test_encrypted_metadata_release_encryption_context_plist );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encrypted_metadata_compact",
+	 fvde_test_encrypted_metadata_compact );
+
 	/* TODO: add tests for libfvde_encrypted_metadata_get_volume_master_key */
 
 	/* TODO: add tests for libfvde_encrypted_metadata_get_number_of_logical_volume_descriptors */
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -293,6 +294,1082 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_encryption_context_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_add_reference(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	libfvde_encryption_context_t *reference          = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encryption_context_add_reference(
+	          encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->reference_count",
+	 encryption_context->reference_count,
+	 2 );
+
+	reference = encryption_context;
+
+	result = libfvde_encryption_context_free(
+	          &reference,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->reference_count",
+	 encryption_context->reference_count,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_encryption_context_add_reference(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encryption_context_get_reference_count function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_get_reference_count(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	int reference_count                              = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encryption_context_get_reference_count(
+	          encryption_context,
+	          &reference_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "reference_count",
+	 reference_count,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encryption_context_get_reference_count(
+	          NULL,
+	          &reference_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_get_reference_count(
+	          encryption_context,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encryption_context_compare_keys_digest function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_compare_keys_digest(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	uint8_t tweak_key_data[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	uint8_t keys_digest[ 32 ];
+
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_calculate_keys_digest(
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          keys_digest,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encryption_context_compare_keys_digest(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          keys_digest,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_set_keys(
+	          encryption_context,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_compare_keys_digest(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          keys_digest,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_calculate_keys_digest(
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          tweak_key_data,
+	          16,
+	          key_data,
+	          16,
+	          keys_digest,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_compare_keys_digest(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          keys_digest,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_encryption_context_compare_keys_digest(
+	          NULL,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          keys_digest,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_compare_keys_digest(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          NULL,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_compare_keys_digest(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          keys_digest,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encryption_context_grab_decryption_context and
+ * libfvde_encryption_context_release_decryption_context functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_grab_decryption_context(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	uint8_t tweak_key_data[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	libcaes_tweaked_context_t *decryption_context1   = NULL;
+	libcaes_tweaked_context_t *decryption_context2   = NULL;
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases without keys
+	 */
+	result = libfvde_encryption_context_grab_decryption_context(
+	          encryption_context,
+	          &decryption_context1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_set_keys(
+	          encryption_context,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->number_of_decryption_contexts",
+	 encryption_context->number_of_decryption_contexts,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encryption_context_grab_decryption_context(
+	          encryption_context,
+	          &decryption_context1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_context1",
+	 decryption_context1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->number_of_decryption_contexts",
+	 encryption_context->number_of_decryption_contexts,
+	 0 );
+
+	/* Test that concurrent callers get their own decryption context
+	 */
+	result = libfvde_encryption_context_grab_decryption_context(
+	          encryption_context,
+	          &decryption_context2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_context2",
+	 decryption_context2 );
+
+	FVDE_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "decryption_context2",
+	 (intptr_t) decryption_context2,
+	 (intptr_t) decryption_context1 );
+
+	result = libfvde_encryption_context_release_decryption_context(
+	          encryption_context,
+	          &decryption_context2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "decryption_context2",
+	 decryption_context2 );
+
+	result = libfvde_encryption_context_release_decryption_context(
+	          encryption_context,
+	          &decryption_context1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "decryption_context1",
+	 decryption_context1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->number_of_decryption_contexts",
+	 encryption_context->number_of_decryption_contexts,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfvde_encryption_context_grab_decryption_context(
+	          NULL,
+	          &decryption_context1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_grab_decryption_context(
+	          encryption_context,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decryption_context1 = (libcaes_tweaked_context_t *) 0x12345678UL;
+
+	result = libfvde_encryption_context_grab_decryption_context(
+	          encryption_context,
+	          &decryption_context1,
+	          &error );
+
+	decryption_context1 = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_release_decryption_context(
+	          NULL,
+	          &decryption_context1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_release_decryption_context(
+	          encryption_context,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decryption_context2 != NULL )
+	{
+		libcaes_tweaked_context_free(
+		 &decryption_context2,
+		 NULL );
+	}
+	if( decryption_context1 != NULL )
+	{
+		libcaes_tweaked_context_free(
+		 &decryption_context1,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encryption_context_crypt function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_crypt(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint8_t tweak_key_data[ 16 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	/* IEEE 1619 XTS-AES-128 test vector 1
+	 */
+	uint8_t encrypted_data[ 32 ] = {
+		0x91, 0x7c, 0xf6, 0x9e, 0xbd, 0x68, 0xb2, 0xec, 0x9b, 0x9f, 0xe9, 0xa3, 0xea, 0xdd, 0xa6, 0x92,
+		0xcd, 0x43, 0xd2, 0xf5, 0x95, 0x98, 0xed, 0x85, 0x8c, 0x02, 0xc2, 0x65, 0x2f, 0xbf, 0x92, 0x2e };
+
+	uint8_t expected_data[ 32 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint8_t data[ 32 ];
+
+	libcerror_error_t *error                         = NULL;
+	libfvde_encryption_context_t *encryption_context = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case without keys
+	 */
+	result = libfvde_encryption_context_crypt(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          32,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_set_keys(
+	          encryption_context,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encryption_context_crypt(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          32,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          32 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The decryption context is returned for reuse
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->number_of_decryption_contexts",
+	 encryption_context->number_of_decryption_contexts,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_encryption_context_crypt(
+	          NULL,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          32,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt(
+	          encryption_context,
+	          -1,
+	          encrypted_data,
+	          32,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          NULL,
+	          32,
+	          data,
+	          32,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          32,
+	          NULL,
+	          32,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_crypt(
+	          encryption_context,
+	          LIBFVDE_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          encrypted_data,
+	          32,
+	          data,
+	          16,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -320,9 +1397,27 @@ int main(
 	 "libfvde_encryption_context_free",
 	 fvde_test_encryption_context_free );
 
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_add_reference",
+	 fvde_test_encryption_context_add_reference );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_get_reference_count",
+	 fvde_test_encryption_context_get_reference_count );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_compare_keys_digest",
+	 fvde_test_encryption_context_compare_keys_digest );
+
 	/* TODO: add tests for libfvde_encryption_context_set_keys */
 
-	/* TODO: add tests for libfvde_encryption_context_crypt */
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_grab_decryption_context",
+	 fvde_test_encryption_context_grab_decryption_context );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_crypt",
+	 fvde_test_encryption_context_crypt );
 
 	/* TODO: add tests for libfvde_encryption_aes_key_unwrap */
 
@@ -21,20 +21,23 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
-#include "fvde_test_libfplist.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_definitions.h"
 #include "../libfvde/libfvde_encryption_context_plist.h"
+#include "../libfvde/libfvde_passphrase_wrapped_kek.h"
 
 uint8_t fvde_test_encrypted_context_plist_data1[ 2981 ] = {
 	0x3c, 0x64, 0x69, 0x63, 0x74, 0x20, 0x49, 0x44, 0x3d, 0x22, 0x30, 0x22, 0x3e, 0x3c, 0x6b, 0x65,
@@ -111920,6 +111923,150 @@ uint8_t fvde_test_encrypted_context_plist_data4[ 740868 ] = {
 	0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69,
 	0x73, 0x74, 0x3e, 0x0a };
 
+uint8_t fvde_test_encrypted_context_plist_data5[ 2267 ] = {
+	0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31,
+	0x2e, 0x30, 0x22, 0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x55, 0x54,
+	0x46, 0x2d, 0x38, 0x22, 0x3f, 0x3e, 0x0a, 0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45,
+	0x20, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d,
+	0x2f, 0x2f, 0x41, 0x70, 0x70, 0x6c, 0x65, 0x2f, 0x2f, 0x44, 0x54, 0x44, 0x20, 0x50, 0x4c, 0x49,
+	0x53, 0x54, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x20, 0x22, 0x68, 0x74, 0x74,
+	0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2e, 0x63, 0x6f,
+	0x6d, 0x2f, 0x44, 0x54, 0x44, 0x73, 0x2f, 0x50, 0x72, 0x6f, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4c,
+	0x69, 0x73, 0x74, 0x2d, 0x31, 0x2e, 0x30, 0x2e, 0x64, 0x74, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x70,
+	0x6c, 0x69, 0x73, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x31, 0x2e,
+	0x30, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79,
+	0x3e, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x49, 0x6e, 0x66, 0x6f, 0x3c,
+	0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x53,
+	0x74, 0x61, 0x74, 0x75, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74, 0x65, 0x3c, 0x2f,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x54,
+	0x61, 0x72, 0x67, 0x65, 0x74, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x3c, 0x2f, 0x6b, 0x65,
+	0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31, 0x3c,
+	0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x43, 0x72, 0x79, 0x70, 0x74, 0x6f, 0x55,
+	0x73, 0x65, 0x72, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x3c, 0x61, 0x72, 0x72,
+	0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x50, 0x61, 0x73, 0x73, 0x70, 0x68, 0x72, 0x61, 0x73, 0x65, 0x57,
+	0x72, 0x61, 0x70, 0x70, 0x65, 0x64, 0x4b, 0x45, 0x4b, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x3c,
+	0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a,
+	0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64,
+	0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x50, 0x61, 0x73, 0x73, 0x70, 0x68, 0x72, 0x61, 0x73, 0x65,
+	0x48, 0x69, 0x6e, 0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a,
+	0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63,
+	0x74, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x50, 0x61, 0x73, 0x73, 0x70,
+	0x68, 0x72, 0x61, 0x73, 0x65, 0x57, 0x72, 0x61, 0x70, 0x70, 0x65, 0x64, 0x4b, 0x45, 0x4b, 0x53,
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x41, 0x77, 0x41, 0x41, 0x41, 0x42, 0x41,
+	0x41, 0x41, 0x41, 0x42, 0x4d, 0x42, 0x4e, 0x38, 0x62, 0x63, 0x73, 0x47, 0x34, 0x36, 0x57, 0x35,
+	0x56, 0x53, 0x36, 0x39, 0x67, 0x35, 0x46, 0x4d, 0x6b, 0x45, 0x41, 0x41, 0x41, 0x41, 0x42, 0x67,
+	0x41, 0x41, 0x41, 0x42, 0x4f, 0x52, 0x42, 0x6f, 0x78, 0x7a, 0x79, 0x59, 0x78, 0x0a, 0x09, 0x09,
+	0x09, 0x56, 0x33, 0x59, 0x4e, 0x37, 0x36, 0x6d, 0x43, 0x51, 0x2f, 0x6b, 0x39, 0x4e, 0x46, 0x4e,
+	0x48, 0x6d, 0x6d, 0x48, 0x6b, 0x79, 0x6d, 0x49, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x0a, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0a, 0x09, 0x09,
+	0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x0a, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x4d, 0x67, 0x30, 0x42, 0x41, 0x41, 0x45,
+	0x41, 0x41, 0x41, 0x41, 0x42, 0x41, 0x41, 0x41, 0x41, 0x41, 0x77, 0x41, 0x41, 0x41, 0x41, 0x6f,
+	0x41, 0x41, 0x41, 0x41, 0x72, 0x4b, 0x47, 0x54, 0x49, 0x52, 0x68, 0x65, 0x42, 0x0a, 0x09, 0x09,
+	0x09, 0x71, 0x55, 0x65, 0x32, 0x4f, 0x36, 0x6f, 0x6f, 0x48, 0x31, 0x51, 0x59, 0x4f, 0x53, 0x70,
+	0x75, 0x6c, 0x48, 0x31, 0x33, 0x54, 0x4d, 0x79, 0x57, 0x5a, 0x4e, 0x6a, 0x67, 0x57, 0x32, 0x39,
+	0x78, 0x4a, 0x71, 0x58, 0x7a, 0x76, 0x6f, 0x50, 0x41, 0x70, 0x30, 0x41, 0x41, 0x69, 0x2f, 0x4d,
+	0x2f, 0x31, 0x79, 0x33, 0x55, 0x0a, 0x09, 0x09, 0x09, 0x78, 0x77, 0x68, 0x64, 0x5a, 0x75, 0x44,
+	0x59, 0x5a, 0x2f, 0x46, 0x4a, 0x30, 0x4c, 0x48, 0x45, 0x30, 0x4c, 0x42, 0x42, 0x59, 0x68, 0x4f,
+	0x38, 0x68, 0x71, 0x6b, 0x39, 0x42, 0x57, 0x50, 0x57, 0x56, 0x64, 0x59, 0x59, 0x49, 0x4f, 0x30,
+	0x46, 0x66, 0x32, 0x73, 0x69, 0x74, 0x56, 0x58, 0x65, 0x33, 0x4a, 0x74, 0x68, 0x0a, 0x09, 0x09,
+	0x09, 0x2b, 0x6e, 0x4b, 0x47, 0x52, 0x33, 0x4b, 0x39, 0x33, 0x70, 0x38, 0x73, 0x74, 0x2b, 0x30,
+	0x3d, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x3c,
+	0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e,
+	0x0a, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x57, 0x72, 0x61, 0x70, 0x70, 0x65, 0x64, 0x56, 0x6f,
+	0x6c, 0x75, 0x6d, 0x65, 0x4b, 0x65, 0x79, 0x73, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09,
+	0x3c, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x41, 0x6c,
+	0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x4e, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4b,
+	0x45, 0x4b, 0x57, 0x72, 0x61, 0x70, 0x70, 0x65, 0x64, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x4b,
+	0x65, 0x79, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x61,
+	0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x4b, 0x65, 0x79, 0x45,
+	0x6e, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6e, 0x67, 0x4b, 0x65, 0x79, 0x49, 0x64, 0x65, 0x6e,
+	0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69,
+	0x6e, 0x67, 0x3e, 0x6e, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x4b,
+	0x65, 0x79, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x36, 0x30, 0x38, 0x34, 0x46, 0x31, 0x39,
+	0x32, 0x2d, 0x39, 0x39, 0x38, 0x36, 0x2d, 0x34, 0x45, 0x33, 0x44, 0x2d, 0x41, 0x31, 0x39, 0x37,
+	0x2d, 0x46, 0x46, 0x45, 0x39, 0x32, 0x42, 0x41, 0x30, 0x36, 0x46, 0x43, 0x43, 0x3c, 0x2f, 0x73,
+	0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x56,
+	0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x4b, 0x65, 0x79, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x3c, 0x2f, 0x6b,
+	0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e,
+	0x30, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c,
+	0x6b, 0x65, 0x79, 0x3e, 0x57, 0x72, 0x61, 0x70, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3c,
+	0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x3e, 0x30, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09,
+	0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x64, 0x69, 0x63, 0x74, 0x3e,
+	0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x41, 0x6c,
+	0x67, 0x6f, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x41, 0x45, 0x53, 0x2d, 0x58, 0x54, 0x53,
+	0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65,
+	0x79, 0x3e, 0x4b, 0x45, 0x4b, 0x57, 0x72, 0x61, 0x70, 0x70, 0x65, 0x64, 0x56, 0x6f, 0x6c, 0x75,
+	0x6d, 0x65, 0x4b, 0x65, 0x79, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79,
+	0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x41,
+	0x67, 0x41, 0x41, 0x41, 0x42, 0x67, 0x41, 0x41, 0x41, 0x43, 0x59, 0x53, 0x33, 0x4d, 0x48, 0x65,
+	0x5a, 0x56, 0x6e, 0x2b, 0x61, 0x79, 0x41, 0x37, 0x34, 0x6c, 0x33, 0x41, 0x55, 0x2b, 0x6c, 0x65,
+	0x79, 0x6b, 0x4c, 0x69, 0x73, 0x44, 0x48, 0x2b, 0x51, 0x34, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x0a, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x0a, 0x09, 0x09, 0x09, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x0a, 0x09, 0x09, 0x09, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x51, 0x41, 0x41, 0x41,
+	0x41, 0x4d, 0x41, 0x41, 0x41, 0x41, 0x4b, 0x41, 0x41, 0x41, 0x41, 0x0a, 0x09, 0x09, 0x09, 0x57,
+	0x50, 0x49, 0x48, 0x58, 0x71, 0x48, 0x75, 0x74, 0x6d, 0x4c, 0x70, 0x66, 0x76, 0x62, 0x4d, 0x67,
+	0x4c, 0x52, 0x2f, 0x6b, 0x46, 0x6c, 0x4c, 0x6c, 0x43, 0x41, 0x4c, 0x69, 0x4a, 0x64, 0x31, 0x54,
+	0x70, 0x33, 0x52, 0x46, 0x75, 0x4b, 0x45, 0x63, 0x70, 0x30, 0x42, 0x34, 0x4a, 0x34, 0x30, 0x45,
+	0x42, 0x78, 0x57, 0x0a, 0x09, 0x09, 0x09, 0x54, 0x2f, 0x44, 0x53, 0x54, 0x42, 0x4f, 0x44, 0x30,
+	0x6b, 0x32, 0x4c, 0x4f, 0x56, 0x46, 0x77, 0x55, 0x4a, 0x36, 0x6a, 0x38, 0x73, 0x79, 0x58, 0x52,
+	0x4d, 0x51, 0x62, 0x32, 0x61, 0x6b, 0x6d, 0x44, 0x73, 0x70, 0x4f, 0x5a, 0x39, 0x69, 0x59, 0x4f,
+	0x46, 0x78, 0x45, 0x47, 0x49, 0x55, 0x45, 0x31, 0x73, 0x6e, 0x76, 0x0a, 0x09, 0x09, 0x09, 0x44,
+	0x48, 0x4a, 0x4f, 0x71, 0x69, 0x48, 0x38, 0x61, 0x37, 0x32, 0x64, 0x69, 0x47, 0x6c, 0x31, 0x58,
+	0x66, 0x35, 0x34, 0x6c, 0x68, 0x5a, 0x6c, 0x41, 0x51, 0x41, 0x41, 0x41, 0x41, 0x3d, 0x3d, 0x0a,
+	0x09, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b,
+	0x65, 0x79, 0x3e, 0x4b, 0x65, 0x79, 0x45, 0x6e, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6e, 0x67,
+	0x4b, 0x65, 0x79, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09,
+	0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x39, 0x45, 0x42, 0x34, 0x37, 0x45,
+	0x39, 0x35, 0x2d, 0x34, 0x34, 0x43, 0x36, 0x2d, 0x34, 0x36, 0x42, 0x31, 0x2d, 0x42, 0x32, 0x37,
+	0x46, 0x2d, 0x44, 0x38, 0x39, 0x32, 0x44, 0x46, 0x35, 0x37, 0x42, 0x34, 0x41, 0x41, 0x3c, 0x2f,
+	0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e,
+	0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x4b, 0x65, 0x79, 0x49, 0x64, 0x65, 0x6e, 0x74, 0x3c, 0x2f,
+	0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e,
+	0x36, 0x34, 0x45, 0x44, 0x33, 0x36, 0x41, 0x43, 0x2d, 0x37, 0x42, 0x33, 0x31, 0x2d, 0x34, 0x34,
+	0x45, 0x33, 0x2d, 0x41, 0x39, 0x37, 0x45, 0x2d, 0x39, 0x33, 0x39, 0x37, 0x46, 0x32, 0x42, 0x37,
+	0x46, 0x37, 0x30, 0x37, 0x3c, 0x2f, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3e, 0x0a, 0x09, 0x09,
+	0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x4b, 0x65, 0x79, 0x49,
+	0x6e, 0x64, 0x65, 0x78, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x69,
+	0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+	0x72, 0x3e, 0x0a, 0x09, 0x09, 0x09, 0x3c, 0x6b, 0x65, 0x79, 0x3e, 0x57, 0x72, 0x61, 0x70, 0x56,
+	0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6b, 0x65, 0x79, 0x3e, 0x0a, 0x09, 0x09, 0x09,
+	0x3c, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x3e, 0x31, 0x3c, 0x2f, 0x69, 0x6e, 0x74, 0x65,
+	0x67, 0x65, 0x72, 0x3e, 0x0a, 0x09, 0x09, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e, 0x0a, 0x09,
+	0x3c, 0x2f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x63, 0x74, 0x3e,
+	0x0a, 0x3c, 0x2f, 0x70, 0x6c, 0x69, 0x73, 0x74, 0x3e, 0x0a, 0x00 };
+
 /* Tests the libfvde_encryption_context_plist_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -112584,9 +112731,9 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
      void )
 {
 	libcerror_error_t *error                                     = NULL;
-	libfplist_property_t *array_entry_property                   = NULL;
-	libfplist_property_t *passphrase_wrapped_kek_struct_property = NULL;
 	libfvde_encryption_context_plist_t *encryption_context_plist = NULL;
+	uint8_t *passphrase_wrapped_kek                              = NULL;
+	size_t passphrase_wrapped_kek_size                           = 0;
 	int result                                                   = 0;
 
 	/* Initialize test
@@ -112623,21 +112770,23 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 "error",
 	 error );
 
-	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "encryption_context_plist->crypto_users_property",
-	 ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->crypto_users_property );
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "encryption_context_plist->crypto_users_element.type",
+	 ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->crypto_users_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
 	 "encryption_context_plist->number_of_crypto_users_entries",
 	 ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->number_of_crypto_users_entries,
 	 3 );
 
-	/* Test retrieving the first crypto user sub property
+	/* Test retrieving the passphrase wrapped KEK of the first crypto user
 	 */
-	result = libfplist_property_get_array_entry_by_index(
-	          ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->crypto_users_property,
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
+	          encryption_context_plist,
 	          0,
-	          &array_entry_property,
+	          &passphrase_wrapped_kek,
+	          &passphrase_wrapped_kek_size,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112645,19 +112794,53 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 result,
 	 1 );
 
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "array_entry_property",
-	 array_entry_property );
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "passphrase_wrapped_kek_size",
+	 passphrase_wrapped_kek_size,
+	 (size_t) 284 );
+
+	memory_free(
+	 passphrase_wrapped_kek );
+
+	passphrase_wrapped_kek = NULL;
+
+	/* Test retrieving the passphrase wrapped KEK of the second crypto user
+	 */
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
+	          encryption_context_plist,
+	          1,
+	          &passphrase_wrapped_kek,
+	          &passphrase_wrapped_kek_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          array_entry_property,
-	          (uint8_t *) "PassphraseWrappedKEKStruct",
-	          26,
-	          &passphrase_wrapped_kek_struct_property,
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	/* Test retrieving the passphrase wrapped KEK of the third crypto user
+	 */
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_kek(
+	          encryption_context_plist,
+	          2,
+	          &passphrase_wrapped_kek,
+	          &passphrase_wrapped_kek_size,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112665,16 +112848,28 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 result,
 	 1 );
 
-	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "passphrase_wrapped_kek_struct_property",
-	 passphrase_wrapped_kek_struct_property );
-
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &passphrase_wrapped_kek_struct_property,
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "passphrase_wrapped_kek_size",
+	 passphrase_wrapped_kek_size,
+	 (size_t) 284 );
+
+	memory_free(
+	 passphrase_wrapped_kek );
+
+	passphrase_wrapped_kek = NULL;
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_plist_free(
+	          &encryption_context_plist,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112683,15 +112878,52 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "passphrase_wrapped_kek_struct_property",
-	 passphrase_wrapped_kek_struct_property );
+	 "encryption_context_plist",
+	 encryption_context_plist );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &array_entry_property,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( passphrase_wrapped_kek != NULL )
+	{
+		memory_free(
+		 passphrase_wrapped_kek );
+	}
+	if( encryption_context_plist != NULL )
+	{
+		libfvde_encryption_context_plist_free(
+		 &encryption_context_plist,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encryption_context_plist_get_passphrase_wrapped_keks function
+ * The second crypto user has no passphrase wrapped KEK and is ignored
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_plist_get_passphrase_wrapped_keks(
+     void )
+{
+	libcdata_array_t *passphrase_wrapped_keks                    = NULL;
+	libcerror_error_t *error                                     = NULL;
+	libfvde_encryption_context_plist_t *encryption_context_plist = NULL;
+	int number_of_entries                                        = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_plist_initialize(
+	          &encryption_context_plist,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112699,20 +112931,34 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 result,
 	 1 );
 
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context_plist",
+	 encryption_context_plist );
+
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "array_entry_property",
-	 array_entry_property );
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_plist_read_xml(
+	          encryption_context_plist,
+	          fvde_test_encrypted_context_plist_data4,
+	          740868,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test retrieving the second crypto user sub property
+	/* Test regular cases
 	 */
-	result = libfplist_property_get_array_entry_by_index(
-	          ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->crypto_users_property,
-	          1,
-	          &array_entry_property,
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+	          encryption_context_plist,
+	          &passphrase_wrapped_keks,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112721,35 +112967,35 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "array_entry_property",
-	 array_entry_property );
+	 "passphrase_wrapped_keks",
+	 passphrase_wrapped_keks );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          array_entry_property,
-	          (uint8_t *) "PassphraseWrappedKEKStruct",
-	          26,
-	          &passphrase_wrapped_kek_struct_property,
+	result = libcdata_array_get_number_of_entries(
+	          passphrase_wrapped_keks,
+	          &number_of_entries,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	FVDE_TEST_ASSERT_IS_NULL(
-	 "passphrase_wrapped_kek_struct_property",
-	 passphrase_wrapped_kek_struct_property );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &array_entry_property,
+	result = libcdata_array_free(
+	          &passphrase_wrapped_keks,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112758,19 +113004,55 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "array_entry_property",
-	 array_entry_property );
+	 "error",
+	 error );
+
+	/* Test retrieving the cached passphrase wrapped KEKs
+	 */
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context_plist->passphrase_wrapped_keks",
+	 ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->passphrase_wrapped_keks );
+
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+	          encryption_context_plist,
+	          &passphrase_wrapped_keks,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "passphrase_wrapped_keks",
+	 passphrase_wrapped_keks );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test retrieving the third crypto user sub property
+	/* Test error cases
 	 */
-	result = libfplist_property_get_array_entry_by_index(
-	          ( (libfvde_internal_encryption_context_plist_t * )encryption_context_plist )->crypto_users_property,
-	          2,
-	          &array_entry_property,
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+	          encryption_context_plist,
+	          &passphrase_wrapped_keks,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcdata_array_free(
+	          &passphrase_wrapped_keks,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112778,19 +113060,104 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 result,
 	 1 );
 
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+	          NULL,
+	          &passphrase_wrapped_keks,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+	          encryption_context_plist,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "array_entry_property",
-	 array_entry_property );
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_encryption_context_plist_free(
+	          &encryption_context_plist,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context_plist",
+	 encryption_context_plist );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_get_sub_property_by_utf8_name(
-	          array_entry_property,
-	          (uint8_t *) "PassphraseWrappedKEKStruct",
-	          26,
-	          &passphrase_wrapped_kek_struct_property,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( passphrase_wrapped_keks != NULL )
+	{
+		libcdata_array_free(
+		 &passphrase_wrapped_keks,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+		 NULL );
+	}
+	if( encryption_context_plist != NULL )
+	{
+		libfvde_encryption_context_plist_free(
+		 &encryption_context_plist,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_encryption_context_plist_get_passphrase_wrapped_keks function on a XML plist
+ * where the first crypto user has a malformed passphrase wrapped KEK, which is skipped
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_encryption_context_plist_get_passphrase_wrapped_keks_with_malformed_passphrase_wrapped_kek(
+     void )
+{
+	libcdata_array_t *passphrase_wrapped_keks                    = NULL;
+	libcerror_error_t *error                                     = NULL;
+	libfvde_encryption_context_plist_t *encryption_context_plist = NULL;
+	int number_of_entries                                        = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_encryption_context_plist_initialize(
+	          &encryption_context_plist,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112799,15 +113166,17 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "passphrase_wrapped_kek_struct_property",
-	 passphrase_wrapped_kek_struct_property );
+	 "encryption_context_plist",
+	 encryption_context_plist );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &passphrase_wrapped_kek_struct_property,
+	result = libfvde_encryption_context_plist_read_xml(
+	          encryption_context_plist,
+	          fvde_test_encrypted_context_plist_data5,
+	          2267,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112816,15 +113185,32 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "passphrase_wrapped_kek_struct_property",
-	 passphrase_wrapped_kek_struct_property );
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_encryption_context_plist_get_passphrase_wrapped_keks(
+	          encryption_context_plist,
+	          &passphrase_wrapped_keks,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "passphrase_wrapped_keks",
+	 passphrase_wrapped_keks );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfplist_property_free(
-	          &array_entry_property,
+	result = libcdata_array_get_number_of_entries(
+	          passphrase_wrapped_keks,
+	          &number_of_entries,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -112832,9 +113218,24 @@ int fvde_test_encryption_context_plist_read_xml_with_large_blob(
 	 result,
 	 1 );
 
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "array_entry_property",
-	 array_entry_property );
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &passphrase_wrapped_keks,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -112867,16 +113268,11 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( passphrase_wrapped_kek_struct_property != NULL )
-	{
-		libfplist_property_free(
-		 &passphrase_wrapped_kek_struct_property,
-		 NULL );
-	}
-	if( array_entry_property != NULL )
+	if( passphrase_wrapped_keks != NULL )
 	{
-		libfplist_property_free(
-		 &array_entry_property,
+		libcdata_array_free(
+		 &passphrase_wrapped_keks,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfvde_passphrase_wrapped_kek_free,
 		 NULL );
 	}
 	if( encryption_context_plist != NULL )
@@ -112945,6 +113341,14 @@ int main(
 
 	/* TODO: add tests for libfvde_encryption_context_plist_get_passphrase_wrapped_kek */
 
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_plist_get_passphrase_wrapped_keks",
+	 fvde_test_encryption_context_plist_get_passphrase_wrapped_keks );
+
+	FVDE_TEST_RUN(
+	 "libfvde_encryption_context_plist_get_passphrase_wrapped_keks with malformed passphrase wrapped KEK",
+	 fvde_test_encryption_context_plist_get_passphrase_wrapped_keks_with_malformed_passphrase_wrapped_kek );
+
 	/* TODO: add tests for libfvde_encryption_context_plist_get_kek_wrapped_volume_key */
 
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
@@ -0,0 +1,1492 @@
+/*
+ * Library executor type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_executor.h"
+
+#define FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS	64
+
+/* The tasks deferred by the test host
+ */
+typedef struct fvde_test_executor_host fvde_test_executor_host_t;
+
+struct fvde_test_executor_host
+{
+	/* The task functions
+	 */
+	int (*task_functions[ FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS ])(
+	       intptr_t *task );
+
+	/* The tasks
+	 */
+	intptr_t *tasks[ FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS ];
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The number of times the wait function was called
+	 */
+	int number_of_waits;
+};
+
+/* Test task callback function that marks its value
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_executor_task_callback(
+     intptr_t *value,
+     void *arguments FVDE_TEST_ATTRIBUTE_UNUSED )
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	*( (int *) value ) += 1;
+
+	return( 1 );
+}
+
+/* Test host submit function that defers the task until the wait function is called
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_executor_host_submit(
+     intptr_t *host_data,
+     int (*task_function)(
+            intptr_t *task ),
+     intptr_t *task )
+{
+	fvde_test_executor_host_t *host = (fvde_test_executor_host_t *) host_data;
+
+	if( ( host == NULL )
+	 || ( host->number_of_tasks >= FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS ) )
+	{
+		return( -1 );
+	}
+	host->task_functions[ host->number_of_tasks ] = task_function;
+	host->tasks[ host->number_of_tasks ]          = task;
+
+	host->number_of_tasks += 1;
+
+	return( 1 );
+}
+
+/* Test host wait function that runs the deferred tasks
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_executor_host_wait(
+     intptr_t *host_data )
+{
+	fvde_test_executor_host_t *host = (fvde_test_executor_host_t *) host_data;
+	int result                      = 1;
+	int task_index                  = 0;
+
+	if( host == NULL )
+	{
+		return( -1 );
+	}
+	host->number_of_waits += 1;
+
+	for( task_index = 0;
+	     task_index < host->number_of_tasks;
+	     task_index++ )
+	{
+		if( host->task_functions[ task_index ](
+		     host->tasks[ task_index ] ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	host->number_of_tasks = 0;
+
+	return( result );
+}
+
+/* Tests the libfvde_executor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfvde_executor_t *executor    = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvde_executor_initialize(
+	          &executor,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "executor",
+	 executor );
+
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	result = libfvde_executor_initialize(
+	          &executor,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "executor",
+	 executor );
+
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	/* Test error cases
+	 */
+	result = libfvde_executor_initialize(
+	          NULL,
+	          2,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	executor = (libfvde_executor_t *) 0x12345678UL;
+
+	result = libfvde_executor_initialize(
+	          &executor,
+	          2,
+	          &error );
+
+	executor = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_initialize(
+	          &executor,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_executor_initialize with malloc failing
+		 */
+		fvde_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvde_executor_initialize(
+		          &executor,
+		          0,
+		          &error );
+
+		if( fvde_test_malloc_attempts_before_fail != -1 )
+		{
+			fvde_test_malloc_attempts_before_fail = -1;
+
+			if( executor != NULL )
+			{
+				libfvde_executor_free(
+				 &executor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "executor",
+			 executor );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_executor_initialize with memset failing
+		 */
+		fvde_test_memset_attempts_before_fail = test_number;
+
+		result = libfvde_executor_initialize(
+		          &executor,
+		          0,
+		          &error );
+
+		if( fvde_test_memset_attempts_before_fail != -1 )
+		{
+			fvde_test_memset_attempts_before_fail = -1;
+
+			if( executor != NULL )
+			{
+				libfvde_executor_free(
+				 &executor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "executor",
+			 executor );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( executor != NULL )
+	{
+		libfvde_executor_free(
+		 &executor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_executor_initialize_with_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_initialize_with_callbacks(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfvde_executor_t *executor = NULL;
+	int number_of_threads        = -1;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_executor_initialize_with_callbacks(
+	          &executor,
+	          NULL,
+	          &fvde_test_executor_host_submit,
+	          &fvde_test_executor_host_wait,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "executor",
+	 executor );
+
+	result = libfvde_executor_get_number_of_threads(
+	          executor,
+	          &number_of_threads,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	/* Test error cases
+	 */
+	result = libfvde_executor_initialize_with_callbacks(
+	          NULL,
+	          NULL,
+	          &fvde_test_executor_host_submit,
+	          &fvde_test_executor_host_wait,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_initialize_with_callbacks(
+	          &executor,
+	          NULL,
+	          NULL,
+	          &fvde_test_executor_host_wait,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( executor != NULL )
+	{
+		libfvde_executor_free(
+		 &executor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_executor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_executor_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_executor_get_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_get_number_of_threads(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfvde_executor_t *executor = NULL;
+	int number_of_threads        = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_executor_initialize(
+	          &executor,
+	          3,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "executor",
+	 executor );
+
+	/* Test regular cases
+	 */
+	result = libfvde_executor_get_number_of_threads(
+	          executor,
+	          &number_of_threads,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfvde_executor_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_get_number_of_threads(
+	          executor,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( executor != NULL )
+	{
+		libfvde_executor_free(
+		 &executor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_executor_attach function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_attach(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	libfvde_executor_t *executor = NULL;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_executor_initialize(
+	          &executor,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "executor",
+	 executor );
+
+	/* Test regular cases
+	 */
+	result = libfvde_executor_attach(
+	          executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_users",
+	 ( (libfvde_internal_executor_t *) executor )->number_of_users,
+	 1 );
+
+	/* An executor that is still used cannot be freed
+	 */
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_detach(
+	          executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_users",
+	 ( (libfvde_internal_executor_t *) executor )->number_of_users,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_executor_detach(
+	          executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_attach(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_detach(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( executor != NULL )
+	{
+		libfvde_executor_free(
+		 &executor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_executor_task_group_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_task_group_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libfvde_executor_task_group_t *task_group = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_executor_task_group_initialize(
+	          &task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "task_group",
+	 task_group );
+
+	result = libfvde_executor_task_group_free(
+	          &task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "task_group",
+	 task_group );
+
+	/* Test error cases
+	 */
+	result = libfvde_executor_task_group_initialize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	task_group = (libfvde_executor_task_group_t *) 0x12345678UL;
+
+	result = libfvde_executor_task_group_initialize(
+	          &task_group,
+	          &error );
+
+	task_group = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_task_group_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_group != NULL )
+	{
+		libfvde_executor_task_group_free(
+		 &task_group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_executor_submit function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_submit(
+     void )
+{
+	int values[ FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS ];
+
+	libcerror_error_t *error                  = NULL;
+	libfvde_executor_t *executor              = NULL;
+	libfvde_executor_task_group_t *task_group = NULL;
+	int number_of_threads                     = 0;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	result = libfvde_executor_task_group_initialize(
+	          &task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "task_group",
+	 task_group );
+
+	/* Test regular cases with and without a thread pool
+	 */
+	for( number_of_threads = 0;
+	     number_of_threads <= 4;
+	     number_of_threads += 4 )
+	{
+		result = libfvde_executor_initialize(
+		          &executor,
+		          number_of_threads,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( value_index = 0;
+		     value_index < FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS;
+		     value_index++ )
+		{
+			values[ value_index ] = 0;
+
+			result = libfvde_executor_submit(
+			          executor,
+			          task_group,
+			          &fvde_test_executor_task_callback,
+			          (intptr_t *) &( values[ value_index ] ),
+			          NULL,
+			          &error );
+
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfvde_executor_wait(
+		          executor,
+		          task_group,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "number_of_pending_tasks",
+		 task_group->number_of_pending_tasks,
+		 0 );
+
+		for( value_index = 0;
+		     value_index < FVDE_TEST_EXECUTOR_NUMBER_OF_TASKS;
+		     value_index++ )
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "value",
+			 values[ value_index ],
+			 1 );
+		}
+		result = libfvde_executor_free(
+		          &executor,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfvde_executor_initialize(
+	          &executor,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_executor_submit(
+	          NULL,
+	          task_group,
+	          &fvde_test_executor_task_callback,
+	          (intptr_t *) &( values[ 0 ] ),
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_submit(
+	          executor,
+	          NULL,
+	          &fvde_test_executor_task_callback,
+	          (intptr_t *) &( values[ 0 ] ),
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_submit(
+	          executor,
+	          task_group,
+	          NULL,
+	          (intptr_t *) &( values[ 0 ] ),
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_tasks",
+	 task_group->number_of_pending_tasks,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	result = libfvde_executor_task_group_free(
+	          &task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_group != NULL )
+	{
+		libfvde_executor_task_group_free(
+		 &task_group,
+		 NULL );
+	}
+	if( executor != NULL )
+	{
+		libfvde_executor_free(
+		 &executor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_executor_wait function with the functions of a host
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_executor_wait(
+     void )
+{
+	fvde_test_executor_host_t host;
+	int values[ 8 ];
+
+	libcerror_error_t *error                  = NULL;
+	libfvde_executor_t *executor              = NULL;
+	libfvde_executor_task_group_t *task_group = NULL;
+	int result                                = 0;
+	int value_index                           = 0;
+
+	/* Initialize test
+	 */
+	host.number_of_tasks = 0;
+	host.number_of_waits = 0;
+
+	result = libfvde_executor_initialize_with_callbacks(
+	          &executor,
+	          (intptr_t *) &host,
+	          &fvde_test_executor_host_submit,
+	          &fvde_test_executor_host_wait,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_executor_task_group_initialize(
+	          &task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		values[ value_index ] = 0;
+
+		result = libfvde_executor_submit(
+		          executor,
+		          task_group,
+		          &fvde_test_executor_task_callback,
+		          (intptr_t *) &( values[ value_index ] ),
+		          NULL,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The host defers the tasks until the library waits
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_tasks",
+	 task_group->number_of_pending_tasks,
+	 8 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 0 );
+
+	result = libfvde_executor_wait(
+	          executor,
+	          task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_waits",
+	 host.number_of_waits,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_pending_tasks",
+	 task_group->number_of_pending_tasks,
+	 0 );
+
+	for( value_index = 0;
+	     value_index < 8;
+	     value_index++ )
+	{
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 values[ value_index ],
+		 1 );
+	}
+	/* Test error cases
+	 */
+	result = libfvde_executor_wait(
+	          NULL,
+	          task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_executor_wait(
+	          executor,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_executor_task_group_free(
+	          &task_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_executor_free(
+	          &executor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "executor",
+	 executor );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( task_group != NULL )
+	{
+		libfvde_executor_task_group_free(
+		 &task_group,
+		 NULL );
+	}
+	if( executor != NULL )
+	{
+		libfvde_executor_free(
+		 &executor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_initialize",
+	 fvde_test_executor_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_initialize_with_callbacks",
+	 fvde_test_executor_initialize_with_callbacks );
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_free",
+	 fvde_test_executor_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_get_number_of_threads",
+	 fvde_test_executor_get_number_of_threads );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_attach",
+	 fvde_test_executor_attach );
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_task_group_initialize",
+	 fvde_test_executor_task_group_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_submit",
+	 fvde_test_executor_submit );
+
+	FVDE_TEST_RUN(
+	 "libfvde_executor_wait",
+	 fvde_test_executor_wait );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
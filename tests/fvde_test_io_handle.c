@@ -27,12 +27,15 @@
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
 #include "fvde_test_memory.h"
 #include "fvde_test_unused.h"
 
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_encryption_context.h"
 #include "../libfvde/libfvde_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
@@ -398,6 +401,631 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_io_handle_get_encryption_context function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_io_handle_get_encryption_context(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	uint8_t tweak_key_data[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	libcerror_error_t *error                                = NULL;
+	libfvde_encryption_context_t *encryption_context        = NULL;
+	libfvde_encryption_context_t *cached_encryption_context = NULL;
+	libfvde_io_handle_t *io_handle                          = NULL;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the same keys retrieve the cached encryption context
+	 */
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &cached_encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "cached_encryption_context == encryption_context",
+	 (int) ( cached_encryption_context == encryption_context ),
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_release_encryption_context(
+	          io_handle,
+	          &cached_encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if different keys retrieve another encryption context
+	 */
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          tweak_key_data,
+	          16,
+	          key_data,
+	          16,
+	          &cached_encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "cached_encryption_context == encryption_context",
+	 (int) ( cached_encryption_context == encryption_context ),
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_release_encryption_context(
+	          io_handle,
+	          &cached_encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the encryption context remains usable after the IO handle was cleared
+	 */
+	result = libfvde_io_handle_clear(
+	          io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->reference_count",
+	 encryption_context->reference_count,
+	 1 );
+
+	result = libfvde_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_io_handle_get_encryption_context(
+	          NULL,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          0xffffffffUL,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          NULL,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cached_encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &cached_encryption_context,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_io_handle_release_encryption_context function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_io_handle_release_encryption_context(
+     void )
+{
+	uint8_t key_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	uint8_t tweak_key_data[ 16 ] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff };
+
+	libcerror_error_t *error                                = NULL;
+	libfvde_encryption_context_t *encryption_context        = NULL;
+	libfvde_encryption_context_t *shared_encryption_context = NULL;
+	libfvde_io_handle_t *io_handle                          = NULL;
+	int number_of_encryption_contexts                       = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if releasing the last reference evicts the encryption context from the cache
+	 */
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->encryption_contexts_array,
+	          &number_of_encryption_contexts,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_encryption_contexts",
+	 number_of_encryption_contexts,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_release_encryption_context(
+	          io_handle,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->encryption_contexts_array,
+	          &number_of_encryption_contexts,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_encryption_contexts",
+	 number_of_encryption_contexts,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a shared encryption context is only evicted when its last reference is released
+	 */
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_get_encryption_context(
+	          io_handle,
+	          LIBFVDE_ENCRYPTION_METHOD_AES_128_XTS,
+	          key_data,
+	          16,
+	          tweak_key_data,
+	          16,
+	          &shared_encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_release_encryption_context(
+	          io_handle,
+	          &shared_encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->encryption_contexts_array,
+	          &number_of_encryption_contexts,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_encryption_contexts",
+	 number_of_encryption_contexts,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "encryption_context->reference_count",
+	 encryption_context->reference_count,
+	 2 );
+
+	result = libfvde_io_handle_release_encryption_context(
+	          io_handle,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          io_handle->encryption_contexts_array,
+	          &number_of_encryption_contexts,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_encryption_contexts",
+	 number_of_encryption_contexts,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_io_handle_release_encryption_context(
+	          NULL,
+	          &encryption_context,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_io_handle_release_encryption_context(
+	          io_handle,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( shared_encryption_context != NULL )
+	{
+		libfvde_io_handle_release_encryption_context(
+		 io_handle,
+		 &shared_encryption_context,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libfvde_io_handle_release_encryption_context(
+		 io_handle,
+		 &encryption_context,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +1057,14 @@ int main(
 	 "libfvde_io_handle_clear",
 	 fvde_test_io_handle_clear );
 
+	FVDE_TEST_RUN(
+	 "libfvde_io_handle_get_encryption_context",
+	 fvde_test_io_handle_get_encryption_context );
+
+	FVDE_TEST_RUN(
+	 "libfvde_io_handle_release_encryption_context",
+	 fvde_test_io_handle_release_encryption_context );
+
 	/* TODO: add tests for libfvde_io_handle_read_sector */
 
 	/* TODO: add tests for libfvde_io_handle_read_logical_volume_header */
@@ -21,7 +21,11 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
 #include <types.h>
+#include <wide_string.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
@@ -33,29 +37,368 @@
 
 #include <time.h>
 
+#include "fvde_test_functions.h"
+#include "fvde_test_getopt.h"
+#include "fvde_test_libbfio.h"
+#include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
 #include "fvde_test_memory.h"
-#include "fvde_test_unused.h"
 
 #include "../libfvde/libfvde_io_handle.h"
 #include "../libfvde/libfvde_logical_volume.h"
 #include "../libfvde/libfvde_logical_volume_descriptor.h"
+#include "../libfvde/libfvde_memory_budget.h"
+#include "../libfvde/libfvde_memory_usage.h"
+#include "../libfvde/libfvde_segment_descriptor.h"
 
 #define FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE	4096
 
+#if !defined( LIBFVDE_HAVE_BFIO )
+
+LIBFVDE_EXTERN \
+int libfvde_check_volume_signature_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBFVDE_EXTERN \
+int libfvde_volume_open_file_io_handle(
+     libfvde_volume_t *volume,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libfvde_error_t **error );
+
+#endif /* !defined( LIBFVDE_HAVE_BFIO ) */
+
+/* Creates and opens a source volume and retrieves its first logical volume
+ * Returns 1 if successful, 0 if the volume has no logical volumes or -1 on error
+ */
+int fvde_test_logical_volume_open_source(
+     libfvde_volume_t **volume,
+     libfvde_logical_volume_t **logical_volume,
+     libbfio_handle_t *file_io_handle,
+     const system_character_t *password,
+     libcerror_error_t **error )
+{
+	libfvde_volume_group_t *volume_group = NULL;
+	static char *function                = "fvde_test_logical_volume_open_source";
+	size_t string_length                 = 0;
+	int number_of_logical_volumes        = 0;
+	int result                           = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvde_volume_initialize(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( password != NULL )
+	{
+		string_length = system_string_length(
+		                 password );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfvde_volume_set_utf16_password(
+		          *volume,
+		          (uint16_t *) password,
+		          string_length,
+		          error );
+#else
+		result = libfvde_volume_set_utf8_password(
+		          *volume,
+		          (uint8_t *) password,
+		          string_length,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set password.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = libfvde_volume_open_file_io_handle(
+	          *volume,
+	          file_io_handle,
+	          LIBFVDE_OPEN_READ,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_get_volume_group(
+	     *volume,
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve volume group.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvde_volume_group_get_number_of_logical_volumes(
+	     volume_group,
+	     &number_of_logical_volumes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of logical volumes.",
+		 function );
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( number_of_logical_volumes > 0 )
+	{
+		if( libfvde_volume_group_get_logical_volume_by_index(
+		     volume_group,
+		     0,
+		     logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve logical volume: 0.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	if( ( result == 1 )
+	 && ( password != NULL ) )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfvde_logical_volume_set_utf16_password(
+		          *logical_volume,
+		          (uint16_t *) password,
+		          string_length,
+		          error );
+#else
+		result = libfvde_logical_volume_set_utf8_password(
+		          *logical_volume,
+		          (uint8_t *) password,
+		          string_length,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set logical volume password.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvde_logical_volume_unlock(
+		     *logical_volume,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unlock logical volume.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfvde_volume_group_free(
+	     &volume_group,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume group.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( *logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libfvde_volume_group_free(
+		 &volume_group,
+		 NULL );
+	}
+	if( *volume != NULL )
+	{
+		libfvde_volume_free(
+		 volume,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a logical volume and closes and frees its source volume
+ * Returns 0 if successful or -1 on error
+ */
+int fvde_test_logical_volume_close_source(
+     libfvde_volume_t **volume,
+     libfvde_logical_volume_t **logical_volume,
+     libcerror_error_t **error )
+{
+	static char *function = "fvde_test_logical_volume_close_source";
+	int result            = 0;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid logical volume.",
+		 function );
+
+		return( -1 );
+	}
+	/* The logical volume references the IO handle and file IO pool
+	 * of the volume and must be freed before the volume
+	 */
+	if( *logical_volume != NULL )
+	{
+		if( libfvde_logical_volume_free(
+		     logical_volume,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free logical volume.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libfvde_volume_close(
+	     *volume,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close volume.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvde_volume_free(
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free volume.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
-/* Tests the libfvde_logical_volume_initialize function
+/* Tests the libfvde_internal_logical_volume_initialize function
  * Returns 1 if successful or 0 if not
  */
-int fvde_test_logical_volume_initialize(
+int fvde_test_internal_logical_volume_initialize(
      void )
 {
 	libcerror_error_t *error                                       = NULL;
 	libfvde_io_handle_t *io_handle                                 = NULL;
-	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
 	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
 	int result                                                     = 0;
 
@@ -103,8 +446,8 @@ int fvde_test_logical_volume_initialize(
 
 	/* Test regular cases
 	 */
-	result = libfvde_logical_volume_initialize(
-	          &logical_volume,
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
 	          io_handle,
 	          NULL,
 	          logical_volume_descriptor,
@@ -118,15 +461,15 @@ int fvde_test_logical_volume_initialize(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
-	 "logical_volume",
-	 logical_volume );
+	 "internal_logical_volume",
+	 internal_logical_volume );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfvde_logical_volume_free(
-	          &logical_volume,
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -135,8 +478,8 @@ int fvde_test_logical_volume_initialize(
 	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
-	 "logical_volume",
-	 logical_volume );
+	 "internal_logical_volume",
+	 internal_logical_volume );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -144,7 +487,7 @@ int fvde_test_logical_volume_initialize(
 
 	/* Test error cases
 	 */
-	result = libfvde_logical_volume_initialize(
+	result = libfvde_internal_logical_volume_initialize(
 	          NULL,
 	          io_handle,
 	          NULL,
@@ -165,10 +508,10 @@ int fvde_test_logical_volume_initialize(
 	libcerror_error_free(
 	 &error );
 
-	logical_volume = (libfvde_logical_volume_t *) 0x12345678UL;
+	internal_logical_volume = (libfvde_internal_logical_volume_t *) 0x12345678UL;
 
-	result = libfvde_logical_volume_initialize(
-	          &logical_volume,
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
 	          io_handle,
 	          NULL,
 	          logical_volume_descriptor,
@@ -176,7 +519,7 @@ int fvde_test_logical_volume_initialize(
 	          NULL,
 	          &error );
 
-	logical_volume = NULL;
+	internal_logical_volume = NULL;
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -190,8 +533,8 @@ int fvde_test_logical_volume_initialize(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvde_logical_volume_initialize(
-	          &logical_volume,
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
 	          NULL,
 	          NULL,
 	          logical_volume_descriptor,
@@ -211,8 +554,8 @@ int fvde_test_logical_volume_initialize(
 	libcerror_error_free(
 	 &error );
 
-	result = libfvde_logical_volume_initialize(
-	          &logical_volume,
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
 	          io_handle,
 	          NULL,
 	          NULL,
@@ -238,12 +581,12 @@ int fvde_test_logical_volume_initialize(
 	     test_number < number_of_malloc_fail_tests;
 	     test_number++ )
 	{
-		/* Test libfvde_logical_volume_initialize with malloc failing
+		/* Test libfvde_internal_logical_volume_initialize with malloc failing
 		 */
 		fvde_test_malloc_attempts_before_fail = test_number;
 
-		result = libfvde_logical_volume_initialize(
-		          &logical_volume,
+		result = libfvde_internal_logical_volume_initialize(
+		          &internal_logical_volume,
 		          io_handle,
 		          NULL,
 		          logical_volume_descriptor,
@@ -255,10 +598,10 @@ int fvde_test_logical_volume_initialize(
 		{
 			fvde_test_malloc_attempts_before_fail = -1;
 
-			if( logical_volume != NULL )
+			if( internal_logical_volume != NULL )
 			{
-				libfvde_logical_volume_free(
-				 &logical_volume,
+				libfvde_internal_logical_volume_free(
+				 &internal_logical_volume,
 				 NULL );
 			}
 		}
@@ -270,8 +613,8 @@ int fvde_test_logical_volume_initialize(
 			 -1 );
 
 			FVDE_TEST_ASSERT_IS_NULL(
-			 "logical_volume",
-			 logical_volume );
+			 "internal_logical_volume",
+			 internal_logical_volume );
 
 			FVDE_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -285,12 +628,12 @@ int fvde_test_logical_volume_initialize(
 	     test_number < number_of_memset_fail_tests;
 	     test_number++ )
 	{
-		/* Test libfvde_logical_volume_initialize with memset failing
+		/* Test libfvde_internal_logical_volume_initialize with memset failing
 		 */
 		fvde_test_memset_attempts_before_fail = test_number;
 
-		result = libfvde_logical_volume_initialize(
-		          &logical_volume,
+		result = libfvde_internal_logical_volume_initialize(
+		          &internal_logical_volume,
 		          io_handle,
 		          NULL,
 		          logical_volume_descriptor,
@@ -302,10 +645,10 @@ int fvde_test_logical_volume_initialize(
 		{
 			fvde_test_memset_attempts_before_fail = -1;
 
-			if( logical_volume != NULL )
+			if( internal_logical_volume != NULL )
 			{
-				libfvde_logical_volume_free(
-				 &logical_volume,
+				libfvde_internal_logical_volume_free(
+				 &internal_logical_volume,
 				 NULL );
 			}
 		}
@@ -317,8 +660,8 @@ int fvde_test_logical_volume_initialize(
 			 -1 );
 
 			FVDE_TEST_ASSERT_IS_NULL(
-			 "logical_volume",
-			 logical_volume );
+			 "internal_logical_volume",
+			 internal_logical_volume );
 
 			FVDE_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -374,10 +717,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( logical_volume != NULL )
+	if( internal_logical_volume != NULL )
 	{
-		libfvde_logical_volume_free(
-		 &logical_volume,
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
 		 NULL );
 	}
 	if( logical_volume_descriptor != NULL )
@@ -395,74 +738,90 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
-
-/* Tests the libfvde_logical_volume_free function
+/* Tests the libfvde_logical_volume_initialize function
  * Returns 1 if successful or 0 if not
  */
-int fvde_test_logical_volume_free(
+int fvde_test_logical_volume_initialize(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_t *second_logical_volume                = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	off64_t offset                                                 = 0;
+	int result                                                     = 0;
 
-	/* Test error cases
+#if defined( HAVE_FVDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                                = 1;
+	int number_of_memset_fail_tests                                = 1;
+	int test_number                                                = 0;
+#endif
+
+	/* Initialize test
 	 */
-	result = libfvde_logical_volume_free(
-	          NULL,
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
 
-	return( 1 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
 
-#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-/* Tests the libfvde_internal_logical_volume_read_buffer_from_file_io_pool function
- * Returns 1 if successful or 0 if not
- */
-int fvde_test_internal_logical_volume_read_buffer_from_file_io_pool(
-     libfvde_logical_volume_t *logical_volume )
-{
-	uint8_t buffer[ FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE ];
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
 
-	libcerror_error_t *error = NULL;
-	time_t timestamp         = 0;
-	size64_t remaining_size  = 0;
-	size64_t size            = 0;
-	size_t read_size         = 0;
-	ssize_t read_count       = 0;
-	off64_t offset           = 0;
-	off64_t read_offset      = 0;
-	int number_of_tests      = 1024;
-	int random_number        = 0;
-	int result               = 0;
-	int test_number          = 0;
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* Determine size
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
 	 */
-	result = libfvde_logical_volume_get_size(
-	          logical_volume,
-	          &size,
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT(
@@ -470,292 +829,4265 @@ int fvde_test_internal_logical_volume_read_buffer_from_file_io_pool(
 	 result,
 	 1 );
 
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Reset offset to 0
+	result = libfvde_logical_volume_initialize(
+	          &second_logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "second_logical_volume",
+	 second_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if both logical volumes share the same internal logical volume
+	 */
+	FVDE_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "logical_volume",
+	 (intptr_t *) logical_volume,
+	 (intptr_t *) second_logical_volume );
+
+	FVDE_TEST_ASSERT_EQUAL_INTPTR(
+	 "internal_logical_volume",
+	 (intptr_t *) ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume,
+	 (intptr_t *) internal_logical_volume );
+
+	FVDE_TEST_ASSERT_EQUAL_INTPTR(
+	 "internal_logical_volume",
+	 (intptr_t *) ( (libfvde_logical_volume_handle_t *) second_logical_volume )->internal_logical_volume,
+	 (intptr_t *) internal_logical_volume );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "reference_count",
+	 internal_logical_volume->reference_count,
+	 3 );
+
+	/* Test if the logical volumes have independent offsets
 	 */
+	internal_logical_volume->is_locked = 0;
+
 	offset = libfvde_logical_volume_seek_offset(
 	          logical_volume,
-	          0,
+	          1024,
 	          SEEK_SET,
 	          &error );
 
 	FVDE_TEST_ASSERT_EQUAL_INT64(
 	 "offset",
 	 offset,
-	 (int64_t) 0 );
+	 (int64_t) 1024 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	read_size = FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE;
+	result = libfvde_logical_volume_get_offset(
+	          second_logical_volume,
+	          &offset,
+	          &error );
 
-	if( size < FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE )
-	{
-		read_size = (size_t) size;
-	}
-	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-	              (libfvde_internal_logical_volume_t *) logical_volume,
-	              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-	              buffer,
-	              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
-	              &error );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_get_offset(
+	          logical_volume,
+	          &offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_free(
+	          &second_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "second_logical_volume",
+	 second_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "reference_count",
+	 internal_logical_volume->reference_count,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_initialize(
+	          NULL,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	logical_volume = (libfvde_logical_volume_t *) 0x12345678UL;
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	logical_volume = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_logical_volume_initialize with malloc failing
+		 */
+		fvde_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvde_logical_volume_initialize(
+		          &logical_volume,
+		          internal_logical_volume,
+		          &error );
+
+		if( fvde_test_malloc_attempts_before_fail != -1 )
+		{
+			fvde_test_malloc_attempts_before_fail = -1;
+
+			if( logical_volume != NULL )
+			{
+				libfvde_logical_volume_free(
+				 &logical_volume,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "logical_volume",
+			 logical_volume );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_logical_volume_initialize with memset failing
+		 */
+		fvde_test_memset_attempts_before_fail = test_number;
+
+		result = libfvde_logical_volume_initialize(
+		          &logical_volume,
+		          internal_logical_volume,
+		          &error );
+
+		if( fvde_test_memset_attempts_before_fail != -1 )
+		{
+			fvde_test_memset_attempts_before_fail = -1;
+
+			if( logical_volume != NULL )
+			{
+				libfvde_logical_volume_free(
+				 &logical_volume,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "logical_volume",
+			 logical_volume );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &second_logical_volume,
+		 NULL );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* Tests the libfvde_logical_volume_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_internal_logical_volume_read_buffer_from_file_io_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_logical_volume_read_buffer_from_file_io_pool(
+     libfvde_logical_volume_t *logical_volume )
+{
+	uint8_t buffer[ FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error = NULL;
+	time_t timestamp         = 0;
+	size64_t remaining_size  = 0;
+	size64_t size            = 0;
+	size_t read_size         = 0;
+	ssize_t read_count       = 0;
+	off64_t offset           = 0;
+	off64_t read_offset      = 0;
+	int number_of_tests      = 1024;
+	int random_number        = 0;
+	int result               = 0;
+	int test_number          = 0;
+
+	/* Determine size
+	 */
+	result = libfvde_logical_volume_get_size(
+	          logical_volume,
+	          &size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reset offset to 0
+	 */
+	offset = libfvde_logical_volume_seek_offset(
+	          logical_volume,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_size = FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE;
+
+	if( size < FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+	              (libfvde_logical_volume_handle_t *) logical_volume,
+	              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+	              buffer,
+	              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( size > 8 )
+	{
+		/* Set offset to size - 8
+		 */
+		offset = libfvde_logical_volume_seek_offset(
+		          logical_volume,
+		          -8,
+		          SEEK_END,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 (int64_t) size - 8 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer on size boundary
+		 */
+		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+		              (libfvde_logical_volume_handle_t *) logical_volume,
+		              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+		              buffer,
+		              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+		              &error );
+
+		FVDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 8 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Read buffer beyond size boundary
+		 */
+		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+		              (libfvde_logical_volume_handle_t *) logical_volume,
+		              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+		              buffer,
+		              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+		              &error );
+
+		FVDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 0 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Stress test read buffer
+	 */
+	timestamp = time(
+	             NULL );
+
+	srand(
+	 (unsigned int) timestamp );
+
+	offset = libfvde_logical_volume_seek_offset(
+	          logical_volume,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	remaining_size = size;
+
+	for( test_number = 0;
+	     test_number < number_of_tests;
+	     test_number++ )
+	{
+		random_number = rand();
+
+		FVDE_TEST_ASSERT_GREATER_THAN_INT(
+		 "random_number",
+		 random_number,
+		 -1 );
+
+		read_size = (size_t) random_number % FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE;
+
+#if defined( FVDE_TEST_VOLUME_VERBOSE )
+		fprintf(
+		 stdout,
+		 "libfvde_logical_volume_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+		 read_offset,
+		 read_offset,
+		 read_size );
+#endif
+		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+		              (libfvde_logical_volume_handle_t *) logical_volume,
+		              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+		              buffer,
+		              read_size,
+		              &error );
+
+		if( read_size > remaining_size )
+		{
+			read_size = (size_t) remaining_size;
+		}
+		FVDE_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) read_size );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		read_offset += read_count;
+
+		result = libfvde_logical_volume_get_offset(
+		          logical_volume,
+		          &offset,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 offset,
+		 read_offset );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		remaining_size -= read_count;
+
+		if( remaining_size == 0 )
+		{
+			offset = libfvde_logical_volume_seek_offset(
+			          logical_volume,
+			          0,
+			          SEEK_SET,
+			          &error );
+
+			FVDE_TEST_ASSERT_EQUAL_INT64(
+			 "offset",
+			 offset,
+			 (int64_t) 0 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			read_offset = 0;
+
+			remaining_size = size;
+		}
+	}
+	/* Reset offset to 0
+	 */
+	offset = libfvde_logical_volume_seek_offset(
+	          logical_volume,
+	          0,
+	          SEEK_SET,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+	              NULL,
+	              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+	              buffer,
+	              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+	              (libfvde_logical_volume_handle_t *) logical_volume,
+	              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+	              NULL,
+	              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
+	              (libfvde_logical_volume_handle_t *) logical_volume,
+	              ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume->file_io_pool,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_logical_volume_get_number_of_extents function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_get_number_of_extents(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	int number_of_extents                                          = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_get_number_of_extents(
+	          logical_volume,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_extents",
+	 number_of_extents,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_get_number_of_extents(
+	          NULL,
+	          &number_of_extents,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_number_of_extents(
+	          logical_volume,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_logical_volume_get_extent_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_get_extent_by_index(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	size64_t extent_size                                           = 0;
+	off64_t extent_offset                                          = 0;
+	off64_t physical_volume_offset                                 = 0;
+	int physical_volume_index                                      = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "extent_offset",
+	 extent_offset,
+	 (int64_t) 8192 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "extent_size",
+	 extent_size,
+	 (uint64_t) 12288 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "physical_volume_index",
+	 physical_volume_index,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "physical_volume_offset",
+	 physical_volume_offset,
+	 (int64_t) 86016 );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_get_extent_by_index(
+	          NULL,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          -1,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          1,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          NULL,
+	          &extent_size,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          NULL,
+	          &physical_volume_index,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          NULL,
+	          &physical_volume_offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_extent_by_index(
+	          logical_volume,
+	          0,
+	          &extent_offset,
+	          &extent_size,
+	          &physical_volume_index,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_logical_volume_get_block_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_get_block_reference(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	libfvde_block_reference_t *block_reference                     = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_get_block_reference(
+	          NULL,
+	          0,
+	          &block_reference,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_block_reference(
+	          logical_volume,
+	          0,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_reference = (libfvde_block_reference_t *) 0x12345678UL;
+
+	result = libfvde_logical_volume_get_block_reference(
+	          logical_volume,
+	          0,
+	          &block_reference,
+	          &error );
+
+	block_reference = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving a block reference from a locked logical volume
+	 */
+	logical_volume_descriptor->size = 3 * 4096;
+
+	result = libfvde_logical_volume_get_block_reference(
+	          logical_volume,
+	          0,
+	          &block_reference,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libfvde_logical_volume_submit_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_submit_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	libfvde_read_request_t *read_request                           = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_submit_read_buffer_at_offset(
+	          NULL,
+	          buffer,
+	          FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	          0,
+	          NULL,
+	          NULL,
+	          &read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_submit_read_buffer_at_offset(
+	          logical_volume,
+	          buffer,
+	          FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	          0,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_request = (libfvde_read_request_t *) 0x12345678UL;
+
+	result = libfvde_logical_volume_submit_read_buffer_at_offset(
+	          logical_volume,
+	          buffer,
+	          FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	          0,
+	          NULL,
+	          NULL,
+	          &read_request,
+	          &error );
+
+	read_request = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libfvde_logical_volume_advise function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_advise(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          0,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          0,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_DONTNEED,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_advise(
+	          NULL,
+	          0,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          -1,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          0,
+	          (size64_t) INT64_MAX + 1,
+	          LIBFVDE_ACCESS_ADVICE_NORMAL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          0,
+	          0,
+	          -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libfvde_logical_volume_start_access_trace, libfvde_logical_volume_get_access_trace_size,
+ * libfvde_logical_volume_copy_access_trace and libfvde_logical_volume_replay_access_trace functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_access_trace(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	size_t data_size                                               = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_get_access_trace_size(
+	          logical_volume,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_start_access_trace(
+	          logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_get_access_trace_size(
+	          logical_volume,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 20 );
+
+	result = libfvde_logical_volume_copy_access_trace(
+	          logical_volume,
+	          data,
+	          data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a replayed access trace without blocks does not read
+	 */
+	result = libfvde_logical_volume_replay_access_trace(
+	          logical_volume,
+	          data,
+	          data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_start_access_trace(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_access_trace_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_get_access_trace_size(
+	          logical_volume,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_copy_access_trace(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_copy_access_trace(
+	          logical_volume,
+	          NULL,
+	          data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_copy_access_trace(
+	          logical_volume,
+	          data,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_replay_access_trace(
+	          NULL,
+	          data,
+	          data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_replay_access_trace(
+	          logical_volume,
+	          NULL,
+	          data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_replay_access_trace(
+	          logical_volume,
+	          data,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libfvde_logical_volume_set_maximum_pinned_size, libfvde_logical_volume_pin_range
+ * and libfvde_logical_volume_unpin_range functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_pin_range(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          logical_volume,
+	          1048576,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_pin_range(
+	          logical_volume,
+	          0,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_unpin_range(
+	          logical_volume,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          logical_volume,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          logical_volume,
+	          (size64_t) -1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_pin_range(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_pin_range(
+	          logical_volume,
+	          -1,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_pin_range(
+	          logical_volume,
+	          0,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test pinning a range of a locked logical volume
+	 */
+	logical_volume_descriptor->size = 3 * 4096;
+
+	result = libfvde_logical_volume_pin_range(
+	          logical_volume,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_unpin_range(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_unpin_range(
+	          logical_volume,
+	          -1,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_logical_volume_unpin_range(
+	          logical_volume,
+	          0,
+	          (size64_t) INT64_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libfvde_internal_logical_volume_compact_on_request function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_internal_logical_volume_compact_on_request(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_io_handle_t *io_handle                                 = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_segment_descriptor_t *segment_descriptor               = NULL;
+	int entry_index                                                = 0;
+	libfvde_memory_budget_t *memory_budget                         = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_segment_descriptor_initialize(
+	          &segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_descriptor",
+	 segment_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor->logical_block_number  = 2;
+	segment_descriptor->number_of_blocks      = 3;
+	segment_descriptor->physical_block_number = 5;
+	segment_descriptor->physical_volume_index = 1;
+
+	result = libcdata_array_append_entry(
+	          logical_volume_descriptor->segment_descriptors,
+	          &entry_index,
+	          (intptr_t *) segment_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_descriptor = NULL;
+
+	logical_volume_descriptor->base_physical_block_number = 16;
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_initialize(
+	          &logical_volume,
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_usage_set_memory_budget(
+	          io_handle->memory_usage,
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_request_compaction(
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_compact_on_request(
+	          internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "internal_logical_volume->compaction_generation",
+	 internal_logical_volume->compaction_generation,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_internal_logical_volume_compact_on_request(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_usage_set_memory_budget(
+	          io_handle->memory_usage,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_free(
+	          &internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( io_handle != NULL )
+	 && ( memory_budget != NULL ) )
+	{
+		libfvde_memory_usage_set_memory_budget(
+		 io_handle->memory_usage,
+		 NULL,
+		 NULL );
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( internal_logical_volume != NULL )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( segment_descriptor != NULL )
+	{
+		libfvde_segment_descriptor_free(
+		 &segment_descriptor,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfvde_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* Tests the logical volume read, block reference, advice, access trace and pinning functions
+ * on the first logical volume of a test image
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_logical_volume_read_functions(
+     libfvde_logical_volume_t *logical_volume )
+{
+	uint8_t buffer[ FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE ];
+	uint8_t submit_buffer[ FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE ];
+
+	libcerror_error_t *error                   = NULL;
+	libfvde_block_reference_t *block_reference = NULL;
+	libfvde_read_request_t *read_request       = NULL;
+	const uint8_t *block_data                  = NULL;
+	uint8_t *access_trace_data                 = NULL;
+	size64_t size                              = 0;
+	size_t access_trace_data_size              = 0;
+	size_t block_data_size                     = 0;
+	size_t compare_size                        = 0;
+	size_t read_size                           = 0;
+	ssize_t read_count                         = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_logical_volume_get_size(
+	          logical_volume,
+	          &size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_size = FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE;
+
+	if( size < FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE )
+	{
+		read_size = (size_t) size;
+	}
+	result = libfvde_logical_volume_start_access_trace(
+	          logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfvde_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              buffer,
+	              read_size,
+	              0,
+	              &error );
+
+	FVDE_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) read_size );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test submitting a read request
+	 */
+	result = libfvde_logical_volume_submit_read_buffer_at_offset(
+	          logical_volume,
+	          submit_buffer,
+	          read_size,
+	          0,
+	          NULL,
+	          NULL,
+	          &read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_wait(
+	          read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_read_request_get_read_count(
+	          read_request,
+	          &read_count,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	FVDE_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
 	 (ssize_t) read_size );
 
+	result = memory_compare(
+	          submit_buffer,
+	          buffer,
+	          read_size );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfvde_read_request_free(
+	          &read_request,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( size > 8 )
-	{
-		/* Set offset to size - 8
-		 */
-		offset = libfvde_logical_volume_seek_offset(
-		          logical_volume,
-		          -8,
-		          SEEK_END,
-		          &error );
-
-		FVDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 (int64_t) size - 8 );
+	/* Test retrieving a block reference
+	 */
+	result = libfvde_logical_volume_get_block_reference(
+	          logical_volume,
+	          0,
+	          &block_reference,
+	          &error );
 
-		FVDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		/* Read buffer on size boundary
-		 */
-		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-		              (libfvde_internal_logical_volume_t *) logical_volume,
-		              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-		              buffer,
-		              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
-		              &error );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FVDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 8 );
+	result = libfvde_block_reference_get_data(
+	          block_reference,
+	          &block_data,
+	          &block_data_size,
+	          &error );
 
-		FVDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		/* Read buffer beyond size boundary
-		 */
-		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-		              (libfvde_internal_logical_volume_t *) logical_volume,
-		              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-		              buffer,
-		              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
-		              &error );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FVDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) 0 );
+	compare_size = read_size;
 
-		FVDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	if( block_data_size < compare_size )
+	{
+		compare_size = block_data_size;
 	}
-	/* Stress test read buffer
-	 */
-	timestamp = time(
-	             NULL );
+	result = memory_compare(
+	          block_data,
+	          buffer,
+	          compare_size );
 
-	srand(
-	 (unsigned int) timestamp );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	offset = libfvde_logical_volume_seek_offset(
+	result = libfvde_block_reference_free(
+	          &block_reference,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_get_block_reference(
 	          logical_volume,
-	          0,
-	          SEEK_SET,
+	          (off64_t) size,
+	          &block_reference,
 	          &error );
 
-	FVDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	remaining_size = size;
+	/* Test copying and replaying the access trace
+	 */
+	result = libfvde_logical_volume_get_access_trace_size(
+	          logical_volume,
+	          &access_trace_data_size,
+	          &error );
 
-	for( test_number = 0;
-	     test_number < number_of_tests;
-	     test_number++ )
-	{
-		random_number = rand();
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FVDE_TEST_ASSERT_GREATER_THAN_INT(
-		 "random_number",
-		 random_number,
-		 -1 );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		read_size = (size_t) random_number % FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE;
+	access_trace_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * access_trace_data_size );
 
-#if defined( FVDE_TEST_VOLUME_VERBOSE )
-		fprintf(
-		 stdout,
-		 "libfvde_logical_volume_read_buffer: at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
-		 read_offset,
-		 read_offset,
-		 read_size );
-#endif
-		read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-		              (libfvde_internal_logical_volume_t *) logical_volume,
-		              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-		              buffer,
-		              read_size,
-		              &error );
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "access_trace_data",
+	 access_trace_data );
 
-		if( read_size > remaining_size )
-		{
-			read_size = (size_t) remaining_size;
-		}
-		FVDE_TEST_ASSERT_EQUAL_SSIZE(
-		 "read_count",
-		 read_count,
-		 (ssize_t) read_size );
+	result = libfvde_logical_volume_copy_access_trace(
+	          logical_volume,
+	          access_trace_data,
+	          access_trace_data_size,
+	          &error );
 
-		FVDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		read_offset += read_count;
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		result = libfvde_logical_volume_get_offset(
-		          logical_volume,
-		          &offset,
-		          &error );
+	result = libfvde_logical_volume_replay_access_trace(
+	          logical_volume,
+	          access_trace_data,
+	          access_trace_data_size,
+	          &error );
 
-		FVDE_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FVDE_TEST_ASSERT_EQUAL_INT64(
-		 "offset",
-		 offset,
-		 read_offset );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FVDE_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	memory_free(
+	 access_trace_data );
 
-		remaining_size -= read_count;
+	access_trace_data = NULL;
 
-		if( remaining_size == 0 )
-		{
-			offset = libfvde_logical_volume_seek_offset(
-			          logical_volume,
-			          0,
-			          SEEK_SET,
-			          &error );
+	/* Test advising the access pattern
+	 */
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          0,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_WILLNEED,
+	          &error );
 
-			FVDE_TEST_ASSERT_EQUAL_INT64(
-			 "offset",
-			 offset,
-			 (int64_t) 0 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			FVDE_TEST_ASSERT_IS_NULL(
-			 "error",
-			 error );
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_advise(
+	          logical_volume,
+	          0,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_SEQUENTIAL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			read_offset = 0;
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-			remaining_size = size;
-		}
-	}
-	/* Reset offset to 0
-	 */
-	offset = libfvde_logical_volume_seek_offset(
+	result = libfvde_logical_volume_advise(
 	          logical_volume,
 	          0,
-	          SEEK_SET,
+	          0,
+	          LIBFVDE_ACCESS_ADVICE_NORMAL,
 	          &error );
 
-	FVDE_TEST_ASSERT_EQUAL_INT64(
-	 "offset",
-	 offset,
-	 (int64_t) 0 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
+	/* Test pinning a range
 	 */
-	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-	              NULL,
-	              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-	              buffer,
-	              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
-	              &error );
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          logical_volume,
+	          1048576,
+	          &error );
 
-	FVDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfvde_logical_volume_pin_range(
+	          logical_volume,
+	          0,
+	          read_size,
+	          &error );
 
-	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-	              (libfvde_internal_logical_volume_t *) logical_volume,
-	              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-	              NULL,
-	              FVDE_TEST_LOGICAL_VOLUME_READ_BUFFER_SIZE,
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libfvde_logical_volume_read_buffer_at_offset(
+	              logical_volume,
+	              submit_buffer,
+	              read_size,
+	              0,
 	              &error );
 
 	FVDE_TEST_ASSERT_EQUAL_SSIZE(
 	 "read_count",
 	 read_count,
-	 (ssize_t) -1 );
+	 (ssize_t) read_size );
 
-	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = memory_compare(
+	          submit_buffer,
+	          buffer,
+	          read_size );
 
-	read_count = libfvde_internal_logical_volume_read_buffer_from_file_io_pool(
-	              (libfvde_internal_logical_volume_t *) logical_volume,
-	              ( (libfvde_internal_logical_volume_t *) logical_volume )->file_io_pool,
-	              buffer,
-	              (size_t) SSIZE_MAX + 1,
-	              &error );
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-	FVDE_TEST_ASSERT_EQUAL_SSIZE(
-	 "read_count",
-	 read_count,
-	 (ssize_t) -1 );
+	result = libfvde_logical_volume_unpin_range(
+	          logical_volume,
+	          0,
+	          read_size,
+	          &error );
 
-	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfvde_logical_volume_set_maximum_pinned_size(
+	          logical_volume,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -765,29 +5097,107 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( access_trace_data != NULL )
+	{
+		memory_free(
+		 access_trace_data );
+	}
+	if( block_reference != NULL )
+	{
+		libfvde_block_reference_free(
+		 &block_reference,
+		 NULL );
+	}
+	if( read_request != NULL )
+	{
+		libfvde_read_request_free(
+		 &read_request,
+		 NULL );
+	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
-
-
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 int wmain(
-     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     wchar_t * const argv[] )
 #else
 int main(
-     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+     int argc,
+     char * const argv[] )
 #endif
 {
-	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
-	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libfvde_logical_volume_t *logical_volume = NULL;
+	libfvde_volume_t *volume                 = NULL;
+	system_character_t *option_offset        = NULL;
+	system_character_t *option_password      = NULL;
+	system_character_t *source               = NULL;
+	system_integer_t option                  = 0;
+	size_t string_length                     = 0;
+	off64_t volume_offset                    = 0;
+	int result                               = 0;
+
+	while( ( option = fvde_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:p:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
+				option_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 'p':
+				option_password = optarg;
+
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	if( option_offset != NULL )
+	{
+		string_length = system_string_length(
+		                 option_offset );
+
+		result = fvde_test_system_string_copy_from_64_bit_in_decimal(
+		          option_offset,
+		          string_length + 1,
+		          (uint64_t *) &volume_offset,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
+	FVDE_TEST_RUN(
+	 "libfvde_internal_logical_volume_initialize",
+	 fvde_test_internal_logical_volume_initialize );
+
 	FVDE_TEST_RUN(
 	 "libfvde_logical_volume_initialize",
 	 fvde_test_logical_volume_initialize );
@@ -822,11 +5232,221 @@ int main(
 
 	/* TODO: add tests for libfvde_internal_logical_volume_seek_offset */
 
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_get_number_of_extents",
+	 fvde_test_logical_volume_get_number_of_extents );
+
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_get_extent_by_index",
+	 fvde_test_logical_volume_get_extent_by_index );
+
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_get_block_reference",
+	 fvde_test_logical_volume_get_block_reference );
+
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_submit_read_buffer_at_offset",
+	 fvde_test_logical_volume_submit_read_buffer_at_offset );
+
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_advise",
+	 fvde_test_logical_volume_advise );
+
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_access_trace",
+	 fvde_test_logical_volume_access_trace );
+
+	FVDE_TEST_RUN(
+	 "libfvde_logical_volume_pin_range",
+	 fvde_test_logical_volume_pin_range );
+
+	FVDE_TEST_RUN(
+	 "libfvde_internal_logical_volume_compact_on_request",
+	 fvde_test_internal_logical_volume_compact_on_request );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libbfio_file_range_initialize(
+		          &file_io_handle,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_range_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_range_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libbfio_file_range_set(
+		          file_io_handle,
+		          volume_offset,
+		          0,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfvde_check_volume_signature_file_io_handle(
+		          file_io_handle,
+		          &error );
+
+		FVDE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			/* Initialize logical volume for tests
+			 */
+			result = fvde_test_logical_volume_open_source(
+			          &volume,
+			          &logical_volume,
+			          file_io_handle,
+			          option_password,
+			          &error );
+
+			FVDE_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( logical_volume != NULL )
+			{
+				result = libfvde_logical_volume_is_locked(
+				          logical_volume,
+				          &error );
+
+				FVDE_TEST_ASSERT_NOT_EQUAL_INT(
+				 "result",
+				 result,
+				 -1 );
+
+				FVDE_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				if( result == 0 )
+				{
+					FVDE_TEST_RUN_WITH_ARGS(
+					 "libfvde_logical_volume_read_functions",
+					 fvde_test_logical_volume_read_functions,
+					 logical_volume );
+				}
+			}
+			/* Clean up
+			 */
+			result = fvde_test_logical_volume_close_source(
+			          &volume,
+			          &logical_volume,
+			          &error );
+
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "volume",
+			 volume );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	return( EXIT_FAILURE );
 }
 
@@ -0,0 +1,2178 @@
+/*
+ * Library memory_budget type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_memory_budget.h"
+#include "../libfvde/libfvde_memory_usage.h"
+
+/* Tests the libfvde_memory_budget_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 2;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_budget = (libfvde_memory_budget_t *) 0x12345678UL;
+
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          0,
+	          &error );
+
+	memory_budget = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_memory_budget_initialize with malloc failing
+		 */
+		fvde_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvde_memory_budget_initialize(
+		          &memory_budget,
+		          0,
+		          &error );
+
+		if( fvde_test_malloc_attempts_before_fail != -1 )
+		{
+			fvde_test_malloc_attempts_before_fail = -1;
+
+			if( memory_budget != NULL )
+			{
+				libfvde_memory_budget_free(
+				 &memory_budget,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "memory_budget",
+			 memory_budget );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_memory_budget_initialize with memset failing
+		 */
+		fvde_test_memset_attempts_before_fail = test_number;
+
+		result = libfvde_memory_budget_initialize(
+		          &memory_budget,
+		          0,
+		          &error );
+
+		if( fvde_test_memset_attempts_before_fail != -1 )
+		{
+			fvde_test_memset_attempts_before_fail = -1;
+
+			if( memory_budget != NULL )
+			{
+				libfvde_memory_budget_free(
+				 &memory_budget,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "memory_budget",
+			 memory_budget );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_get_maximum_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_get_maximum_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	size64_t maximum_size                  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_get_maximum_size(
+	          memory_budget,
+	          &maximum_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 maximum_size,
+	 (uint64_t) 1024 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_get_maximum_size(
+	          NULL,
+	          &maximum_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_maximum_size(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_set_maximum_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_set_maximum_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	size64_t maximum_size                  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_set_maximum_size(
+	          memory_budget,
+	          2048,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_maximum_size(
+	          memory_budget,
+	          &maximum_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 maximum_size,
+	 (uint64_t) 2048 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_set_maximum_size(
+	          NULL,
+	          2048,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_get_used_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_get_used_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	size64_t used_size                     = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_get_used_size(
+	          memory_budget,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 used_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_get_used_size(
+	          NULL,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_used_size(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_get_used_size_by_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_get_used_size_by_type(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	size64_t used_size                     = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_get_used_size_by_type(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 used_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_get_used_size_by_type(
+	          NULL,
+	          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_used_size_by_type(
+	          memory_budget,
+	          0,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_used_size_by_type(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_PINNED + 1,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_used_size_by_type(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_get_number_of_volumes function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_get_number_of_volumes(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	int number_of_volumes                  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_get_number_of_volumes(
+	          memory_budget,
+	          &number_of_volumes,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_get_number_of_volumes(
+	          NULL,
+	          &number_of_volumes,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_number_of_volumes(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_request_compaction function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_request_compaction(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_request_compaction(
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_request_compaction(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_memory_budget_attach_volume function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_attach_volume(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	libfvde_memory_usage_t *memory_usage   = NULL;
+	int number_of_volumes                  = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	result = libfvde_memory_usage_initialize(
+	          &memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_usage",
+	 memory_usage );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_attach_volume(
+	          memory_budget,
+	          memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_number_of_volumes(
+	          memory_budget,
+	          &number_of_volumes,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 1 );
+
+	/* A memory budget that is still used cannot be freed
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_detach_volume(
+	          memory_budget,
+	          memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_number_of_volumes(
+	          memory_budget,
+	          &number_of_volumes,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_volumes",
+	 number_of_volumes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_attach_volume(
+	          NULL,
+	          memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_attach_volume(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_detach_volume(
+	          NULL,
+	          memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_detach_volume(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test detaching a memory usage that is not attached
+	 */
+	result = libfvde_memory_budget_detach_volume(
+	          memory_budget,
+	          memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_usage_free(
+	          &memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_usage",
+	 memory_usage );
+
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_usage != NULL )
+	{
+		libfvde_memory_usage_free(
+		 &memory_usage,
+		 NULL );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Compact function that counts the number of times it is called
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_memory_budget_compact_function(
+     intptr_t *compact_value,
+     libcerror_error_t **error FVDE_TEST_ATTRIBUTE_UNUSED )
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( compact_value == NULL )
+	{
+		return( -1 );
+	}
+	*( (int *) compact_value ) += 1;
+
+	return( 1 );
+}
+
+/* Tests if libfvde_memory_budget_request_compaction compacts the attached volumes
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_request_compaction_of_volumes(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	libfvde_memory_usage_t *memory_usage   = NULL;
+	int number_of_compactions              = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_usage_initialize(
+	          &memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_usage_set_compact_function(
+	          memory_usage,
+	          (intptr_t *) &number_of_compactions,
+	          &fvde_test_memory_budget_compact_function,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_usage_set_memory_budget(
+	          memory_usage,
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an attached volume that is not being read is compacted
+	 */
+	result = libfvde_memory_budget_request_compaction(
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_compactions",
+	 number_of_compactions,
+	 1 );
+
+	/* Test if a detached volume is no longer compacted
+	 */
+	result = libfvde_memory_usage_set_memory_budget(
+	          memory_usage,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_request_compaction(
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_compactions",
+	 number_of_compactions,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_usage_free(
+	          &memory_usage,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_usage != NULL )
+	{
+		libfvde_memory_usage_free(
+		 &memory_usage,
+		 NULL );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_add_used_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_add_used_size(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	size64_t used_size                     = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          200,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_used_size(
+	          memory_budget,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 used_size,
+	 (uint64_t) 300 );
+
+	result = libfvde_memory_budget_get_used_size_by_type(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 used_size,
+	 (uint64_t) 200 );
+
+	/* Removing more than the used size of a type does not affect the other types
+	 */
+	result = libfvde_memory_budget_remove_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          500,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_used_size(
+	          memory_budget,
+	          &used_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 used_size,
+	 (uint64_t) 100 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_add_used_size(
+	          NULL,
+	          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          0,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_remove_used_size(
+	          NULL,
+	          LIBFVDE_MEMORY_USAGE_TYPE_METADATA,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_remove_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_PINNED + 1,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_memory_budget_get_compaction_generation function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_memory_budget_get_compaction_generation(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libfvde_memory_budget_t *memory_budget = NULL;
+	uint32_t compaction_generation         = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_memory_budget_initialize(
+	          &memory_budget,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	/* Test regular cases
+	 */
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 0 );
+
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_SECTORS_CACHE,
+	          1000,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 0 );
+
+	/* Exceeding the maximum size requests compaction
+	 */
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 1 );
+
+	/* Used size that remains exceeding the maximum size and grows requests compaction again
+	 */
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 2 );
+
+	result = libfvde_memory_budget_remove_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          200,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_add_used_size(
+	          memory_budget,
+	          LIBFVDE_MEMORY_USAGE_TYPE_READ_AHEAD,
+	          100,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 3 );
+
+	result = libfvde_memory_budget_request_compaction(
+	          memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 4 );
+
+	/* Lowering the maximum size below the used size requests compaction
+	 */
+	result = libfvde_memory_budget_set_maximum_size(
+	          memory_budget,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "compaction_generation",
+	 compaction_generation,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libfvde_memory_budget_get_compaction_generation(
+	          NULL,
+	          &compaction_generation,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_memory_budget_get_compaction_generation(
+	          memory_budget,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_memory_budget_free(
+	          &memory_budget,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "memory_budget",
+	 memory_budget );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_budget != NULL )
+	{
+		libfvde_memory_budget_free(
+		 &memory_budget,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_initialize",
+	 fvde_test_memory_budget_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_free",
+	 fvde_test_memory_budget_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_get_maximum_size",
+	 fvde_test_memory_budget_get_maximum_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_set_maximum_size",
+	 fvde_test_memory_budget_set_maximum_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_get_used_size",
+	 fvde_test_memory_budget_get_used_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_get_used_size_by_type",
+	 fvde_test_memory_budget_get_used_size_by_type );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_get_number_of_volumes",
+	 fvde_test_memory_budget_get_number_of_volumes );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_request_compaction",
+	 fvde_test_memory_budget_request_compaction );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_attach_volume",
+	 fvde_test_memory_budget_attach_volume );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_request_compaction_of_volumes",
+	 fvde_test_memory_budget_request_compaction_of_volumes );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_add_used_size",
+	 fvde_test_memory_budget_add_used_size );
+
+	FVDE_TEST_RUN(
+	 "libfvde_memory_budget_get_compaction_generation",
+	 fvde_test_memory_budget_get_compaction_generation );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
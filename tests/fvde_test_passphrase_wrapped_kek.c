@@ -0,0 +1,863 @@
+/*
+ * Library passphrase_wrapped_kek type test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_passphrase_wrapped_kek.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_passphrase_wrapped_kek_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_passphrase_wrapped_kek_initialize(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek = NULL;
+	int result                                               = 0;
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+	int number_of_malloc_fail_tests                          = 1;
+	int number_of_memset_fail_tests                          = 1;
+	int test_number                                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_initialize(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_passphrase_wrapped_kek_free(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_initialize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	passphrase_wrapped_kek = (libfvde_passphrase_wrapped_kek_t *) 0x12345678UL;
+
+	result = libfvde_passphrase_wrapped_kek_initialize(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	passphrase_wrapped_kek = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FVDE_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_passphrase_wrapped_kek_initialize with malloc failing
+		 */
+		fvde_test_malloc_attempts_before_fail = test_number;
+
+		result = libfvde_passphrase_wrapped_kek_initialize(
+		          &passphrase_wrapped_kek,
+		          &error );
+
+		if( fvde_test_malloc_attempts_before_fail != -1 )
+		{
+			fvde_test_malloc_attempts_before_fail = -1;
+
+			if( passphrase_wrapped_kek != NULL )
+			{
+				libfvde_passphrase_wrapped_kek_free(
+				 &passphrase_wrapped_kek,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "passphrase_wrapped_kek",
+			 passphrase_wrapped_kek );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfvde_passphrase_wrapped_kek_initialize with memset failing
+		 */
+		fvde_test_memset_attempts_before_fail = test_number;
+
+		result = libfvde_passphrase_wrapped_kek_initialize(
+		          &passphrase_wrapped_kek,
+		          &error );
+
+		if( fvde_test_memset_attempts_before_fail != -1 )
+		{
+			fvde_test_memset_attempts_before_fail = -1;
+
+			if( passphrase_wrapped_kek != NULL )
+			{
+				libfvde_passphrase_wrapped_kek_free(
+				 &passphrase_wrapped_kek,
+				 NULL );
+			}
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "passphrase_wrapped_kek",
+			 passphrase_wrapped_kek );
+
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FVDE_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( passphrase_wrapped_kek != NULL )
+	{
+		libfvde_passphrase_wrapped_kek_free(
+		 &passphrase_wrapped_kek,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_passphrase_wrapped_kek_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_passphrase_wrapped_kek_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_passphrase_wrapped_kek_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_passphrase_wrapped_kek_clone(
+     void )
+{
+	libcerror_error_t *error                                             = NULL;
+	libfvde_passphrase_wrapped_kek_t *destination_passphrase_wrapped_kek = NULL;
+	libfvde_passphrase_wrapped_kek_t *source_passphrase_wrapped_kek      = NULL;
+	int result                                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_passphrase_wrapped_kek_initialize(
+	          &source_passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "source_passphrase_wrapped_kek",
+	 source_passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_passphrase_wrapped_kek->salt[ 0 ]            = 0x5a;
+	source_passphrase_wrapped_kek->number_of_iterations = 1000;
+	source_passphrase_wrapped_kek->wrapped_kek[ 0 ]     = 0xa5;
+	source_passphrase_wrapped_kek->kek[ 0 ]             = 0xff;
+	source_passphrase_wrapped_kek->kek_is_set           = 1;
+
+	/* Test regular cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_clone(
+	          &destination_passphrase_wrapped_kek,
+	          source_passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_passphrase_wrapped_kek",
+	 destination_passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_passphrase_wrapped_kek->salt[ 0 ]",
+	 destination_passphrase_wrapped_kek->salt[ 0 ],
+	 (uint8_t) 0x5a );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_passphrase_wrapped_kek->number_of_iterations",
+	 destination_passphrase_wrapped_kek->number_of_iterations,
+	 (uint32_t) 1000 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_passphrase_wrapped_kek->wrapped_kek[ 0 ]",
+	 destination_passphrase_wrapped_kek->wrapped_kek[ 0 ],
+	 (uint8_t) 0xa5 );
+
+	/* The unwrapped KEK is not copied
+	 */
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_passphrase_wrapped_kek->kek[ 0 ]",
+	 destination_passphrase_wrapped_kek->kek[ 0 ],
+	 (uint8_t) 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "destination_passphrase_wrapped_kek->kek_is_set",
+	 destination_passphrase_wrapped_kek->kek_is_set,
+	 (uint8_t) 0 );
+
+	result = libfvde_passphrase_wrapped_kek_free(
+	          &destination_passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_passphrase_wrapped_kek_clone(
+	          &destination_passphrase_wrapped_kek,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "destination_passphrase_wrapped_kek",
+	 destination_passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_clone(
+	          NULL,
+	          source_passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_passphrase_wrapped_kek = source_passphrase_wrapped_kek;
+
+	result = libfvde_passphrase_wrapped_kek_clone(
+	          &destination_passphrase_wrapped_kek,
+	          source_passphrase_wrapped_kek,
+	          &error );
+
+	destination_passphrase_wrapped_kek = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_passphrase_wrapped_kek_free(
+	          &source_passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "source_passphrase_wrapped_kek",
+	 source_passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_passphrase_wrapped_kek != NULL )
+	{
+		libfvde_passphrase_wrapped_kek_free(
+		 &destination_passphrase_wrapped_kek,
+		 NULL );
+	}
+	if( source_passphrase_wrapped_kek != NULL )
+	{
+		libfvde_passphrase_wrapped_kek_free(
+		 &source_passphrase_wrapped_kek,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_passphrase_wrapped_kek_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_passphrase_wrapped_kek_read_data(
+     void )
+{
+	uint8_t passphrase_wrapped_kek_data[ 284 ];
+
+	libcerror_error_t *error                                 = NULL;
+	libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 passphrase_wrapped_kek_data,
+	 0,
+	 284 );
+
+	passphrase_wrapped_kek_data[ 0 ]   = 0x03;
+	passphrase_wrapped_kek_data[ 4 ]   = 0x10;
+	passphrase_wrapped_kek_data[ 8 ]   = 0x5a;
+	passphrase_wrapped_kek_data[ 24 ]  = 0x10;
+	passphrase_wrapped_kek_data[ 28 ]  = 0x18;
+	passphrase_wrapped_kek_data[ 32 ]  = 0xa5;
+	passphrase_wrapped_kek_data[ 168 ] = 0xe8;
+	passphrase_wrapped_kek_data[ 169 ] = 0x03;
+
+	result = libfvde_passphrase_wrapped_kek_initialize(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_read_data(
+	          passphrase_wrapped_kek,
+	          passphrase_wrapped_kek_data,
+	          284,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "passphrase_wrapped_kek->number_of_iterations",
+	 passphrase_wrapped_kek->number_of_iterations,
+	 (uint32_t) 1000 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "passphrase_wrapped_kek->salt[ 0 ]",
+	 passphrase_wrapped_kek->salt[ 0 ],
+	 (uint8_t) 0x5a );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "passphrase_wrapped_kek->wrapped_kek[ 0 ]",
+	 passphrase_wrapped_kek->wrapped_kek[ 0 ],
+	 (uint8_t) 0xa5 );
+
+	/* Test error cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_read_data(
+	          NULL,
+	          passphrase_wrapped_kek_data,
+	          284,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_passphrase_wrapped_kek_read_data(
+	          passphrase_wrapped_kek,
+	          NULL,
+	          284,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_passphrase_wrapped_kek_read_data(
+	          passphrase_wrapped_kek,
+	          passphrase_wrapped_kek_data,
+	          283,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the salt value type is not supported
+	 */
+	passphrase_wrapped_kek_data[ 0 ] = 0xff;
+
+	result = libfvde_passphrase_wrapped_kek_read_data(
+	          passphrase_wrapped_kek,
+	          passphrase_wrapped_kek_data,
+	          284,
+	          &error );
+
+	passphrase_wrapped_kek_data[ 0 ] = 0x03;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the wrapped KEK value size is not supported
+	 */
+	passphrase_wrapped_kek_data[ 28 ] = 0xff;
+
+	result = libfvde_passphrase_wrapped_kek_read_data(
+	          passphrase_wrapped_kek,
+	          passphrase_wrapped_kek_data,
+	          284,
+	          &error );
+
+	passphrase_wrapped_kek_data[ 28 ] = 0x18;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_passphrase_wrapped_kek_free(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( passphrase_wrapped_kek != NULL )
+	{
+		libfvde_passphrase_wrapped_kek_free(
+		 &passphrase_wrapped_kek,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_passphrase_wrapped_kek_unwrap function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_passphrase_wrapped_kek_unwrap(
+     void )
+{
+	uint8_t password[ 8 ] = {
+		'p', 'a', 's', 's', 'w', 'o', 'r', 'd' };
+
+	libcerror_error_t *error                                 = NULL;
+	libfvde_passphrase_wrapped_kek_t *passphrase_wrapped_kek = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_passphrase_wrapped_kek_initialize(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	passphrase_wrapped_kek->number_of_iterations = 1;
+
+	/* Test unwrap with a password that does not match
+	 */
+	result = libfvde_passphrase_wrapped_kek_unwrap(
+	          passphrase_wrapped_kek,
+	          password,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "passphrase_wrapped_kek->kek_is_set",
+	 passphrase_wrapped_kek->kek_is_set,
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_passphrase_wrapped_kek_unwrap(
+	          NULL,
+	          password,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_passphrase_wrapped_kek_unwrap(
+	          passphrase_wrapped_kek,
+	          NULL,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_passphrase_wrapped_kek_free(
+	          &passphrase_wrapped_kek,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "passphrase_wrapped_kek",
+	 passphrase_wrapped_kek );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( passphrase_wrapped_kek != NULL )
+	{
+		libfvde_passphrase_wrapped_kek_free(
+		 &passphrase_wrapped_kek,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_passphrase_wrapped_kek_initialize",
+	 fvde_test_passphrase_wrapped_kek_initialize );
+
+	FVDE_TEST_RUN(
+	 "libfvde_passphrase_wrapped_kek_free",
+	 fvde_test_passphrase_wrapped_kek_free );
+
+	FVDE_TEST_RUN(
+	 "libfvde_passphrase_wrapped_kek_clone",
+	 fvde_test_passphrase_wrapped_kek_clone );
+
+	FVDE_TEST_RUN(
+	 "libfvde_passphrase_wrapped_kek_read_data",
+	 fvde_test_passphrase_wrapped_kek_read_data );
+
+	FVDE_TEST_RUN(
+	 "libfvde_passphrase_wrapped_kek_unwrap",
+	 fvde_test_passphrase_wrapped_kek_unwrap );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,2188 @@
+/*
+ * Library plist_scanner functions test program
+ *
+ * Copyright (C) 2011-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_libfvde.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_memory.h"
+#include "fvde_test_unused.h"
+
+#include "../libfvde/libfvde_definitions.h"
+#include "../libfvde/libfvde_plist_scanner.h"
+
+uint8_t fvde_test_plist_scanner_data1[ 407 ] =
+	"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+	"<!-- comment with > character -->\n"
+	"<plist version=\"1.0\">\n"
+	"<dict>\n"
+	"\t<key>sequence</key>\n"
+	"\t<integer size=\"32\">0x1</integer>\n"
+	"\t<key>nested</key>\n"
+	"\t<dict><key>name</key><string>nested</string></dict>\n"
+	"\t<key>name</key>\n"
+	"\t<string>Mac &amp; HD</string>\n"
+	"\t<key>volumes</key>\n"
+	"\t<array>\n"
+	"\t\t<string ID=\"1\">7577A486-8F94-47F0-ABF2-DDF18A5CDA9A</string>\n"
+	"\t\t<true/>\n"
+	"\t</array>\n"
+	"</dict>\n"
+	"</plist>\n";
+
+uint8_t fvde_test_plist_scanner_data2[ 34 ] =
+	"<dict><key>a</key><string>b</dic>";
+
+uint8_t fvde_test_plist_scanner_data3[ 89 ] =
+	"<dict>"
+	"<key>blob</key><data>\n\tSGVs\n\tbG8=\n</data>"
+	"<key>bad</key><data>SGVsbG8</data>"
+	"</dict>";
+
+uint8_t fvde_test_plist_scanner_uuid1[ 16 ] = {
+	0x75, 0x77, 0xa4, 0x86, 0x8f, 0x94, 0x47, 0xf0, 0xab, 0xf2, 0xdd, 0xf1, 0x8a, 0x5c, 0xda, 0x9a };
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+/* Tests the libfvde_plist_scanner_read_element function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_read_element(
+     void )
+{
+	libfvde_plist_element_t element;
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	data_offset = 0;
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &data_offset,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "element.type",
+	 element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_PLIST );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 405 );
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &data_offset,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	data_offset = 0;
+
+	result = libfvde_plist_scanner_read_element(
+	          NULL,
+	          406,
+	          &data_offset,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &data_offset,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &data_offset,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is truncated
+	 */
+	data_offset = 0;
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          200,
+	          &data_offset,
+	          &element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_get_root_dict function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_get_root_dict(
+     void )
+{
+	libfvde_plist_element_t dict_element;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "dict_element.type",
+	 dict_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_DICT );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          NULL,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the end tag does not match
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data2,
+	          33,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_get_dict_value_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_get_dict_value_by_key(
+     void )
+{
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t value_element;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "value_element.type",
+	 value_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY );
+
+	/* Keys of nested dicts should not match
+	 */
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "name",
+	          4,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "value_element.content_size",
+	 value_element.content_size,
+	 (size_t) 12 );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "missing",
+	          7,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          "volumes",
+	          7,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          NULL,
+	          7,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          16,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_compare_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_compare_key(
+     void )
+{
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t key_element;
+	libfvde_plist_element_t value_element;
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_offset = dict_element.content_offset;
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &data_offset,
+	          &key_element,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_compare_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &key_element,
+	          "sequence",
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Keys that are a prefix of or extend the key should not match
+	 */
+	result = libfvde_plist_scanner_compare_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &key_element,
+	          "sequenc",
+	          7,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_compare_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &key_element,
+	          "sequences",
+	          9,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_compare_key(
+	          NULL,
+	          406,
+	          &key_element,
+	          "sequence",
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_compare_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          "sequence",
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_compare_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &value_element,
+	          "sequence",
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_compare_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &key_element,
+	          NULL,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_read_dict_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_read_dict_entry(
+     void )
+{
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t key_element;
+	libfvde_plist_element_t value_element;
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	data_offset = dict_element.content_offset;
+
+	do
+	{
+		result = libfvde_plist_scanner_read_dict_entry(
+		          fvde_test_plist_scanner_data1,
+		          406,
+		          &dict_element,
+		          &data_offset,
+		          &key_element,
+		          &value_element,
+		          &error );
+
+		FVDE_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result != 0 )
+		{
+			FVDE_TEST_ASSERT_EQUAL_UINT8(
+			 "key_element.type",
+			 key_element.type,
+			 LIBFVDE_PLIST_ELEMENT_TYPE_KEY );
+
+			number_of_entries++;
+		}
+	}
+	while( result != 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 4 );
+
+	/* The value element of the last entry is the volumes array
+	 */
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "value_element.type",
+	 value_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_ARRAY );
+
+	/* Test error cases
+	 */
+	data_offset = dict_element.content_offset;
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          &data_offset,
+	          &key_element,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          NULL,
+	          &key_element,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &data_offset,
+	          NULL,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &data_offset,
+	          &key_element,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_offset = 0;
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &data_offset,
+	          &key_element,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_get_array_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_get_array_number_of_entries(
+     void )
+{
+	libfvde_plist_element_t array_element;
+	libfvde_plist_element_t dict_element;
+
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          &array_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_array_number_of_entries(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_get_array_number_of_entries(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_number_of_entries(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &number_of_entries,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_number_of_entries(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_get_array_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_get_array_entry_by_index(
+     void )
+{
+	libfvde_plist_element_t array_element;
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t entry_element;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          &array_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_array_entry_by_index(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          1,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_element.type",
+	 entry_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_TRUE );
+
+	result = libfvde_plist_scanner_get_array_entry_by_index(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          2,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_get_array_entry_by_index(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          0,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_entry_by_index(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          0,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_entry_by_index(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          -1,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_entry_by_index(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          0,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_get_array_next_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_get_array_next_entry(
+     void )
+{
+	libfvde_plist_element_t array_element;
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t entry_element;
+	libfvde_plist_element_t previous_entry_element;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          &array_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          NULL,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_element.type",
+	 entry_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_STRING );
+
+	previous_entry_element = entry_element;
+
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          &previous_entry_element,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "entry_element.type",
+	 entry_element.type,
+	 LIBFVDE_PLIST_ELEMENT_TYPE_TRUE );
+
+	/* Test if the previous entry element can be reused as the entry element
+	 */
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          &entry_element,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          NULL,
+	          NULL,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          NULL,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	previous_entry_element.end_offset = array_element.end_offset;
+
+	result = libfvde_plist_scanner_get_array_next_entry(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &array_element,
+	          &previous_entry_element,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_copy_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_copy_string(
+     void )
+{
+	uint8_t string[ 16 ];
+
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t value_element;
+
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "name",
+	          4,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_string_size(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &value_element,
+	          &string_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 9 );
+
+	result = libfvde_plist_scanner_copy_string(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &value_element,
+	          string,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          string,
+	          "Mac & HD",
+	          9 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_copy_string(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &value_element,
+	          NULL,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_copy_string(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &value_element,
+	          string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_copy_string(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &value_element,
+	          string,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_copy_uuid_string_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_copy_uuid_string_to_byte_stream(
+     void )
+{
+	uint8_t uuid_data[ 16 ];
+
+	libfvde_plist_element_t array_element;
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t entry_element;
+
+	libcerror_error_t *error = NULL;
+	size_t array_end_offset  = 0;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &dict_element,
+	          "volumes",
+	          7,
+	          &array_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	array_end_offset = array_element.content_offset + array_element.content_size;
+	data_offset      = array_element.content_offset;
+
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          array_end_offset,
+	          &data_offset,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &entry_element,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uuid_data,
+	          fvde_test_plist_scanner_uuid1,
+	          16 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &entry_element,
+	          NULL,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &entry_element,
+	          uuid_data,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the element is not a string
+	 */
+	result = libfvde_plist_scanner_read_element(
+	          fvde_test_plist_scanner_data1,
+	          array_end_offset,
+	          &data_offset,
+	          &entry_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_copy_uuid_string_to_byte_stream(
+	          fvde_test_plist_scanner_data1,
+	          406,
+	          &entry_element,
+	          uuid_data,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_plist_scanner_copy_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_plist_scanner_copy_data(
+     void )
+{
+	uint8_t byte_stream[ 8 ];
+
+	libfvde_plist_element_t dict_element;
+	libfvde_plist_element_t key_element;
+	libfvde_plist_element_t value_element;
+
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	size_t data_offset       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_plist_scanner_get_root_dict(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &dict_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &dict_element,
+	          "blob",
+	          4,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_plist_scanner_get_data_size(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 5 );
+
+	result = libfvde_plist_scanner_copy_data(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          byte_stream,
+	          5,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          "Hello",
+	          5 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfvde_plist_scanner_copy_data(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          NULL,
+	          5,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_copy_data(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          byte_stream,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_copy_data(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          byte_stream,
+	          6,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_plist_scanner_get_data_size(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is not padded
+	 */
+	result = libfvde_plist_scanner_get_dict_value_by_key(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &dict_element,
+	          "bad",
+	          3,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_data_size(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &value_element,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an element that is not a data element
+	 */
+	data_offset = dict_element.content_offset;
+
+	result = libfvde_plist_scanner_read_dict_entry(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &dict_element,
+	          &data_offset,
+	          &key_element,
+	          &value_element,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_plist_scanner_get_data_size(
+	          fvde_test_plist_scanner_data3,
+	          88,
+	          &key_element,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_read_element",
+	 fvde_test_plist_scanner_read_element );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_get_root_dict",
+	 fvde_test_plist_scanner_get_root_dict );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_compare_key",
+	 fvde_test_plist_scanner_compare_key );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_read_dict_entry",
+	 fvde_test_plist_scanner_read_dict_entry );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_get_dict_value_by_key",
+	 fvde_test_plist_scanner_get_dict_value_by_key );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_get_array_number_of_entries",
+	 fvde_test_plist_scanner_get_array_number_of_entries );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_get_array_entry_by_index",
+	 fvde_test_plist_scanner_get_array_entry_by_index );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_get_array_next_entry",
+	 fvde_test_plist_scanner_get_array_next_entry );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_copy_string",
+	 fvde_test_plist_scanner_copy_string );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_copy_uuid_string_to_byte_stream",
+	 fvde_test_plist_scanner_copy_uuid_string_to_byte_stream );
+
+	FVDE_TEST_RUN(
+	 "libfvde_plist_scanner_copy_data",
+	 fvde_test_plist_scanner_copy_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+}
+
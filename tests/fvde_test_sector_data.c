@@ -21,12 +21,16 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_functions.h"
+#include "fvde_test_libbfio.h"
+#include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
@@ -35,6 +39,8 @@
 
 #include "../libfvde/libfvde_sector_data.h"
 
+uint8_t fvde_test_sector_data_data1[ 1024 ];
+
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
 /* Tests the libfvde_sector_data_initialize function
@@ -309,6 +315,511 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_sector_data_add_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_data_add_reference(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfvde_sector_data_t *sector_data = NULL;
+	libfvde_sector_data_t *reference   = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_sector_data_initialize(
+	          &sector_data,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "sector_data",
+	 sector_data );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_sector_data_add_reference(
+	          sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "sector_data->reference_count",
+	 sector_data->reference_count,
+	 2 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Freeing a referenced sector data only releases the reference
+	 */
+	reference = sector_data;
+
+	result = libfvde_sector_data_free(
+	          &reference,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "reference",
+	 reference );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "sector_data->reference_count",
+	 sector_data->reference_count,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_data_add_reference(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_sector_data_free(
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "sector_data",
+	 sector_data );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfvde_sector_data_read_with_error_tolerance function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_sector_data_read_with_error_tolerance(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libbfio_pool_t *file_io_pool          = NULL;
+	libcdata_range_list_t *read_errors    = NULL;
+	libcerror_error_t *error              = NULL;
+	libfvde_sector_data_t *sector_data    = NULL;
+	intptr_t *range_value                 = NULL;
+	uint64_t range_size                   = 0;
+	uint64_t range_start                  = 0;
+	int file_io_pool_entry                = 0;
+	int number_of_read_errors             = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 fvde_test_sector_data_data1,
+	 0x5a,
+	 sizeof( uint8_t ) * 1024 );
+
+	result = fvde_test_open_file_io_handle(
+	          &file_io_handle,
+	          fvde_test_sector_data_data1,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_initialize(
+	          &file_io_pool,
+	          0,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_append_handle(
+	          file_io_pool,
+	          &file_io_pool_entry,
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_io_handle = NULL;
+
+	result = libcdata_range_list_initialize(
+	          &read_errors,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_data_initialize(
+	          &sector_data,
+	          2048,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of a sector of which the second half cannot be read
+	 */
+	result = libfvde_sector_data_read_with_error_tolerance(
+	          sector_data,
+	          NULL,
+	          file_io_pool,
+	          file_io_pool_entry,
+	          0,
+	          0,
+	          0,
+	          0xff,
+	          read_errors,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 1023 ]",
+	 sector_data->data[ 1023 ],
+	 (uint8_t) 0x5a );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 1024 ]",
+	 sector_data->data[ 1024 ],
+	 (uint8_t) 0xff );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 2047 ]",
+	 sector_data->data[ 2047 ],
+	 (uint8_t) 0xff );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          read_errors,
+	          &number_of_read_errors,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_read_errors",
+	 number_of_read_errors,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_get_range_by_index(
+	          read_errors,
+	          0,
+	          &range_start,
+	          &range_size,
+	          &range_value,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "range_start",
+	 range_start,
+	 (uint64_t) 4096 + 1024 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read of a sector that can be read
+	 */
+	result = libfvde_sector_data_free(
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_data_initialize(
+	          &sector_data,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_sector_data_read_with_error_tolerance(
+	          sector_data,
+	          NULL,
+	          file_io_pool,
+	          file_io_pool_entry,
+	          512,
+	          1,
+	          0,
+	          0xff,
+	          read_errors,
+	          512,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "sector_data->data[ 511 ]",
+	 sector_data->data[ 511 ],
+	 (uint8_t) 0x5a );
+
+	/* Test error cases
+	 */
+	result = libfvde_sector_data_read_with_error_tolerance(
+	          NULL,
+	          NULL,
+	          file_io_pool,
+	          file_io_pool_entry,
+	          0,
+	          0,
+	          0,
+	          0xff,
+	          read_errors,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_sector_data_read_with_error_tolerance(
+	          sector_data,
+	          NULL,
+	          file_io_pool,
+	          file_io_pool_entry,
+	          0,
+	          0,
+	          0,
+	          0xff,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_sector_data_free(
+	          &sector_data,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_free(
+	          &read_errors,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sector_data != NULL )
+	{
+		libfvde_sector_data_free(
+		 &sector_data,
+		 NULL );
+	}
+	if( read_errors != NULL )
+	{
+		libcdata_range_list_free(
+		 &read_errors,
+		 NULL,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -336,8 +847,16 @@ int main(
 	 "libfvde_sector_data_free",
 	 fvde_test_sector_data_free );
 
+	FVDE_TEST_RUN(
+	 "libfvde_sector_data_add_reference",
+	 fvde_test_sector_data_add_reference );
+
 	/* TODO: add tests for libfvde_sector_data_read */
 
+	FVDE_TEST_RUN(
+	 "libfvde_sector_data_read_with_error_tolerance",
+	 fvde_test_sector_data_read_with_error_tolerance );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,538 @@
+/*
+ * Tools export scheduler functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../fvdetools/export_scheduler.h"
+
+/* Tests the export_scheduler_initialize and export_scheduler_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_export_scheduler_initialize(
+     void )
+{
+	export_scheduler_t *export_scheduler = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = export_scheduler_initialize(
+	          &export_scheduler,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_scheduler",
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_free(
+	          &export_scheduler,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "export_scheduler",
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_scheduler_initialize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	export_scheduler = (export_scheduler_t *) 0x12345678UL;
+
+	result = export_scheduler_initialize(
+	          &export_scheduler,
+	          &error );
+
+	export_scheduler = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &export_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_scheduler_dispatch function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_export_scheduler_dispatch(
+     void )
+{
+	export_scheduler_request_t requests[ 4 ];
+
+	/* The requests in the expected dispatch order
+	 */
+	int expected_request_indexes[ 4 ] = {
+		3, 1, 0, 2 };
+
+	export_scheduler_request_t *request  = NULL;
+	export_scheduler_t *export_scheduler = NULL;
+	libcerror_error_t *error             = NULL;
+	int request_index                    = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = export_scheduler_initialize(
+	          &export_scheduler,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_scheduler",
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	requests[ 0 ].physical_volume_index  = 1;
+	requests[ 0 ].physical_volume_offset = 0;
+	requests[ 1 ].physical_volume_index  = 0;
+	requests[ 1 ].physical_volume_offset = 8192;
+	requests[ 2 ].physical_volume_index  = 0;
+	requests[ 2 ].physical_volume_offset = 0;
+	requests[ 3 ].physical_volume_index  = 0;
+	requests[ 3 ].physical_volume_offset = 4096;
+
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		requests[ request_index ].granted = 0;
+
+		export_scheduler->requests[ request_index ] = &( requests[ request_index ] );
+	}
+	export_scheduler->number_of_requests          = 4;
+	export_scheduler->head_physical_volume_index  = 0;
+	export_scheduler->head_physical_volume_offset = 4096;
+
+	/* Test that no read is granted while a read is in progress
+	 */
+	export_scheduler->busy = 1;
+
+	export_scheduler_dispatch(
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "export_scheduler->number_of_requests",
+	 export_scheduler->number_of_requests,
+	 4 );
+
+	export_scheduler->busy = 0;
+
+	/* Test regular cases
+	 * The reads are granted in ascending physical order from the head
+	 * and wrap around to the lowest physical offset
+	 */
+	for( request_index = 0;
+	     request_index < 4;
+	     request_index++ )
+	{
+		export_scheduler_dispatch(
+		 export_scheduler );
+
+		request = &( requests[ expected_request_indexes[ request_index ] ] );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "request->granted",
+		 request->granted,
+		 1 );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "export_scheduler->busy",
+		 export_scheduler->busy,
+		 1 );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "export_scheduler->number_of_requests",
+		 export_scheduler->number_of_requests,
+		 3 - request_index );
+
+		/* Simulate the release of a read of 4096 bytes
+		 */
+		export_scheduler->head_physical_volume_index  = request->physical_volume_index;
+		export_scheduler->head_physical_volume_offset = request->physical_volume_offset + 4096;
+		export_scheduler->busy                        = 0;
+	}
+	/* Only the reads of physical volume 1 and the wrap around did not continue the previous read
+	 */
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "export_scheduler->number_of_reads",
+	 export_scheduler->number_of_reads,
+	 4 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "export_scheduler->number_of_seeks",
+	 export_scheduler->number_of_seeks,
+	 2 );
+
+	/* Test that no read is granted without requests
+	 */
+	export_scheduler_dispatch(
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "export_scheduler->busy",
+	 export_scheduler->busy,
+	 0 );
+
+	/* Test error cases
+	 */
+	export_scheduler_dispatch(
+	 NULL );
+
+	/* Clean up
+	 */
+	result = export_scheduler_free(
+	          &export_scheduler,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "export_scheduler",
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &export_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_scheduler_acquire and export_scheduler_release functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_export_scheduler_acquire(
+     void )
+{
+	export_scheduler_t *export_scheduler = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = export_scheduler_initialize(
+	          &export_scheduler,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "export_scheduler",
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = export_scheduler_acquire(
+	          export_scheduler,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "export_scheduler->busy",
+	 export_scheduler->busy,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "export_scheduler->number_of_requests",
+	 export_scheduler->number_of_requests,
+	 0 );
+
+	result = export_scheduler_release(
+	          export_scheduler,
+	          0,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "export_scheduler->busy",
+	 export_scheduler->busy,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "export_scheduler->head_physical_volume_index",
+	 export_scheduler->head_physical_volume_index,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "export_scheduler->head_physical_volume_offset",
+	 export_scheduler->head_physical_volume_offset,
+	 8192 );
+
+	/* Test error cases
+	 */
+	result = export_scheduler_acquire(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	export_scheduler->number_of_requests = EXPORT_SCHEDULER_MAXIMUM_NUMBER_OF_READERS;
+
+	result = export_scheduler_acquire(
+	          export_scheduler,
+	          0,
+	          4096,
+	          &error );
+
+	export_scheduler->number_of_requests = 0;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_release(
+	          NULL,
+	          0,
+	          8192,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_scheduler_free(
+	          &export_scheduler,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "export_scheduler",
+	 export_scheduler );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &export_scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "export_scheduler_initialize",
+	 fvde_test_tools_export_scheduler_initialize );
+
+	FVDE_TEST_RUN(
+	 "export_scheduler_dispatch",
+	 fvde_test_tools_export_scheduler_dispatch );
+
+	FVDE_TEST_RUN(
+	 "export_scheduler_acquire",
+	 fvde_test_tools_export_scheduler_acquire );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,824 @@
+/*
+ * Tools fvdecheck lookup functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../fvdetools/fvdecheck_extent.h"
+#include "../fvdetools/fvdecheck_lookup.h"
+
+uint8_t fvde_test_tools_fvdecheck_lookup_uuid[ 16 ] = {
+	0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+
+/* Creates a volume state with a reserved, an allocated and a free extent
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_tools_fvdecheck_lookup_volume_state_initialize(
+     fvdecheck_volume_state_t **volume_state,
+     libcerror_error_t **error )
+{
+	static char *function = "fvde_test_tools_fvdecheck_lookup_volume_state_initialize";
+	uint32_t lv_index     = 0;
+	uint32_t pv_index     = 0;
+
+	if( fvdecheck_volume_state_initialize(
+	     volume_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume state.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_add_physical_volume(
+	     *volume_state,
+	     fvde_test_tools_fvdecheck_lookup_uuid,
+	     1000,
+	     &pv_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add physical volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_add_logical_volume(
+	     *volume_state,
+	     fvde_test_tools_fvdecheck_lookup_uuid,
+	     100,
+	     &lv_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add logical volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_mark_reserved(
+	     *volume_state,
+	     pv_index,
+	     0,
+	     10,
+	     "Volume header",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark reserved extent.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_mark_allocated(
+	     *volume_state,
+	     pv_index,
+	     100,
+	     50,
+	     lv_index,
+	     0,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark allocated extent.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_mark_free(
+	     *volume_state,
+	     pv_index,
+	     200,
+	     20,
+	     2,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark free extent.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 volume_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the fvdecheck_lookup_initialize and fvdecheck_lookup_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_lookup_initialize(
+     void )
+{
+	fvdecheck_lookup_t *lookup = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = fvdecheck_lookup_initialize(
+	          &lookup,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup",
+	 lookup );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->unit",
+	 lookup->unit,
+	 FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR );
+
+	result = fvdecheck_lookup_free(
+	          &lookup,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "lookup",
+	 lookup );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = fvdecheck_lookup_initialize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	lookup = (fvdecheck_lookup_t *) 0x12345678UL;
+
+	result = fvdecheck_lookup_initialize(
+	          &lookup,
+	          &error );
+
+	lookup = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_lookup_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lookup != NULL )
+	{
+		fvdecheck_lookup_free(
+		 &lookup,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fvdecheck_lookup_append_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_lookup_append_value(
+     void )
+{
+	fvdecheck_lookup_t *lookup = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+	int value_index            = 0;
+
+	/* Initialize test
+	 */
+	result = fvdecheck_lookup_initialize(
+	          &lookup,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup",
+	 lookup );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Appending more values than the initial maximum number of entries resizes the entries
+	 */
+	for( value_index = 0;
+	     value_index < 1025;
+	     value_index++ )
+	{
+		result = fvdecheck_lookup_append_value(
+		          lookup,
+		          (uint64_t) value_index,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_entries",
+	 lookup->number_of_entries,
+	 1025 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "lookup->entries[ 1024 ].value",
+	 lookup->entries[ 1024 ].value,
+	 1024 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->resolved",
+	 lookup->resolved,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = fvdecheck_lookup_append_value(
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvdecheck_lookup_free(
+	          &lookup,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "lookup",
+	 lookup );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lookup != NULL )
+	{
+		fvdecheck_lookup_free(
+		 &lookup,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fvdecheck_lookup_resolve function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_lookup_resolve(
+     void )
+{
+	/* The values are not sorted and contain a duplicate
+	 */
+	uint64_t values[ 8 ] = {
+		210, 120, 5, 500, 120, 0, 150, 149 };
+
+	/* The values in the expected order after resolving
+	 */
+	uint64_t expected_values[ 8 ] = {
+		0, 5, 120, 120, 149, 150, 210, 500 };
+
+	/* The extent states of the expected values, where 0 indicates no extent
+	 */
+	int expected_states[ 8 ] = {
+		FVDECHECK_EXTENT_STATE_RESERVED,
+		FVDECHECK_EXTENT_STATE_RESERVED,
+		FVDECHECK_EXTENT_STATE_ALLOCATED,
+		FVDECHECK_EXTENT_STATE_ALLOCATED,
+		FVDECHECK_EXTENT_STATE_ALLOCATED,
+		0,
+		FVDECHECK_EXTENT_STATE_FREE,
+		0 };
+
+	fvdecheck_lookup_entry_t *entry        = NULL;
+	fvdecheck_lookup_t *lookup             = NULL;
+	fvdecheck_volume_state_t *volume_state = NULL;
+	libcerror_error_t *error               = NULL;
+	uint32_t block_size                    = 0;
+	int entry_index                        = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_tools_fvdecheck_lookup_volume_state_initialize(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_lookup_initialize(
+	          &lookup,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "lookup",
+	 lookup );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	lookup->unit = FVDECHECK_LOOKUP_UNIT_BLOCK;
+
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		result = fvdecheck_lookup_append_value(
+		          lookup,
+		          values[ entry_index ],
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = fvdecheck_lookup_resolve(
+	          lookup,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->resolved",
+	 lookup->resolved,
+	 1 );
+
+	for( entry_index = 0;
+	     entry_index < 8;
+	     entry_index++ )
+	{
+		entry = &( lookup->entries[ entry_index ] );
+
+		FVDE_TEST_ASSERT_EQUAL_UINT64(
+		 "entry->value",
+		 entry->value,
+		 expected_values[ entry_index ] );
+
+		FVDE_TEST_ASSERT_EQUAL_UINT64(
+		 "entry->block_number",
+		 entry->block_number,
+		 expected_values[ entry_index ] );
+
+		if( expected_states[ entry_index ] == 0 )
+		{
+			FVDE_TEST_ASSERT_IS_NULL(
+			 "entry->extent",
+			 entry->extent );
+		}
+		else
+		{
+			FVDE_TEST_ASSERT_IS_NOT_NULL(
+			 "entry->extent",
+			 entry->extent );
+
+			FVDE_TEST_ASSERT_EQUAL_INT(
+			 "entry->extent->state",
+			 entry->extent->state,
+			 expected_states[ entry_index ] );
+		}
+	}
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_allocated_entries",
+	 lookup->number_of_allocated_entries,
+	 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_free_entries",
+	 lookup->number_of_free_entries,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_reserved_entries",
+	 lookup->number_of_reserved_entries,
+	 2 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_unknown_entries",
+	 lookup->number_of_unknown_entries,
+	 2 );
+
+	/* Test resolving Linux sectors, where 8 sectors make up a block
+	 */
+	lookup->unit = FVDECHECK_LOOKUP_UNIT_LINUX_SECTOR;
+
+	result = fvdecheck_lookup_resolve(
+	          lookup,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Sector 500 is in block 62, at offset 2048
+	 */
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "lookup->entries[ 7 ].value",
+	 lookup->entries[ 7 ].value,
+	 500 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "lookup->entries[ 7 ].block_number",
+	 lookup->entries[ 7 ].block_number,
+	 62 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "lookup->entries[ 7 ].offset_in_block",
+	 lookup->entries[ 7 ].offset_in_block,
+	 2048 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_allocated_entries",
+	 lookup->number_of_allocated_entries,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_free_entries",
+	 lookup->number_of_free_entries,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_reserved_entries",
+	 lookup->number_of_reserved_entries,
+	 2 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_unknown_entries",
+	 lookup->number_of_unknown_entries,
+	 6 );
+
+	/* Test resolving against a physical volume that is not in the volume state
+	 */
+	lookup->unit     = FVDECHECK_LOOKUP_UNIT_BLOCK;
+	lookup->pv_index = 1;
+
+	result = fvdecheck_lookup_resolve(
+	          lookup,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "lookup->number_of_unknown_entries",
+	 lookup->number_of_unknown_entries,
+	 8 );
+
+	lookup->pv_index = 0;
+
+	/* Test error cases
+	 */
+	result = fvdecheck_lookup_resolve(
+	          NULL,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_lookup_resolve(
+	          lookup,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_size = volume_state->block_size;
+
+	volume_state->block_size = 0;
+
+	result = fvdecheck_lookup_resolve(
+	          lookup,
+	          volume_state,
+	          &error );
+
+	volume_state->block_size = block_size;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	lookup->unit = -1;
+
+	result = fvdecheck_lookup_resolve(
+	          lookup,
+	          volume_state,
+	          &error );
+
+	lookup->unit = FVDECHECK_LOOKUP_UNIT_BLOCK;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvdecheck_lookup_free(
+	          &lookup,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "lookup",
+	 lookup );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_volume_state_free(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_state",
+	 volume_state );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lookup != NULL )
+	{
+		fvdecheck_lookup_free(
+		 &lookup,
+		 NULL );
+	}
+	if( volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 &volume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_lookup_initialize",
+	 fvde_test_tools_fvdecheck_lookup_initialize );
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_lookup_append_value",
+	 fvde_test_tools_fvdecheck_lookup_append_value );
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_lookup_resolve",
+	 fvde_test_tools_fvdecheck_lookup_resolve );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
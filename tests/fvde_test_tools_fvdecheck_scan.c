@@ -0,0 +1,1395 @@
+/*
+ * Tools fvdecheck scan functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_functions.h"
+#include "fvde_test_libbfio.h"
+#include "fvde_test_libcerror.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../fvdetools/fvdecheck_extent.h"
+#include "../fvdetools/fvdecheck_scan.h"
+
+/* The physical volume data contains 12 blocks of 4096 bytes
+ */
+uint8_t fvde_test_tools_fvdecheck_scan_data[ 12 * 4096 ];
+
+uint8_t fvde_test_tools_fvdecheck_scan_uuid[ 16 ] = {
+	0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+
+/* Creates a volume state with an allocated extent of blocks 2 to 4 and of blocks 10 to 13
+ * where blocks 12 and 13 are beyond the end of the physical volume data
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_tools_fvdecheck_scan_volume_state_initialize(
+     fvdecheck_volume_state_t **volume_state,
+     libcerror_error_t **error )
+{
+	static char *function = "fvde_test_tools_fvdecheck_scan_volume_state_initialize";
+	uint32_t lv_index     = 0;
+	uint32_t pv_index     = 0;
+
+	if( fvdecheck_volume_state_initialize(
+	     volume_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create volume state.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_add_physical_volume(
+	     *volume_state,
+	     fvde_test_tools_fvdecheck_scan_uuid,
+	     16,
+	     &pv_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add physical volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_add_logical_volume(
+	     *volume_state,
+	     fvde_test_tools_fvdecheck_scan_uuid,
+	     7,
+	     &lv_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to add logical volume.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_mark_allocated(
+	     *volume_state,
+	     pv_index,
+	     2,
+	     3,
+	     lv_index,
+	     0,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark allocated extent.",
+		 function );
+
+		goto on_error;
+	}
+	if( fvdecheck_volume_state_mark_allocated(
+	     *volume_state,
+	     pv_index,
+	     10,
+	     4,
+	     lv_index,
+	     3,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark allocated extent.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 volume_state,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates a file IO pool with the physical volume data
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_tools_fvdecheck_scan_file_io_pool_initialize(
+     libbfio_pool_t **file_io_pool,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "fvde_test_tools_fvdecheck_scan_file_io_pool_initialize";
+	int file_io_pool_entry           = 0;
+
+	if( fvde_test_open_file_io_handle(
+	     &file_io_handle,
+	     fvde_test_tools_fvdecheck_scan_data,
+	     12 * 4096,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_initialize(
+	     file_io_pool,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_pool_append_handle(
+	     *file_io_pool,
+	     &file_io_pool_entry,
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file IO handle to pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 file_io_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the fvdecheck_scan_initialize and fvdecheck_scan_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_scan_initialize(
+     void )
+{
+	fvdecheck_scan_t *scan                 = NULL;
+	fvdecheck_volume_state_t *volume_state = NULL;
+	libbfio_pool_t *file_io_pool           = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_tools_fvdecheck_scan_volume_state_initialize(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_tools_fvdecheck_scan_file_io_pool_initialize(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->number_of_threads",
+	 scan->number_of_threads,
+	 FVDECHECK_SCAN_DEFAULT_NUMBER_OF_THREADS );
+
+	result = fvdecheck_scan_free(
+	          &scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = fvdecheck_scan_initialize(
+	          NULL,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan = (fvdecheck_scan_t *) 0x12345678UL;
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	scan = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          NULL,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_scan_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_volume_state_free(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_state",
+	 volume_state );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan != NULL )
+	{
+		fvdecheck_scan_free(
+		 &scan,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 &volume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fvdecheck_scan_append_region function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_scan_append_region(
+     void )
+{
+	fvdecheck_scan_t *scan                 = NULL;
+	fvdecheck_volume_state_t *volume_state = NULL;
+	libbfio_pool_t *file_io_pool           = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_tools_fvdecheck_scan_volume_state_initialize(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_tools_fvdecheck_scan_file_io_pool_initialize(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = fvdecheck_scan_append_region(
+	          scan,
+	          FVDECHECK_SCAN_REGION_SLOW,
+	          0,
+	          0,
+	          4096,
+	          1500,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an adjacent region of the same type is merged
+	 */
+	result = fvdecheck_scan_append_region(
+	          scan,
+	          FVDECHECK_SCAN_REGION_SLOW,
+	          0,
+	          4096,
+	          4096,
+	          2500,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->number_of_regions",
+	 scan->number_of_regions,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 0 ].size",
+	 scan->regions[ 0 ].size,
+	 8192 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 0 ].duration",
+	 scan->regions[ 0 ].duration,
+	 2500 );
+
+	/* Test that an adjacent region of another type or physical volume is not merged
+	 */
+	result = fvdecheck_scan_append_region(
+	          scan,
+	          FVDECHECK_SCAN_REGION_UNREADABLE,
+	          0,
+	          8192,
+	          4096,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_scan_append_region(
+	          scan,
+	          FVDECHECK_SCAN_REGION_UNREADABLE,
+	          1,
+	          12288,
+	          4096,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->number_of_regions",
+	 scan->number_of_regions,
+	 3 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 1 ].offset",
+	 scan->regions[ 1 ].offset,
+	 8192 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "scan->regions[ 2 ].pv_index",
+	 scan->regions[ 2 ].pv_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = fvdecheck_scan_append_region(
+	          NULL,
+	          FVDECHECK_SCAN_REGION_SLOW,
+	          0,
+	          0,
+	          4096,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvdecheck_scan_free(
+	          &scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_volume_state_free(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_state",
+	 volume_state );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan != NULL )
+	{
+		fvdecheck_scan_free(
+		 &scan,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 &volume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fvdecheck_scan_run function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_scan_run(
+     void )
+{
+	fvdecheck_scan_t *scan                 = NULL;
+	fvdecheck_volume_state_t *volume_state = NULL;
+	libbfio_pool_t *file_io_pool           = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_tools_fvdecheck_scan_volume_state_initialize(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_tools_fvdecheck_scan_file_io_pool_initialize(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * A single reader reads from the file IO pool
+	 */
+	scan->number_of_threads = 1;
+
+	result = fvdecheck_scan_run(
+	          scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->total_size",
+	 scan->total_size,
+	 7 * 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->scanned_size",
+	 scan->scanned_size,
+	 7 * 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->unreadable_size",
+	 scan->unreadable_size,
+	 2 * 4096 );
+
+	/* Test that the unreadable blocks are merged into a single region
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->number_of_regions",
+	 scan->number_of_regions,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->regions[ 0 ].type",
+	 scan->regions[ 0 ].type,
+	 FVDECHECK_SCAN_REGION_UNREADABLE );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "scan->regions[ 0 ].pv_index",
+	 scan->regions[ 0 ].pv_index,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 0 ].offset",
+	 scan->regions[ 0 ].offset,
+	 12 * 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 0 ].size",
+	 scan->regions[ 0 ].size,
+	 2 * 4096 );
+
+	result = fvdecheck_scan_free(
+	          &scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Test concurrent readers that read from clones of the file IO handle
+	 */
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	scan->number_of_threads = 2;
+
+	result = fvdecheck_scan_run(
+	          scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->total_size",
+	 scan->total_size,
+	 7 * 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->scanned_size",
+	 scan->scanned_size,
+	 7 * 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->unreadable_size",
+	 scan->unreadable_size,
+	 2 * 4096 );
+
+	/* Test that the unreadable blocks are merged into a single region
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->number_of_regions",
+	 scan->number_of_regions,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "scan->regions[ 0 ].type",
+	 scan->regions[ 0 ].type,
+	 FVDECHECK_SCAN_REGION_UNREADABLE );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT32(
+	 "scan->regions[ 0 ].pv_index",
+	 scan->regions[ 0 ].pv_index,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 0 ].offset",
+	 scan->regions[ 0 ].offset,
+	 12 * 4096 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT64(
+	 "scan->regions[ 0 ].size",
+	 scan->regions[ 0 ].size,
+	 2 * 4096 );
+
+	result = fvdecheck_scan_free(
+	          &scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = fvdecheck_scan_run(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan->number_of_threads = 0;
+
+	result = fvdecheck_scan_run(
+	          scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvdecheck_scan_free(
+	          &scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_volume_state_free(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_state",
+	 volume_state );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan != NULL )
+	{
+		fvdecheck_scan_free(
+		 &scan,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 &volume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the fvdecheck_scan_read_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_fvdecheck_scan_read_chunk(
+     void )
+{
+	fvdecheck_scan_chunk_t chunk;
+
+	fvdecheck_scan_t *scan                 = NULL;
+	fvdecheck_volume_state_t *volume_state = NULL;
+	libbfio_pool_t *file_io_pool           = NULL;
+	libcerror_error_t *error               = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = fvde_test_tools_fvdecheck_scan_volume_state_initialize(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_tools_fvdecheck_scan_file_io_pool_initialize(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_scan_initialize(
+	          &scan,
+	          file_io_pool,
+	          volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunk.pv_index = 0;
+	chunk.offset   = 0;
+	chunk.size     = 0;
+
+	/* Test error cases
+	 */
+	result = fvdecheck_scan_read_chunk(
+	          NULL,
+	          &( scan->slots[ 0 ] ),
+	          &chunk,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_scan_read_chunk(
+	          scan,
+	          NULL,
+	          &chunk,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_scan_read_chunk(
+	          scan,
+	          &( scan->slots[ 0 ] ),
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvdecheck_scan_read_chunk(
+	          scan,
+	          &( scan->slots[ 0 ] ),
+	          &chunk,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk.size = FVDECHECK_SCAN_CHUNK_SIZE + 1;
+
+	result = fvdecheck_scan_read_chunk(
+	          scan,
+	          &( scan->slots[ 0 ] ),
+	          &chunk,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fvdecheck_scan_free(
+	          &scan,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "scan",
+	 scan );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_pool_free(
+	          &file_io_pool,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "file_io_pool",
+	 file_io_pool );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvdecheck_volume_state_free(
+	          &volume_state,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_state",
+	 volume_state );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan != NULL )
+	{
+		fvdecheck_scan_free(
+		 &scan,
+		 NULL );
+	}
+	if( file_io_pool != NULL )
+	{
+		libbfio_pool_free(
+		 &file_io_pool,
+		 NULL );
+	}
+	if( volume_state != NULL )
+	{
+		fvdecheck_volume_state_free(
+		 &volume_state,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_scan_initialize",
+	 fvde_test_tools_fvdecheck_scan_initialize );
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_scan_append_region",
+	 fvde_test_tools_fvdecheck_scan_append_region );
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_scan_read_chunk",
+	 fvde_test_tools_fvdecheck_scan_read_chunk );
+
+	FVDE_TEST_RUN(
+	 "fvdecheck_scan_run",
+	 fvde_test_tools_fvdecheck_scan_run );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
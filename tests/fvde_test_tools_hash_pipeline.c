@@ -0,0 +1,1068 @@
+/*
+ * Tools hash pipeline functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../fvdetools/hash_pipeline.h"
+
+/* The test stream consists of 2 buffers of HASH_PIPELINE_BUFFER_SIZE and a smaller last buffer
+ */
+#define FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE	( ( 2 * HASH_PIPELINE_BUFFER_SIZE ) + 1000 )
+
+/* The piece size is not aligned with the buffers
+ */
+#define FVDE_TEST_TOOLS_HASH_PIPELINE_PIECE_SIZE	( 3 * HASH_PIPELINE_BUFFER_SIZE / 2 )
+
+uint8_t fvde_test_tools_hash_pipeline_md5[ 16 ] = {
+	0x13, 0xd9, 0x4b, 0x2d, 0x98, 0x49, 0x6a, 0xe9, 0x21, 0x8a, 0xe4, 0xd8, 0x63, 0x27, 0x91, 0xb5 };
+
+uint8_t fvde_test_tools_hash_pipeline_sha1[ 20 ] = {
+	0x0e, 0x0a, 0xac, 0xd6, 0x6a, 0xd4, 0x49, 0x01, 0xdf, 0x7d, 0x1a, 0x40, 0xd8, 0x2e, 0xe6, 0x3f,
+	0x45, 0x12, 0xb8, 0x22 };
+
+uint8_t fvde_test_tools_hash_pipeline_sha256[ 32 ] = {
+	0x89, 0x0b, 0x17, 0xbe, 0xea, 0x9e, 0xd9, 0x46, 0x00, 0x74, 0x05, 0xb8, 0x34, 0x35, 0x71, 0x45,
+	0xb1, 0xf9, 0xb1, 0x04, 0xf7, 0x23, 0xea, 0xdc, 0xf3, 0xf1, 0xc5, 0x56, 0x29, 0xa2, 0x35, 0x92 };
+
+uint8_t fvde_test_tools_hash_pipeline_tree_hash[ 32 ] = {
+	0x98, 0x02, 0x6c, 0xba, 0xe0, 0x19, 0x79, 0xcd, 0xef, 0xc7, 0x3f, 0xd0, 0x7c, 0x8f, 0xab, 0x65,
+	0xe2, 0x85, 0x3b, 0x6f, 0xe1, 0x6b, 0xf0, 0xb8, 0x6b, 0xa3, 0xe8, 0xa4, 0x22, 0xd5, 0xff, 0x5b };
+
+uint8_t fvde_test_tools_hash_pipeline_piece_md5[ 32 ] = {
+	0xb3, 0xf0, 0x6d, 0xa4, 0x65, 0x1d, 0x21, 0x5a, 0xab, 0x53, 0xa3, 0x33, 0x84, 0xcc, 0x94, 0xd1,
+	0x44, 0xf1, 0x8e, 0x17, 0xf1, 0xd1, 0xe7, 0x1d, 0xe9, 0x9c, 0x30, 0x0d, 0x76, 0x06, 0x3e, 0x79 };
+
+uint8_t fvde_test_tools_hash_pipeline_piece_sha256[ 64 ] = {
+	0x4e, 0xf2, 0x08, 0xd9, 0x5d, 0x55, 0xb7, 0x43, 0x1e, 0x25, 0x91, 0x0c, 0x9d, 0x38, 0x49, 0x69,
+	0x94, 0xc9, 0x31, 0xaf, 0x47, 0xf4, 0xe4, 0x48, 0xfb, 0x89, 0x46, 0x11, 0xeb, 0x1c, 0x69, 0xae,
+	0x6c, 0xa9, 0xf0, 0xa6, 0x69, 0x00, 0x95, 0xa9, 0x0c, 0xde, 0x77, 0x24, 0x7c, 0xfc, 0x36, 0x98,
+	0x6e, 0x4b, 0x26, 0xae, 0xe9, 0xe3, 0xe9, 0xd8, 0xc0, 0xd3, 0x6d, 0xa0, 0xa6, 0x7e, 0x92, 0xd3 };
+
+char *fvde_test_tools_hash_pipeline_print_data =
+	"MD5 hash calculated over data:\t\t13d94b2d98496ae9218ae4d8632791b5\n"
+	"SHA256 tree hash of 3 blocks of 1048576 bytes:\t98026cbae01979cdefc73fd07c8fab65e2853b6fe16bf0b86ba3e8a422d5ff5b\n"
+	"\n"
+	"Piecewise hashes of 1572864 bytes:\n"
+	"Piece: 1 offset: 0 size: 1572864\n"
+	"\tMD5:\tb3f06da4651d215aab53a33384cc94d1\n"
+	"Piece: 2 offset: 1572864 size: 525288\n"
+	"\tMD5:\t44f18e17f1d1e71de99c300d76063e79\n";
+
+/* Pushes the test stream onto a hash pipeline
+ * The byte at stream offset N contains N modulus 251
+ * Returns 1 if successful or -1 on error
+ */
+int fvde_test_tools_hash_pipeline_push_stream(
+     hash_pipeline_t *hash_pipeline,
+     libcerror_error_t **error )
+{
+	hash_pipeline_buffer_t *buffer = NULL;
+	static char *function          = "fvde_test_tools_hash_pipeline_push_stream";
+	size64_t stream_offset         = 0;
+	size_t data_offset             = 0;
+
+	while( stream_offset < FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE )
+	{
+		if( hash_pipeline_get_buffer(
+		     hash_pipeline,
+		     &buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve buffer.",
+			 function );
+
+			return( -1 );
+		}
+		buffer->data_size = HASH_PIPELINE_BUFFER_SIZE;
+
+		if( buffer->data_size > ( FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE - stream_offset ) )
+		{
+			buffer->data_size = (size_t) ( FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE - stream_offset );
+		}
+		for( data_offset = 0;
+		     data_offset < buffer->data_size;
+		     data_offset++ )
+		{
+			buffer->data[ data_offset ] = (uint8_t) ( ( stream_offset + data_offset ) % 251 );
+		}
+		stream_offset += buffer->data_size;
+
+		if( hash_pipeline_push_buffer(
+		     hash_pipeline,
+		     buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Tests the hash_pipeline_initialize and hash_pipeline_free functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_hash_pipeline_initialize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	hash_pipeline_t *hash_pipeline = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_MD5 | HASH_PIPELINE_CALCULATE_SHA1 | HASH_PIPELINE_CALCULATE_SHA256 |
+	          HASH_PIPELINE_CALCULATE_TREE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_PIECE_SIZE,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_pipeline_free(
+	          &hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = hash_pipeline_initialize(
+	          NULL,
+	          HASH_PIPELINE_CALCULATE_MD5,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_pipeline = (hash_pipeline_t *) 0x12345678UL;
+
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_MD5,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	hash_pipeline = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          0,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          0x10,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_MD5,
+	          (size64_t) INT64_MAX + 1,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test piecewise hashes without a MD5, SHA1 or SHA256 hash
+	 */
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_TREE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_PIECE_SIZE,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_pipeline != NULL )
+	{
+		hash_pipeline_free(
+		 &hash_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_pipeline_finalize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_hash_pipeline_finalize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	hash_pipeline_t *hash_pipeline = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_MD5 | HASH_PIPELINE_CALCULATE_SHA1 | HASH_PIPELINE_CALCULATE_SHA256 |
+	          HASH_PIPELINE_CALCULATE_TREE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_PIECE_SIZE,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_tools_hash_pipeline_push_stream(
+	          hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = hash_pipeline_finalize(
+	          hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the buffers were hashed in stream order
+	 */
+	result = memory_compare(
+	          hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_MD5 ].hash,
+	          fvde_test_tools_hash_pipeline_md5,
+	          16 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_SHA1 ].hash,
+	          fvde_test_tools_hash_pipeline_sha1,
+	          20 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_SHA256 ].hash,
+	          fvde_test_tools_hash_pipeline_sha256,
+	          32 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the tree hash, which is the SHA256 of the SHA256 of every buffer
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "hash_pipeline->number_of_blocks",
+	 hash_pipeline->number_of_blocks,
+	 3 );
+
+	result = memory_compare(
+	          hash_pipeline->tree_hash,
+	          fvde_test_tools_hash_pipeline_tree_hash,
+	          32 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the piecewise hashes, where the last piece is smaller
+	 */
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_MD5 ].number_of_pieces",
+	 hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_MD5 ].number_of_pieces,
+	 2 );
+
+	result = memory_compare(
+	          hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_MD5 ].piece_hashes,
+	          fvde_test_tools_hash_pipeline_piece_md5,
+	          32 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_SHA256 ].number_of_pieces",
+	 hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_SHA256 ].number_of_pieces,
+	 2 );
+
+	result = memory_compare(
+	          hash_pipeline->digests[ HASH_PIPELINE_DIGEST_TYPE_SHA256 ].piece_hashes,
+	          fvde_test_tools_hash_pipeline_piece_sha256,
+	          64 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = hash_pipeline_finalize(
+	          hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_finalize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = hash_pipeline_free(
+	          &hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test finalizing a hash pipeline without all data of the stream
+	 */
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_SHA256,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_pipeline_finalize(
+	          hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_free(
+	          &hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_pipeline != NULL )
+	{
+		hash_pipeline_free(
+		 &hash_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_pipeline_push_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_hash_pipeline_push_buffer(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	hash_pipeline_buffer_t *buffer = NULL;
+	hash_pipeline_t *hash_pipeline = NULL;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_SHA256 | HASH_PIPELINE_CALCULATE_TREE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          0,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_pipeline_get_buffer(
+	          hash_pipeline,
+	          &buffer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = hash_pipeline_push_buffer(
+	          NULL,
+	          buffer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_push_buffer(
+	          hash_pipeline,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_push_buffer(
+	          hash_pipeline,
+	          buffer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test pushing a buffer smaller than HASH_PIPELINE_BUFFER_SIZE that is not the last buffer
+	 */
+	buffer->data_size = 1000;
+
+	result = hash_pipeline_push_buffer(
+	          hash_pipeline,
+	          buffer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test pushing a buffer beyond the end of the stream
+	 */
+	buffer->data_size = HASH_PIPELINE_BUFFER_SIZE + 1;
+
+	result = hash_pipeline_push_buffer(
+	          hash_pipeline,
+	          buffer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = hash_pipeline_free(
+	          &hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_pipeline != NULL )
+	{
+		hash_pipeline_free(
+		 &hash_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the hash_pipeline_print function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_hash_pipeline_print(
+     void )
+{
+	char data[ 512 ];
+
+	libcerror_error_t *error       = NULL;
+	hash_pipeline_t *hash_pipeline = NULL;
+	FILE *stream                   = NULL;
+	size_t read_count              = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = hash_pipeline_initialize(
+	          &hash_pipeline,
+	          HASH_PIPELINE_CALCULATE_MD5 | HASH_PIPELINE_CALCULATE_TREE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_STREAM_SIZE,
+	          FVDE_TEST_TOOLS_HASH_PIPELINE_PIECE_SIZE,
+	          4,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	stream = file_stream_open(
+	          "hash_pipeline.txt",
+	          FILE_STREAM_OPEN_WRITE );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = hash_pipeline_print(
+	          hash_pipeline,
+	          stream,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = fvde_test_tools_hash_pipeline_push_stream(
+	          hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_pipeline_finalize(
+	          hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = hash_pipeline_print(
+	          NULL,
+	          stream,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = hash_pipeline_print(
+	          hash_pipeline,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = hash_pipeline_print(
+	          hash_pipeline,
+	          stream,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	stream = file_stream_open(
+	          "hash_pipeline.txt",
+	          FILE_STREAM_OPEN_READ );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              512 );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 362 );
+
+	result = file_stream_close(
+	          stream );
+
+	stream = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the hashes are printed in order of digest type, followed by the tree and piecewise hashes
+	 */
+	result = memory_compare(
+	          data,
+	          fvde_test_tools_hash_pipeline_print_data,
+	          362 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = hash_pipeline_free(
+	          &hash_pipeline,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "hash_pipeline",
+	 hash_pipeline );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		file_stream_close(
+		 stream );
+	}
+	if( hash_pipeline != NULL )
+	{
+		hash_pipeline_free(
+		 &hash_pipeline,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "hash_pipeline_initialize",
+	 fvde_test_tools_hash_pipeline_initialize );
+
+	FVDE_TEST_RUN(
+	 "hash_pipeline_push_buffer",
+	 fvde_test_tools_hash_pipeline_push_buffer );
+
+	FVDE_TEST_RUN(
+	 "hash_pipeline_finalize",
+	 fvde_test_tools_hash_pipeline_finalize );
+
+	FVDE_TEST_RUN(
+	 "hash_pipeline_print",
+	 fvde_test_tools_hash_pipeline_print );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1039 @@
+/*
+ * Tools JSON writer functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../fvdetools/json_writer.h"
+
+uint8_t fvde_test_tools_json_writer_uuid_data[ 16 ] = {
+	0x94, 0x92, 0x3b, 0x58, 0x9f, 0x31, 0x49, 0x88, 0x87, 0x07, 0xcb, 0x90, 0xc8, 0xe4, 0x5a, 0x46 };
+
+/* Tests the json_writer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_json_writer_initialize(
+     void )
+{
+	json_writer_t *json_writer = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = json_writer_initialize(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "json_writer",
+	 json_writer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = json_writer_free(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "json_writer",
+	 json_writer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = json_writer_initialize(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	json_writer = (json_writer_t *) 0x12345678UL;
+
+	result = json_writer_initialize(
+	          &json_writer,
+	          &error );
+
+	json_writer = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the json_writer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_json_writer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = json_writer_free(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests writing an object with the json_writer functions
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_json_writer_write_object(
+     void )
+{
+	const char *expected_data = "{\"name\":\"a\\\"b\\\\c\\n\\u0001\",\"size\":18446744073709551615,"
+	                            "\"identifier\":\"94923b58-9f31-4988-8707-cb90c8e45a46\","
+	                            "\"volumes\":[{\"is_locked\":true},{\"is_locked\":false}],\"empty\":[],\"none\":null}";
+
+	json_writer_t *json_writer = NULL;
+	libcerror_error_t *error   = NULL;
+	const uint8_t *data        = NULL;
+	size_t data_size           = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = json_writer_initialize(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "json_writer",
+	 json_writer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = json_writer_object_start(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "name",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_utf8_string_value(
+	          json_writer,
+	          (uint8_t *) "a\"b\\c\n\x01",
+	          7,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "size",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_unsigned_integer_value(
+	          json_writer,
+	          (uint64_t) 0xffffffffffffffffULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "identifier",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_uuid_value(
+	          json_writer,
+	          fvde_test_tools_json_writer_uuid_data,
+	          16,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "volumes",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_array_start(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_object_start(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "is_locked",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_boolean_value(
+	          json_writer,
+	          1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_object_end(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_object_start(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "is_locked",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_boolean_value(
+	          json_writer,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_object_end(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_array_end(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "empty",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_array_start(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_array_end(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_key(
+	          json_writer,
+	          "none",
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_null_value(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = json_writer_object_end(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = json_writer_get_data(
+	          json_writer,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 180 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          180 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test json_writer_reset
+	 */
+	result = json_writer_reset(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = json_writer_get_data(
+	          json_writer,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = json_writer_uuid_value(
+	          json_writer,
+	          fvde_test_tools_json_writer_uuid_data,
+	          8,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = json_writer_key(
+	          json_writer,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = json_writer_free(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the json_writer_append_data function with data that exceeds the initial buffer size
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_json_writer_append_data(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	json_writer_t *json_writer = NULL;
+	libcerror_error_t *error   = NULL;
+	const uint8_t *buffer      = NULL;
+	size_t buffer_size         = 0;
+	int iterator               = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 'x',
+	 1024 );
+
+	result = json_writer_initialize(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "json_writer",
+	 json_writer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( iterator = 0;
+	     iterator < 9;
+	     iterator++ )
+	{
+		result = json_writer_append_data(
+		          json_writer,
+		          data,
+		          1024,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = json_writer_get_data(
+	          json_writer,
+	          &buffer,
+	          &buffer_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "buffer_size",
+	 buffer_size,
+	 (size_t) ( 9 * 1024 ) );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer[ 9215 ]",
+	 buffer[ 9215 ],
+	 (uint8_t) 'x' );
+
+	/* Test error cases
+	 */
+	result = json_writer_append_data(
+	          NULL,
+	          data,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = json_writer_append_data(
+	          json_writer,
+	          NULL,
+	          1024,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = json_writer_free(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the json_writer_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_json_writer_flush(
+     void )
+{
+	json_writer_t *json_writer = NULL;
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = json_writer_initialize(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "json_writer",
+	 json_writer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = json_writer_flush(
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test flush without a stream
+	 */
+	result = json_writer_flush(
+	          json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = json_writer_set_stream(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = json_writer_free(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the json_writer_system_string_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_json_writer_system_string_value(
+     void )
+{
+	json_writer_t *json_writer = NULL;
+	libcerror_error_t *error   = NULL;
+	const uint8_t *data        = NULL;
+	size_t data_size           = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = json_writer_initialize(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "json_writer",
+	 json_writer );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = json_writer_system_string_value(
+	          json_writer,
+	          _SYSTEM_STRING( "image\"1.raw" ),
+	          11,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = json_writer_get_data(
+	          json_writer,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 14 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "\"image\\\"1.raw\"",
+	          14 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = json_writer_system_string_value(
+	          NULL,
+	          _SYSTEM_STRING( "image.raw" ),
+	          9,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = json_writer_system_string_value(
+	          json_writer,
+	          NULL,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = json_writer_free(
+	          &json_writer,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( json_writer != NULL )
+	{
+		json_writer_free(
+		 &json_writer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "json_writer_initialize",
+	 fvde_test_tools_json_writer_initialize )
+
+	FVDE_TEST_RUN(
+	 "json_writer_free",
+	 fvde_test_tools_json_writer_free )
+
+	FVDE_TEST_RUN(
+	 "json_writer_write_object",
+	 fvde_test_tools_json_writer_write_object )
+
+	FVDE_TEST_RUN(
+	 "json_writer_append_data",
+	 fvde_test_tools_json_writer_append_data )
+
+	FVDE_TEST_RUN(
+	 "json_writer_flush",
+	 fvde_test_tools_json_writer_flush )
+
+	FVDE_TEST_RUN(
+	 "json_writer_system_string_value",
+	 fvde_test_tools_json_writer_system_string_value )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,532 @@
+/*
+ * Tools zero block functions test program
+ *
+ * Copyright (C) 2010-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fvde_test_libcerror.h"
+#include "fvde_test_macros.h"
+#include "fvde_test_unused.h"
+
+#include "../fvdetools/zero_block.h"
+
+/* Tests the zero_block_check function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_zero_block_check(
+     void )
+{
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 64 );
+
+	/* Test regular cases
+	 */
+	result = zero_block_check(
+	          data,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data that is not aligned
+	 */
+	result = zero_block_check(
+	          &( data[ 1 ] ),
+	          61,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data smaller than the alignment
+	 */
+	result = zero_block_check(
+	          data,
+	          3,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zero_block_check(
+	          data,
+	          0,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a non-zero byte in the aligned part, the unaligned start and the trailing bytes
+	 */
+	data[ 33 ] = 0xff;
+
+	result = zero_block_check(
+	          data,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zero_block_check(
+	          &( data[ 1 ] ),
+	          61,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zero_block_check(
+	          data,
+	          32,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 33 ] = 0;
+	data[ 1 ]  = 0xff;
+
+	result = zero_block_check(
+	          &( data[ 1 ] ),
+	          61,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 1 ]  = 0;
+	data[ 62 ] = 0xff;
+
+	result = zero_block_check(
+	          &( data[ 1 ] ),
+	          62,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = zero_block_check(
+	          &( data[ 1 ] ),
+	          61,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = zero_block_check(
+	          NULL,
+	          64,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zero_block_check(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the zero_block_get_run_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_tools_zero_block_get_run_size(
+     void )
+{
+	uint8_t data[ ( 3 * ZERO_BLOCK_SIZE ) + 100 ];
+
+	libcerror_error_t *error = NULL;
+	size_t run_size          = 0;
+	uint8_t is_zero          = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 ( 3 * ZERO_BLOCK_SIZE ) + 100 );
+
+	data[ ( 2 * ZERO_BLOCK_SIZE ) + 17 ] = 0xff;
+
+	/* Test regular cases
+	 */
+	/* Test a run of 2 zero blocks followed by a block with data
+	 */
+	result = zero_block_get_run_size(
+	          data,
+	          ( 3 * ZERO_BLOCK_SIZE ) + 100,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) ( 2 * ZERO_BLOCK_SIZE ) );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_zero",
+	 is_zero,
+	 1 );
+
+	/* Test a run of a block with data followed by a smaller zero block
+	 */
+	result = zero_block_get_run_size(
+	          &( data[ 2 * ZERO_BLOCK_SIZE ] ),
+	          ZERO_BLOCK_SIZE + 100,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) ZERO_BLOCK_SIZE );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_zero",
+	 is_zero,
+	 0 );
+
+	/* Test a run of a smaller zero block at the end of the data
+	 */
+	result = zero_block_get_run_size(
+	          &( data[ 3 * ZERO_BLOCK_SIZE ] ),
+	          100,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) 100 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_zero",
+	 is_zero,
+	 1 );
+
+	/* Test a run of blocks with data that spans the end of the data
+	 */
+	data[ ( 3 * ZERO_BLOCK_SIZE ) + 99 ] = 0xff;
+
+	result = zero_block_get_run_size(
+	          &( data[ 2 * ZERO_BLOCK_SIZE ] ),
+	          ZERO_BLOCK_SIZE + 100,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_SIZE(
+	 "run_size",
+	 run_size,
+	 (size_t) ZERO_BLOCK_SIZE + 100 );
+
+	FVDE_TEST_ASSERT_EQUAL_UINT8(
+	 "is_zero",
+	 is_zero,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = zero_block_get_run_size(
+	          NULL,
+	          ZERO_BLOCK_SIZE,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zero_block_get_run_size(
+	          data,
+	          0,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zero_block_get_run_size(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &run_size,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zero_block_get_run_size(
+	          data,
+	          ZERO_BLOCK_SIZE,
+	          NULL,
+	          &is_zero,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = zero_block_get_run_size(
+	          data,
+	          ZERO_BLOCK_SIZE,
+	          &run_size,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FVDE_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FVDE_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FVDE_TEST_UNREFERENCED_PARAMETER( argc )
+	FVDE_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FVDE_TEST_RUN(
+	 "zero_block_check",
+	 fvde_test_tools_zero_block_check );
+
+	FVDE_TEST_RUN(
+	 "zero_block_get_run_size",
+	 fvde_test_tools_zero_block_get_run_size );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
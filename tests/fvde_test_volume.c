@@ -2749,6 +2749,248 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfvde_volume_get_transaction_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_get_transaction_identifier(
+     libfvde_volume_t *volume )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t transaction_identifier = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfvde_volume_get_transaction_identifier(
+	          volume,
+	          &transaction_identifier,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfvde_volume_get_transaction_identifier(
+	          NULL,
+	          &transaction_identifier,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_volume_get_transaction_identifier(
+	          volume,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests freeing a retrieved logical volume before the volume
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_free_logical_volume_before_volume(
+     libbfio_handle_t *file_io_handle,
+     const system_character_t *password )
+{
+	libcerror_error_t *error                 = NULL;
+	libfvde_logical_volume_t *logical_volume = NULL;
+	libfvde_volume_t *volume                 = NULL;
+	libfvde_volume_group_t *volume_group     = NULL;
+	int number_of_logical_volumes            = 0;
+	int result                               = 0;
+
+	result = fvde_test_volume_open_source(
+	          &volume,
+	          file_io_handle,
+	          password,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_get_volume_group(
+	          volume,
+	          &volume_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_group_get_number_of_logical_volumes(
+	          volume_group,
+	          &number_of_logical_volumes,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_logical_volumes > 0 )
+	{
+		result = libfvde_volume_group_get_logical_volume_by_index(
+		          volume_group,
+		          0,
+		          &logical_volume,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NOT_NULL(
+		 "logical_volume",
+		 logical_volume );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The logical volume references the IO handle and file IO pool
+		 * of the volume and must be freed before the volume
+		 */
+		result = libfvde_logical_volume_free(
+		          &logical_volume,
+		          &error );
+
+		FVDE_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "logical_volume",
+		 logical_volume );
+
+		FVDE_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfvde_volume_group_free(
+	          &volume_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fvde_test_volume_close_source(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libfvde_volume_group_free(
+		 &volume_group,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		fvde_test_volume_close_source(
+		 &volume,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -3033,6 +3275,11 @@ int main(
 
 		/* TODO: add tests for libfvde_volume_get_physical_volume_identifier */
 
+		FVDE_TEST_RUN_WITH_ARGS(
+		 "libfvde_volume_get_transaction_identifier",
+		 fvde_test_volume_get_transaction_identifier,
+		 volume );
+
 		/* TODO: add tests for libfvde_volume_set_keys */
 
 		/* TODO: add tests for libfvde_volume_set_utf8_password */
@@ -3071,6 +3318,12 @@ int main(
 		FVDE_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
+
+		FVDE_TEST_RUN_WITH_ARGS(
+		 "libfvde_volume_free_logical_volume_before_volume",
+		 fvde_test_volume_free_logical_volume_before_volume,
+		 file_io_handle,
+		 option_password );
 	}
 	if( file_io_handle != NULL )
 	{
@@ -27,6 +27,7 @@
 #include <stdlib.h>
 #endif
 
+#include "fvde_test_libcdata.h"
 #include "fvde_test_libcerror.h"
 #include "fvde_test_libfvde.h"
 #include "fvde_test_macros.h"
@@ -34,6 +35,9 @@
 #include "fvde_test_unused.h"
 
 #include "../libfvde/libfvde_io_handle.h"
+#include "../libfvde/libfvde_logical_volume.h"
+#include "../libfvde/libfvde_logical_volume_descriptor.h"
+#include "../libfvde/libfvde_volume.h"
 #include "../libfvde/libfvde_volume_group.h"
 #include "../libfvde/libfvde_volume_header.h"
 
@@ -47,6 +51,7 @@ int fvde_test_volume_group_initialize(
 {
 	libcerror_error_t *error               = NULL;
 	libfvde_io_handle_t *io_handle         = NULL;
+	libfvde_volume_t *volume               = NULL;
 	libfvde_volume_group_t *volume_group   = NULL;
 	libfvde_volume_header_t *volume_header = NULL;
 	int result                             = 0;
@@ -59,6 +64,23 @@ int fvde_test_volume_group_initialize(
 
 	/* Initialize test
 	 */
+	result = libfvde_volume_initialize(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfvde_io_handle_initialize(
 	          &io_handle,
 	          &error );
@@ -97,6 +119,7 @@ int fvde_test_volume_group_initialize(
 	 */
 	result = libfvde_volume_group_initialize(
 	          &volume_group,
+	          volume,
 	          io_handle,
 	          NULL,
 	          volume_header,
@@ -139,6 +162,7 @@ int fvde_test_volume_group_initialize(
 	 */
 	result = libfvde_volume_group_initialize(
 	          NULL,
+	          volume,
 	          io_handle,
 	          NULL,
 	          volume_header,
@@ -163,6 +187,7 @@ int fvde_test_volume_group_initialize(
 
 	result = libfvde_volume_group_initialize(
 	          &volume_group,
+	          volume,
 	          io_handle,
 	          NULL,
 	          volume_header,
@@ -188,6 +213,30 @@ int fvde_test_volume_group_initialize(
 	result = libfvde_volume_group_initialize(
 	          &volume_group,
 	          NULL,
+	          io_handle,
+	          NULL,
+	          volume_header,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_volume_group_initialize(
+	          &volume_group,
+	          volume,
+	          NULL,
 	          NULL,
 	          volume_header,
 	          NULL,
@@ -209,6 +258,7 @@ int fvde_test_volume_group_initialize(
 
 	result = libfvde_volume_group_initialize(
 	          &volume_group,
+	          volume,
 	          io_handle,
 	          NULL,
 	          NULL,
@@ -241,6 +291,7 @@ int fvde_test_volume_group_initialize(
 
 		result = libfvde_volume_group_initialize(
 		          &volume_group,
+		          volume,
 		          io_handle,
 		          NULL,
 		          volume_header,
@@ -289,6 +340,7 @@ int fvde_test_volume_group_initialize(
 
 		result = libfvde_volume_group_initialize(
 		          &volume_group,
+		          volume,
 		          io_handle,
 		          NULL,
 		          volume_header,
@@ -365,6 +417,23 @@ int fvde_test_volume_group_initialize(
 	 "error",
 	 error );
 
+	result = libfvde_volume_free(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -391,6 +460,12 @@ on_error:
 		 &io_handle,
 		 NULL );
 	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -436,6 +511,565 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
 
+/* Tests the libfvde_volume_group_get_logical_volume_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fvde_test_volume_group_get_logical_volume_by_index(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfvde_internal_logical_volume_t *internal_logical_volume     = NULL;
+	libfvde_logical_volume_t *logical_volume                       = NULL;
+	libfvde_logical_volume_t *second_logical_volume                = NULL;
+	libfvde_logical_volume_descriptor_t *logical_volume_descriptor = NULL;
+	libfvde_volume_t *volume                                       = NULL;
+	libfvde_volume_group_t *second_volume_group                    = NULL;
+	libfvde_volume_group_t *volume_group                           = NULL;
+	libfvde_volume_header_t *volume_header                         = NULL;
+	off64_t offset                                                 = 0;
+	int entry_index                                                = -1;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfvde_volume_initialize(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_header_initialize(
+	          &volume_header,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_header",
+	 volume_header );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_initialize(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_internal_logical_volume_initialize(
+	          &internal_logical_volume,
+	          ( (libfvde_internal_volume_t *) volume )->io_handle,
+	          NULL,
+	          logical_volume_descriptor,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_logical_volume",
+	 internal_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_logical_volume->is_locked = 0;
+
+	/* Add the logical volume to the volume as if it was opened by a previous retrieval
+	 */
+	result = libcdata_array_append_entry(
+	          ( (libfvde_internal_volume_t *) volume )->logical_volumes_array,
+	          &entry_index,
+	          (intptr_t *) internal_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_group_initialize(
+	          &volume_group,
+	          volume,
+	          ( (libfvde_internal_volume_t *) volume )->io_handle,
+	          NULL,
+	          volume_header,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_group",
+	 volume_group );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_group_initialize(
+	          &second_volume_group,
+	          volume,
+	          ( (libfvde_internal_volume_t *) volume )->io_handle,
+	          NULL,
+	          volume_header,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "second_volume_group",
+	 second_volume_group );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          second_volume_group,
+	          0,
+	          &second_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "second_logical_volume",
+	 second_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the logical volume is kept by the volume and shared by the volume groups
+	 */
+	FVDE_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "logical_volume",
+	 (intptr_t *) logical_volume,
+	 (intptr_t *) second_logical_volume );
+
+	FVDE_TEST_ASSERT_EQUAL_INTPTR(
+	 "internal_logical_volume",
+	 (intptr_t *) ( (libfvde_logical_volume_handle_t *) logical_volume )->internal_logical_volume,
+	 (intptr_t *) internal_logical_volume );
+
+	FVDE_TEST_ASSERT_EQUAL_INTPTR(
+	 "internal_logical_volume",
+	 (intptr_t *) ( (libfvde_logical_volume_handle_t *) second_logical_volume )->internal_logical_volume,
+	 (intptr_t *) internal_logical_volume );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "reference_count",
+	 internal_logical_volume->reference_count,
+	 3 );
+
+	/* Test if the logical volumes have independent offsets
+	 */
+	offset = libfvde_logical_volume_seek_offset(
+	          logical_volume,
+	          1024,
+	          SEEK_SET,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 1024 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_get_offset(
+	          second_logical_volume,
+	          &offset,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 offset,
+	 (int64_t) 0 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_free(
+	          &second_logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "second_logical_volume",
+	 second_logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_free(
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "reference_count",
+	 internal_logical_volume->reference_count,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          NULL,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          volume_group,
+	          -1,
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          volume_group,
+	          0,
+	          NULL,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	logical_volume = (libfvde_logical_volume_t *) 0x12345678UL;
+
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          volume_group,
+	          0,
+	          &logical_volume,
+	          &error );
+
+	logical_volume = NULL;
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with missing encrypted metadata
+	 */
+	result = libfvde_volume_group_get_logical_volume_by_index(
+	          volume_group,
+	          1,
+	          &logical_volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume",
+	 logical_volume );
+
+	FVDE_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvde_volume_group_free(
+	          &second_volume_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "second_volume_group",
+	 second_volume_group );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_group_free(
+	          &volume_group,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_group",
+	 volume_group );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The volume frees the logical volume it keeps
+	 */
+	internal_logical_volume = NULL;
+
+	result = libfvde_volume_free(
+	          &volume,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume",
+	 volume );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_logical_volume_descriptor_free(
+	          &logical_volume_descriptor,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "logical_volume_descriptor",
+	 logical_volume_descriptor );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvde_volume_header_free(
+	          &volume_header,
+	          &error );
+
+	FVDE_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "volume_header",
+	 volume_header );
+
+	FVDE_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &second_logical_volume,
+		 NULL );
+	}
+	if( logical_volume != NULL )
+	{
+		libfvde_logical_volume_free(
+		 &logical_volume,
+		 NULL );
+	}
+	if( second_volume_group != NULL )
+	{
+		libfvde_volume_group_free(
+		 &second_volume_group,
+		 NULL );
+	}
+	if( volume_group != NULL )
+	{
+		libfvde_volume_group_free(
+		 &volume_group,
+		 NULL );
+	}
+	if( ( internal_logical_volume != NULL )
+	 && ( entry_index == -1 ) )
+	{
+		libfvde_internal_logical_volume_free(
+		 &internal_logical_volume,
+		 NULL );
+	}
+	if( volume != NULL )
+	{
+		libfvde_volume_free(
+		 &volume,
+		 NULL );
+	}
+	if( logical_volume_descriptor != NULL )
+	{
+		libfvde_logical_volume_descriptor_free(
+		 &logical_volume_descriptor,
+		 NULL );
+	}
+	if( volume_header != NULL )
+	{
+		libfvde_volume_header_free(
+		 &volume_header,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
 
 /* The main program
@@ -465,6 +1099,14 @@ int main(
 	 "libfvde_volume_group_free",
 	 fvde_test_volume_group_free );
 
+#if defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT )
+
+	FVDE_TEST_RUN(
+	 "libfvde_volume_group_get_logical_volume_by_index",
+	 fvde_test_volume_group_get_logical_volume_by_index );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFVDE_DLL_IMPORT ) */
+
 	return( EXIT_SUCCESS );
 
 on_error:
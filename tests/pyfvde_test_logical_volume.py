@@ -535,6 +535,131 @@ class LogicalVolumeTypeTests(unittest.TestCase):
 
       fvde_volume.close()
 
+  def test_advise(self):
+    """Tests the advise function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fvde_volume = pyfvde.volume()
+      fvde_volume.open_file_object(file_object)
+      fvde_volume.open_physical_volume_files_as_file_objects([file_object])
+
+      fvde_volume_group = fvde_volume.get_volume_group()
+      self.assertIsNotNone(fvde_volume_group)
+
+      if not fvde_volume_group.number_of_logical_volumes:
+        raise unittest.SkipTest("source has no logical volumes")
+
+      fvde_logical_volume = fvde_volume_group.get_logical_volume(0)
+      self.assertIsNotNone(fvde_logical_volume)
+
+      fvde_logical_volume.advise(0, 0, "sequential")
+      fvde_logical_volume.advise(0, 4096, "dontneed")
+      fvde_logical_volume.advise(0, 0, "normal")
+
+      with self.assertRaises(ValueError):
+        fvde_logical_volume.advise(0, 0, "bogus")
+
+      fvde_volume.close()
+
+  def test_access_trace(self):
+    """Tests the start_access_trace, get_access_trace and replay_access_trace functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fvde_volume = pyfvde.volume()
+      fvde_volume.open_file_object(file_object)
+      fvde_volume.open_physical_volume_files_as_file_objects([file_object])
+
+      fvde_volume_group = fvde_volume.get_volume_group()
+      self.assertIsNotNone(fvde_volume_group)
+
+      if not fvde_volume_group.number_of_logical_volumes:
+        raise unittest.SkipTest("source has no logical volumes")
+
+      fvde_logical_volume = fvde_volume_group.get_logical_volume(0)
+      self.assertIsNotNone(fvde_logical_volume)
+
+      access_trace = fvde_logical_volume.get_access_trace()
+      self.assertIsNone(access_trace)
+
+      fvde_logical_volume.start_access_trace()
+
+      access_trace = fvde_logical_volume.get_access_trace()
+      self.assertIsNotNone(access_trace)
+      self.assertEqual(access_trace[:8], b"fvdetrac")
+
+      fvde_logical_volume.replay_access_trace(access_trace)
+
+      with self.assertRaises(IOError):
+        fvde_logical_volume.replay_access_trace(b"bogus")
+
+      fvde_volume.close()
+
+  def test_pin_range(self):
+    """Tests the pin_range and unpin_range functions."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    test_offset = getattr(unittest, "offset", None)
+
+    with DataRangeFileObject(
+        test_source, test_offset or 0, None) as file_object:
+
+      fvde_volume = pyfvde.volume()
+      fvde_volume.open_file_object(file_object)
+      fvde_volume.open_physical_volume_files_as_file_objects([file_object])
+
+      fvde_volume_group = fvde_volume.get_volume_group()
+      self.assertIsNotNone(fvde_volume_group)
+
+      if not fvde_volume_group.number_of_logical_volumes:
+        raise unittest.SkipTest("source has no logical volumes")
+
+      fvde_logical_volume = fvde_volume_group.get_logical_volume(0)
+      self.assertIsNotNone(fvde_logical_volume)
+
+      fvde_logical_volume.set_maximum_pinned_size(1024 * 1024)
+
+      if fvde_logical_volume.is_locked():
+        with self.assertRaises(IOError):
+          fvde_logical_volume.pin_range(0, 4096)
+
+      else:
+        fvde_logical_volume.pin_range(0, 4096)
+
+        data = fvde_logical_volume.read_buffer_at_offset(4096, 0)
+        self.assertIsNotNone(data)
+
+        with self.assertRaises(IOError):
+          fvde_logical_volume.pin_range(0, 2 * 1024 * 1024)
+
+      fvde_logical_volume.unpin_range(0, 4096)
+
+      fvde_volume.close()
+
   def test_get_identifier(self):
     """Tests the get_identifier function and identifier property."""
     test_source = getattr(unittest, "source", None)
@@ -6,8 +6,8 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "bit_stream checksum compression deflate encrypted_metadata encryption_context encryption_context_plist error huffman_tree io_handle keyring logical_volume logical_volume_descriptor metadata metadata_block notify physical_volume physical_volume_descriptor sector_data segment_descriptor volume_data_handle volume_group volume_header"
-$LibraryTestsWithInput = "support volume"
+$LibraryTests = "access_trace bit_stream block_cache block_reference checksum compression deflate encrypted_metadata encryption_context encryption_context_plist error executor huffman_tree io_handle keyring logical_volume_descriptor memory_budget memory_usage metadata metadata_block notify passphrase_wrapped_kek physical_volume physical_volume_descriptor plist_scanner read_ahead read_request sector_data segment_descriptor volume_data_handle volume_group volume_header volume_scanner"
+$LibraryTestsWithInput = "logical_volume support volume"
 $OptionSets = "offset password recovery_password"
 
 $InputGlob = "*"
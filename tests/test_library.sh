@@ -7,8 +7,8 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="bit_stream checksum compression deflate encrypted_metadata encryption_context encryption_context_plist error huffman_tree io_handle keyring logical_volume logical_volume_descriptor metadata metadata_block notify physical_volume physical_volume_descriptor sector_data segment_descriptor volume_data_handle volume_group volume_header";
-LIBRARY_TESTS_WITH_INPUT="support volume";
+LIBRARY_TESTS="access_trace bit_stream block_cache block_reference checksum compression deflate encrypted_metadata encryption_context encryption_context_plist error executor huffman_tree io_handle keyring logical_volume_descriptor memory_budget memory_usage metadata metadata_block notify passphrase_wrapped_kek physical_volume physical_volume_descriptor plist_scanner read_ahead read_request sector_data segment_descriptor volume_data_handle volume_group volume_header volume_scanner";
+LIBRARY_TESTS_WITH_INPUT="logical_volume support volume";
 OPTION_SETS=("offset" "password" "recovery_password");
 
 INPUT_GLOB="*";
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$ToolsTests = "output signal"
+$ToolsTests = "export_handle export_scheduler fvdecheck_lookup fvdecheck_scan hash_pipeline info_handle json_writer output signal zero_block"
 $ToolsTestsWithInput = ""
 
 $InputGlob = "*"
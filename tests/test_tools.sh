@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="output signal";
+TOOLS_TESTS="export_handle export_scheduler fvdecheck_lookup fvdecheck_scan hash_pipeline info_handle json_writer output signal zero_block";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS=("offset" "password" "recovery_password");
 